@@ -0,0 +1,253 @@
+/*==============================================================================
+
+@@@Aj[V̏Ă[anim_bake.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "anim_bake.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    const double kPi = 3.14159265358979323846;
+
+    // keys[i].time <= time < keys[i + 1].time ƂȂ ii͈͊O͒[̋ԁj
+    template<class Key>
+    size_t FindInterval(const std::vector<Key>& keys, double time)
+    {
+        const auto it = std::upper_bound(keys.begin(), keys.end(), time,
+            [](double t, const Key& k) { return t < k.time; });
+        const size_t i = it == keys.begin() ? 0 : (size_t)(it - keys.begin()) - 1;
+        return (std::min)(i, keys.size() - 2);
+    }
+
+    template<class Key>
+    float Factor(const Key& a, const Key& b, double time)
+    {
+        if (b.time <= a.time) return 0.0f;
+        const double f = (time - a.time) / (b.time - a.time);
+        return (float)(std::max)(0.0, (std::min)(f, 1.0));
+    }
+
+    void EvaluateVector(const std::vector<AnimVectorKey>& keys, double time, const float identity[3], float out[3])
+    {
+        if (keys.empty()) {
+            for (int c = 0; c < 3; ++c) out[c] = identity[c];
+            return;
+        }
+        if (keys.size() == 1) {
+            for (int c = 0; c < 3; ++c) out[c] = keys[0].value[c];
+            return;
+        }
+        const size_t i = FindInterval(keys, time);
+        const AnimVectorKey& a = keys[i];
+        const AnimVectorKey& b = keys[i + 1];
+        const float f = Factor(a, b, time);
+        for (int c = 0; c < 3; ++c) out[c] = a.value[c] + (b.value[c] - a.value[c]) * f;
+    }
+
+    // aiQuaternion::Interpolate Ɠ slerp
+    void Slerp(const float a[4], const float b[4], float f, float out[4])
+    {
+        float end[4] = { b[0], b[1], b[2], b[3] };
+        float cosom = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+        if (cosom < 0.0f) {
+            cosom = -cosom;
+            for (float& c : end) c = -c;
+        }
+
+        float sclp, sclq;
+        if ((1.0f - cosom) > 0.0001f) {
+            const float omega = std::acos(cosom);
+            const float sinom = std::sin(omega);
+            sclp = std::sin((1.0f - f) * omega) / sinom;
+            sclq = std::sin(f * omega) / sinom;
+        }
+        else {
+            sclp = 1.0f - f;
+            sclq = f;
+        }
+        for (int c = 0; c < 4; ++c) out[c] = sclp * a[c] + sclq * end[c];
+    }
+
+    void Normalize4(float q[4])
+    {
+        const float len = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+        if (len > 0.0f) {
+            for (int c = 0; c < 4; ++c) q[c] /= len;
+        }
+    }
+
+    double FrameTime(const AnimBakedClip& clip, uint32_t frame)
+    {
+        return (std::min)(frame * clip.ticksPerFrame, clip.duration);
+    }
+}
+
+AnimLocalTRS AnimBake_EvaluateKeys(const AnimTrackKeys& track, double time)
+{
+    static const float kZero[3] = { 0.0f, 0.0f, 0.0f };
+    static const float kOne[3] = { 1.0f, 1.0f, 1.0f };
+
+    AnimLocalTRS trs;
+    EvaluateVector(track.position, time, kZero, trs.t);
+    EvaluateVector(track.scaling, time, kOne, trs.s);
+
+    const std::vector<AnimQuatKey>& keys = track.rotation;
+    if (keys.empty()) {
+        trs.r[0] = trs.r[1] = trs.r[2] = 0.0f;
+        trs.r[3] = 1.0f;
+    }
+    else if (keys.size() == 1) {
+        for (int c = 0; c < 4; ++c) trs.r[c] = keys[0].value[c];
+    }
+    else {
+        const size_t i = FindInterval(keys, time);
+        Slerp(keys[i].value, keys[i + 1].value, Factor(keys[i], keys[i + 1], time), trs.r);
+    }
+    Normalize4(trs.r);
+    return trs;
+}
+
+bool AnimBake_Bake(const std::vector<AnimTrackKeys>& tracks, double duration, double ticksPerSecond,
+    float sampleRate, AnimBakedClip* out)
+{
+    *out = AnimBakedClip{};
+    if (sampleRate <= 0.0f || ticksPerSecond <= 0.0 || duration < 0.0) return false;
+
+    AnimBakedClip& clip = *out;
+    clip.duration = duration;
+    clip.sampleRate = sampleRate;
+    clip.ticksPerFrame = ticksPerSecond / sampleRate;
+    clip.trackCount = (uint32_t)tracks.size();
+    clip.trackStride = (clip.trackCount + 3) & ~3u;
+    // Ō̃R}͂傤 duration ɒuiԊuZȂ邱Ƃj
+    clip.frameCount = (std::max)(2u, (uint32_t)std::ceil(duration / clip.ticksPerFrame - 1e-9) + 1);
+
+    const size_t poseFloats = clip.PoseFloats();
+    clip.data.assign(clip.frameCount * poseFloats, 0.0f);
+
+    for (uint32_t f = 0; f < clip.frameCount; ++f) {
+        float* pose = &clip.data[f * poseFloats];
+        const float* prev = f > 0 ? pose - poseFloats : nullptr;
+        const double time = FrameTime(clip, f);
+
+        for (uint32_t t = 0; t < clip.trackCount; ++t) {
+            AnimLocalTRS trs = AnimBake_EvaluateKeys(tracks[t], time);
+
+            // nlerp ߂悤ɁAÕR}Ɠւ낦
+            if (prev) {
+                const float dot = trs.r[0] * prev[ANIM_RX * clip.trackStride + t] + trs.r[1] * prev[ANIM_RY * clip.trackStride + t]
+                    + trs.r[2] * prev[ANIM_RZ * clip.trackStride + t] + trs.r[3] * prev[ANIM_RW * clip.trackStride + t];
+                if (dot < 0.0f) {
+                    for (float& c : trs.r) c = -c;
+                }
+            }
+
+            const float values[ANIM_STREAM_COUNT] = {
+                trs.t[0], trs.t[1], trs.t[2],
+                trs.r[0], trs.r[1], trs.r[2], trs.r[3],
+                trs.s[0], trs.s[1], trs.s[2],
+            };
+            for (int s = 0; s < ANIM_STREAM_COUNT; ++s) {
+                pose[s * clip.trackStride + t] = values[s];
+            }
+        }
+
+        // lߕ̏͒Pʂ̎pɂĂiK 0 ZȂ悤Ɂj
+        for (uint32_t t = clip.trackCount; t < clip.trackStride; ++t) {
+            pose[ANIM_RW * clip.trackStride + t] = 1.0f;
+            pose[ANIM_SX * clip.trackStride + t] = 1.0f;
+            pose[ANIM_SY * clip.trackStride + t] = 1.0f;
+            pose[ANIM_SZ * clip.trackStride + t] = 1.0f;
+        }
+    }
+    return true;
+}
+
+void AnimBake_Sample(const AnimBakedClip& clip, double time, float* out)
+{
+    const size_t poseFloats = clip.PoseFloats();
+    if (clip.frameCount < 2 || poseFloats == 0) return;
+
+    // R}ԍ͊ZŌ܂iTȂj
+    const double position = time > 0.0 ? time / clip.ticksPerFrame : 0.0;
+    const uint32_t f0 = (uint32_t)(std::min)(position, (double)(clip.frameCount - 2));
+    const double t0 = FrameTime(clip, f0);
+    const double t1 = FrameTime(clip, f0 + 1);
+    const float alpha = t1 > t0 ? (float)(std::max)(0.0, (std::min)((time - t0) / (t1 - t0), 1.0)) : 0.0f;
+
+    const float* a = &clip.data[f0 * poseFloats];
+    const float* b = a + poseFloats;
+    for (size_t i = 0; i < poseFloats; ++i) {
+        out[i] = a[i] + (b[i] - a[i]) * alpha;
+    }
+
+    // nlerpiSgbN܂Ƃ߂ĐKj
+    const uint32_t stride = clip.trackStride;
+    float* rx = out + ANIM_RX * stride;
+    float* ry = out + ANIM_RY * stride;
+    float* rz = out + ANIM_RZ * stride;
+    float* rw = out + ANIM_RW * stride;
+    for (uint32_t t = 0; t < stride; ++t) {
+        const float inv = 1.0f / std::sqrt(rx[t] * rx[t] + ry[t] * ry[t] + rz[t] * rz[t] + rw[t] * rw[t]);
+        rx[t] *= inv;
+        ry[t] *= inv;
+        rz[t] *= inv;
+        rw[t] *= inv;
+    }
+}
+
+AnimBakeReport AnimBake_Measure(const AnimBakedClip& clip, const std::vector<AnimTrackKeys>& tracks, int subdivisions)
+{
+    AnimBakeReport report{};
+    report.frameCount = clip.frameCount;
+    report.bakedBytes = clip.data.size() * sizeof(float);
+    for (const AnimTrackKeys& track : tracks) {
+        report.keyBytes += (track.position.size() + track.scaling.size()) * sizeof(AnimVectorKey);
+        report.keyBytes += track.rotation.size() * sizeof(AnimQuatKey);
+    }
+    if (clip.frameCount < 2 || tracks.size() != clip.trackCount) return report;
+
+    subdivisions = (std::max)(1, subdivisions);
+    std::vector<float> pose(clip.PoseFloats());
+    const uint32_t stride = clip.trackStride;
+
+    for (uint32_t f = 0; f + 1 < clip.frameCount; ++f) {
+        const double t0 = FrameTime(clip, f);
+        const double t1 = FrameTime(clip, f + 1);
+        for (int k = 0; k <= subdivisions; ++k) {
+            const double time = t0 + (t1 - t0) * k / subdivisions;
+            AnimBake_Sample(clip, time, pose.data());
+
+            for (uint32_t t = 0; t < clip.trackCount; ++t) {
+                const AnimLocalTRS ref = AnimBake_EvaluateKeys(tracks[t], time);
+
+                float d2 = 0.0f;
+                for (int c = 0; c < 3; ++c) {
+                    const float d = pose[(ANIM_TX + c) * stride + t] - ref.t[c];
+                    d2 += d * d;
+                    report.maxScaleError = (std::max)(report.maxScaleError, std::fabs(pose[(ANIM_SX + c) * stride + t] - ref.s[c]));
+                }
+                report.maxPositionError = (std::max)(report.maxPositionError, std::sqrt(d2));
+
+                // pxłȂ悤ɁA̒pxoi|a - b| = 2 sin(/4)j
+                float dot = 0.0f;
+                for (int c = 0; c < 4; ++c) dot += pose[(ANIM_RX + c) * stride + t] * ref.r[c];
+                const float sign = dot < 0.0f ? -1.0f : 1.0f;
+                float diff2 = 0.0f;
+                for (int c = 0; c < 4; ++c) {
+                    const float d = pose[(ANIM_RX + c) * stride + t] - sign * ref.r[c];
+                    diff2 += d * d;
+                }
+                const double half = (std::min)(std::sqrt((double)diff2) * 0.5, 1.0);
+                const float angle = (float)(4.0 * std::asin(half) * 180.0 / kPi);
+                report.maxRotationErrorDeg = (std::max)(report.maxRotationErrorDeg, angle);
+            }
+        }
+    }
+    return report;
+}
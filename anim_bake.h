@@ -0,0 +1,100 @@
+/*==============================================================================
+
+@@@Aj[V̏Ă[anim_bake.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    L[iAssimp  aiNodeAnim ƓgjԊui 30HzjŕW{āA
+    m[h̃[J TRS ̕\ɂĂBĐ͑O2R}
+    `ԁi] nlerpj邾ɂȂB
+
+    \̓R}Ƃ [][gbN]  SoAB1R}̒
+      tx[stride] ty[stride] tz[stride] rx[stride] ry[stride] rz[stride] rw[stride] sx[stride] sy[stride] sz[stride]
+    ƕԂ̂ŁASgbN܂Ƃ߂ēvZŕԂłistride  4 ̔{jB
+    ]͏ĂɑÕR}Ɠւ낦ĂB
+
+    AnimBake_Measure Ō̃L[ԂƂ̍Ƒ傫𑪂AW{̊ԊuIԖڈɂB
+    CPU ŊiD3DEAssimp ɈˑȂjB
+
+==============================================================================*/
+#ifndef ANIM_BAKE_H
+#define ANIM_BAKE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct AnimVectorKey
+{
+    double time;
+    float value[3];
+};
+
+struct AnimQuatKey
+{
+    double time;
+    float value[4]; // x, y, z, w
+};
+
+// 1m[h̃L[BǂꂩȂ炻̐͒Pʁiʒu 0E]ȂEgk 1j
+struct AnimTrackKeys
+{
+    std::vector<AnimVectorKey> position;
+    std::vector<AnimQuatKey> rotation;
+    std::vector<AnimVectorKey> scaling;
+};
+
+struct AnimLocalTRS
+{
+    float t[3];
+    float r[4]; // x, y, z, w
+    float s[3];
+};
+
+// \̐̕
+enum AnimStream
+{
+    ANIM_TX, ANIM_TY, ANIM_TZ,
+    ANIM_RX, ANIM_RY, ANIM_RZ, ANIM_RW,
+    ANIM_SX, ANIM_SY, ANIM_SZ,
+    ANIM_STREAM_COUNT
+};
+
+struct AnimBakedClip
+{
+    double duration = 0.0;      // tick
+    double ticksPerFrame = 0.0;
+    float sampleRate = 0.0f;    // Hz
+    uint32_t trackCount = 0;
+    uint32_t trackStride = 0;   // trackCount  4 ̔{ɐ؂グ
+    uint32_t frameCount = 0;
+    std::vector<float> data;    // frameCount * ANIM_STREAM_COUNT * trackStride
+
+    size_t PoseFloats() const { return (size_t)ANIM_STREAM_COUNT * trackStride; }
+};
+
+struct AnimBakeReport
+{
+    uint32_t frameCount;
+    size_t bakedBytes;          // \̑傫
+    size_t keyBytes;            // ̃L[̑傫iAnimVectorKey / AnimQuatKey Ƃāj
+    float maxPositionError;     // ʒu̍ij
+    float maxRotationErrorDeg;  // ]̍ipxj
+    float maxScaleError;        // gk̍iƂ̍őj
+};
+
+// ̃L[ԂiAssimp ƓFʒuEgk͐`A] slerpB͈͊O͒[̃L[j
+AnimLocalTRS AnimBake_EvaluateKeys(const AnimTrackKeys& track, double time);
+
+// duration  ticksPerSecond  aiAnimation ̂́BsampleRate  1 b̃R}
+bool AnimBake_Bake(const std::vector<AnimTrackKeys>& tracks, double duration, double ticksPerSecond,
+    float sampleRate, AnimBakedClip* out);
+
+// timeitickj̎p out ɏBout  clip.PoseFloats() iт͕\1R}Ɠj
+void AnimBake_Sample(const AnimBakedClip& clip, double time, float* out);
+
+// R}̊Ԃ subdivisions ŁA\ƃL[Ԃ̍𑪂
+AnimBakeReport AnimBake_Measure(const AnimBakedClip& clip, const std::vector<AnimTrackKeys>& tracks, int subdivisions = 4);
+
+#endif//ANIM_BAKE_H
@@ -0,0 +1,269 @@
+/*==============================================================================
+
+@@@Aj[V̏Ẵ݂`FbN[anim_bake_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D  Assimp Ȃőg߂B
+        g++ -std=c++17 anim_bake_test.cpp anim_bake.cpp
+    ܂ AnimBake_EvaluateKeys  Assimp ̕ԁiɏʂ́jƓl
+    oƂm߁A AnimBake_Measure ŏĂ\Ƃ̍B
+    L[ anim_compress_test.cpp Ɠianim_test_tracks.hjB
+
+==============================================================================*/
+#include "anim_bake.h"
+#include "anim_test_tracks.h"
+#include "test_check.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace
+{
+    //=====Assimp ̕Ԃʂ́iׂj=====
+    // L[̒T assimp_view  AnimEvaluatorA] aiQuaternion::InterpolateB
+    // Assimp ͌ʂ𐳋KȂAsɂOɐK̂łłKĔׂ
+    template<class Key>
+    size_t AssimpFrame(const std::vector<Key>& keys, double time)
+    {
+        size_t frame = 0;
+        while (frame < keys.size() - 1 && time >= keys[frame + 1].time) ++frame;
+        return frame;
+    }
+
+    void AssimpVector(const std::vector<AnimVectorKey>& keys, double time, float out[3])
+    {
+        const size_t frame = AssimpFrame(keys, time);
+        const size_t next = (std::min)(frame + 1, keys.size() - 1);
+        const AnimVectorKey& a = keys[frame];
+        const AnimVectorKey& b = keys[next];
+        const double diff = b.time - a.time;
+        const float f = diff > 0.0 ? (float)(std::max)(0.0, (std::min)((time - a.time) / diff, 1.0)) : 0.0f;
+        for (int c = 0; c < 3; ++c) out[c] = a.value[c] + (b.value[c] - a.value[c]) * f;
+    }
+
+    void AssimpQuat(const std::vector<AnimQuatKey>& keys, double time, float out[4])
+    {
+        const size_t frame = AssimpFrame(keys, time);
+        const size_t next = (std::min)(frame + 1, keys.size() - 1);
+        const float* p = keys[frame].value;
+        const float* q = keys[next].value;
+        const double diff = keys[next].time - keys[frame].time;
+        const float f = diff > 0.0 ? (float)(std::max)(0.0, (std::min)((time - keys[frame].time) / diff, 1.0)) : 0.0f;
+
+        float cosom = p[0] * q[0] + p[1] * q[1] + p[2] * q[2] + p[3] * q[3];
+        float end[4] = { q[0], q[1], q[2], q[3] };
+        if (cosom < 0.0f) {
+            cosom = -cosom;
+            for (float& c : end) c = -c;
+        }
+        float sclp, sclq;
+        if ((1.0f - cosom) > 0.0001f) {
+            const float omega = std::acos(cosom);
+            const float sinom = std::sin(omega);
+            sclp = std::sin((1.0f - f) * omega) / sinom;
+            sclq = std::sin(f * omega) / sinom;
+        }
+        else {
+            sclp = 1.0f - f;
+            sclq = f;
+        }
+        float len = 0.0f;
+        for (int c = 0; c < 4; ++c) {
+            out[c] = sclp * p[c] + sclq * end[c];
+            len += out[c] * out[c];
+        }
+        len = std::sqrt(len);
+        for (int c = 0; c < 4; ++c) out[c] /= len;
+    }
+
+    // L[Ԃ̒l Assimp ̒l̍iʒuEgk͐ƁA]͕낦Ɓj
+    float DiffFromAssimp(const AnimTrackKeys& track, double time)
+    {
+        const AnimLocalTRS trs = AnimBake_EvaluateKeys(track, time);
+        float t[3], s[3], r[4];
+        AssimpVector(track.position, time, t);
+        AssimpVector(track.scaling, time, s);
+        AssimpQuat(track.rotation, time, r);
+
+        const float dot = trs.r[0] * r[0] + trs.r[1] * r[1] + trs.r[2] * r[2] + trs.r[3] * r[3];
+        const float sign = dot < 0.0f ? -1.0f : 1.0f;
+        float diff = 0.0f;
+        for (int c = 0; c < 3; ++c) {
+            diff = (std::max)(diff, std::fabs(trs.t[c] - t[c]));
+            diff = (std::max)(diff, std::fabs(trs.s[c] - s[c]));
+        }
+        for (int c = 0; c < 4; ++c) diff = (std::max)(diff, std::fabs(trs.r[c] - sign * r[c]));
+        return diff;
+    }
+
+    bool Bake(const std::vector<AnimTrackKeys>& tracks, double duration, float sampleRate, AnimBakedClip* clip)
+    {
+        return AnimBake_Bake(tracks, duration, kAnimTestTicksPerSecond, sampleRate, clip);
+    }
+
+    // \1gbNo
+    AnimLocalTRS PoseTrack(const AnimBakedClip& clip, const std::vector<float>& pose, uint32_t t)
+    {
+        const uint32_t stride = clip.trackStride;
+        AnimLocalTRS trs;
+        for (int c = 0; c < 3; ++c) {
+            trs.t[c] = pose[(ANIM_TX + c) * stride + t];
+            trs.s[c] = pose[(ANIM_SX + c) * stride + t];
+        }
+        for (int c = 0; c < 4; ++c) trs.r[c] = pose[(ANIM_RX + c) * stride + t];
+        return trs;
+    }
+
+    void PrintReport(const char* name, const AnimBakeReport& r)
+    {
+        std::printf("     %s: %u frames, %zu bytes (keys %zu bytes), pos %.3g, rot %.3g deg, scale %.3g\n",
+            name, r.frameCount, r.bakedBytes, r.keyBytes, r.maxPositionError, r.maxRotationErrorDeg, r.maxScaleError);
+    }
+}
+
+int main()
+{
+    const std::vector<AnimTrackKeys> walk = AnimTestTracks_Walk(5, 0.5f);
+
+    // FL[Ԃ Assimp ƓiL[̏AL[̊ԁA͈͊Oj
+    {
+        float maxDiff = 0.0f;
+        for (const AnimTrackKeys& track : walk) {
+            for (int i = -20; i <= 1220; ++i) {
+                maxDiff = (std::max)(maxDiff, DiffFromAssimp(track, i * 0.05 + 0.013 * (i % 7)));
+            }
+        }
+        TestCheck_Expect(maxDiff <= 1e-5f, "EvaluateKeys matches the Assimp interpolation", maxDiff, 1e-5);
+    }
+
+    // L[Ɠ 30HzFR}̏̓L[̂́AԂ nlerp  slerp ̍
+    AnimBakeReport report30{};
+    {
+        AnimBakedClip clip;
+        TestCheck_True(Bake(walk, kAnimTestDuration, 30.0f, &clip), "30Hz: bakes");
+        TestCheck_True(clip.trackCount == 5 && clip.trackStride == 8 && clip.frameCount == 61 &&
+                       clip.data.size() == clip.frameCount * clip.PoseFloats(), "30Hz: layout (stride padded to 4)");
+
+        std::vector<float> pose(clip.PoseFloats());
+        float frameDiff = 0.0f;
+        bool paddingIdentity = true;
+        for (uint32_t f = 0; f < clip.frameCount; ++f) {
+            const double time = f * clip.ticksPerFrame;
+            AnimBake_Sample(clip, time, pose.data());
+            for (uint32_t t = 0; t < clip.trackCount; ++t) {
+                const AnimLocalTRS baked = PoseTrack(clip, pose, t);
+                const AnimLocalTRS ref = AnimBake_EvaluateKeys(walk[t], time);
+                const float dot = baked.r[0] * ref.r[0] + baked.r[1] * ref.r[1] + baked.r[2] * ref.r[2] + baked.r[3] * ref.r[3];
+                for (int c = 0; c < 3; ++c) frameDiff = (std::max)({ frameDiff, std::fabs(baked.t[c] - ref.t[c]), std::fabs(baked.s[c] - ref.s[c]) });
+                frameDiff = (std::max)(frameDiff, 1.0f - std::fabs(dot));
+            }
+            for (uint32_t t = clip.trackCount; t < clip.trackStride; ++t) {
+                const AnimLocalTRS pad = PoseTrack(clip, pose, t);
+                paddingIdentity = paddingIdentity && pad.r[3] == 1.0f && pad.s[0] == 1.0f && pad.t[0] == 0.0f;
+            }
+        }
+        TestCheck_Expect(frameDiff <= 1e-6f, "30Hz: sampling on a frame returns the keys", frameDiff, 1e-6);
+        TestCheck_True(paddingIdentity, "30Hz: padding tracks stay identity");
+
+        report30 = AnimBake_Measure(clip, walk, 8);
+        PrintReport("30Hz", report30);
+        TestCheck_Expect(report30.maxPositionError <= 1e-5f, "30Hz: position error", report30.maxPositionError, 1e-5);
+        TestCheck_Expect(report30.maxRotationErrorDeg <= 0.01f, "30Hz: rotation error (deg)", report30.maxRotationErrorDeg, 0.01);
+        TestCheck_Expect(report30.maxScaleError <= 1e-5f, "30Hz: scale error", report30.maxScaleError, 1e-5);
+    }
+
+    // ԊuςFeƌ덷\͏AׂĂ덷͑Ȃ
+    {
+        AnimBakedClip clip10, clip60;
+        Bake(walk, kAnimTestDuration, 10.0f, &clip10);
+        Bake(walk, kAnimTestDuration, 60.0f, &clip60);
+        const AnimBakeReport report10 = AnimBake_Measure(clip10, walk, 8);
+        const AnimBakeReport report60 = AnimBake_Measure(clip60, walk, 8);
+        PrintReport("10Hz", report10);
+        PrintReport("60Hz", report60);
+        TestCheck_True(report10.maxPositionError > report30.maxPositionError * 10.0f &&
+                       report10.maxRotationErrorDeg > report30.maxRotationErrorDeg &&
+                       report10.bakedBytes < report30.bakedBytes, "10Hz: larger error, smaller table");
+        // L[31R}ɂ܂Ƃ߂̂ŁAԂ̃L[̋Ȃ肪̂܂܌덷ɂȂi2.6 xقǁj
+        TestCheck_Expect(report10.maxRotationErrorDeg <= 3.0f, "10Hz: rotation error (deg)", report10.maxRotationErrorDeg, 3.0);
+        TestCheck_Expect(report60.maxPositionError <= report30.maxPositionError + 1e-6f, "60Hz: position error",
+                         report60.maxPositionError, report30.maxPositionError + 1e-6f);
+        TestCheck_Expect(report60.maxRotationErrorDeg <= report30.maxRotationErrorDeg + 1e-3f, "60Hz: rotation error (deg)",
+                         report60.maxRotationErrorDeg, report30.maxRotationErrorDeg + 1e-3f);
+    }
+
+    // R}̊ԊuŊ؂ȂFŌ̃R} duration 傤ǁA͈͊O͒[
+    {
+        const double duration = 59.5;
+        AnimBakedClip clip;
+        Bake(walk, duration, 30.0f, &clip);
+        TestCheck_True(clip.frameCount == 61, "uneven: last frame lands on the duration");
+
+        std::vector<float> pose(clip.PoseFloats());
+        float endDiff = 0.0f;
+        const double times[] = { duration, duration + 10.0, -5.0 };
+        for (double time : times) {
+            AnimBake_Sample(clip, time, pose.data());
+            const double clamped = (std::max)(0.0, (std::min)(time, duration));
+            for (uint32_t t = 0; t < clip.trackCount; ++t) {
+                const AnimLocalTRS baked = PoseTrack(clip, pose, t);
+                const AnimLocalTRS ref = AnimBake_EvaluateKeys(walk[t], clamped);
+                for (int c = 0; c < 3; ++c) endDiff = (std::max)(endDiff, std::fabs(baked.t[c] - ref.t[c]));
+            }
+        }
+        TestCheck_Expect(endDiff <= 1e-6f, "uneven: ends and out-of-range clamp to the end frames", endDiff, 1e-6);
+        const AnimBakeReport report = AnimBake_Measure(clip, walk, 8);
+        TestCheck_Expect(report.maxPositionError <= 1e-4f, "uneven: position error", report.maxPositionError, 1e-4);
+    }
+
+    // ]̃L[1ɕ]ĂijFĂ\͓ɂ낤
+    {
+        std::vector<AnimTrackKeys> flipped = walk;
+        for (AnimTrackKeys& track : flipped) {
+            for (size_t i = 1; i < track.rotation.size(); i += 2) {
+                for (float& c : track.rotation[i].value) c = -c;
+            }
+        }
+        AnimBakedClip clip;
+        Bake(flipped, kAnimTestDuration, 10.0f, &clip);
+        bool sameHemisphere = true;
+        const size_t poseFloats = clip.PoseFloats();
+        for (uint32_t f = 1; f < clip.frameCount; ++f) {
+            for (uint32_t t = 0; t < clip.trackCount; ++t) {
+                float dot = 0.0f;
+                for (int c = 0; c < 4; ++c) {
+                    dot += clip.data[f * poseFloats + (ANIM_RX + c) * clip.trackStride + t] *
+                           clip.data[(f - 1) * poseFloats + (ANIM_RX + c) * clip.trackStride + t];
+                }
+                sameHemisphere = sameHemisphere && dot >= 0.0f;
+            }
+        }
+        TestCheck_True(sameHemisphere, "flipped keys: neighbouring frames share a hemisphere");
+
+        AnimBakedClip reference;
+        Bake(walk, kAnimTestDuration, 10.0f, &reference);
+        const AnimBakeReport a = AnimBake_Measure(clip, flipped, 8);
+        const AnimBakeReport b = AnimBake_Measure(reference, walk, 8);
+        TestCheck_Expect(std::fabs(a.maxRotationErrorDeg - b.maxRotationErrorDeg) <= 1e-3f,
+                         "flipped keys: same rotation error as unflipped", a.maxRotationErrorDeg, b.maxRotationErrorDeg);
+    }
+
+    // ̐͒PʁAȈ͎s
+    {
+        std::vector<AnimTrackKeys> empty(1);
+        empty[0].position.push_back({ 0.0, { 1.0f, 2.0f, 3.0f } });
+        AnimBakedClip clip;
+        TestCheck_True(Bake(empty, 10.0, 30.0f, &clip), "single key: bakes");
+        std::vector<float> pose(clip.PoseFloats());
+        AnimBake_Sample(clip, 4.2, pose.data());
+        const AnimLocalTRS trs = PoseTrack(clip, pose, 0);
+        TestCheck_True(trs.t[0] == 1.0f && trs.t[2] == 3.0f && trs.r[3] == 1.0f && trs.r[0] == 0.0f && trs.s[1] == 1.0f,
+                       "single key: held position, identity rotation and scale");
+        TestCheck_True(!AnimBake_Bake(walk, 60.0, 30.0, 0.0f, &clip) && !AnimBake_Bake(walk, 60.0, 0.0, 30.0f, &clip) &&
+                       !AnimBake_Bake(walk, -1.0, 30.0, 30.0f, &clip), "bad arguments are rejected");
+    }
+
+    return TestCheck_Result();
+}
@@ -0,0 +1,122 @@
+/*==============================================================================
+
+@@@Aj[V̎p̍[anim_blend.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "anim_blend.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    float NodeWeight(float weight, const float* mask, bool invertMask, uint32_t n)
+    {
+        if (!mask) return weight;
+        return weight * (invertMask ? 1.0f - mask[n] : mask[n]);
+    }
+
+    void Normalize4(float q[4])
+    {
+        const float len = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+        if (len <= 0.0f)
+        {
+            q[0] = q[1] = q[2] = 0.0f;
+            q[3] = 1.0f;
+            return;
+        }
+        const float inv = 1.0f / len;
+        q[0] *= inv; q[1] *= inv; q[2] *= inv; q[3] *= inv;
+    }
+
+    // a  b ̕ t inlerpjBq  -q ͓]Ȃ̂ŋ߂ɍ킹
+    void Nlerp(const float a[4], const float b[4], float t, float out[4])
+    {
+        const float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+        const float tb = dot < 0.0f ? -t : t;
+        const float ta = 1.0f - t;
+        for (int i = 0; i < 4; ++i) out[i] = a[i] * ta + b[i] * tb;
+        Normalize4(out);
+    }
+
+    // n~g a * bix, y, z, wj
+    void Multiply(const float a[4], const float b[4], float out[4])
+    {
+        const float x = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+        const float y = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+        const float z = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+        const float w = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+        out[0] = x; out[1] = y; out[2] = z; out[3] = w;
+    }
+}
+
+AnimLocalTRS AnimBlend_Identity()
+{
+    return { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 1.0f } };
+}
+
+void AnimBlend_Lerp(AnimLocalTRS* inout, const AnimLocalTRS* pose, uint32_t count,
+    float weight, const float* mask, bool invertMask)
+{
+    if (weight <= 0.0f) return;
+
+    for (uint32_t n = 0; n < count; ++n)
+    {
+        const float w = (std::min)(NodeWeight(weight, mask, invertMask, n), 1.0f);
+        if (w <= 0.0f) continue;
+
+        AnimLocalTRS& out = inout[n];
+        const AnimLocalTRS& in = pose[n];
+        if (w >= 1.0f)
+        {
+            out = in;
+            continue;
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+            out.t[i] += (in.t[i] - out.t[i]) * w;
+            out.s[i] += (in.s[i] - out.s[i]) * w;
+        }
+        Nlerp(out.r, in.r, w, out.r);
+    }
+}
+
+void AnimBlend_Additive(AnimLocalTRS* inout, const AnimLocalTRS* pose, const AnimLocalTRS* reference, uint32_t count,
+    float weight, const float* mask, bool invertMask)
+{
+    if (weight <= 0.0f) return;
+
+    const float identity[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    for (uint32_t n = 0; n < count; ++n)
+    {
+        const float w = (std::min)(NodeWeight(weight, mask, invertMask, n), 1.0f);
+        if (w <= 0.0f) continue;
+
+        AnimLocalTRS& out = inout[n];
+        const AnimLocalTRS& in = pose[n];
+        const AnimLocalTRS& ref = reference[n];
+
+        for (int i = 0; i < 3; ++i)
+        {
+            out.t[i] += (in.t[i] - ref.t[i]) * w;
+            // gk͔ői 0 Ȃ獷Ȃj
+            const float ratio = ref.s[i] != 0.0f ? in.s[i] / ref.s[i] : 1.0f;
+            out.s[i] *= 1.0f + (ratio - 1.0f) * w;
+        }
+
+        // inv(reference) * pose  weight āAbase ̌Ɋ|
+        const float refInv[4] = { -ref.r[0], -ref.r[1], -ref.r[2], ref.r[3] };
+        float delta[4];
+        Multiply(refInv, in.r, delta);
+        Normalize4(delta);
+        if (w < 1.0f) Nlerp(identity, delta, w, delta);
+
+        float r[4];
+        Multiply(out.r, delta, r);
+        Normalize4(r);
+        for (int i = 0; i < 4; ++i) out.r[i] = r[i];
+    }
+}
@@ -0,0 +1,37 @@
+/*==============================================================================
+
+@@@Aj[V̎p̍[anim_blend.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    m[hƂ̃[JpiAnimLocalTRS ̕сjǂB
+
+    E㏑iLerpjFʒuEgk͐`A] nlerpi߂̔ɍ킹j
+    EZiAdditivejF̎p̍𑫂B] base * (inv(reference) * pose)
+      Ȃ̂ŁAbase  reference ƓȂ pose ɂȂ
+    Emask ̓m[hƂ̏d݁i0..1jBnullptr ȂS 1BinvertMask Ȃ 1 - mask
+
+    sɂOɍ̂ŁAm[h̐ɔႷԂōςށi̍s͍Ō1jB
+    CPU ŊiD3DEAssimp ɈˑȂjB
+
+==============================================================================*/
+#ifndef ANIM_BLEND_H
+#define ANIM_BLEND_H
+
+#include <cstdint>
+
+#include "anim_bake.h"
+
+// Pʂ̎piʒu 0E]ȂEgk 1j
+AnimLocalTRS AnimBlend_Identity();
+
+// inout  pose ̕ weighti0..1j񂹂
+void AnimBlend_Lerp(AnimLocalTRS* inout, const AnimLocalTRS* pose, uint32_t count,
+    float weight, const float* mask = nullptr, bool invertMask = false);
+
+// inout  pose  reference ̍ weighti0..1j
+void AnimBlend_Additive(AnimLocalTRS* inout, const AnimLocalTRS* pose, const AnimLocalTRS* reference, uint32_t count,
+    float weight, const float* mask = nullptr, bool invertMask = false);
+
+#endif//ANIM_BLEND_H
@@ -0,0 +1,472 @@
+/*==============================================================================
+
+@@@Aj[V̈k[anim_compress.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "anim_compress.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+    const double kPi = 3.14159265358979323846;
+    const float kQuatRange = 0.70710678f;   // smallest-three ̎c3 }1/2 ɓ
+    const float kQuatSteps = 32767.0f;      // 15bit
+    const float kValueSteps = 65535.0f;     // 16bit
+
+    const float kZero[3] = { 0.0f, 0.0f, 0.0f };
+    const float kOne[3] = { 1.0f, 1.0f, 1.0f };
+    const float kIdentityQuat[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+    // 16bit ̖̎ڐŕ\ timeiۂ߂Ȃj
+    float TimeToQ(double time, double ticksPerStep)
+    {
+        if (ticksPerStep <= 0.0) return 0.0f;
+        const double q = time / ticksPerStep;
+        return (float)(std::max)(0.0, (std::min)(q, 65535.0));
+    }
+
+    float Distance3(const float a[3], const float b[3])
+    {
+        const float dx = a[0] - b[0], dy = a[1] - b[1], dz = a[2] - b[2];
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    // pxłȂ悤ɁA̒pxoi|a - b| = 2 sin(/4)j
+    float AngleDeg(const float a[4], const float b[4])
+    {
+        const float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+        const float sign = dot < 0.0f ? -1.0f : 1.0f;
+        float diff2 = 0.0f;
+        for (int c = 0; c < 4; ++c) {
+            const float d = a[c] - sign * b[c];
+            diff2 += d * d;
+        }
+        const double half = (std::min)(std::sqrt((double)diff2) * 0.5, 1.0);
+        return (float)(4.0 * std::asin(half) * 180.0 / kPi);
+    }
+
+    void Nlerp(const float a[4], const float b[4], float f, float out[4])
+    {
+        const float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+        const float fb = dot < 0.0f ? -f : f;
+        float len2 = 0.0f;
+        for (int c = 0; c < 4; ++c) {
+            out[c] = a[c] * (1.0f - f) + b[c] * fb;
+            len2 += out[c] * out[c];
+        }
+        const float inv = 1.0f / std::sqrt(len2);
+        for (int c = 0; c < 4; ++c) out[c] *= inv;
+    }
+
+    void EncodeQuat(const float q[4], uint16_t out[3])
+    {
+        int largest = 0;
+        for (int c = 1; c < 4; ++c) {
+            if (std::fabs(q[c]) > std::fabs(q[largest])) largest = c;
+        }
+        // q  -q ͓]Ȃ̂ŁÂĂ鐬ɂȂɂ낦
+        const float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+
+        uint64_t bits = (uint64_t)largest << 45;
+        int shift = 0;
+        for (int c = 0; c < 4; ++c) {
+            if (c == largest) continue;
+            const float v = (std::max)(-1.0f, (std::min)(q[c] * sign / kQuatRange, 1.0f));
+            bits |= (uint64_t)std::lround((v * 0.5f + 0.5f) * kQuatSteps) << shift;
+            shift += 15;
+        }
+        out[0] = (uint16_t)bits;
+        out[1] = (uint16_t)(bits >> 16);
+        out[2] = (uint16_t)(bits >> 32);
+    }
+
+    void DecodeQuat(const uint16_t in[3], float q[4])
+    {
+        const uint64_t bits = in[0] | (uint64_t)in[1] << 16 | (uint64_t)in[2] << 32;
+        const int largest = (int)(bits >> 45) & 3;
+
+        float sum = 0.0f;
+        int shift = 0;
+        for (int c = 0; c < 4; ++c) {
+            if (c == largest) continue;
+            const float v = (((bits >> shift) & 0x7fff) / kQuatSteps * 2.0f - 1.0f) * kQuatRange;
+            q[c] = v;
+            sum += v * v;
+            shift += 15;
+        }
+        q[largest] = std::sqrt((std::max)(0.0f, 1.0f - sum));
+    }
+
+    void DecodeVector(const uint16_t in[3], const float* range, float out[3])
+    {
+        for (int c = 0; c < 3; ++c) out[c] = range[c] + in[c] * (range[3 + c] / kValueSteps);
+    }
+
+    // times[i] <= q < times[i + 1] ƂȂ ii͈͊O͒[̋ԁjBÖʒu班iނōςނƂ
+    uint32_t FindKey(const uint16_t* times, uint32_t count, float q, uint32_t& cursor)
+    {
+        const uint32_t last = count - 2; // Ԃ̍Ōicount >= 2 ŌĂԁj
+        uint32_t i = (std::min)(cursor, last);
+
+        if (q >= times[i]) {
+            for (int step = 0; step < 4 && i < last && q >= times[i + 1]; ++step) ++i;
+            if (i < last && q >= times[i + 1]) {
+                i = (uint32_t)(std::upper_bound(times + i + 1, times + count, q) - times) - 1;
+            }
+        }
+        else {
+            const uint16_t* found = std::upper_bound(times, times + i, q);
+            i = found == times ? 0 : (uint32_t)(found - times) - 1;
+        }
+
+        i = (std::min)(i, last);
+        cursor = i;
+        return i;
+    }
+
+    float Factor(float q, uint16_t t0, uint16_t t1)
+    {
+        if (t1 <= t0) return 0.0f;
+        return (std::max)(0.0f, (std::min)((q - t0) / (float)(t1 - t0), 1.0f));
+    }
+
+    // Ԃ̃L[̂ĂĂciŏƍŌ͕KcjBfits(a, e)  a  e ̊Ԃ₦邩
+    template<class Fits>
+    std::vector<uint32_t> ReduceKeys(uint32_t count, Fits fits)
+    {
+        std::vector<uint32_t> kept{ 0 };
+        uint32_t anchor = 0;
+        for (uint32_t end = 2; end < count; ++end) {
+            if (!fits(anchor, end)) {
+                anchor = end - 1;
+                kept.push_back(anchor);
+            }
+        }
+        kept.push_back(count - 1);
+        return kept;
+    }
+
+    void EncodeVector(const std::vector<AnimVectorKey>& keys, const float identity[3], float tolerance,
+        double ticksPerStep, AnimCompressedClip& clip, AnimCompressedChannel& channel)
+    {
+        channel = AnimCompressedChannel{};
+        if (keys.empty()) return;
+
+        bool constant = true;
+        for (const AnimVectorKey& key : keys) {
+            if (Distance3(key.value, keys[0].value) > tolerance) {
+                constant = false;
+                break;
+            }
+        }
+        if (constant) {
+            if (Distance3(keys[0].value, identity) <= tolerance) return;
+            channel.keyCount = 1;
+            channel.floatOffset = (uint32_t)clip.floats.size();
+            clip.floats.insert(clip.floats.end(), keys[0].value, keys[0].value + 3);
+            return;
+        }
+
+        float range[6] = { keys[0].value[0], keys[0].value[1], keys[0].value[2], 0.0f, 0.0f, 0.0f };
+        float maxValue[3] = { range[0], range[1], range[2] };
+        for (const AnimVectorKey& key : keys) {
+            for (int c = 0; c < 3; ++c) {
+                range[c] = (std::min)(range[c], key.value[c]);
+                maxValue[c] = (std::max)(maxValue[c], key.value[c]);
+            }
+        }
+        for (int c = 0; c < 3; ++c) range[3 + c] = maxValue[c] - range[c];
+
+        // ۂ߂̌덷͍őŖڐ̔Bꂾŋe̔𒴂i}500 ʒuȂǁj
+        // Ԉ]nȂÃL[̈ʒułeɎ܂Ȃ̂ float ̂܂܎
+        float roundError2 = 0.0f;
+        for (int c = 0; c < 3; ++c) {
+            const float half = range[3 + c] / kValueSteps * 0.5f;
+            roundError2 += half * half;
+        }
+        const bool floatKeys = std::sqrt(roundError2) > tolerance * 0.5f;
+
+        // ߂lŔ肷iĐƓvZj
+        const uint32_t count = (uint32_t)keys.size();
+        std::vector<uint16_t> times(count), values(count * 3);
+        std::vector<float> decoded(count * 3);
+        for (uint32_t k = 0; k < count; ++k) {
+            times[k] = (uint16_t)std::lround(TimeToQ(keys[k].time, ticksPerStep));
+            if (floatKeys) {
+                std::copy(keys[k].value, keys[k].value + 3, &decoded[k * 3]);
+                continue;
+            }
+            for (int c = 0; c < 3; ++c) {
+                const float n = range[3 + c] > 0.0f ? (keys[k].value[c] - range[c]) / range[3 + c] : 0.0f;
+                values[k * 3 + c] = (uint16_t)std::lround((std::max)(0.0f, (std::min)(n, 1.0f)) * kValueSteps);
+            }
+            DecodeVector(&values[k * 3], range, &decoded[k * 3]);
+        }
+
+        // m̍͐܂ځĩL[̎jňԑ傫Ȃ̂ŁA΂悢
+        const std::vector<uint32_t> kept = ReduceKeys(count, [&](uint32_t a, uint32_t e) {
+            for (uint32_t k = a + 1; k < e; ++k) {
+                const float f = Factor(TimeToQ(keys[k].time, ticksPerStep), times[a], times[e]);
+                float v[3];
+                for (int c = 0; c < 3; ++c) v[c] = decoded[a * 3 + c] + (decoded[e * 3 + c] - decoded[a * 3 + c]) * f;
+                if (Distance3(v, keys[k].value) > tolerance) return false;
+            }
+            return true;
+        });
+
+        channel.keyCount = (uint32_t)kept.size();
+        channel.keyOffset = (uint32_t)clip.times.size();
+        channel.floatOffset = (uint32_t)clip.floats.size();
+        if (floatKeys) {
+            channel.valueOffset = ANIM_FLOAT_KEYS;
+            for (uint32_t k : kept) {
+                clip.times.push_back(times[k]);
+                clip.floats.insert(clip.floats.end(), keys[k].value, keys[k].value + 3);
+            }
+            return;
+        }
+        channel.valueOffset = (uint32_t)clip.values.size();
+        clip.floats.insert(clip.floats.end(), range, range + 6);
+        for (uint32_t k : kept) {
+            clip.times.push_back(times[k]);
+            clip.values.insert(clip.values.end(), &values[k * 3], &values[k * 3] + 3);
+        }
+    }
+
+    void EncodeRotation(const AnimTrackKeys& track, float tolerance, double ticksPerStep,
+        AnimCompressedClip& clip, AnimCompressedChannel& channel)
+    {
+        channel = AnimCompressedChannel{};
+        const std::vector<AnimQuatKey>& keys = track.rotation;
+        if (keys.empty()) return;
+
+        // KĂׂĩL[ԂKlԂj
+        const uint32_t count = (uint32_t)keys.size();
+        std::vector<float> source(count * 4);
+        for (uint32_t k = 0; k < count; ++k) {
+            const float* q = keys[k].value;
+            const float len = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            for (int c = 0; c < 4; ++c) source[k * 4 + c] = len > 0.0f ? q[c] / len : kIdentityQuat[c];
+        }
+
+        bool constant = true;
+        for (uint32_t k = 1; k < count && constant; ++k) {
+            constant = AngleDeg(&source[k * 4], &source[0]) <= tolerance;
+        }
+        if (constant) {
+            if (AngleDeg(&source[0], kIdentityQuat) <= tolerance) return;
+            channel.keyCount = 1;
+            channel.floatOffset = (uint32_t)clip.floats.size();
+            clip.floats.insert(clip.floats.end(), &source[0], &source[0] + 4);
+            return;
+        }
+
+        std::vector<uint16_t> times(count), values(count * 3);
+        std::vector<float> decoded(count * 4);
+        for (uint32_t k = 0; k < count; ++k) {
+            times[k] = (uint16_t)std::lround(TimeToQ(keys[k].time, ticksPerStep));
+            EncodeQuat(&source[k * 4], &values[k * 3]);
+            DecodeQuat(&values[k * 3], &decoded[k * 4]);
+        }
+
+        // slerp  nlerp ͋Ԃ̒قǂł̂ŁÃL[̊Ԃ̐^񒆂
+        std::vector<float> middle((count - 1) * 4);
+        std::vector<double> middleTime(count - 1);
+        for (uint32_t k = 0; k + 1 < count; ++k) {
+            middleTime[k] = (keys[k].time + keys[k + 1].time) * 0.5;
+            const AnimLocalTRS trs = AnimBake_EvaluateKeys(track, middleTime[k]);
+            std::copy(trs.r, trs.r + 4, &middle[k * 4]);
+        }
+
+        const std::vector<uint32_t> kept = ReduceKeys(count, [&](uint32_t a, uint32_t e) {
+            float q[4];
+            for (uint32_t k = a; k < e; ++k) {
+                if (k > a) {
+                    Nlerp(&decoded[a * 4], &decoded[e * 4], Factor(TimeToQ(keys[k].time, ticksPerStep), times[a], times[e]), q);
+                    if (AngleDeg(q, &source[k * 4]) > tolerance) return false;
+                }
+                Nlerp(&decoded[a * 4], &decoded[e * 4], Factor(TimeToQ(middleTime[k], ticksPerStep), times[a], times[e]), q);
+                if (AngleDeg(q, &middle[k * 4]) > tolerance) return false;
+            }
+            return true;
+        });
+
+        channel.keyCount = (uint32_t)kept.size();
+        channel.keyOffset = (uint32_t)clip.times.size();
+        channel.valueOffset = (uint32_t)clip.values.size();
+        for (uint32_t k : kept) {
+            clip.times.push_back(times[k]);
+            clip.values.insert(clip.values.end(), &values[k * 3], &values[k * 3] + 3);
+        }
+    }
+
+    void SampleVector(const AnimCompressedClip& clip, const AnimCompressedChannel& channel, float q,
+        uint32_t& cursor, const float identity[3], float out[3])
+    {
+        if (channel.keyCount == 0) {
+            for (int c = 0; c < 3; ++c) out[c] = identity[c];
+            return;
+        }
+        const float* floats = &clip.floats[channel.floatOffset];
+        if (channel.keyCount == 1) {
+            for (int c = 0; c < 3; ++c) out[c] = floats[c];
+            return;
+        }
+
+        const uint16_t* times = &clip.times[channel.keyOffset];
+        const uint32_t i = FindKey(times, channel.keyCount, q, cursor);
+        const float f = Factor(q, times[i], times[i + 1]);
+        float decoded[6];
+        const float* a = decoded;
+        const float* b = decoded + 3;
+        if (channel.valueOffset == ANIM_FLOAT_KEYS) {
+            a = floats + i * 3;
+            b = floats + (i + 1) * 3;
+        }
+        else {
+            DecodeVector(&clip.values[channel.valueOffset + i * 3], floats, decoded);
+            DecodeVector(&clip.values[channel.valueOffset + (i + 1) * 3], floats, decoded + 3);
+        }
+        for (int c = 0; c < 3; ++c) out[c] = a[c] + (b[c] - a[c]) * f;
+    }
+
+    void SampleRotation(const AnimCompressedClip& clip, const AnimCompressedChannel& channel, float q,
+        uint32_t& cursor, float out[4])
+    {
+        if (channel.keyCount == 0) {
+            for (int c = 0; c < 4; ++c) out[c] = kIdentityQuat[c];
+            return;
+        }
+        if (channel.keyCount == 1) {
+            for (int c = 0; c < 4; ++c) out[c] = clip.floats[channel.floatOffset + c];
+            return;
+        }
+
+        const uint16_t* times = &clip.times[channel.keyOffset];
+        const uint32_t i = FindKey(times, channel.keyCount, q, cursor);
+        float a[4], b[4];
+        DecodeQuat(&clip.values[channel.valueOffset + i * 3], a);
+        DecodeQuat(&clip.values[channel.valueOffset + (i + 1) * 3], b);
+        Nlerp(a, b, Factor(q, times[i], times[i + 1]), out);
+    }
+}
+
+bool AnimCompress_Compress(const std::vector<AnimTrackKeys>& tracks, double duration,
+    const AnimCompressSettings& settings, AnimCompressedClip* out)
+{
+    *out = AnimCompressedClip{};
+    if (duration < 0.0) return false;
+
+    AnimCompressedClip& clip = *out;
+    clip.duration = duration;
+    clip.trackCount = (uint32_t)tracks.size();
+
+    // ̖ڐBL[S tick  65535 Ɏ܂Ȃ 1 tickiȂjA
+    // łȂ΍Ō̃L[iduration Ȃ炻j܂ł 65535 
+    double lastTime = duration;
+    bool wholeTicks = true;
+    auto checkKeys = [&](const auto& keys) {
+        for (const auto& key : keys) {
+            lastTime = (std::max)(lastTime, key.time);
+            wholeTicks = wholeTicks && key.time == std::floor(key.time);
+        }
+    };
+    for (const AnimTrackKeys& track : tracks) {
+        checkKeys(track.position);
+        checkKeys(track.rotation);
+        checkKeys(track.scaling);
+    }
+    clip.ticksPerStep = (wholeTicks && lastTime <= 65535.0) ? 1.0 : lastTime / 65535.0;
+    clip.channels.resize(clip.trackCount * ANIM_CHANNEL_COUNT);
+
+    for (uint32_t t = 0; t < clip.trackCount; ++t) {
+        AnimCompressedChannel* channels = &clip.channels[t * ANIM_CHANNEL_COUNT];
+        EncodeVector(tracks[t].position, kZero, settings.positionTolerance, clip.ticksPerStep, clip, channels[ANIM_CHANNEL_POSITION]);
+        EncodeRotation(tracks[t], settings.rotationToleranceDeg, clip.ticksPerStep, clip, channels[ANIM_CHANNEL_ROTATION]);
+        EncodeVector(tracks[t].scaling, kOne, settings.scaleTolerance, clip.ticksPerStep, clip, channels[ANIM_CHANNEL_SCALING]);
+    }
+
+    clip.times.shrink_to_fit();
+    clip.values.shrink_to_fit();
+    clip.floats.shrink_to_fit();
+    return true;
+}
+
+void AnimCompress_Sample(const AnimCompressedClip& clip, double time, AnimCompressCursor* cursors, AnimLocalTRS* out)
+{
+    const float q = TimeToQ(time, clip.ticksPerStep);
+    for (uint32_t t = 0; t < clip.trackCount; ++t) {
+        const AnimCompressedChannel* channels = &clip.channels[t * ANIM_CHANNEL_COUNT];
+        AnimCompressCursor scratch;
+        AnimCompressCursor& cursor = cursors ? cursors[t] : scratch;
+
+        SampleVector(clip, channels[ANIM_CHANNEL_POSITION], q, cursor.key[ANIM_CHANNEL_POSITION], kZero, out[t].t);
+        SampleRotation(clip, channels[ANIM_CHANNEL_ROTATION], q, cursor.key[ANIM_CHANNEL_ROTATION], out[t].r);
+        SampleVector(clip, channels[ANIM_CHANNEL_SCALING], q, cursor.key[ANIM_CHANNEL_SCALING], kOne, out[t].s);
+    }
+}
+
+AnimCompressReport AnimCompress_Measure(const AnimCompressedClip& clip, const std::vector<AnimTrackKeys>& tracks, double step)
+{
+    AnimCompressReport report{};
+    report.compressedBytes = clip.Bytes();
+    for (const AnimTrackKeys& track : tracks) {
+        report.keyBytes += (track.position.size() + track.scaling.size()) * sizeof(AnimVectorKey);
+        report.keyBytes += track.rotation.size() * sizeof(AnimQuatKey);
+        report.sourceKeys += (uint32_t)(track.position.size() + track.rotation.size() + track.scaling.size());
+    }
+    for (const AnimCompressedChannel& channel : clip.channels) {
+        if (channel.keyCount == 0) ++report.identityChannels;
+        else if (channel.keyCount == 1) ++report.constantChannels;
+        else ++report.animatedChannels;
+        if (channel.keyCount >= 2 && channel.valueOffset == ANIM_FLOAT_KEYS) ++report.floatKeyChannels;
+        report.keptKeys += channel.keyCount;
+    }
+    if (tracks.size() != clip.trackCount || clip.trackCount == 0) return report;
+
+    std::vector<double> times;
+    if (step > 0.0) {
+        for (double time = 0.0; time < clip.duration; time += step) times.push_back(time);
+    }
+    times.push_back(clip.duration);
+
+    using Clock = std::chrono::steady_clock;
+    std::vector<AnimLocalTRS> pose(clip.trackCount);
+    std::vector<AnimLocalTRS> reference(clip.trackCount);
+    std::vector<AnimCompressCursor> cursors(clip.trackCount);
+
+    // Ԃ͒ʂĐiO֐iނjőBsink ͌vZȂȂ悤ɖ񏑂߂
+    const Clock::time_point decodeStart = Clock::now();
+    volatile float sink = 0.0f;
+    for (double time : times) {
+        AnimCompress_Sample(clip, time, cursors.data(), pose.data());
+        sink = sink + pose[0].r[3];
+    }
+    const Clock::time_point keyStart = Clock::now();
+    for (double time : times) {
+        for (uint32_t t = 0; t < clip.trackCount; ++t) reference[t] = AnimBake_EvaluateKeys(tracks[t], time);
+        sink = sink + reference[0].r[3];
+    }
+    const Clock::time_point keyEnd = Clock::now();
+    report.decodeMicroseconds = std::chrono::duration<double, std::micro>(keyStart - decodeStart).count() / times.size();
+    report.keyMicroseconds = std::chrono::duration<double, std::micro>(keyEnd - keyStart).count() / times.size();
+
+    cursors.assign(clip.trackCount, AnimCompressCursor{});
+    for (double time : times) {
+        AnimCompress_Sample(clip, time, cursors.data(), pose.data());
+        for (uint32_t t = 0; t < clip.trackCount; ++t) {
+            const AnimLocalTRS ref = AnimBake_EvaluateKeys(tracks[t], time);
+            report.maxPositionError = (std::max)(report.maxPositionError, Distance3(pose[t].t, ref.t));
+            report.maxRotationErrorDeg = (std::max)(report.maxRotationErrorDeg, AngleDeg(pose[t].r, ref.r));
+            for (int c = 0; c < 3; ++c) {
+                report.maxScaleError = (std::max)(report.maxScaleError, std::fabs(pose[t].s[c] - ref.s[c]));
+            }
+        }
+    }
+    return report;
+}
@@ -0,0 +1,106 @@
+/*==============================================================================
+
+@@@Aj[V̈k[anim_compress.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    L[ianim_bake.h  AnimTrackKeysjāAĐɂ̏Ŗ߂B
+
+    E] smallest-threeiԑ傫̂ĂĎc3 15bit Av 48bitj
+    EʒuƊgk̓`lƂ͈̔́iŏEjɑ΂ 16bit
+      i͈͂L 16bit ̖ڐ肾ŋe̔𒴂`l float ̂܂܎j
+    E 16bitBL[ tickiR}ԍjȂ炻̂܂܁AłȂΒ 65535 
+    EقƂǓȂ`l1̒lɁAPʂƕςȂ͉̂Ȃ
+    EԂ̃L[𒼐i] nlerpjŕ₦Ȃ̂ĂBe AnimCompressSettings
+
+    e͍̔ĐƓ߂EԂōŝŁÃL[ԂƂ̍
+    قڋeɎ܂iAnimCompress_Measure Ŋm߂jB
+    CPU ŊiD3DEAssimp ɈˑȂjB
+
+==============================================================================*/
+#ifndef ANIM_COMPRESS_H
+#define ANIM_COMPRESS_H
+
+#include "anim_bake.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct AnimCompressSettings
+{
+    float positionTolerance = 0.001f;   // if̃[JPʁj
+    float rotationToleranceDeg = 0.02f; // px
+    float scaleTolerance = 0.0001f;
+};
+
+// `l̕сigbNƂ ʒuE]Egkj
+enum AnimChannelKind
+{
+    ANIM_CHANNEL_POSITION,
+    ANIM_CHANNEL_ROTATION,
+    ANIM_CHANNEL_SCALING,
+    ANIM_CHANNEL_COUNT
+};
+
+// AnimCompressedChannel::valueOffset ȂAL[̒l floats  float ̂܂ܓĂ
+constexpr uint32_t ANIM_FLOAT_KEYS = 0xffffffffu;
+
+struct AnimCompressedChannel
+{
+    uint32_t keyCount;      // 0:P  1:ifloats ɒlj  2ȏ:L[
+    uint32_t keyOffset;     // times ̐擪
+    uint32_t valueOffset;   // values ̐擪i1L[3jBANIM_FLOAT_KEYS Ȃ floats g
+    uint32_t floatOffset;   // Ȃli3  4jAʒuEgk̃L[Ȃ͈́iŏ3E3j float ̃L[i1L[3j
+};
+
+struct AnimCompressedClip
+{
+    double duration = 0.0;                      // tick
+    double ticksPerStep = 0.0;                  // times  1 ڐ肪 tick 
+    uint32_t trackCount = 0;
+    std::vector<AnimCompressedChannel> channels;// trackCount * ANIM_CHANNEL_COUNT
+    std::vector<uint16_t> times;                // tick / ticksPerStep
+    std::vector<uint16_t> values;               // 1L[ 3iʒuEgk xyzA] 48bitj
+    std::vector<float> floats;
+
+    size_t Bytes() const
+    {
+        return channels.size() * sizeof(AnimCompressedChannel)
+            + (times.size() + values.size()) * sizeof(uint16_t) + floats.size() * sizeof(float);
+    }
+};
+
+// ĐʒůoigbNƁjBÕL[֏Tōςނ悤ɂ
+struct AnimCompressCursor
+{
+    uint32_t key[ANIM_CHANNEL_COUNT] = {};
+};
+
+struct AnimCompressReport
+{
+    size_t compressedBytes;
+    size_t keyBytes;            // ̃L[̑傫iAnimVectorKey / AnimQuatKey Ƃāj
+    uint32_t identityChannels;  // Ȃ`l
+    uint32_t constantChannels;  // l1̃`l
+    uint32_t animatedChannels;
+    uint32_t floatKeyChannels;  // animatedChannels ̂ 16bit Ɏ܂炸 float ̂܂܎
+    uint32_t sourceKeys;
+    uint32_t keptKeys;
+    float maxPositionError;
+    float maxRotationErrorDeg;
+    float maxScaleError;
+    double decodeMicroseconds;  // 1piSgbNj߂
+    double keyMicroseconds;     // p̃L[Ԃ鎞
+};
+
+bool AnimCompress_Compress(const std::vector<AnimTrackKeys>& tracks, double duration,
+    const AnimCompressSettings& settings, AnimCompressedClip* out);
+
+// timeitickj̎p out[trackCount] ɏBcursors  trackCount  nullptr
+void AnimCompress_Sample(const AnimCompressedClip& clip, double time, AnimCompressCursor* cursors, AnimLocalTRS* out);
+
+// 0..duration  stepitickjƂɖ߂āÃL[ԂƂ̍Ɩ߂Ԃ𑪂
+AnimCompressReport AnimCompress_Measure(const AnimCompressedClip& clip, const std::vector<AnimTrackKeys>& tracks, double step);
+
+#endif//ANIM_COMPRESS_H
@@ -0,0 +1,52 @@
+/*==============================================================================
+
+@@@Aj[Vǩ덷`FbN[anim_compress_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D Ȃőg߂B
+        g++ -std=c++17 anim_compress_test.cpp anim_compress.cpp anim_bake.cpp
+    ߂pƌ̃L[ԂƂ̍eɎ܂邩Bs 1 ԂB
+
+==============================================================================*/
+#include "anim_compress.h"
+#include "anim_test_tracks.h"
+#include "test_check.h"
+#include <cstdio>
+
+namespace
+{
+    void CheckClip(const char* name, float amplitude, bool expectFloatKeys)
+    {
+        const std::vector<AnimTrackKeys> tracks = AnimTestTracks_Walk(8, amplitude);
+        const AnimCompressSettings settings;
+        AnimCompressedClip clip;
+        if (!AnimCompress_Compress(tracks, kAnimTestDuration, settings, &clip)) {
+            TestCheck_True(false, name);
+            return;
+        }
+        const AnimCompressReport report = AnimCompress_Measure(clip, tracks, 0.05);
+
+        char label[128];
+        std::snprintf(label, sizeof(label), "%s position", name);
+        TestCheck_Expect(report.maxPositionError <= settings.positionTolerance * 1.01f, label, report.maxPositionError, settings.positionTolerance);
+        std::snprintf(label, sizeof(label), "%s rotation(deg)", name);
+        TestCheck_Expect(report.maxRotationErrorDeg <= settings.rotationToleranceDeg * 1.01f, label, report.maxRotationErrorDeg, settings.rotationToleranceDeg);
+        std::snprintf(label, sizeof(label), "%s scale", name);
+        TestCheck_Expect(report.maxScaleError <= settings.scaleTolerance * 1.01f, label, report.maxScaleError, settings.scaleTolerance);
+        std::snprintf(label, sizeof(label), "%s float key channels", name);
+        TestCheck_Expect((report.floatKeyChannels > 0) == expectFloatKeys, label, report.floatKeyChannels, expectFloatKeys ? 8 : 0);
+        std::printf("     %zu bytes (keys %zu bytes), kept %u/%u\n", report.compressedBytes, report.keyBytes, report.keptKeys, report.sourceKeys);
+    }
+}
+
+int main()
+{
+    // }0.5 Ȃ 16bit ͈̔͂ő
+    CheckClip("small extent", 0.5f, false);
+    // }500  16bit ̖ڐ肪 0.015 ɂȂ苖e 0.001 𒴂̂ float ̂܂܎͂
+    CheckClip("large extent", 500.0f, true);
+
+    return TestCheck_Result();
+}
@@ -0,0 +1,43 @@
+/*==============================================================================
+
+@@@Aj[V̒P̃`FbNp̃L[[anim_test_tracks.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    anim_bake_test.cpp  anim_compress_test.cpp œL[g߂̂́B
+    Q[ɂ͓ȂB
+
+==============================================================================*/
+#ifndef ANIM_TEST_TRACKS_H
+#define ANIM_TEST_TRACKS_H
+
+#include "anim_bake.h"
+#include <cmath>
+#include <vector>
+
+// ɋ߂L[i30 tick/bAtick 0 ` 60 2bjBʒu͐Uꕝ amplitude œ
+const double kAnimTestTicksPerSecond = 30.0;
+const double kAnimTestDuration = 60.0;
+
+inline std::vector<AnimTrackKeys> AnimTestTracks_Walk(int trackCount, float amplitude)
+{
+    const double kPi = 3.14159265358979323846;
+    std::vector<AnimTrackKeys> tracks(trackCount);
+    for (int t = 0; t < trackCount; ++t) {
+        for (int i = 0; i <= 60; ++i) {
+            const double s = i / 30.0;
+            const float wave = (float)std::sin(2.0 * kPi * (s + t * 0.01));
+            const float a = (float)(kPi / 3.0) * wave;
+            AnimVectorKey p{ (double)i, { amplitude * wave, 0.3f * (float)std::sin(4.0 * kPi * s), 0.1f * t } };
+            AnimQuatKey r{ (double)i, { std::sin(a / 2) * 0.6f, std::sin(a / 2) * 0.8f, 0.0f, std::cos(a / 2) } };
+            AnimVectorKey k{ (double)i, { 1.0f + 0.05f * wave, 1.0f, 1.0f } };
+            tracks[t].position.push_back(p);
+            tracks[t].rotation.push_back(r);
+            tracks[t].scaling.push_back(k);
+        }
+    }
+    return tracks;
+}
+
+#endif // ANIM_TEST_TRACKS_H
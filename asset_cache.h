@@ -0,0 +1,130 @@
+/*==============================================================================
+
+@@@ǂݍ񂾃AZbg̋L[asset_cache.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    L[ipXƓǂݍݐݒj̃AZbg1AQƐŋLB
+
+    QƂ 0 ɂȂĂAɂ͏ɁugpvƂĎcĂB
+    Xe[W؂ւł́AÕXe[W Finalize ŎQƂ 0 ɂȂĂ
+    ̃Xe[W Initialize œ̂蒼΁AǂݍݒɂȂȂB
+    {ɏ̂ Purge Ă񂾂Ƃi蒼Ȃ̂jB
+
+    g̍E͌Ăяoi GPU ɂ Assimp ɂˑȂjB
+
+==============================================================================*/
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+
+// pXƓǂݍݐݒ肩L[
+inline std::string AssetCache_MakeKey(const char* path, float scale, bool isBrender)
+{
+    char buf[48];
+    snprintf(buf, sizeof(buf), "|%a|%d", scale, isBrender ? 1 : 0); // %a Ȃۂ߂ɋʂł
+    return std::string(path ? path : "") + buf;
+}
+
+template<class T>
+class AssetCache
+{
+public:
+    AssetCache() = default;
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+
+    // ΎQƂ𑝂₵ĕԂBȂ nullptr
+    T* Acquire(const std::string& key)
+    {
+        const auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            ++m_misses;
+            return nullptr;
+        }
+
+        ++m_hits;
+        ++it->second.refs;
+        return it->second.asset;
+    }
+
+    // ǂݍ񂾂̂o^iQƐ 1jBL[ falseiĂяoŎ̂Ăj
+    bool Insert(const std::string& key, T* asset, uint64_t bytes)
+    {
+        if (!asset || m_entries.count(key)) return false;
+
+        m_entries.emplace(key, Entry{ asset, 1, bytes });
+        m_keys.emplace(asset, key);
+        m_bytes += bytes;
+        return true;
+    }
+
+    // QƂ1ԂBo^ĂȂ̂Ȃ falseiĂяoł̂܂܏j
+    bool Release(T* asset)
+    {
+        const auto k = m_keys.find(asset);
+        if (k == m_keys.end()) return false;
+
+        Entry& e = m_entries.at(k->second);
+        if (e.refs > 0) --e.refs;
+        return true;
+    }
+
+    // QƂ 0 ̂̂ destroy(T*) ŏB߂l͏
+    template<class Destroy>
+    int Purge(Destroy destroy)
+    {
+        int count = 0;
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if (it->second.refs > 0) {
+                ++it;
+                continue;
+            }
+
+            m_bytes -= it->second.bytes;
+            m_keys.erase(it->second.asset);
+            destroy(it->second.asset);
+            it = m_entries.erase(it);
+            ++count;
+        }
+        return count;
+    }
+
+    int RefCount(const T* asset) const
+    {
+        const auto k = m_keys.find(const_cast<T*>(asset));
+        return k == m_keys.end() ? 0 : m_entries.at(k->second).refs;
+    }
+
+    int Count() const { return (int)m_entries.size(); }
+    int UnusedCount() const
+    {
+        int count = 0;
+        for (const auto& kv : m_entries) count += kv.second.refs == 0 ? 1 : 0;
+        return count;
+    }
+    uint64_t Bytes() const { return m_bytes; }
+    uint64_t Hits() const { return m_hits; }     // ǂݍݍς݂̂̂Ԃ
+    uint64_t Misses() const { return m_misses; } // ǂݍ݂Kv
+
+private:
+    struct Entry
+    {
+        T* asset;
+        int refs;
+        uint64_t bytes;
+    };
+
+    std::unordered_map<std::string, Entry> m_entries;
+    std::unordered_map<T*, std::string> m_keys; // Release ̓|C^ŗ̂ŋt
+    uint64_t m_bytes = 0;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+};
+
+#endif//ASSET_CACHE_H
@@ -0,0 +1,199 @@
+/*==============================================================================
+
+@@@AgX̋lߍ[atlas_pack.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "atlas_pack.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <numeric>
+
+namespace
+{
+    int AlignUp(int v, int a)
+    {
+        return (a > 1) ? ((v + a - 1) / a) * a : v;
+    }
+}
+
+SkylinePacker::SkylinePacker(int width, int height, int padding, int align)
+{
+    Reset(width, height, padding, align);
+}
+
+void SkylinePacker::Clear()
+{
+    Reset(m_width, m_height, m_padding, m_align);
+}
+
+void SkylinePacker::Reset(int width, int height, int padding, int align)
+{
+    m_align = (align > 1) ? align : 1;
+    m_padding = (padding > 0) ? padding : 0;
+    // y[W align ̔{ɂĂi[͎gȂj
+    m_width = (width > 0) ? (width / m_align) * m_align : 0;
+    m_height = (height > 0) ? (height / m_align) * m_align : 0;
+    m_usedArea = 0;
+
+    m_skyline.clear();
+    if (m_width > 0) m_skyline.push_back({ 0, 0, m_width });
+}
+
+float SkylinePacker::Occupancy() const
+{
+    const double area = (double)m_width * (double)m_height;
+    return (area > 0.0) ? (float)((double)m_usedArea / area) : 0.0f;
+}
+
+int SkylinePacker::Fit(int index, int w, int h) const
+{
+    const Node& start = m_skyline[index];
+    if (start.x + w > m_width) return -1;
+
+    int y = start.y;
+    int remaining = w;
+    for (int i = index; remaining > 0; ++i)
+    {
+        if (i >= (int)m_skyline.size()) return -1;
+        y = std::max(y, m_skyline[i].y);
+        if (y + h > m_height) return -1;
+        remaining -= m_skyline[i].w;
+    }
+    return y;
+}
+
+bool SkylinePacker::Insert(int w, int h, AtlasPackRect* out)
+{
+    if (w <= 0 || h <= 0) return false;
+
+    const int pw = AlignUp(w + m_padding * 2, m_align);
+    const int ph = AlignUp(h + m_padding * 2, m_align);
+
+    // [ԒႭȂꏊBȂ畝̋iiԂcɂj
+    int best = -1;
+    int bestTop = INT_MAX;
+    int bestWidth = INT_MAX;
+    int bestY = 0;
+    for (int i = 0; i < (int)m_skyline.size(); ++i)
+    {
+        const int y = Fit(i, pw, ph);
+        if (y < 0) continue;
+
+        const int top = y + ph;
+        if (top < bestTop || (top == bestTop && m_skyline[i].w < bestWidth))
+        {
+            best = i;
+            bestTop = top;
+            bestWidth = m_skyline[i].w;
+            bestY = y;
+        }
+    }
+    if (best < 0) return false;
+
+    const int x = m_skyline[best].x;
+
+    // ViāAꂽi
+    m_skyline.insert(m_skyline.begin() + best, Node{ x, bestY + ph, pw });
+    for (int i = best + 1; i < (int)m_skyline.size(); )
+    {
+        Node& n = m_skyline[i];
+        const int prevRight = m_skyline[i - 1].x + m_skyline[i - 1].w;
+        if (n.x >= prevRight) break;
+
+        const int shrink = prevRight - n.x;
+        if (n.w <= shrink)
+        {
+            m_skyline.erase(m_skyline.begin() + i);
+            continue;
+        }
+        n.x += shrink;
+        n.w -= shrink;
+        break;
+    }
+
+    // ׂ̗ǂ͂܂Ƃ߂
+    for (int i = 0; i + 1 < (int)m_skyline.size(); )
+    {
+        if (m_skyline[i].y == m_skyline[i + 1].y)
+        {
+            m_skyline[i].w += m_skyline[i + 1].w;
+            m_skyline.erase(m_skyline.begin() + i + 1);
+            continue;
+        }
+        ++i;
+    }
+
+    m_usedArea += (uint64_t)w * (uint64_t)h;
+    if (out) *out = { x + m_padding, bestY + m_padding, w, h };
+    return true;
+}
+
+void AtlasPack_Place(std::vector<SkylinePacker>* pages, const SkylinePacker& pageTemplate,
+    const AtlasPackImage* images, int count, std::vector<AtlasPackPlacement>* out)
+{
+    if (!out) return;
+    out->assign(count > 0 ? count : 0, AtlasPackPlacement{});
+    if (!pages || !images || count <= 0) return;
+
+    // iȂ畝̍Ljɋl߂ƒi̓ʉ
+    std::vector<int> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b)
+        {
+            if (images[a].height != images[b].height) return images[a].height > images[b].height;
+            return images[a].width > images[b].width;
+        });
+
+    for (int i : order)
+    {
+        const AtlasPackImage& img = images[i];
+        AtlasPackPlacement& dst = (*out)[i];
+
+        for (int p = 0; p < (int)pages->size(); ++p)
+        {
+            if ((*pages)[p].Insert(img.width, img.height, &dst.rect))
+            {
+                dst.page = p;
+                break;
+            }
+        }
+        if (dst.page >= 0) continue;
+
+        // ̃y[WɂȂ傫Ȃy[W͑₳Ȃ
+        SkylinePacker page = pageTemplate;
+        page.Clear();
+        if (!page.Insert(img.width, img.height, &dst.rect)) continue;
+
+        pages->push_back(page);
+        dst.page = (int)pages->size() - 1;
+    }
+}
+
+void AtlasPack_BlitPadded(const void* src, int w, int h, int srcPitch,
+    void* dst, int dstPitch, int pad)
+{
+    if (!src || !dst || w <= 0 || h <= 0) return;
+    if (pad < 0) pad = 0;
+
+    const uint8_t* s = static_cast<const uint8_t*>(src);
+    uint8_t* d = static_cast<uint8_t*>(dst);
+    const int outW = w + pad * 2;
+    const int outH = h + pad * 2;
+
+    for (int y = 0; y < outH; ++y)
+    {
+        const int sy = std::min(std::max(y - pad, 0), h - 1);
+        const uint32_t* srow = reinterpret_cast<const uint32_t*>(s + (size_t)sy * srcPitch);
+        uint32_t* drow = reinterpret_cast<uint32_t*>(d + (size_t)y * dstPitch);
+
+        const uint32_t left = srow[0];
+        const uint32_t right = srow[w - 1];
+        for (int x = 0; x < pad; ++x) drow[x] = left;
+        std::memcpy(drow + pad, srow, (size_t)w * 4);
+        for (int x = pad + w; x < outW; ++x) drow[x] = right;
+    }
+}
@@ -0,0 +1,87 @@
+/*==============================================================================
+
+@@@AgX̋lߍ[atlas_pack.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    摜傫ȃy[WɃXJCC@il߁jŕׂB
+    D3D ɈˑȂ̂ŁA傫̕тŋlߋ⎞Ԃ𑪂B
+
+    padding : 摜̎ɑ]i̐FL΂Ė߂jB
+    align   : ]݂̋`𑵂PʁB2^k ɑĂƁA~bv k iڂ܂
+              ׂ̉摜ƍȂipadding  2^k ȏɂjB
+
+==============================================================================*/
+#ifndef ATLAS_PACK_H
+#define ATLAS_PACK_H
+
+#include <cstdint>
+#include <vector>
+
+struct AtlasPackRect
+{
+    int x, y; // 摜̍i]͊܂܂Ȃj
+    int w, h;
+};
+
+class SkylinePacker
+{
+public:
+    SkylinePacker(int width = 2048, int height = 2048, int padding = 0, int align = 1);
+
+    void Reset(int width, int height, int padding, int align);
+    void Clear(); // ݒ͂̂܂܂ŋɂ
+
+    // Ȃ falseig͕ςȂj
+    bool Insert(int w, int h, AtlasPackRect* out);
+
+    int Width() const { return m_width; }
+    int Height() const { return m_height; }
+    int Padding() const { return m_padding; }
+    uint64_t UsedArea() const { return m_usedArea; } // ]܂܂Ȃ摜̖ʐ
+    float Occupancy() const;                         // UsedArea / y[Wʐ
+
+private:
+    struct Node
+    {
+        int x;
+        int y;
+        int w;
+    };
+
+    int Fit(int index, int w, int h) const; // u yBuȂ -1
+
+    std::vector<Node> m_skyline;
+    int m_width = 0;
+    int m_height = 0;
+    int m_padding = 0;
+    int m_align = 1;
+    uint64_t m_usedArea = 0;
+};
+
+struct AtlasPackImage
+{
+    int id;
+    int width;
+    int height;
+};
+
+struct AtlasPackPlacement
+{
+    int page = -1;      // Ȃ -1iy[W傫j
+    AtlasPackRect rect{};
+};
+
+// images ̑傫ɁÃy[W  ȂΐVy[W̏ŋl߂B
+// pages ͌Ăяo܂Ŏg񂹂iォǉ镪󂫂ɓjB
+// out  images ƓсBVy[Wɂ͍ŏ̃y[WƓݒg
+void AtlasPack_Place(std::vector<SkylinePacker>* pages, const SkylinePacker& pageTemplate,
+    const AtlasPackImage* images, int count, std::vector<AtlasPackPlacement>* out);
+
+// srciw~h, 1f 4oCgjA pad fL΂
+// (w+2pad)~(h+2pad) ɂ dst ɏBpitch ̓oCgP
+void AtlasPack_BlitPadded(const void* src, int w, int h, int srcPitch,
+    void* dst, int dstPitch, int pad);
+
+#endif // ATLAS_PACK_H
@@ -0,0 +1,184 @@
+/*==============================================================================
+
+@@@AgX̋lߍ݂̃`FbN[atlas_pack_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D Ȃőg߂B
+        g++ -std=c++17 -O2 atlas_pack_test.cpp atlas_pack.cpp
+    傫̂΂΂ȉ摜 2048 l̃y[Wɋl߂āA͂ݏoEdȂE]
+    ̒Pʂm߁Ay[WƋlߋAԂoB
+
+==============================================================================*/
+#include "atlas_pack.h"
+#include "test_check.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr int kPageSize = 2048;
+
+    std::vector<AtlasPackImage> RandomImages(int count, int minSide, int maxSide, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> side(minSide, maxSide);
+        std::vector<AtlasPackImage> images(count);
+        for (int i = 0; i < count; ++i) images[i] = { i, side(rng), side(rng) };
+        return images;
+    }
+
+    int AlignUp(int v, int a)
+    {
+        return (a > 1) ? ((v + a - 1) / a) * a : v;
+    }
+
+    // ]݁E݂Ŏۂɏꏊ`
+    struct Box
+    {
+        int x0, y0, x1, y1;
+    };
+
+    Box Footprint(const AtlasPackRect& r, int padding, int align)
+    {
+        const int x0 = r.x - padding;
+        const int y0 = r.y - padding;
+        return { x0, y0, x0 + AlignUp(r.w + padding * 2, align), y0 + AlignUp(r.h + padding * 2, align) };
+    }
+
+    // y[W̒ŏdȂĂgȂix ŕׂċ߂̂j
+    bool AnyOverlap(std::vector<Box> boxes)
+    {
+        std::sort(boxes.begin(), boxes.end(), [](const Box& a, const Box& b) { return a.x0 < b.x0; });
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            for (size_t j = i + 1; j < boxes.size() && boxes[j].x0 < boxes[i].x1; ++j) {
+                if (boxes[i].y0 < boxes[j].y1 && boxes[j].y0 < boxes[i].y1) return true;
+            }
+        }
+        return false;
+    }
+
+    // l߂ʂm߂BŌÕy[W̋lߋ minFill ȏ
+    void CheckPlacement(const char* name, int count, int minSide, int maxSide, int padding, int align, float minFill)
+    {
+        const std::vector<AtlasPackImage> images = RandomImages(count, minSide, maxSide, 2024);
+        std::vector<SkylinePacker> pages;
+        std::vector<AtlasPackPlacement> placed;
+
+        const auto start = std::chrono::steady_clock::now();
+        AtlasPack_Place(&pages, SkylinePacker(kPageSize, kPageSize, padding, align), images.data(), count, &placed);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        bool allPlaced = (int)placed.size() == count;
+        bool sizeKept = true, inBounds = true, aligned = true;
+        std::vector<std::vector<Box>> perPage(pages.size());
+        uint64_t imageArea = 0;
+        for (int i = 0; i < count && allPlaced; ++i) {
+            const AtlasPackPlacement& pl = placed[i];
+            if (pl.page < 0 || pl.page >= (int)pages.size()) {
+                allPlaced = false;
+                break;
+            }
+            sizeKept &= pl.rect.w == images[i].width && pl.rect.h == images[i].height;
+            const Box box = Footprint(pl.rect, padding, align);
+            inBounds &= box.x0 >= 0 && box.y0 >= 0 && box.x1 <= kPageSize && box.y1 <= kPageSize;
+            aligned &= box.x0 % align == 0 && box.y0 % align == 0;
+            perPage[pl.page].push_back(box);
+            imageArea += (uint64_t)images[i].width * images[i].height;
+        }
+
+        // Ō̃y[W͋l߂ŏÎŁAlߋ͂Õy[WŌ
+        bool overlap = false;
+        uint64_t usedArea = 0, fullPagesArea = 0;
+        for (size_t p = 0; p < pages.size(); ++p) {
+            overlap |= AnyOverlap(perPage[p]);
+            usedArea += pages[p].UsedArea();
+            if (p + 1 < pages.size()) fullPagesArea += pages[p].UsedArea();
+        }
+        const double pageArea = (double)kPageSize * kPageSize;
+        const double fill = pages.empty() ? 0.0 : (double)usedArea / (pages.size() * pageArea);
+        const double fullFill = (pages.size() < 2) ? fill : (double)fullPagesArea / ((pages.size() - 1) * pageArea);
+
+        std::printf("     %s : %d images, %zu pages, fill %.1f%% (%.1f%% before the last page), %.2f ms\n",
+            name, count, pages.size(), fill * 100.0, fullFill * 100.0, ms);
+        const std::string tag = name;
+        TestCheck_True(allPlaced, (tag + " every image placed").c_str());
+        TestCheck_True(sizeKept, (tag + " sizes kept").c_str());
+        TestCheck_True(inBounds, (tag + " inside the page, gutter included").c_str());
+        TestCheck_True(aligned, (tag + " gutter boxes aligned").c_str());
+        TestCheck_True(!overlap, (tag + " no overlap, gutter included").c_str());
+        TestCheck_True(usedArea == imageArea, (tag + " used area matches images").c_str());
+        TestCheck_True(fullFill >= minFill, (tag + " fill before the last page at least " + std::to_string((int)(minFill * 100.0f)) + "%").c_str());
+    }
+
+    // Ăяo܂łO̕ƏdȂȂBy[W傫͓̂ꂸɃy[W₳Ȃ
+    void CheckIncremental()
+    {
+        const SkylinePacker pageTemplate(kPageSize, kPageSize, 8, 8);
+        std::vector<SkylinePacker> pages;
+        std::vector<AtlasPackPlacement> first, second, big;
+        const std::vector<AtlasPackImage> a = RandomImages(300, 8, 256, 7);
+        const std::vector<AtlasPackImage> b = RandomImages(300, 8, 256, 8);
+        AtlasPack_Place(&pages, pageTemplate, a.data(), (int)a.size(), &first);
+        const size_t pagesAfterFirst = pages.size();
+        AtlasPack_Place(&pages, pageTemplate, b.data(), (int)b.size(), &second);
+
+        std::vector<std::vector<Box>> perPage(pages.size());
+        for (const AtlasPackPlacement& pl : first) perPage[pl.page].push_back(Footprint(pl.rect, 8, 8));
+        bool reusedOldPage = false;
+        for (const AtlasPackPlacement& pl : second) {
+            perPage[pl.page].push_back(Footprint(pl.rect, 8, 8));
+            reusedOldPage |= pl.page < (int)pagesAfterFirst;
+        }
+        bool overlap = false;
+        for (const std::vector<Box>& boxes : perPage) overlap |= AnyOverlap(boxes);
+        TestCheck_True(!overlap, "second batch does not overlap the first");
+        TestCheck_True(reusedOldPage, "second batch fills free space on earlier pages");
+
+        const size_t pagesBefore = pages.size();
+        const AtlasPackImage tooBig[] = { { 0, kPageSize, 16 } }; // ]𑫂Ƃ͂ݏo
+        AtlasPack_Place(&pages, pageTemplate, tooBig, 1, &big);
+        TestCheck_True(big.size() == 1 && big[0].page < 0 && pages.size() == pagesBefore, "oversize image is rejected without a new page");
+
+        // Clear ŋɖ߂A܂ォ
+        SkylinePacker& page = pages[0];
+        page.Clear();
+        AtlasPackRect r{};
+        TestCheck_True(page.UsedArea() == 0 && page.Occupancy() == 0.0f, "Clear empties the page");
+        TestCheck_True(page.Insert(32, 32, &r) && r.x == 8 && r.y == 8, "Clear restarts at the top-left");
+    }
+
+    // ]͉̐FL΂
+    void CheckBlit()
+    {
+        const int w = 3, h = 2, pad = 2;
+        const uint32_t src[h][w] = { { 1, 2, 3 }, { 4, 5, 6 } };
+        std::vector<uint32_t> dst((w + pad * 2) * (h + pad * 2), 0);
+        AtlasPack_BlitPadded(src, w, h, w * 4, dst.data(), (w + pad * 2) * 4, pad);
+
+        bool ok = true;
+        for (int y = 0; y < h + pad * 2; ++y) {
+            for (int x = 0; x < w + pad * 2; ++x) {
+                const int sx = std::min(std::max(x - pad, 0), w - 1);
+                const int sy = std::min(std::max(y - pad, 0), h - 1);
+                ok &= dst[y * (w + pad * 2) + x] == src[sy][sx];
+            }
+        }
+        TestCheck_True(ok, "gutter replicates the edge pixels");
+    }
+}
+
+int main()
+{
+    CheckPlacement("8-256px no gutter", 2000, 8, 256, 0, 1, 0.90f);
+    CheckPlacement("8-256px 8px gutter", 2000, 8, 256, 8, 8, 0.70f);
+    CheckPlacement("8-64px 8px gutter", 2000, 8, 64, 8, 8, 0.40f);
+    CheckIncremental();
+    CheckBlit();
+    return TestCheck_Result();
+}
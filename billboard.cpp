@@ -12,8 +12,11 @@
 #include "direct3d.h"
 #include "texture.h"
 #include "shader_billboard.h"
+#include "dynamic_ring.h"
 
 #include <d3d11.h>
+#include <algorithm>
+#include <vector>
 
 using namespace DirectX;
 
@@ -40,6 +43,24 @@ namespace
     // View matrix with translation cleared (set by Billboard_SetViewMatrix)
     XMFLOAT4X4 g_mtxView{};
 
+    // ---- Batch ----
+    // Quads are expanded on the CPU into world space, so one VB/IB pair serves every texture.
+    constexpr UINT kBatchMaxQuads = 4096; // 4 verts each -> fits 16-bit indices
+
+    struct BatchQuad
+    {
+        int         texId;
+        XMFLOAT3    position;
+        XMFLOAT2    scale;
+        UVParameter uv;
+        XMFLOAT4    color;
+        XMFLOAT2    pivot;
+    };
+
+    ID3D11Buffer* g_pBatchIndexBuffer = nullptr;  // immutable, kBatchMaxQuads * 6 indices (verts come from the dynamic ring)
+    std::vector<BatchQuad> g_batchQuads;
+    bool g_batchOpen = false;
+
     struct RenderStateGuard
     {
         ID3D11DeviceContext* ctx = nullptr;
@@ -127,6 +148,32 @@ void Billboard_Initialize()
         Direct3D_GetDevice()->CreateBuffer(&bd, &sd, &g_pIndexBuffer);
     }
 
+    // Batch index buffer (same 0-1-2 / 0-2-3 pattern repeated per quad)
+    {
+        std::vector<uint16_t> indices(kIndexCount * kBatchMaxQuads);
+        for (UINT q = 0; q < kBatchMaxQuads; ++q)
+        {
+            for (UINT i = 0; i < kIndexCount; ++i)
+            {
+                indices[q * kIndexCount + i] = static_cast<uint16_t>(q * kVertexCount + kIndices[i]);
+            }
+        }
+
+        D3D11_BUFFER_DESC bd{};
+        bd.Usage = D3D11_USAGE_IMMUTABLE;
+        bd.ByteWidth = static_cast<UINT>(sizeof(uint16_t) * indices.size());
+        bd.BindFlags = D3D11_BIND_INDEX_BUFFER;
+
+        D3D11_SUBRESOURCE_DATA sd{};
+        sd.pSysMem = indices.data();
+
+        Direct3D_GetDevice()->CreateBuffer(&bd, &sd, &g_pBatchIndexBuffer);
+    }
+
+    g_batchQuads.clear();
+    g_batchQuads.reserve(512);
+    g_batchOpen = false;
+
     // --- Render states (billboard-safe defaults) ---
     {
         // Alpha blend
@@ -167,8 +214,44 @@ void Billboard_Finalize()
     SAFE_RELEASE(g_pCullNone);
     SAFE_RELEASE(g_pDepthReadOnly);
     SAFE_RELEASE(g_pBlendAlpha);
+    SAFE_RELEASE(g_pBatchIndexBuffer);
     SAFE_RELEASE(g_pIndexBuffer);
     SAFE_RELEASE(g_pVertexBuffer);
+
+    g_batchQuads.clear();
+    g_batchOpen = false;
+}
+
+// tex_cut (x, y, w, h in pixels) -> UV scale/translation. false if the texture is not usable.
+static bool Billboard_MakeCutUV(int texId, const XMUINT4& tex_cut, UVParameter& outUV)
+{
+    const unsigned int texW = Texture_Width(texId);
+    const unsigned int texH = Texture_Height(texId);
+    if (texId < 0 || texW == 0 || texH == 0)
+    {
+        // Skip invalid / not-loaded textures (avoid division by zero in UV calc)
+        return false;
+    }
+    const float invW = 1.0f / (float)texW;
+    const float invH = 1.0f / (float)texH;
+
+    // Clamp cut rect into texture bounds and keep at least 1x1.
+    const unsigned int cutX = (tex_cut.x < texW) ? tex_cut.x : (texW - 1);
+    const unsigned int cutY = (tex_cut.y < texH) ? tex_cut.y : (texH - 1);
+
+    const unsigned int maxW = texW - cutX;
+    const unsigned int maxH = texH - cutY;
+    const unsigned int cutW = (tex_cut.z == 0) ? 1u : ((tex_cut.z < maxW) ? tex_cut.z : maxW);
+    const unsigned int cutH = (tex_cut.w == 0) ? 1u : ((tex_cut.w < maxH) ? tex_cut.w : maxH);
+
+    // Half-texel inset to reduce tile bleeding when sampling sprite sheets.
+    const float uvMinX = ((float)cutX + 0.5f) * invW;
+    const float uvMinY = ((float)cutY + 0.5f) * invH;
+    const float uvMaxX = ((float)cutX + (float)cutW - 0.5f) * invW;
+    const float uvMaxY = ((float)cutY + (float)cutH - 0.5f) * invH;
+
+    outUV = { { uvMaxX - uvMinX, uvMaxY - uvMinY }, { uvMinX, uvMinY } };
+    return true;
 }
 
 static void Billboard_DrawInternal(
@@ -241,41 +324,16 @@ void Billboard_Draw(
     const XMFLOAT4& color,
     const XMFLOAT2& pivot)
 {
-    const unsigned int texW = Texture_Width(texId);
-    const unsigned int texH = Texture_Height(texId);
-    if (texId < 0 || texW == 0 || texH == 0)
+    UVParameter uv{};
+    if (!Billboard_MakeCutUV(texId, tex_cut, uv))
     {
-        // Skip invalid / not-loaded textures (avoid division by zero in UV calc)
         return;
     }
-    // tex_cut: (x, y, w, h) in pixels
-    const float invW = 1.0f / (float)texW;
-    const float invH = 1.0f / (float)texH;
-
-    // Clamp cut rect into texture bounds and keep at least 1x1.
-    const unsigned int cutX = (tex_cut.x < texW) ? tex_cut.x : (texW - 1);
-    const unsigned int cutY = (tex_cut.y < texH) ? tex_cut.y : (texH - 1);
-
-    const unsigned int maxW = texW - cutX;
-    const unsigned int maxH = texH - cutY;
-    const unsigned int cutW = (tex_cut.z == 0) ? 1u : ((tex_cut.z < maxW) ? tex_cut.z : maxW);
-    const unsigned int cutH = (tex_cut.w == 0) ? 1u : ((tex_cut.w < maxH) ? tex_cut.w : maxH);
-
-    // Half-texel inset to reduce tile bleeding when sampling sprite sheets.
-    const float uvMinX = ((float)cutX + 0.5f) * invW;
-    const float uvMinY = ((float)cutY + 0.5f) * invH;
-    const float uvMaxX = ((float)cutX + (float)cutW - 0.5f) * invW;
-    const float uvMaxY = ((float)cutY + (float)cutH - 0.5f) * invH;
-
-    const float uvX = uvMinX;
-    const float uvY = uvMinY;
-    const float uvW = uvMaxX - uvMinX;
-    const float uvH = uvMaxY - uvMinY;
     Billboard_DrawInternal(
         texId,
         position,
         scale,
-        { { uvW, uvH }, { uvX, uvY } },
+        uv,
         color,
         pivot);
 }
@@ -288,3 +346,150 @@ void Billboard_SetViewMatrix(const XMFLOAT4X4& view)
     g_mtxView._42 = 0.0f;
     g_mtxView._43 = 0.0f;
 }
+
+// Writes one camera-facing quad (same result as pivot -> scale -> billboardRot -> trans).
+static void Billboard_ExpandQuad(const BatchQuad& q, const XMFLOAT3& right, const XMFLOAT3& up, VertexBillboard* out)
+{
+    static const XMFLOAT2 kCorner[kVertexCount] = {
+        { -0.5f,  0.5f }, {  0.5f,  0.5f }, {  0.5f, -0.5f }, { -0.5f, -0.5f },
+    };
+    static const XMFLOAT2 kUV[kVertexCount] = {
+        { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f },
+    };
+
+    for (UINT v = 0; v < kVertexCount; ++v)
+    {
+        const float lx = (kCorner[v].x - q.pivot.x) * q.scale.x;
+        const float ly = (kCorner[v].y - q.pivot.y) * q.scale.y;
+
+        out[v].position = {
+            q.position.x + right.x * lx + up.x * ly,
+            q.position.y + right.y * lx + up.y * ly,
+            q.position.z + right.z * lx + up.z * ly,
+        };
+        out[v].color = q.color;
+        out[v].texcoord = {
+            kUV[v].x * q.uv.scale.x + q.uv.translation.x,
+            kUV[v].y * q.uv.scale.y + q.uv.translation.y,
+        };
+    }
+}
+
+static void Billboard_BatchFlush()
+{
+    if (g_batchQuads.empty()) return;
+    if (!g_pBatchIndexBuffer)
+    {
+        g_batchQuads.clear();
+        return;
+    }
+
+    // Keep submission order: billboards are alpha blended with depth writes off,
+    // so reordering across textures would change what ends up on top.
+    // Only adjacent quads sharing a texture are merged into one draw below.
+
+    // Camera right/up in world space (rows of R = transpose(view rotation)).
+    const XMFLOAT3 right{ g_mtxView._11, g_mtxView._21, g_mtxView._31 };
+    const XMFLOAT3 up{ g_mtxView._12, g_mtxView._22, g_mtxView._32 };
+
+    auto* ctx = Direct3D_GetContext();
+
+    // Positions are already in world space and color/UV live in the vertices.
+    ShaderBillboard_SetWorldMatrix(XMMatrixIdentity());
+    ShaderBillboard_SetUVParameter({ { 1.0f, 1.0f }, { 0.0f, 0.0f } });
+    ShaderBillboard_SetColor({ 1.0f, 1.0f, 1.0f, 1.0f });
+    ShaderBillboard_Begin();
+
+    // One state save/restore for the whole batch.
+    RenderStateGuard state(ctx);
+    state.ApplyBillboardStates();
+
+    ctx->IASetIndexBuffer(g_pBatchIndexBuffer, DXGI_FORMAT_R16_UINT, 0);
+    ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+    const size_t total = g_batchQuads.size();
+    for (size_t chunkBegin = 0; chunkBegin < total; chunkBegin += kBatchMaxQuads)
+    {
+        const size_t chunkEnd = std::min(total, chunkBegin + (size_t)kBatchMaxQuads);
+
+        DynamicRingSpan span;
+        if (!DynamicRing_MapVertices(static_cast<UINT>(sizeof(VertexBillboard) * kVertexCount * (chunkEnd - chunkBegin)), &span))
+        {
+            break;
+        }
+        VertexBillboard* v = static_cast<VertexBillboard*>(span.data);
+        for (size_t i = chunkBegin; i < chunkEnd; ++i)
+        {
+            Billboard_ExpandQuad(g_batchQuads[i], right, up, v + (i - chunkBegin) * kVertexCount);
+        }
+        DynamicRing_Unmap(span);
+
+        UINT stride = sizeof(VertexBillboard);
+        UINT offset = span.offset;
+        ctx->IASetVertexBuffers(0, 1, &span.buffer, &stride, &offset);
+
+        // One draw per run of consecutive quads with the same texture inside this chunk.
+        size_t runBegin = chunkBegin;
+        while (runBegin < chunkEnd)
+        {
+            const int texId = g_batchQuads[runBegin].texId;
+            size_t runEnd = runBegin + 1;
+            while (runEnd < chunkEnd && g_batchQuads[runEnd].texId == texId) ++runEnd;
+
+            Texture_SetTexture(texId);
+            ctx->DrawIndexed(
+                static_cast<UINT>((runEnd - runBegin) * kIndexCount),
+                static_cast<UINT>((runBegin - chunkBegin) * kIndexCount),
+                0);
+
+            runBegin = runEnd;
+        }
+    }
+
+    g_batchQuads.clear();
+}
+
+static void Billboard_BatchPush(const BatchQuad& quad)
+{
+    g_batchQuads.push_back(quad);
+
+    // Outside Begin/End: draw right away so callers never lose a quad.
+    if (!g_batchOpen)
+    {
+        Billboard_BatchFlush();
+    }
+}
+
+void Billboard_BatchBegin()
+{
+    g_batchQuads.clear();
+    g_batchOpen = true;
+}
+
+void Billboard_BatchEnd()
+{
+    g_batchOpen = false;
+    Billboard_BatchFlush();
+}
+
+void Billboard_BatchDraw(int texId, const XMFLOAT3& position, float scaleX, float scaleY,
+    const XMFLOAT4& color, const XMFLOAT2& pivot)
+{
+    if (texId < 0 || Texture_Width(texId) == 0 || Texture_Height(texId) == 0)
+    {
+        // Skip invalid / not-loaded textures
+        return;
+    }
+    Billboard_BatchPush({ texId, position, { scaleX, scaleY }, { { 1.0f, 1.0f }, { 0.0f, 0.0f } }, color, pivot });
+}
+
+void Billboard_BatchDraw(int texId, const XMFLOAT3& position, const XMFLOAT2& scale,
+    const XMUINT4& tex_cut, const XMFLOAT4& color, const XMFLOAT2& pivot)
+{
+    UVParameter uv{};
+    if (!Billboard_MakeCutUV(texId, tex_cut, uv))
+    {
+        return;
+    }
+    Billboard_BatchPush({ texId, position, scale, uv, color, pivot });
+}
@@ -22,4 +22,21 @@ void Billboard_Draw(int texId, const DirectX::XMFLOAT3& position,
 	const DirectX::XMFLOAT2& pivot = { 0.0f,0.0f });
 
 void Billboard_SetViewMatrix(const DirectX::XMFLOAT4X4& view);
+
+// ---- Batch ----
+// Begin/End ̊Ԃɐς񂾃r{[h End ł܂Ƃ߂ĕ`悷B
+// Xe[g̐ݒ1A_CPUŃJʂɓWJ1̃obt@ցA`͓eNX`ԂƂ1B
+// Ő[xȂ̂Őς񂾏͓ւȂieNX`͑Đςނƕ`񐔂jB
+// Begin  Billboard_BatchDraw Ă񂾏ꍇ͂̏1`悷B
+void Billboard_BatchBegin();
+void Billboard_BatchEnd();
+void Billboard_BatchDraw(int texId, const DirectX::XMFLOAT3& position,
+	float scaleX, float scaleY,
+	const DirectX::XMFLOAT4& color = { 1.0f,1.0f,1.0f,1.0f },
+	const DirectX::XMFLOAT2& pivot = { 0.0f,0.0f });
+void Billboard_BatchDraw(int texId, const DirectX::XMFLOAT3& position,
+	const DirectX::XMFLOAT2& scale, const DirectX::XMUINT4& tex_cut,
+	const DirectX::XMFLOAT4& color = { 1.0f,1.0f,1.0f,1.0f },
+	const DirectX::XMFLOAT2& pivot = { 0.0f,0.0f });
+
 #endif//BILLBOARD_H
\ No newline at end of file
@@ -14,6 +14,8 @@
 #include"debug_text.h"
 #include "shader_billboard.h"
 #include "billboard.h"
+#include "constant_ring.h"
+#include "clustered_light.h"
 #include <windows.h>
 #include<sstream>
 
@@ -33,6 +35,7 @@ static XMFLOAT4X4 g_perspectiveMatrix;
 
 static ID3D11Buffer* g_pVSConstantBuffer1 = nullptr; // 萔obt@b1: view
 static ID3D11Buffer* g_pVSConstantBuffer2 = nullptr; // 萔obt@b2: proj
+static ConstantCache g_viewCache, g_projCache;        // giJȂ瑗蒼Ȃj
 
 
 //}EXΉJ
@@ -100,6 +103,7 @@ void Camera_Initialize()
     buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER; // oChtO
     Direct3D_GetDevice()->CreateBuffer(&buffer_desc, nullptr, &g_pVSConstantBuffer2); // proj
     Direct3D_GetDevice()->CreateBuffer(&buffer_desc, nullptr, &g_pVSConstantBuffer1); // view
+    g_viewCache.valid = g_projCache.valid = false;
 	
 #if defined(DEBUG)||defined(_DEBUG)//[X[ĥƂfobNpcollisioniŌȂ悤ɂ
     g_pDT = new hal::DebugText(Direct3D_GetDevice(), Direct3D_GetContext(), L"consolab_ascii_512.png",
@@ -253,11 +257,15 @@ void Camera_SetMatrix(const DirectX::XMMATRIX& view, const DirectX::XMMATRIX& pr
     XMStoreFloat4x4(&v, XMMatrixTranspose(view));
     XMStoreFloat4x4(&p, XMMatrixTranspose(projection));
 
-    Direct3D_GetContext()->UpdateSubresource(g_pVSConstantBuffer1, 0, nullptr, &v, 0, 0);
+    // r[Pʂ̒萔͒gςioCh͑̃VF[_[ b1/b2 ĝŖj
+    ConstantRing_UpdateCached(g_pVSConstantBuffer1, &g_viewCache, &v, sizeof(v));
     Direct3D_GetContext()->VSSetConstantBuffers(1, 1, &g_pVSConstantBuffer1);
-    Direct3D_GetContext()->UpdateSubresource(g_pVSConstantBuffer2, 0, nullptr, &p, 0, 0);
+    ConstantRing_UpdateCached(g_pVSConstantBuffer2, &g_projCache, &p, sizeof(p));
     Direct3D_GetContext()->VSSetConstantBuffers(2, 1, &g_pVSConstantBuffer2);
 
+    // _̃NX^[̃JŐ؂
+    ClusteredLight_SetView(view, projection);
+
     // ---- Billboard ł view/proj g ----
     ShaderBillboard_SetViewMatrix(view);
     ShaderBillboard_SetProjectionMatrix(projection);
@@ -0,0 +1,244 @@
+/*==============================================================================
+
+@@@NX^[_[clustered_light.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "clustered_light.h"
+#include "light_cluster.h"
+#include "constant_ring.h"
+#include "direct3d.h"
+#include "render_stats.h"
+#include "system_timer.h"
+#include "debug_ostream.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace DirectX;
+
+namespace
+{
+    constexpr UINT kMaxIndices = 64 * 1024; // ԍ̕т̏î͎Ăj
+
+    // VF[_[ StructuredBuffer<PointLight> Ɠ
+    struct GpuPointLight
+    {
+        XMFLOAT3 position;
+        float range;
+        XMFLOAT4 color;
+    };
+
+    // VF[_[ PS_CONSTANT_POINTLIGHT Ɠ
+    struct ClusterConstants
+    {
+        XMFLOAT4X4 viewProjection; // ]uς
+        XMFLOAT4 viewZ;            // dot(float4(posW, 1), viewZ) = r[Ԃ z
+        UINT dims[4];              // ^CX, ^CY, XCX, Cg
+        XMFLOAT4 depth;            // scale, bias, Ȃ1
+    };
+
+    // ӁIŊOݒ肳́BReleasesvB
+    ID3D11Device* g_pDevice = nullptr;
+    ID3D11DeviceContext* g_pContext = nullptr;
+
+    ID3D11Buffer* g_pConstantBuffer = nullptr;
+    ID3D11Buffer* g_pLightBuffer = nullptr;
+    ID3D11Buffer* g_pRangeBuffer = nullptr;
+    ID3D11Buffer* g_pIndexBuffer = nullptr;
+    ID3D11ShaderResourceView* g_pLightSRV = nullptr;
+    ID3D11ShaderResourceView* g_pRangeSRV = nullptr;
+    ID3D11ShaderResourceView* g_pIndexSRV = nullptr;
+    ConstantCache g_constantCache;
+
+    GpuPointLight g_lights[CLUSTERED_LIGHT_MAX]{};
+    int g_lightCount = 0;
+
+    LightClusterGrid g_grid;
+    std::vector<LightClusterSphere> g_spheres;
+    XMFLOAT4X4 g_view{}, g_projection{};
+    bool g_hasView = false;
+    bool g_viewChanged = false; // NX^[̋E͎ۂɎgɍ蒼iep̃JȂǂł͍Ȃj
+    bool g_dirty = true;
+
+    bool CreateStructured(UINT stride, UINT count, ID3D11Buffer** ppBuffer, ID3D11ShaderResourceView** ppSRV)
+    {
+        D3D11_BUFFER_DESC bd{};
+        bd.Usage = D3D11_USAGE_DYNAMIC;
+        bd.ByteWidth = stride * count;
+        bd.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+        bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        bd.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+        bd.StructureByteStride = stride;
+        if (FAILED(g_pDevice->CreateBuffer(&bd, nullptr, ppBuffer))) return false;
+
+        D3D11_SHADER_RESOURCE_VIEW_DESC sd{};
+        sd.Format = DXGI_FORMAT_UNKNOWN;
+        sd.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+        sd.Buffer.FirstElement = 0;
+        sd.Buffer.NumElements = count;
+        return SUCCEEDED(g_pDevice->CreateShaderResourceView(*ppBuffer, &sd, ppSRV));
+    }
+
+    void Upload(ID3D11Buffer* buffer, const void* data, UINT bytes)
+    {
+        D3D11_MAPPED_SUBRESOURCE msr{};
+        if (FAILED(g_pContext->Map(buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr))) return;
+        if (bytes > 0) std::memcpy(msr.pData, data, bytes);
+        g_pContext->Unmap(buffer, 0);
+        RenderStats_AddCounter(RENDER_STATS_CONSTANT_BYTES, bytes);
+    }
+
+    void Rebuild()
+    {
+        const double begin = SystemTimer_GetAbsoluteTime();
+
+        if (g_viewChanged)
+        {
+            g_grid.SetView(g_view, g_projection);
+            g_viewChanged = false;
+        }
+
+        g_spheres.resize(g_lightCount);
+        for (int i = 0; i < g_lightCount; ++i)
+        {
+            g_spheres[i].position = g_lights[i].position;
+            g_spheres[i].range = g_lights[i].range;
+        }
+        g_grid.Build(g_spheres.data(), g_lightCount, kMaxIndices);
+        if (g_grid.DroppedIndices() > 0)
+        {
+            hal::dout << "ClusteredLight : ԍ̕тӂ܂ (" << g_grid.DroppedIndices() << ")" << std::endl;
+        }
+
+        const auto& ranges = g_grid.Ranges();
+        const auto& indices = g_grid.Indices();
+        Upload(g_pLightBuffer, g_lights, sizeof(GpuPointLight) * g_lightCount);
+        Upload(g_pRangeBuffer, ranges.data(), (UINT)(sizeof(LightClusterRange) * ranges.size()));
+        Upload(g_pIndexBuffer, indices.data(), (UINT)(sizeof(uint32_t) * indices.size()));
+
+        ClusterConstants cc{};
+        XMStoreFloat4x4(&cc.viewProjection, XMMatrixTranspose(XMLoadFloat4x4(&g_view) * XMLoadFloat4x4(&g_projection)));
+        cc.viewZ = { g_view._13, g_view._23, g_view._33, g_view._43 };
+        cc.dims[0] = g_grid.TilesX();
+        cc.dims[1] = g_grid.TilesY();
+        cc.dims[2] = g_grid.Slices();
+        cc.dims[3] = g_lightCount;
+        cc.depth = { g_grid.DepthScale(), g_grid.DepthBias(), g_grid.IsPerspective() ? 1.0f : 0.0f, 0.0f };
+        ConstantRing_UpdateCached(g_pConstantBuffer, &g_constantCache, &cc, sizeof(cc));
+
+        RenderStats_AddPassTime(RENDER_STATS_PASS_LIGHT_CLUSTER, (SystemTimer_GetAbsoluteTime() - begin) * 1000.0);
+        RenderStats_AddCounter(RENDER_STATS_LIGHT_INDICES, indices.size());
+        g_dirty = false;
+    }
+}
+
+bool ClusteredLight_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
+{
+    if (!pDevice || !pContext) {
+        hal::dout << "ClusteredLight_Initialize() : ^ꂽfoCXReLXgsł" << std::endl;
+        return false;
+    }
+
+    g_pDevice = pDevice;
+    g_pContext = pContext;
+
+    D3D11_BUFFER_DESC bd{};
+    bd.ByteWidth = sizeof(ClusterConstants);
+    bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    if (FAILED(g_pDevice->CreateBuffer(&bd, nullptr, &g_pConstantBuffer)))
+    {
+        hal::dout << "ClusteredLight_Initialize() : 萔obt@̍쐬Ɏs܂" << std::endl;
+        return false;
+    }
+
+    if (!CreateStructured(sizeof(GpuPointLight), CLUSTERED_LIGHT_MAX, &g_pLightBuffer, &g_pLightSRV) ||
+        !CreateStructured(sizeof(LightClusterRange), (UINT)g_grid.ClusterCount(), &g_pRangeBuffer, &g_pRangeSRV) ||
+        !CreateStructured(sizeof(uint32_t), kMaxIndices, &g_pIndexBuffer, &g_pIndexSRV))
+    {
+        hal::dout << "ClusteredLight_Initialize() : Cgpobt@̍쐬Ɏs܂" << std::endl;
+        ClusteredLight_Finalize();
+        return false;
+    }
+
+    g_constantCache.valid = false;
+    g_lightCount = 0;
+    g_hasView = false;
+    g_dirty = true;
+    return true;
+}
+
+void ClusteredLight_Finalize()
+{
+    SAFE_RELEASE(g_pIndexSRV);
+    SAFE_RELEASE(g_pRangeSRV);
+    SAFE_RELEASE(g_pLightSRV);
+    SAFE_RELEASE(g_pIndexBuffer);
+    SAFE_RELEASE(g_pRangeBuffer);
+    SAFE_RELEASE(g_pLightBuffer);
+    SAFE_RELEASE(g_pConstantBuffer);
+    g_pDevice = nullptr;
+    g_pContext = nullptr;
+}
+
+void ClusteredLight_SetCount(int count)
+{
+    count = std::max(0, std::min(count, CLUSTERED_LIGHT_MAX));
+    if (count == g_lightCount) return;
+    g_lightCount = count;
+    g_dirty = true;
+}
+
+int ClusteredLight_GetCount()
+{
+    return g_lightCount;
+}
+
+void ClusteredLight_Set(int n, const XMFLOAT3& position, float range, const XMFLOAT3& color)
+{
+    if (n < 0 || n >= CLUSTERED_LIGHT_MAX) return;
+
+    const GpuPointLight light{ position, range, { color.x, color.y, color.z, 1.0f } };
+    if (std::memcmp(&g_lights[n], &light, sizeof(light)) == 0) return;
+    g_lights[n] = light;
+    if (n < g_lightCount) g_dirty = true;
+}
+
+void ClusteredLight_SetView(const XMMATRIX& view, const XMMATRIX& projection)
+{
+    XMFLOAT4X4 v, p;
+    XMStoreFloat4x4(&v, view);
+    XMStoreFloat4x4(&p, projection);
+    if (g_hasView && std::memcmp(&v, &g_view, sizeof(v)) == 0 && std::memcmp(&p, &g_projection, sizeof(p)) == 0)
+    {
+        return;
+    }
+
+    g_view = v;
+    g_projection = p;
+    g_hasView = true;
+    g_viewChanged = true;
+    g_dirty = true;
+}
+
+void ClusteredLight_Bind()
+{
+    if (!g_pContext || !g_pConstantBuffer) return;
+
+    // J܂O͐U蕪悤Ȃ̂ŁACg0Ƃđ
+    if (g_dirty && g_hasView)
+    {
+        Rebuild();
+    }
+    else if (!g_hasView && !g_constantCache.valid)
+    {
+        const ClusterConstants cc{};
+        ConstantRing_UpdateCached(g_pConstantBuffer, &g_constantCache, &cc, sizeof(cc));
+    }
+
+    ID3D11ShaderResourceView* srvs[3] = { g_pLightSRV, g_pRangeSRV, g_pIndexSRV };
+    g_pContext->PSSetConstantBuffers(4, 1, &g_pConstantBuffer);
+    g_pContext->PSSetShaderResources(4, 3, srvs);
+}
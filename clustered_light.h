@@ -0,0 +1,35 @@
+/*==============================================================================
+
+@@@NX^[_[clustered_light.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    _4葽g߂̂́BCgƃJς
+    LightClusterGrid ŐU蕪ACgENX^[͈̔́Eԍ̕т
+    PS  t4`t6  b4 ɑB
+    Light_SetPointLight / Light_SetPointLightCount ͂֗B
+
+==============================================================================*/
+#ifndef CLUSTERED_LIGHT_H
+#define CLUSTERED_LIGHT_H
+
+#include <d3d11.h>
+#include <DirectXMath.h>
+
+constexpr int CLUSTERED_LIGHT_MAX = 1024;
+
+bool ClusteredLight_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
+void ClusteredLight_Finalize();
+
+void ClusteredLight_SetCount(int count);
+int  ClusteredLight_GetCount();
+void ClusteredLight_Set(int n, const DirectX::XMFLOAT3& position, float range, const DirectX::XMFLOAT3& color);
+
+// NX^[؂JiCamera_SetMatrix Ă΂j
+void ClusteredLight_SetView(const DirectX::XMMATRIX& view, const DirectX::XMMATRIX& projection);
+
+// KvȂU蕪đAb4  t4`t6 oChiCggVF[_[ Begin ŌĂԁj
+void ClusteredLight_Bind();
+
+#endif // CLUSTERED_LIGHT_H
@@ -11,12 +11,12 @@
 #include"direct3d.h"
 #include"texture.h"
 #include"shader2d.h"
+#include"dynamic_ring.h"
 #include<algorithm>
 
 using namespace DirectX;
 
-static constexpr int NUM_VERTEX = 5000; // _
-static ID3D11Buffer* g_pVertexBuffer = nullptr; // _obt@
+// _͕`悲ƂɋLOidynamic_ring.hjKv؂o
 
 // ӁIŊOݒ肳́BReleasesvB
 static ID3D11Device* g_pDevice = nullptr;
@@ -188,22 +188,11 @@ void Collision_DebugInitialize(ID3D11Device* pDevice, ID3D11DeviceContext* pCont
 	g_pDevice = pDevice;
 	g_pContext = pContext;
 
-	
-	// _obt@
-	D3D11_BUFFER_DESC bd = {};
-	bd.Usage = D3D11_USAGE_DYNAMIC;
-	bd.ByteWidth = sizeof(Vertex) * NUM_VERTEX;
-	bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-	bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-
-	g_pDevice->CreateBuffer(&bd, NULL, &g_pVertexBuffer);
-
 	g_WhiteTexId = Texture_Load(L"white.png");
 }
 
 void Collision_DebugFinalize()
 {
-	SAFE_RELEASE(g_pVertexBuffer);//_obt@̌Еt
 }
 
 
@@ -212,6 +201,7 @@ void Collision_DebugDraw(const Circle& circle, const DirectX::XMFLOAT4& color)
 {
 	//_̐Zo
   int numVertex = (int)(circle.radius * 2.0f * XM_PI);//~̒=_̐
+  if (numVertex <= 0) return;
 
   // VF[_[`pCvCɐݒ
   Shader2D_Begin();
@@ -219,11 +209,11 @@ void Collision_DebugDraw(const Circle& circle, const DirectX::XMFLOAT4& color)
   Shader2D_SetWorldMatrix(XMMatrixIdentity());
 
   // _obt@bN
-  D3D11_MAPPED_SUBRESOURCE msr;
-  g_pContext->Map(g_pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
+  DynamicRingSpan span;
+  if (!DynamicRing_MapVertices(sizeof(Vertex) * numVertex, &span)) return;
 
   // _obt@ւ̉z|C^擾
-  Vertex* v = (Vertex*)msr.pData;
+  Vertex* v = (Vertex*)span.data;
 
   // _
   const float SCREEN_WIDTH = (float)Direct3D_GetBackBufferWidth();
@@ -240,12 +230,12 @@ void Collision_DebugDraw(const Circle& circle, const DirectX::XMFLOAT4& color)
   }
 
   // _obt@̃bN
-  g_pContext->Unmap(g_pVertexBuffer, 0);
+  DynamicRing_Unmap(span);
 
   // _obt@`pCvCɐݒ
   UINT stride = sizeof(Vertex);
-  UINT offset = 0;
-  g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
+  UINT offset = span.offset;
+  g_pContext->IASetVertexBuffers(0, 1, &span.buffer, &stride, &offset);
 
   // _VF[_[ɕϊsݒ
   Shader2D_SetProjectionMatrix(XMMatrixOrthographicOffCenterLH(0.0f, SCREEN_WIDTH, SCREEN_HEIGHT, 0.0f, 0.0f, 1.0f));
@@ -271,11 +261,11 @@ void Collision_DebugDraw(const Box& box, const DirectX::XMFLOAT4& color)
 	Shader2D_SetWorldMatrix(XMMatrixIdentity());
 
 	// _obt@bN
-	D3D11_MAPPED_SUBRESOURCE msr;
-	g_pContext->Map(g_pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
+	DynamicRingSpan span;
+	if (!DynamicRing_MapVertices(sizeof(Vertex) * 5, &span)) return;
 
 	// _obt@ւ̉z|C^擾
-	Vertex* v = (Vertex*)msr.pData;
+	Vertex* v = (Vertex*)span.data;
 
 	// _
 	 // _
@@ -294,12 +284,12 @@ void Collision_DebugDraw(const Box& box, const DirectX::XMFLOAT4& color)
 	}
 
 	// _obt@̃bN
-	g_pContext->Unmap(g_pVertexBuffer, 0);
+	DynamicRing_Unmap(span);
 
 	// _obt@`pCvCɐݒ
 	UINT stride = sizeof(Vertex);
-	UINT offset = 0;
-	g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
+	UINT offset = span.offset;
+	g_pContext->IASetVertexBuffers(0, 1, &span.buffer, &stride, &offset);
 
 	// _VF[_[ɕϊsݒ
 	Shader2D_SetProjectionMatrix(XMMatrixOrthographicOffCenterLH(0.0f, SCREEN_WIDTH, SCREEN_HEIGHT, 0.0f, 0.0f, 1.0f));
@@ -0,0 +1,255 @@
+/*==============================================================================
+
+@@@萔obt@̃t[O[constant_ring.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "constant_ring.h"
+#include "frame_ring.h"
+#include "direct3d.h"
+#include "render_stats.h"
+#include "debug_ostream.h"
+#include <d3d11_1.h>
+#include <cstring>
+
+namespace
+{
+    constexpr UINT kRingBytes = 1024 * 1024;   // 256oCg~4096vf
+    constexpr UINT kAlignment = 256;           // ItZbg16萔(256oCg)P
+    constexpr UINT kMaxBindConstants = D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT;
+
+    // ӁIŊOݒ肳́BReleasesvB
+    ID3D11Device* g_pDevice = nullptr;
+    ID3D11DeviceContext* g_pContext = nullptr;
+
+    ID3D11DeviceContext1* g_pContext1 = nullptr;
+    ID3D11Buffer*         g_pBuffer = nullptr;
+    FrameRing             g_alloc;
+
+    UINT AlignUp(UINT v, UINT a) { return (v + a - 1) & ~(a - 1); }
+
+    bool CheckOffsetSupport()
+    {
+        D3D11_FEATURE_DATA_D3D11_OPTIONS options{};
+        if (FAILED(g_pDevice->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))))
+        {
+            return false;
+        }
+        return options.ConstantBufferOffsetting && options.MapNoOverwriteOnDynamicConstantBuffer;
+    }
+
+    UINT BindRange(const ConstantRingSpan& span, UINT index, UINT* outFirst)
+    {
+        *outFirst = span.firstConstant + span.strideConstants * index;
+        return span.strideConstants < kMaxBindConstants ? span.strideConstants : kMaxBindConstants;
+    }
+}
+
+bool ConstantRing_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
+{
+    if (!pDevice || !pContext) {
+        hal::dout << "ConstantRing_Initialize() : ^ꂽfoCXReLXgsł" << std::endl;
+        return false;
+    }
+
+    g_pDevice = pDevice;
+    g_pContext = pContext;
+
+    // gȂΌĂяopobt@ɑ邾Ȃ̂Ŏsɂ͂Ȃ
+    if (FAILED(g_pContext->QueryInterface(__uuidof(ID3D11DeviceContext1), (void**)&g_pContext1)) || !CheckOffsetSupport())
+    {
+        hal::dout << "ConstantRing : 萔obt@̃ItZbgoChgȂ̂ŏ]̍XVg܂" << std::endl;
+        SAFE_RELEASE(g_pContext1);
+        return true;
+    }
+
+    D3D11_BUFFER_DESC bd{};
+    bd.Usage = D3D11_USAGE_DYNAMIC;
+    bd.ByteWidth = kRingBytes;
+    bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    if (FAILED(g_pDevice->CreateBuffer(&bd, nullptr, &g_pBuffer)))
+    {
+        hal::dout << "ConstantRing : obt@̐Ɏs܂ (" << kRingBytes << " bytes)" << std::endl;
+        SAFE_RELEASE(g_pContext1);
+        return true;
+    }
+
+    g_alloc.Reset(kRingBytes);
+    return true;
+}
+
+void ConstantRing_Finalize()
+{
+    SAFE_RELEASE(g_pBuffer);
+    SAFE_RELEASE(g_pContext1);
+    g_alloc.Reset(0);
+    g_pDevice = nullptr;
+    g_pContext = nullptr;
+}
+
+void ConstantRing_BeginFrame()
+{
+    g_alloc.BeginFrame();
+}
+
+bool ConstantRing_IsSupported()
+{
+    return g_pBuffer != nullptr;
+}
+
+bool ConstantRing_Map(UINT elementBytes, UINT count, ConstantRingSpan* out)
+{
+    if (!out || !g_pBuffer || elementBytes == 0 || count == 0) return false;
+
+    const UINT stride = AlignUp(elementBytes, kAlignment);
+
+    // 1Ŏ܂Ȃ͌ĂяoŕĂ炤
+    if ((uint64_t)stride * count > g_alloc.Capacity()) return false;
+
+    FrameRing::Allocation a;
+    if (!g_alloc.Allocate(stride * count, kAlignment, &a)) return false;
+
+    D3D11_MAPPED_SUBRESOURCE msr{};
+    const D3D11_MAP mapType = a.discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (FAILED(g_pContext->Map(g_pBuffer, 0, mapType, 0, &msr)))
+    {
+        return false;
+    }
+
+    out->buffer = g_pBuffer;
+    out->firstConstant = a.offset / 16;
+    out->strideConstants = stride / 16;
+    out->count = count;
+    out->data = static_cast<uint8_t*>(msr.pData) + a.offset;
+    out->generation = a.generation;
+
+    // ۂɏ̂͗vf̒gi̗]͑Ȃj
+    RenderStats_AddCounter(RENDER_STATS_CONSTANT_BYTES, (unsigned long long)elementBytes * count);
+    return true;
+}
+
+void* ConstantRing_Element(const ConstantRingSpan& span, UINT index)
+{
+    if (!span.data || index >= span.count) return nullptr;
+    return static_cast<uint8_t*>(span.data) + (size_t)span.strideConstants * 16 * index;
+}
+
+void ConstantRing_Unmap(const ConstantRingSpan& span)
+{
+    if (!g_pContext || !span.buffer) return;
+    g_pContext->Unmap(span.buffer, 0);
+}
+
+void ConstantRing_BindVS(UINT slot, const ConstantRingSpan& span, UINT index)
+{
+    if (!g_pContext1 || !span.buffer || index >= span.count) return;
+
+    UINT first = 0;
+    const UINT num = BindRange(span, index, &first);
+    g_pContext1->VSSetConstantBuffers1(slot, 1, &span.buffer, &first, &num);
+}
+
+void ConstantRing_BindPS(UINT slot, const ConstantRingSpan& span, UINT index)
+{
+    if (!g_pContext1 || !span.buffer || index >= span.count) return;
+
+    UINT first = 0;
+    const UINT num = BindRange(span, index, &first);
+    g_pContext1->PSSetConstantBuffers1(slot, 1, &span.buffer, &first, &num);
+}
+
+bool ConstantRing_IsValid(const ConstantRingSpan& span)
+{
+    return span.buffer && span.buffer == g_pBuffer && span.generation == g_alloc.Generation();
+}
+
+bool ConstantRing_UpdateCached(ID3D11Buffer* buffer, ConstantCache* cache, const void* data, UINT bytes)
+{
+    if (!buffer || !g_pContext) return false;
+
+    if (cache && bytes <= sizeof(cache->data))
+    {
+        if (cache->valid && cache->bytes == bytes && std::memcmp(cache->data, data, bytes) == 0)
+        {
+            return false;
+        }
+        std::memcpy(cache->data, data, bytes);
+        cache->bytes = bytes;
+        cache->valid = true;
+    }
+
+    g_pContext->UpdateSubresource(buffer, 0, nullptr, data, 0, 0);
+    RenderStats_AddCounter(RENDER_STATS_CONSTANT_BYTES, bytes);
+    return true;
+}
+
+void ConstantRing_WriteObjectVS(ConstantObject* object, UINT slot, const void* data, UINT bytes)
+{
+    if (!object || !g_pContext) return;
+
+    if (!ConstantRing_IsSupported())
+    {
+        ConstantRing_UpdateCached(object->fallback, &object->cache, data, bytes);
+        g_pContext->VSSetConstantBuffers(slot, 1, &object->fallback);
+        return;
+    }
+
+    // OƓgŁA܂OɎcĂΏȂ
+    const bool same = object->cache.valid && object->cache.bytes == bytes
+        && std::memcmp(object->cache.data, data, bytes) == 0;
+    if (!same || !ConstantRing_IsValid(object->span))
+    {
+        ConstantRingSpan span;
+        if (!ConstantRing_Map(bytes, 1, &span)) return;
+        std::memcpy(span.data, data, bytes);
+        ConstantRing_Unmap(span);
+
+        object->span = span;
+        object->index = 0;
+        if (bytes <= sizeof(object->cache.data))
+        {
+            std::memcpy(object->cache.data, data, bytes);
+            object->cache.bytes = bytes;
+            object->cache.valid = true;
+        }
+    }
+
+    ConstantRing_BindVS(slot, object->span, object->index);
+}
+
+void ConstantRing_SetObjectVS(ConstantObject* object, UINT slot, const ConstantRingSpan& span, UINT index)
+{
+    if (!object) return;
+
+    object->span = span;
+    object->index = index;
+    object->cache.valid = false; // g͂ŎĂȂ
+    ConstantRing_BindVS(slot, span, index);
+}
+
+void ConstantRing_BindObjectVS(ConstantObject* object, UINT slot)
+{
+    if (!object || !g_pContext) return;
+
+    if (!ConstantRing_IsSupported())
+    {
+        g_pContext->VSSetConstantBuffers(slot, 1, &object->fallback);
+        return;
+    }
+
+    if (ConstantRing_IsValid(object->span))
+    {
+        ConstantRing_BindVS(slot, object->span, object->index);
+    }
+    else if (object->cache.valid)
+    {
+        // O擪ɖ߂ĂAoĂ钆g
+        const ConstantCache cache = object->cache;
+        object->cache.valid = false;
+        ConstantRing_WriteObjectVS(object, slot, cache.data, cache.bytes);
+    }
+}
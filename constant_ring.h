@@ -0,0 +1,89 @@
+/*==============================================================================
+
+@@@萔obt@̃t[O[constant_ring.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    [hsȂǃIuWFNgƂ̒萔́A`悲Ƃ UpdateSubresource 
+    傫ȓI萔obt@1{ɋl߂āAItZbgtŃoChiD3D11.1jB
+    ܂Ƃ߂ĕ`Ȃ1 Map őSIuWFNgĂ܂B
+
+        ConstantRingSpan span;
+        if (ConstantRing_Map(sizeof(XMFLOAT4X4), count, &span)) {
+            // ConstantRing_Element(span, i) ɏ
+            ConstantRing_Unmap(span);
+            // `悲Ƃ ConstantRing_BindVS(0, span, i)
+        }
+
+    r[/vWFNV̂悤ɖőɕςȂ萔͍܂Œʂpobt@ɒuA
+    ConstantRing_UpdateCached ŒgςB
+    ItZbgoChgȂł ConstantRing_IsSupported()  false ɂȂA
+    Ăяo͏]̐pobt@֑B
+
+==============================================================================*/
+#ifndef CONSTANT_RING_H
+#define CONSTANT_RING_H
+
+#include <d3d11.h>
+#include <cstdint>
+
+struct ConstantRingSpan
+{
+    ID3D11Buffer* buffer = nullptr;     // oChpiLȂj
+    UINT          firstConstant = 0;    // 擪vf̈ʒui16oCgPʁj
+    UINT          strideConstants = 0;  // vf̊Ԋui16oCgPʁA256oCgj
+    UINT          count = 0;
+    void*         data = nullptr;       // Map̏ݐiUnmap͎gȂj
+    uint32_t      generation = 0;
+};
+
+// p萔obt@̑Mς݂̒gig𑗂蒼Ȃ߁j
+struct ConstantCache
+{
+    unsigned char data[256];
+    UINT          bytes = 0;
+    bool          valid = false;
+};
+
+// IuWFNgƂ̒萔1i[hsȂǁjBOg΃OAgȂΐpobt@
+struct ConstantObject
+{
+    ID3D11Buffer*    fallback = nullptr;  // OgȂ̐pobt@iLȂj
+    ConstantCache    cache;               // ߂̒gid`FbNƃO߂̍đpj
+    ConstantRingSpan span;
+    UINT             index = 0;
+};
+
+bool ConstantRing_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
+void ConstantRing_Finalize();
+
+// 1t[1iPresentjB̊mۂ DISCARD ŐV̈ɂȂ
+void ConstantRing_BeginFrame();
+
+// ItZbgoChg邩
+bool ConstantRing_IsSupported();
+
+// elementBytes  count Bvf256oCgŕ
+bool  ConstantRing_Map(UINT elementBytes, UINT count, ConstantRingSpan* out);
+void* ConstantRing_Element(const ConstantRingSpan& span, UINT index);
+void  ConstantRing_Unmap(const ConstantRingSpan& span);
+
+void ConstantRing_BindVS(UINT slot, const ConstantRingSpan& span, UINT index);
+void ConstantRing_BindPS(UINT slot, const ConstantRingSpan& span, UINT index);
+
+// ܂gcĂ邩iȍ~̕`ŃoChĂ悢j
+bool ConstantRing_IsValid(const ConstantRingSpan& span);
+
+// p萔obt@𒆐gςXVB true
+// bytes ̓obt@ ByteWidth Ɠɂ邱ƁiUpdateSubresource ͑Ŝj
+bool ConstantRing_UpdateCached(ID3D11Buffer* buffer, ConstantCache* cache, const void* data, UINT bytes);
+
+// g VS  slot ɃoCh
+void ConstantRing_WriteObjectVS(ConstantObject* object, UINT slot, const void* data, UINT bytes);
+// ConstantRing_Map ł܂Ƃ߂ďvfwăoCh
+void ConstantRing_SetObjectVS(ConstantObject* object, UINT slot, const ConstantRingSpan& span, UINT index);
+// VF[_[؂ւ̃oCh
+void ConstantRing_BindObjectVS(ConstantObject* object, UINT slot);
+
+#endif // CONSTANT_RING_H
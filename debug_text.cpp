@@ -8,6 +8,7 @@
 ==============================================================================*/
 #include "debug_text.h"
 #include "WICTextureLoader11.h"
+#include "dynamic_ring.h"
 using namespace DirectX;
 #include <D3Dcompiler.h>
 using namespace Microsoft::WRL;
@@ -267,21 +268,23 @@ namespace hal
 			return; // `悷镶Ȃꍇ͉Ȃ
 		}
 
-		if (!m_pVertexBuffer || m_CharacterCount > m_BufferSourceCharacterCount) {
-			createBuffer(m_CharacterCount);
+		// _ƃCfbNX͋LO當Ԃ؂oit[ȊO NO_OVERWRITEj
+		DynamicRingSpan vertexSpan;
+		if (!DynamicRing_MapVertices(sizeof(Vertex) * m_CharacterCount * 4, &vertexSpan)) {
+			return;
 		}
 
-		// _obt@ƒ_CfbNXbN
-		D3D11_MAPPED_SUBRESOURCE msr;
-		m_pContext->Map(m_pVertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
+		DynamicRingSpan indexSpan;
+		if (!DynamicRing_MapIndices(sizeof(WORD) * m_CharacterCount * 6, &indexSpan)) {
+			DynamicRing_Unmap(vertexSpan);
+			return;
+		}
 
 		// _obt@ւ̉z|C^擾
-		Vertex* v = (Vertex*)msr.pData;
-
-		m_pContext->Map(m_pIndexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
+		Vertex* v = (Vertex*)vertexSpan.data;
 
 		// CfbNXobt@ւ̉z|C^擾
-		WORD* indices = (WORD*)msr.pData;
+		WORD* indices = (WORD*)indexSpan.data;
 
 		// _
 		UINT lineCount = 0;
@@ -344,16 +347,16 @@ namespace hal
 		}
 
 		// _obt@ƒ_CfbNX̃bN
-		m_pContext->Unmap(m_pVertexBuffer.Get(), 0);
-		m_pContext->Unmap(m_pIndexBuffer.Get(), 0);
+		DynamicRing_Unmap(vertexSpan);
+		DynamicRing_Unmap(indexSpan);
 
 		// _obt@`pCvCɐݒ
 		UINT stride = sizeof(Vertex);
-		UINT offset = 0;
-		m_pContext->IASetVertexBuffers(0, 1, m_pVertexBuffer.GetAddressOf(), &stride, &offset);
+		UINT offset = vertexSpan.offset;
+		m_pContext->IASetVertexBuffers(0, 1, &vertexSpan.buffer, &stride, &offset);
 
 		// CfbNXobt@`pCvCɐݒ
-		m_pContext->IASetIndexBuffer(m_pIndexBuffer.Get(), DXGI_FORMAT_R16_UINT, 0);
+		m_pContext->IASetIndexBuffer(indexSpan.buffer, DXGI_FORMAT_R16_UINT, indexSpan.offset);
 		
 		// _VF[_[`pCvCɐݒ
 		m_pContext->VSSetShader(m_pVertexShader.Get(), nullptr, 0);
@@ -409,24 +412,4 @@ namespace hal
 		m_CharacterCount = 0;
 	}
 
-	void DebugText::createBuffer(ULONG characterCount)
-	{
-		// _obt@
-		D3D11_BUFFER_DESC bd = {};
-		bd.Usage = D3D11_USAGE_DYNAMIC;
-		bd.ByteWidth = sizeof(Vertex) * characterCount * 4;
-		bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-		bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-
-		m_pDevice->CreateBuffer(&bd, NULL, m_pVertexBuffer.ReleaseAndGetAddressOf());
-
-		// CfbNXobt@
-		bd.ByteWidth = sizeof(WORD) * characterCount * 6;
-		bd.BindFlags = D3D11_BIND_INDEX_BUFFER;
-
-		m_pDevice->CreateBuffer(&bd, NULL, m_pIndexBuffer.ReleaseAndGetAddressOf());
-
-		m_BufferSourceCharacterCount = characterCount;
-	}
-
 }
\ No newline at end of file
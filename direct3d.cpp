@@ -9,6 +9,9 @@
 #include <d3d11.h>
 #include "direct3d.h"
 #include "debug_ostream.h"
+#include "dynamic_ring.h"
+#include "render_graph_d3d.h"
+#include "constant_ring.h"
 
 #pragma comment(lib, "d3d11.lib")
 // #pragma comment(lib, "dxgi.lib")
@@ -61,6 +64,13 @@ static ID3D11DepthStencilView* g_pDepthDepthStencilView = nullptr;
 static D3D11_TEXTURE2D_DESC g_DepthDesc{};
 static D3D11_VIEWPORT g_DepthViewport{};//r[|[gݒp
 static ID3D11Buffer* g_pVSConstantBuffer3 = nullptr;
+static ConstantCache g_VSConstantCache3; // b3ɑgiȂ瑗蒼Ȃj
+
+/* ÓILX^[̐[xLbViTCYEtH[}bgBRs[pj */
+static ID3D11Texture2D* g_pStaticDepthBuffer = nullptr;
+static ID3D11RenderTargetView* g_pStaticDepthRenderTargetView = nullptr;
+static ID3D11Texture2D* g_pStaticDepthStencilBuffer = nullptr;
+static ID3D11DepthStencilView* g_pStaticDepthStencilView = nullptr;
 
 static bool configureDepthBackBuffer(); // [xobNobt@̐ݒE
 static void releaseDepthBackBuffer(); // [xobNobt@̉
@@ -133,6 +143,18 @@ bool Direct3D_Initialize(HWND hWnd)
 		return false;
 	}
 
+	// ꎞWIgiXvCgEr{[hjp̋LIobt@
+	if (!DynamicRing_Initialize(g_pDevice, g_pDeviceContext)) {
+		MessageBox(hWnd, TEXT("Iobt@O̐Ɏs܂"), TEXT("G["), MB_OK);
+		return false;
+	}
+
+	// IuWFNgƂ̒萔i[hsȂǁjp̃O
+	if (!ConstantRing_Initialize(g_pDevice, g_pDeviceContext)) {
+		MessageBox(hWnd, TEXT("萔obt@O̐Ɏs܂"), TEXT("G["), MB_OK);
+		return false;
+	}
+
     return true;
 }
 
@@ -143,6 +165,10 @@ void Direct3D_Finalize()
 		g_pDeviceContext->Flush();
 	}
 
+	DynamicRing_Finalize();
+	ConstantRing_Finalize();
+	RenderGraphD3D_ReleaseTransients();
+
 	SAFE_RELEASE(g_pBlendStateMultiply);
 	SAFE_RELEASE(g_pRasterizerState);
 	SAFE_RELEASE(g_pDepthStencilStateDepthDisable);
@@ -174,6 +200,10 @@ void Direct3D_Present()
 {
 	// Xbv`F[̕\
 	g_pSwapChain->Present(1, 0);//x`}[NƂ͑PPɂ
+
+	// t[̈ꎞWIg̓O̐擪iŏ Map  DISCARDj
+	DynamicRing_BeginFrame();
+	ConstantRing_BeginFrame();
 }
 
 unsigned int Direct3D_GetBackBufferWidth()
@@ -281,9 +311,7 @@ void Direct3D_SetOffscreen()
 {
 	g_pDeviceContext->RSSetViewports(1, &g_OffscreenViewport);  // r[|[g̐ݒ
 
-	float clear_color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };//window̖邳
-	g_pDeviceContext->ClearRenderTargetView(g_pOffscreenRenderTargetView, clear_color);
-	g_pDeviceContext->ClearDepthStencilView(g_pOffscreenDepthStencilView, D3D11_CLEAR_DEPTH, 1.0f, 0);
+	// NA͂ȂiKvȂ Direct3D_ClearOffscreenB`Ȃt[͑Ǒʂcj
 
 	// _[^[Qbgr[ƃfvXXeVr[̐ݒ 
 	g_pDeviceContext->OMSetRenderTargets(1, &g_pOffscreenRenderTargetView,g_pOffscreenDepthStencilView);
@@ -324,6 +352,32 @@ void Direct3D_SetDepthShadowTexture(int slot)
 	g_pDeviceContext->PSSetShaderResources(slot, 1, &g_pDepthShaderResourceView);
 }
 
+void Direct3D_SetStaticShadowDepth()
+{
+	g_pDeviceContext->RSSetViewports(1, &g_DepthViewport);  // r[|[g̐ݒ
+
+	float clear_color[4] = { 1,1,1,1 };// l
+	g_pDeviceContext->ClearRenderTargetView(g_pStaticDepthRenderTargetView, clear_color);
+	g_pDeviceContext->ClearDepthStencilView(g_pStaticDepthStencilView, D3D11_CLEAR_DEPTH, 1.0f, 0);
+
+	g_pDeviceContext->OMSetRenderTargets(1, &g_pStaticDepthRenderTargetView, g_pStaticDepthStencilView);
+}
+
+void Direct3D_SetShadowDepthFromStatic()
+{
+	// [x}bv̓VF[_[ɎhĂ\̂ŊOĂ珑
+	ID3D11ShaderResourceView* nulls[16] = {};
+	g_pDeviceContext->PSSetShaderResources(0, 16, nulls);
+
+	g_pDeviceContext->RSSetViewports(1, &g_DepthViewport);  // r[|[g̐ݒ
+
+	// NȂɃLbVRs[i[xlƐ[xobt@̗BILX^[̐[xeXgɎgj
+	g_pDeviceContext->CopyResource(g_pDepthBuffer, g_pStaticDepthBuffer);
+	g_pDeviceContext->CopyResource(g_pDepthDepthStencilBuffer, g_pStaticDepthStencilBuffer);
+
+	g_pDeviceContext->OMSetRenderTargets(1, &g_pDepthRenderTargetView, g_pDepthDepthStencilView);
+}
+
 void Direct3D_SetLightViewProjectionMatrix(const DirectX::XMMATRIX& matrix)
 {
 	// 萔obt@i[ps̍\̂`
@@ -332,9 +386,8 @@ void Direct3D_SetLightViewProjectionMatrix(const DirectX::XMMATRIX& matrix)
 	// s]uĒ萔obt@i[psɕϊ
 	XMStoreFloat4x4(&transpose, XMMatrixTranspose(matrix));
 
-	//===================UpdateSubresource̓f[^GPUɓn֐=====================
-	// 萔obt@ɍsZbg
-    g_pDeviceContext->UpdateSubresource(g_pVSConstantBuffer3, 0, nullptr, &transpose, 0, 0);
+	// 萔obt@ɍsZbgiCgȂΑȂj
+	ConstantRing_UpdateCached(g_pVSConstantBuffer3, &g_VSConstantCache3, &transpose, sizeof(transpose));
 
 	// 萔obt@(VS)`pCvCɐݒ
 	// 3D VS  b3 g
@@ -657,6 +710,12 @@ bool configureDepthBackBuffer()
 	depth_stencil_view_desc.Flags = 0;
 	g_pDevice->CreateDepthStencilView(g_pDepthDepthStencilBuffer, &depth_stencil_view_desc, &g_pDepthDepthStencilView);
 
+	// ÓILX^[pLbViSRV͕svBt[̃obt@փRs[Ďgj
+	g_pDevice->CreateTexture2D(&g_DepthDesc, nullptr, &g_pStaticDepthBuffer);
+	g_pDevice->CreateRenderTargetView(g_pStaticDepthBuffer, nullptr, &g_pStaticDepthRenderTargetView);
+	g_pDevice->CreateTexture2D(&depth_stencil_desc, nullptr, &g_pStaticDepthStencilBuffer);
+	g_pDevice->CreateDepthStencilView(g_pStaticDepthStencilBuffer, &depth_stencil_view_desc, &g_pStaticDepthStencilView);
+
 
 
 	// r[|[g̐ݒ
@@ -673,6 +732,7 @@ bool configureDepthBackBuffer()
 	buffer_desc.ByteWidth = sizeof(XMFLOAT4X4); // obt@̃TCY
 	buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER; // oChtO
 	g_pDevice->CreateBuffer(&buffer_desc, nullptr, &g_pVSConstantBuffer3);
+	g_VSConstantCache3.valid = false;
 
 	//g_pDeviceContext->RSSetViewports(1, &g_OffscreenViewport);  // r[|[g̐ݒ
 
@@ -687,6 +747,10 @@ void releaseDepthBackBuffer()
 	SAFE_RELEASE(g_pDepthShaderResourceView)
     SAFE_RELEASE(g_pDepthDepthStencilBuffer);
 	SAFE_RELEASE(g_pDepthDepthStencilView);
+	SAFE_RELEASE(g_pStaticDepthBuffer);
+	SAFE_RELEASE(g_pStaticDepthRenderTargetView);
+	SAFE_RELEASE(g_pStaticDepthStencilBuffer);
+	SAFE_RELEASE(g_pStaticDepthStencilView);
 	SAFE_RELEASE(g_pVSConstantBuffer3);
 }
 
@@ -96,7 +96,7 @@ void Direct3D_SetBackBuffer();
 //obNobtÃNA
 void Direct3D_ClearOffscreen();
 
-//eNX`ւ̃_Oɐ؂ւ
+//eNX`ւ̃_Oɐ؂ւiNA͂Ȃj
 void Direct3D_SetOffscreen();
 
 //ItXN[_OeNX`̐ݒ
@@ -111,6 +111,12 @@ void Direct3D_SetShadowDepth();
 //[xobtA_OeNX`̐ݒ
 void Direct3D_SetDepthShadowTexture(int slot);
 
+//ÓILX^[p̐[xobt@iLbVj̃_Oɐ؂ւiNA݁j
+void Direct3D_SetStaticShadowDepth();
+
+//LbVÓI[x[xobt@փRs[āÂ܂ܓILX^[d˕`łԂɂ
+void Direct3D_SetShadowDepthFromStatic();
+
 //Cgr[vWFNVs̒萔obt@ւ̓o^Ɛݒ
 void Direct3D_SetLightViewProjectionMatrix(const DirectX::XMMATRIX & matrix);
 
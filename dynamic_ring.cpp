@@ -0,0 +1,162 @@
+/*==============================================================================
+
+@@@ꎞWIgp̓Iobt@O[dynamic_ring.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "dynamic_ring.h"
+#include "frame_ring.h"
+#include "direct3d.h"
+#include "render_stats.h"
+#include "debug_ostream.h"
+
+namespace
+{
+    enum RingKind
+    {
+        RING_VERTEX,
+        RING_INDEX,
+        RING_MAX
+    };
+
+    constexpr UINT kInitialBytes[RING_MAX] = {
+        4 * 1024 * 1024, // _
+        1 * 1024 * 1024, // CfbNX
+    };
+    constexpr UINT kBindFlags[RING_MAX] = {
+        D3D11_BIND_VERTEX_BUFFER,
+        D3D11_BIND_INDEX_BUFFER,
+    };
+    constexpr UINT kAlignment = 16;
+
+    struct Ring
+    {
+        ID3D11Buffer* buffer = nullptr;
+        FrameRing     alloc;
+    };
+
+    // ӁIŊOݒ肳́BReleasesvB
+    ID3D11Device* g_pDevice = nullptr;
+    ID3D11DeviceContext* g_pContext = nullptr;
+
+    Ring g_rings[RING_MAX];
+
+    bool CreateRingBuffer(int kind, UINT bytes)
+    {
+        D3D11_BUFFER_DESC bd{};
+        bd.Usage = D3D11_USAGE_DYNAMIC;
+        bd.ByteWidth = bytes;
+        bd.BindFlags = kBindFlags[kind];
+        bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+        ID3D11Buffer* buffer = nullptr;
+        if (FAILED(g_pDevice->CreateBuffer(&bd, nullptr, &buffer)))
+        {
+            hal::dout << "DynamicRing : obt@̐Ɏs܂ (" << bytes << " bytes)" << std::endl;
+            return false;
+        }
+
+        // ÂQƂĂ`R}hD3DQƂĂ̂ŁAŎĂ悢
+        SAFE_RELEASE(g_rings[kind].buffer);
+        g_rings[kind].buffer = buffer;
+        g_rings[kind].alloc.Reset(bytes);
+        return true;
+    }
+
+    bool MapRing(int kind, UINT bytes, DynamicRingSpan* out)
+    {
+        if (!out || !g_pContext || bytes == 0) return false;
+
+        Ring& ring = g_rings[kind];
+        if (!ring.buffer) return false;
+
+        // 1Ŏ܂ȂTCYȂ蒼čL
+        if (bytes > ring.alloc.Capacity())
+        {
+            UINT newBytes = ring.alloc.Capacity();
+            while (newBytes < bytes) newBytes *= 2;
+            hal::dout << "DynamicRing : Og܂ " << ring.alloc.Capacity() << " -> " << newBytes << std::endl;
+            if (!CreateRingBuffer(kind, newBytes)) return false;
+        }
+
+        FrameRing::Allocation a;
+        if (!ring.alloc.Allocate(bytes, kAlignment, &a)) return false;
+
+        D3D11_MAPPED_SUBRESOURCE msr{};
+        const D3D11_MAP mapType = a.discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+        if (FAILED(g_pContext->Map(ring.buffer, 0, mapType, 0, &msr)))
+        {
+            return false;
+        }
+
+        out->buffer = ring.buffer;
+        out->offset = a.offset;
+        out->data = static_cast<uint8_t*>(msr.pData) + a.offset;
+        out->generation = a.generation;
+        out->ring = kind;
+        RenderStats_AddCounter(RENDER_STATS_GEOMETRY_BYTES, bytes);
+        return true;
+    }
+}
+
+bool DynamicRing_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
+{
+    if (!pDevice || !pContext) {
+        hal::dout << "DynamicRing_Initialize() : ^ꂽfoCXReLXgsł" << std::endl;
+        return false;
+    }
+
+    g_pDevice = pDevice;
+    g_pContext = pContext;
+
+    for (int i = 0; i < RING_MAX; ++i)
+    {
+        if (!CreateRingBuffer(i, kInitialBytes[i])) return false;
+    }
+    return true;
+}
+
+void DynamicRing_Finalize()
+{
+    for (auto& ring : g_rings)
+    {
+        SAFE_RELEASE(ring.buffer);
+        ring.alloc.Reset(0);
+    }
+    g_pDevice = nullptr;
+    g_pContext = nullptr;
+}
+
+void DynamicRing_BeginFrame()
+{
+    for (auto& ring : g_rings)
+    {
+        ring.alloc.BeginFrame();
+    }
+}
+
+bool DynamicRing_MapVertices(UINT bytes, DynamicRingSpan* out)
+{
+    return MapRing(RING_VERTEX, bytes, out);
+}
+
+bool DynamicRing_MapIndices(UINT bytes, DynamicRingSpan* out)
+{
+    return MapRing(RING_INDEX, bytes, out);
+}
+
+void DynamicRing_Unmap(const DynamicRingSpan& span)
+{
+    if (!g_pContext || !span.buffer) return;
+    g_pContext->Unmap(span.buffer, 0);
+}
+
+bool DynamicRing_IsValid(const DynamicRingSpan& span)
+{
+    if (span.ring < 0 || span.ring >= RING_MAX) return false;
+
+    const Ring& ring = g_rings[span.ring];
+    return span.buffer == ring.buffer && span.generation == ring.alloc.Generation();
+}
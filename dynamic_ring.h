@@ -0,0 +1,53 @@
+/*==============================================================================
+
+@@@ꎞWIgp̓Iobt@O[dynamic_ring.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    XvCgEr{[hEfobO`EXLbVȂǁAt[
+    钸_/CfbNX͂؂oB
+    `悲Ƃ WRITE_DISCARD ƃhCoobt@ւ̂ŁA
+    傫ȃobt@1{ NO_OVERWRITE ŋl߂ĂADISCARD ̓t[ɂB
+
+    gF
+        DynamicRingSpan span;
+        if (DynamicRing_MapVertices(bytes, &span)) {
+            // span.data ɏ
+            DynamicRing_Unmap(span);
+            // span.buffer  span.offset ŃoChĕ`
+        }
+
+    mۂ͎̈ DynamicRing_BeginFrame() ܂ŁieʕsŐ擪ɖ߂
+    ꍇ͂܂ŁjLBt[܂Ŏg񂷂Ȃ DynamicRing_IsValid ŊmFB
+
+==============================================================================*/
+#ifndef DYNAMIC_RING_H
+#define DYNAMIC_RING_H
+
+#include <d3d11.h>
+#include <cstdint>
+
+struct DynamicRingSpan
+{
+    ID3D11Buffer* buffer = nullptr; // oChpiLȂj
+    UINT          offset = 0;       // obt@擪̃oCgʒu
+    void*         data = nullptr;   // Map̏ݐiUnmap͎gȂj
+    uint32_t      generation = 0;
+    int           ring = -1;        // _/CfbNXǂ̃O
+};
+
+bool DynamicRing_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
+void DynamicRing_Finalize();
+
+// 1t[1iPresentjB̊mۂ DISCARD ŐV̈ɂȂ
+void DynamicRing_BeginFrame();
+
+bool DynamicRing_MapVertices(UINT bytes, DynamicRingSpan* out);
+bool DynamicRing_MapIndices(UINT bytes, DynamicRingSpan* out);
+void DynamicRing_Unmap(const DynamicRingSpan& span);
+
+// ܂gcĂ邩iȍ~̕`ŃoChĂ悢j
+bool DynamicRing_IsValid(const DynamicRingSpan& span);
+
+#endif // DYNAMIC_RING_H
@@ -11,6 +11,14 @@
 #include "stage01_manage.h"
 #include "stage_cube.h"
 #include "player.h"
+#include "render_stats.h"
+#include "map_pass.h"
+#include "constant_ring.h"
+#include "occlusion_buffer.h"
+#include "texture.h"
+#include "model.h"
+#include "model_skinned_fixed.h"
+#include "shadow_cache.h"
 #include <cstdio>
 #include<algorithm>
 #include <sstream>
@@ -614,6 +622,115 @@ static void MotionLab_Draw(double dt)
     ImGui::End();
 }
 
+static void FrameStats_Draw()
+{
+    if (!ImGui::Begin("Frame Stats"))
+    {
+        ImGui::End();
+        return;
+    }
+
+    // 1t[ÕpXƂCPUԁiR}hs܂ŁBGPUԂł͂Ȃj
+    if (ImGui::BeginTable("passes", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Pass");
+        ImGui::TableSetupColumn("CPU ms");
+        ImGui::TableSetupColumn("Run");
+        ImGui::TableSetupColumn("Skip");
+        ImGui::TableHeadersRow();
+
+        for (int i = 0; i < RENDER_STATS_PASS_MAX; ++i)
+        {
+            const RenderStatsPass pass = (RenderStatsPass)i;
+            const RenderStatsPassInfo& info = RenderStats_GetPass(pass);
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0); ImGui::TextUnformatted(RenderStats_GetPassName(pass));
+            ImGui::TableSetColumnIndex(1); ImGui::Text("%.3f", info.cpuMs);
+            ImGui::TableSetColumnIndex(2); ImGui::Text("%d", info.runCount);
+            ImGui::TableSetColumnIndex(3); ImGui::Text("%d", info.skipCount);
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::Separator();
+    ImGui::Text("Uploads");
+
+    for (int i = 0; i < RENDER_STATS_COUNTER_MAX; ++i)
+    {
+        const RenderStatsCounter c = (RenderStatsCounter)i;
+        ImGui::Text("%s: %llu", RenderStats_GetCounterName(c), RenderStats_GetCounter(c));
+    }
+
+    const unsigned long long blocks = RenderStats_GetCounter(RENDER_STATS_BLOCKS_DRAWN);
+    if (blocks > 0)
+    {
+        ImGui::Text("Constant bytes / block: %.1f",
+            (double)RenderStats_GetCounter(RENDER_STATS_CONSTANT_BYTES) / (double)blocks);
+    }
+    ImGui::Text("Constant ring: %s", ConstantRing_IsSupported() ? "offset binding" : "fallback (UpdateSubresource)");
+
+    ImGui::Separator();
+    ImGui::Text("Textures");
+    ImGui::Text("Resident: %d (%.2f MB)", Texture_GetResidentCount(),
+        (double)Texture_GetResidentBytes() / (1024.0 * 1024.0));
+    ImGui::Text("Pending uploads: %d", Texture_GetPendingCount());
+
+    ImGui::Separator();
+    ImGui::Text("Models");
+    ImGui::Text("Resident: %d (unused %d, %.2f MB)", Model_GetResidentCount(), Model_GetUnusedCount(),
+        (double)Model_GetResidentBytes() / (1024.0 * 1024.0));
+    ImGui::Text("Skinned: %d (%.2f MB)", SkinnedModel_GetResidentCount(),
+        (double)SkinnedModel_GetResidentBytes() / (1024.0 * 1024.0));
+    ImGui::Text("Skinned instances: %d (%.1f KB)", SkinnedModel_GetInstanceCount(),
+        (double)SkinnedModel_GetInstanceBytes() / 1024.0);
+
+    ImGui::Separator();
+    ImGui::Text("Culling");
+
+    bool occlusion = Stage01_IsOcclusionCulling();
+    if (ImGui::Checkbox("Occlusion culling", &occlusion))
+        Stage01_SetOcclusionCulling(occlusion);
+
+    const OcclusionBuffer& ob = Stage01_GetOcclusionBuffer();
+    ImGui::Text("Occluders: %d (%d faces, %dx%d)", ob.OccluderCount(), ob.FaceCount(), ob.Width(), ob.Height());
+
+    ImGui::Separator();
+    ImGui::Text("Shadows");
+
+    bool blockShadows = ShadowCache_GetMode() == SHADOW_MODE_CACHED_STATIC;
+    if (ImGui::Checkbox("Stage blocks cast shadows", &blockShadows))
+        ShadowCache_SetMode(blockShadows ? SHADOW_MODE_CACHED_STATIC : SHADOW_MODE_DYNAMIC_ONLY);
+    ImGui::Text("Static bakes: %u", ShadowCache_GetStaticBakeCount());
+
+    ImGui::Separator();
+    ImGui::Text("Map Pass");
+
+    static const char* kPolicyNames[] = { "Every Frame", "Every Nth Frame", "Time Budget", "On Change" };
+    int policy = (int)MapPass_GetPolicy();
+    if (ImGui::Combo("Policy", &policy, kPolicyNames, IM_ARRAYSIZE(kPolicyNames)))
+        MapPass_SetPolicy((PassScheduler::Policy)policy);
+
+    int interval = MapPass_GetFrameInterval();
+    if (ImGui::SliderInt("Every N", &interval, 1, 30))
+        MapPass_SetFrameInterval(interval);
+
+    float budget = MapPass_GetBudgetMsPerSecond();
+    if (ImGui::DragFloat("Budget ms/s", &budget, 0.5f, 0.0f, 1000.0f, "%.1f"))
+        MapPass_SetBudgetMsPerSecond(budget);
+
+    const PassScheduler& s = MapPass_GetScheduler();
+    ImGui::Text("Last cost: %.3f ms", s.LastCostMs());
+    ImGui::Text("Frames since run: %d", s.FramesSinceRun());
+    ImGui::Text("Total run / skip: %llu / %llu",
+        (unsigned long long)s.RunCount(), (unsigned long long)s.SkipCount());
+
+    if (ImGui::Button("Redraw Now"))
+        MapPass_Invalidate();
+
+    ImGui::End();
+}
+
 void PlayerUI_Draw()
 {
     if (!ImGui::Begin("Player Tuning"))
@@ -1044,6 +1161,8 @@ void EditorUI_Draw(double elapsedTime)
     PlayerUI_Draw();
 
     MotionLab_Draw(elapsedTime);
+
+    FrameStats_Draw();
 }
 
 void BuildStage01Cpp(std::string& out)
@@ -0,0 +1,196 @@
+/*==============================================================================
+
+@@@bVtB[h̃^CLOD[field_tiles.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "field_tiles.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+    constexpr int kMaxTileCells = 128;  // (128+1)^2 _Ȃ16bitɎ܂
+    constexpr float kTileThickness = 0.5f; // ȃ^C̔Ɏ݁i㉺ꂼj
+
+    int FloorPow2(int v)
+    {
+        int p = 1;
+        while (p * 2 <= v) p *= 2;
+        return p;
+    }
+
+    int Log2(int pow2)
+    {
+        int n = 0;
+        while ((1 << n) < pow2) ++n;
+        return n;
+    }
+}
+
+void FieldTileGrid::Setup(const FieldTileDesc& desc)
+{
+    m_desc = desc;
+    m_desc.tileCells = FloorPow2(std::max(2, std::min(desc.tileCells, kMaxTileCells)));
+    // 1ieׂ̊Ԋu^CɎ܂Ƃ܂
+    m_desc.lodCount = std::max(1, std::min(desc.lodCount, Log2(m_desc.tileCells)));
+    m_desc.lodDistance = std::max(desc.lodDistance, 0.001f);
+
+    m_tilesX = std::max(1, (desc.cellsX + m_desc.tileCells - 1) / m_desc.tileCells);
+    m_tilesZ = std::max(1, (desc.cellsZ + m_desc.tileCells - 1) / m_desc.tileCells);
+    m_desc.cellsX = m_tilesX * m_desc.tileCells;
+    m_desc.cellsZ = m_tilesZ * m_desc.tileCells;
+
+    m_lods.assign(m_tilesX * m_tilesZ, 0);
+    m_bounds.assign(m_tilesX * m_tilesZ, FieldTileBounds{});
+    m_visible.clear();
+}
+
+void FieldTileGrid::SelectUnculled(const float eye[3], const float world[4][4])
+{
+    const int tileCount = m_tilesX * m_tilesZ;
+    const float size = TileSize();
+    m_lods.assign(tileCount, 0);
+    m_visible.clear();
+
+    m_bounds.resize(tileCount);
+
+    // ^C̔i[hjƃJ̋ LOD ߂
+    for (int tz = 0; tz < m_tilesZ; ++tz)
+    {
+        for (int tx = 0; tx < m_tilesX; ++tx)
+        {
+            const int t = tx + tz * m_tilesX;
+            float* mn = m_bounds[t].min;
+            float* mx = m_bounds[t].max;
+            std::fill(mn, mn + 3, FLT_MAX);
+            std::fill(mx, mx + 3, -FLT_MAX);
+
+            for (int c = 0; c < 8; ++c)
+            {
+                const float lx = (tx + ((c & 1) ? 1 : 0)) * size;
+                const float ly = (c & 2) ? kTileThickness : -kTileThickness;
+                const float lz = (tz + ((c & 4) ? 1 : 0)) * size;
+                for (int k = 0; k < 3; ++k)
+                {
+                    const float w = lx * world[0][k] + ly * world[1][k] + lz * world[2][k] + world[3][k];
+                    mn[k] = std::min(mn[k], w);
+                    mx[k] = std::max(mx[k], w);
+                }
+            }
+
+            float d2 = 0.0f;
+            for (int k = 0; k < 3; ++k)
+            {
+                const float dk = std::max({ mn[k] - eye[k], 0.0f, eye[k] - mx[k] });
+                d2 += dk * dk;
+            }
+            const float d = std::sqrt(d2);
+
+            int lod = 0;
+            if (d >= m_desc.lodDistance)
+            {
+                lod = 1 + (int)std::floor(std::log2(d / m_desc.lodDistance));
+            }
+            m_lods[t] = std::min(lod, m_desc.lodCount - 1);
+        }
+    }
+
+    // ׂƂ̍1i܂łɂiׂɍ킹j
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (int tz = 0; tz < m_tilesZ; ++tz)
+        {
+            for (int tx = 0; tx < m_tilesX; ++tx)
+            {
+                int& lod = m_lods[tx + tz * m_tilesX];
+                int limit = lod;
+                if (tx > 0)             limit = std::min(limit, m_lods[tx - 1 + tz * m_tilesX] + 1);
+                if (tx < m_tilesX - 1)  limit = std::min(limit, m_lods[tx + 1 + tz * m_tilesX] + 1);
+                if (tz > 0)             limit = std::min(limit, m_lods[tx + (tz - 1) * m_tilesX] + 1);
+                if (tz < m_tilesZ - 1)  limit = std::min(limit, m_lods[tx + (tz + 1) * m_tilesX] + 1);
+                if (limit < lod)
+                {
+                    lod = limit;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    // eׂƖD킹ӂtĕׂiōî Selectj
+    for (int tz = 0; tz < m_tilesZ; ++tz)
+    {
+        for (int tx = 0; tx < m_tilesX; ++tx)
+        {
+            const int t = tx + tz * m_tilesX;
+            const int lod = m_lods[t];
+            unsigned stitch = 0;
+            if (tx > 0 && m_lods[t - 1] > lod)                      stitch |= FIELD_TILE_STITCH_NEG_X;
+            if (tx < m_tilesX - 1 && m_lods[t + 1] > lod)           stitch |= FIELD_TILE_STITCH_POS_X;
+            if (tz > 0 && m_lods[t - m_tilesX] > lod)               stitch |= FIELD_TILE_STITCH_NEG_Z;
+            if (tz < m_tilesZ - 1 && m_lods[t + m_tilesX] > lod)    stitch |= FIELD_TILE_STITCH_POS_Z;
+
+            m_visible.push_back({ tx, tz, lod, stitch });
+        }
+    }
+}
+
+void FieldTileGrid::SelectAll()
+{
+    m_lods.assign(m_tilesX * m_tilesZ, 0);
+    m_visible.clear();
+    for (int tz = 0; tz < m_tilesZ; ++tz)
+    {
+        for (int tx = 0; tx < m_tilesX; ++tx)
+        {
+            m_visible.push_back({ tx, tz, 0, 0u });
+        }
+    }
+}
+
+void FieldTileGrid::BuildIndices(int tileCells, int lod, unsigned stitch, std::vector<uint16_t>* out)
+{
+    out->clear();
+
+    const int step = 1 << lod;
+    const int n = tileCells / step;
+    const int pitch = tileCells + 1;
+
+    // D킹ӂ̏ŁAeׂɖ_istep ̊{jO̒_Ɋ񂹂
+    auto vertex = [&](int x, int z) -> uint16_t
+    {
+        if ((stitch & FIELD_TILE_STITCH_NEG_Z) && z == 0         && ((x / step) & 1)) x -= step;
+        if ((stitch & FIELD_TILE_STITCH_POS_Z) && z == tileCells && ((x / step) & 1)) x -= step;
+        if ((stitch & FIELD_TILE_STITCH_NEG_X) && x == 0         && ((z / step) & 1)) z -= step;
+        if ((stitch & FIELD_TILE_STITCH_POS_X) && x == tileCells && ((z / step) & 1)) z -= step;
+        return (uint16_t)(x + z * pitch);
+    };
+
+    auto triangle = [out](uint16_t a, uint16_t b, uint16_t c)
+    {
+        if (a == b || b == c || c == a) return; // 񂹂Ēׂꂽ
+        out->push_back(a);
+        out->push_back(b);
+        out->push_back(c);
+    };
+
+    out->reserve((size_t)n * n * 6);
+    for (int j = 0; j < n; ++j)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            const int x0 = i * step, x1 = x0 + step;
+            const int z0 = j * step, z1 = z0 + step;
+
+            // ̃tB[hƓ
+            triangle(vertex(x0, z0), vertex(x1, z1), vertex(x1, z0));
+            triangle(vertex(x0, z0), vertex(x0, z1), vertex(x1, z1));
+        }
+    }
+}
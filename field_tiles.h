@@ -0,0 +1,106 @@
+/*==============================================================================
+
+@@@bVtB[h̃^CLOD[field_tiles.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    tB[h tileCells ~ tileCells }X̃^CɕA
+    ^CƂɎJOƋłLODiԈj߂B
+    LOD 1ieׂƂ́Aڂ̊Ԗڂ̒_ԖڂɊ񂹂āiD킹āj
+    ŤԂłȂ悤ɂBׂǂLOD̍1i܂łɂ낦B
+
+    ǂ̃^C (tileCells+1)^2 _̃ObhĝŁA
+    CfbNX16bit̂܂܁AtB[hŜ̑傫ɂ͏ȂB
+    D3D ɈˑȂ̂ŃQ[OłBLOD ̑Iѕ BuildIndices 
+    DirectXMath gȂiōi Select  field_tiles_cull.cppjB
+
+==============================================================================*/
+#ifndef FIELD_TILES_H
+#define FIELD_TILES_H
+
+#include <cstdint>
+#include <vector>
+
+struct Frustum;
+namespace DirectX
+{
+    struct XMFLOAT3;
+    struct XMFLOAT4X4;
+}
+
+struct FieldTileDesc
+{
+    int   cellsX = 160;         // }XitileCells ̔{ɐ؂グj
+    int   cellsZ = 160;
+    float cellSize = 1.0f;      // 1}X̕
+    int   tileCells = 32;       // 1^C̃}Xi2̗ݏA255ȉj
+    int   lodCount = 4;         // LOD ̒ii0 ԍׂj
+    float lodDistance = 24.0f;  // 艓 LOD 1A̔{ LOD 2 ...
+};
+
+// ׂ̃^C1ieӁiD킹Ӂj
+enum FieldTileStitch
+{
+    FIELD_TILE_STITCH_NEG_X = 1 << 0,
+    FIELD_TILE_STITCH_POS_X = 1 << 1,
+    FIELD_TILE_STITCH_NEG_Z = 1 << 2,
+    FIELD_TILE_STITCH_POS_Z = 1 << 3,
+
+    FIELD_TILE_STITCH_VARIANTS = 1 << 4
+};
+
+// ^C̔i[hjBȃ^Cɂ㉺ɏ݂
+struct FieldTileBounds
+{
+    float min[3];
+    float max[3];
+};
+
+struct FieldTileDraw
+{
+    int tileX;
+    int tileZ;
+    int lod;
+    unsigned stitch;    // FieldTileStitch ̑gݍ킹
+};
+
+class FieldTileGrid
+{
+public:
+    void Setup(const FieldTileDesc& desc);
+
+    const FieldTileDesc& Desc() const { return m_desc; }
+    int TilesX() const { return m_tilesX; }
+    int TilesZ() const { return m_tilesZ; }
+    int LodCount() const { return m_desc.lodCount; }
+    float TileSize() const { return m_desc.tileCells * m_desc.cellSize; }
+
+    // world ̓tB[hŚi_}X(0,0)j̕ϊBfrustum  nullptr ȂSĂ鈵
+    void Select(const DirectX::XMFLOAT3& eye, const Frustum* frustum, const DirectX::XMFLOAT4X4& world);
+    // Ȃ SelectBS^C LOD ƖD킹߂ĕׂiworld ͍sxNg4x4j
+    void SelectUnculled(const float eye[3], const float world[4][4]);
+    // JȂpBS^C LOD 0 
+    void SelectAll();
+
+    // O Select ̌ʁiĂ^Cj
+    const std::vector<FieldTileDraw>& Visible() const { return m_visible; }
+    int CulledCount() const { return m_tilesX * m_tilesZ - (int)m_visible.size(); }
+
+    // O Select Ō߂^C LOD ƔiĂȂ^Cj
+    int Lod(int tileX, int tileZ) const { return m_lods[tileX + tileZ * m_tilesX]; }
+    const FieldTileBounds& Bounds(int tileX, int tileZ) const { return m_bounds[tileX + tileZ * m_tilesX]; }
+
+    // 1^C̒_Obhix + z * (tileCells+1)jł̎Op`XgBD킹ŒׂꂽOp`͓Ȃ
+    static void BuildIndices(int tileCells, int lod, unsigned stitch, std::vector<uint16_t>* out);
+
+private:
+    FieldTileDesc m_desc;
+    int m_tilesX = 0;
+    int m_tilesZ = 0;
+    std::vector<int> m_lods;
+    std::vector<FieldTileBounds> m_bounds;
+    std::vector<FieldTileDraw> m_visible;
+};
+
+#endif // FIELD_TILES_H
@@ -0,0 +1,30 @@
+/*==============================================================================
+
+@@@bVtB[h̃^C̎JO[field_tiles_cull.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    FieldTileGrid ̂ DirectXMath ƎgƂ낾B
+    LOD ƖD킹 field_tiles.cpp  SelectUnculled Ō߂āAł
+    Ȃ^CтOɂiLOD ͌Ȃ^C܂߂Č߂܂܁jB
+
+==============================================================================*/
+#include "field_tiles.h"
+#include "frustum.h"
+#include <algorithm>
+
+void FieldTileGrid::Select(const DirectX::XMFLOAT3& eye, const Frustum* frustum, const DirectX::XMFLOAT4X4& world)
+{
+    const float eyePos[3] = { eye.x, eye.y, eye.z };
+    SelectUnculled(eyePos, world.m);
+    if (!frustum) return;
+
+    m_visible.erase(std::remove_if(m_visible.begin(), m_visible.end(), [&](const FieldTileDraw& tile)
+    {
+        const FieldTileBounds& b = Bounds(tile.tileX, tile.tileZ);
+        const DirectX::XMFLOAT3 mn(b.min[0], b.min[1], b.min[2]);
+        const DirectX::XMFLOAT3 mx(b.max[0], b.max[1], b.max[2]);
+        return !Frustum_IntersectsAabb(*frustum, mn, mx);
+    }), m_visible.end());
+}
@@ -0,0 +1,228 @@
+/*==============================================================================
+
+@@@tB[h̃^CLOD̃`FbN[field_tiles_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D  DirectXMath Ȃőg߂B
+        g++ -std=c++17 field_tiles_test.cpp field_tiles.cpp
+    Setup ̐؂グAł LODAׂƂ̍1i܂ŁAD킹ӁA
+    BuildIndices ̎Op`i͈͓AׂȂAD킹ӂ͑e_jB
+    ōi Selectifield_tiles_cull.cppj͂ł͌ȂB
+
+==============================================================================*/
+#include "field_tiles.h"
+#include "test_check.h"
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    const float kIdentity[4][4] = {
+        { 1.0f, 0.0f, 0.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+        { 0.0f, 0.0f, 1.0f, 0.0f },
+        { 0.0f, 0.0f, 0.0f, 1.0f },
+    };
+
+    // т̒ (tx,tz) T
+    const FieldTileDraw* FindDraw(const FieldTileGrid& grid, int tx, int tz)
+    {
+        for (const FieldTileDraw& d : grid.Visible())
+        {
+            if (d.tileX == tx && d.tileZ == tz) return &d;
+        }
+        return nullptr;
+    }
+
+    // ׂǂ̍1i܂ŁAD킹̈󂪂傤ǑêׂƂAS^C1񂸂
+    bool CheckNeighbours(const FieldTileGrid& grid)
+    {
+        if ((int)grid.Visible().size() != grid.TilesX() * grid.TilesZ()) return false;
+        for (int tz = 0; tz < grid.TilesZ(); ++tz)
+        {
+            for (int tx = 0; tx < grid.TilesX(); ++tx)
+            {
+                const FieldTileDraw* d = FindDraw(grid, tx, tz);
+                if (!d || d->lod != grid.Lod(tx, tz)) return false;
+
+                const struct { int dx, dz; unsigned flag; } sides[] = {
+                    { -1, 0, FIELD_TILE_STITCH_NEG_X }, { 1, 0, FIELD_TILE_STITCH_POS_X },
+                    { 0, -1, FIELD_TILE_STITCH_NEG_Z }, { 0, 1, FIELD_TILE_STITCH_POS_Z },
+                };
+                for (const auto& s : sides)
+                {
+                    const int nx = tx + s.dx, nz = tz + s.dz;
+                    const bool inside = nx >= 0 && nx < grid.TilesX() && nz >= 0 && nz < grid.TilesZ();
+                    const int nlod = inside ? grid.Lod(nx, nz) : d->lod;
+                    if (std::abs(nlod - d->lod) > 1) return false;
+                    if (((d->stitch & s.flag) != 0) != (nlod > d->lod)) return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // _ԍ͈͓AׂꂽOp`ȂAD킹ӂɑeׂɖ_gĂȂ
+    bool CheckIndices(int tileCells, int lod, unsigned stitch, const std::vector<uint16_t>& idx)
+    {
+        const int pitch = tileCells + 1;
+        const int coarse = 2 << lod;    // 1ieׂ̒_Ԋu
+        if (idx.size() % 3) return false;
+        for (size_t i = 0; i < idx.size(); i += 3)
+        {
+            if (idx[i] == idx[i + 1] || idx[i + 1] == idx[i + 2] || idx[i + 2] == idx[i]) return false;
+            for (size_t k = i; k < i + 3; ++k)
+            {
+                if (idx[k] >= pitch * pitch) return false;
+                const int x = idx[k] % pitch, z = idx[k] / pitch;
+                if ((stitch & FIELD_TILE_STITCH_NEG_X) && x == 0         && z % coarse) return false;
+                if ((stitch & FIELD_TILE_STITCH_POS_X) && x == tileCells && z % coarse) return false;
+                if ((stitch & FIELD_TILE_STITCH_NEG_Z) && z == 0         && x % coarse) return false;
+                if ((stitch & FIELD_TILE_STITCH_POS_Z) && z == tileCells && x % coarse) return false;
+            }
+        }
+        return true;
+    }
+
+    // Op`̖ʐρixzA}XPʁj̍vBD킹Ă1^CԂ̂܂
+    long long TwiceArea(int tileCells, const std::vector<uint16_t>& idx)
+    {
+        const int pitch = tileCells + 1;
+        long long sum = 0;
+        for (size_t i = 0; i < idx.size(); i += 3)
+        {
+            const int ax = idx[i] % pitch, az = idx[i] / pitch;
+            const int bx = idx[i + 1] % pitch, bz = idx[i + 1] / pitch;
+            const int cx = idx[i + 2] % pitch, cz = idx[i + 2] / pitch;
+            sum += std::llabs((long long)(bx - ax) * (cz - az) - (long long)(bz - az) * (cx - ax));
+        }
+        return sum;
+    }
+}
+
+int main()
+{
+    // Setup : ^C̃}X2̗ݏALOD ̒i̓^CɎ܂܂ŁA}X̓^C̔{ɐ؂グ
+    {
+        FieldTileDesc desc;
+        desc.cellsX = 100;
+        desc.cellsZ = 33;
+        desc.tileCells = 48;
+        desc.lodCount = 9;
+        FieldTileGrid grid;
+        grid.Setup(desc);
+        TestCheck_True(grid.Desc().tileCells == 32, "tileCells rounds down to a power of two");
+        TestCheck_True(grid.LodCount() == 5, "lodCount is clamped to log2(tileCells)");
+        TestCheck_True(grid.TilesX() == 4 && grid.TilesZ() == 2, "tile count rounds up");
+        TestCheck_True(grid.Desc().cellsX == 128 && grid.Desc().cellsZ == 64, "cells round up to whole tiles");
+
+        desc.tileCells = 1000;
+        grid.Setup(desc);
+        TestCheck_True(grid.Desc().tileCells == 128, "tileCells is clamped to 128");
+        desc.tileCells = 1;
+        grid.Setup(desc);
+        TestCheck_True(grid.Desc().tileCells == 2 && grid.LodCount() == 1, "tileCells is at least 2");
+    }
+
+    // 1̃^Cł̋ LODFlodDistance  0A̐2{Ƃ1iAlodCount-1 Ŏ~܂
+    {
+        FieldTileDesc desc;
+        desc.cellsX = 16 * 8;
+        desc.cellsZ = 8;
+        desc.cellSize = 1.0f;
+        desc.tileCells = 8;
+        desc.lodCount = 3;
+        desc.lodDistance = 10.0f;
+        FieldTileGrid grid;
+        grid.Setup(desc);
+
+        // ڂ̓^C0̐^񒆁B^C ti1ȏj̔܂ł̋ 8t-4
+        const float eye[3] = { 4.0f, 0.0f, 4.0f };
+        grid.SelectUnculled(eye, kIdentity);
+        const int expected[16] = { 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
+        bool ok = true;
+        for (int t = 0; t < 16; ++t) ok = ok && grid.Lod(t, 0) == expected[t];
+        TestCheck_True(ok, "lod steps at lodDistance and doubles, clamped to lodCount-1");
+        TestCheck_True(CheckNeighbours(grid), "row: neighbours differ by one and stitch flags match");
+
+        const FieldTileBounds& b = grid.Bounds(3, 0);
+        TestCheck_True(b.min[0] == 24.0f && b.max[0] == 32.0f && b.min[1] < 0.0f && b.max[1] > 0.0f,
+                       "tile bounds follow the tile and have thickness");
+    }
+
+    // iȂׂׂƐڂzuF1i܂łɋl߂
+    {
+        FieldTileDesc desc;
+        desc.cellsX = 16 * 16;
+        desc.cellsZ = 16 * 16;
+        desc.tileCells = 16;
+        desc.lodCount = 4;
+        desc.lodDistance = 4.0f;
+        FieldTileGrid grid;
+        grid.Setup(desc);
+
+        const float eye[3] = { 3.0f, 60.0f, 250.0f };   // Ƃ납Âق
+        grid.SelectUnculled(eye, kIdentity);
+        TestCheck_True(CheckNeighbours(grid), "grid from above: neighbours differ by one and stitch flags match");
+
+        // őŜȂ̂ŁAׂ̐ȂΑSԑe
+        int coarsest = 0;
+        for (const FieldTileDraw& d : grid.Visible()) coarsest += d.lod == grid.LodCount() - 1;
+        TestCheck_True(coarsest == grid.TilesX() * grid.TilesZ(), "all tiles coarsest when far above");
+
+        // nʂꂷA^񒆂FׂƂ납O1i
+        const float nearEye[3] = { 128.0f, 0.5f, 128.0f };
+        grid.SelectUnculled(nearEye, kIdentity);
+        TestCheck_True(grid.Lod(8, 8) == 0 && grid.Lod(0, 0) == grid.LodCount() - 1, "centre fine, corner coarse");
+        TestCheck_True(CheckNeighbours(grid), "grid from the centre: neighbours differ by one and stitch flags match");
+
+        // 炵Ċg債 world ł LOD Ă
+        float world[4][4] = {};
+        world[0][0] = world[1][1] = world[2][2] = 2.0f;
+        world[3][0] = -256.0f;
+        world[3][2] = -256.0f;
+        world[3][3] = 1.0f;
+        const float originEye[3] = { 0.0f, 1.0f, 0.0f };
+        grid.SelectUnculled(originEye, world);
+        TestCheck_True(grid.Lod(8, 8) == 0 && grid.Bounds(8, 8).min[0] == 0.0f && grid.Bounds(8, 8).max[0] == 32.0f,
+                       "world transform moves bounds and lod centre");
+        TestCheck_True(CheckNeighbours(grid), "transformed grid: neighbours differ by one and stitch flags match");
+
+        grid.SelectAll();
+        bool allFine = (int)grid.Visible().size() == grid.TilesX() * grid.TilesZ();
+        for (const FieldTileDraw& d : grid.Visible()) allFine = allFine && d.lod == 0 && d.stitch == 0;
+        TestCheck_True(allFine && grid.CulledCount() == 0, "SelectAll gives every tile at lod 0 without stitching");
+    }
+
+    // BuildIndicesFS LOD ~ D킹̑gݍ킹
+    {
+        const int tileCells = 32;
+        const long long fullArea = 2LL * tileCells * tileCells;
+        bool inRange = true;
+        bool areaKept = true;
+        bool countOk = true;
+        std::vector<uint16_t> idx;
+        for (int lod = 0; lod < 5; ++lod)
+        {
+            const int n = tileCells >> lod;
+            for (unsigned stitch = 0; stitch < FIELD_TILE_STITCH_VARIANTS; ++stitch)
+            {
+                FieldTileGrid::BuildIndices(tileCells, lod, stitch, &idx);
+                inRange = inRange && CheckIndices(tileCells, lod, stitch, idx);
+                areaKept = areaKept && TwiceArea(tileCells, idx) == fullArea;
+
+                // D킹ӂƂɁA񂹂_̐in/2jOp`
+                int sides = 0;
+                for (unsigned s = stitch; s; s >>= 1) sides += s & 1;
+                countOk = countOk && (int)idx.size() / 3 == 2 * n * n - sides * (n / 2);
+            }
+        }
+        TestCheck_True(inRange, "indices in range, no degenerate triangles, stitched edges use coarse vertices only");
+        TestCheck_True(areaKept, "every variant covers the whole tile");
+        TestCheck_True(countOk, "each stitched side drops n/2 triangles");
+    }
+
+    return TestCheck_Result();
+}
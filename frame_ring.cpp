@@ -0,0 +1,64 @@
+/*==============================================================================
+
+@@@t[Omۂ̊Ǘ[frame_ring.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "frame_ring.h"
+#include <cassert>
+
+FrameRing::FrameRing(uint32_t capacity)
+{
+    Reset(capacity);
+}
+
+void FrameRing::Reset(uint32_t capacity)
+{
+    m_capacity = capacity;
+    m_head = 0;
+    m_discardPending = true;
+    ++m_generation;
+}
+
+void FrameRing::BeginFrame()
+{
+    // Ot[̊mۂ͂gȂB Map  DISCARD ăhCoɐV̈Ⴄ
+    m_discardPending = true;
+    m_frameBytes = 0;
+    m_frameWrapCount = 0;
+    ++m_generation;
+}
+
+bool FrameRing::Allocate(uint32_t size, uint32_t alignment, Allocation* out)
+{
+    assert(out);
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    if (size == 0 || size > m_capacity)
+    {
+        return false;
+    }
+
+    bool discard = m_discardPending;
+    uint64_t offset = discard ? 0 : ((uint64_t)m_head + alignment - 1) & ~(uint64_t)(alignment - 1);
+
+    if (!discard && offset + size > m_capacity)
+    {
+        // eʕsF擪ɖ߂BGPUǂłO DISCARD ŕʗ̈ɂȂ
+        offset = 0;
+        discard = true;
+        ++m_generation;
+        ++m_frameWrapCount;
+    }
+
+    m_discardPending = false;
+    m_head = (uint32_t)offset + size;
+    m_frameBytes += size;
+
+    out->offset = (uint32_t)offset;
+    out->generation = m_generation;
+    out->discard = discard;
+    return true;
+}
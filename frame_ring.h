@@ -0,0 +1,59 @@
+/*==============================================================================
+
+@@@t[Omۂ̊Ǘ[frame_ring.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    傫ȓIobt@1{擪؂oĂAmۈʒǔvZB
+    D3Dɂ͐GȂ̂ŒP̂œĊmFłiobt@dynamic_ring.cppjB
+
+    Et[̍ŏ̊mۂ DISCARDAȊO NO_OVERWRITE
+    Et[rŗeʂȂȂ擪ɖ߂ DISCARDiwrapj
+    EDISCARD N邽тɐi߂Bオςmیʂ͎gȂ
+
+==============================================================================*/
+#ifndef FRAME_RING_H
+#define FRAME_RING_H
+
+#include <cstdint>
+
+class FrameRing
+{
+public:
+    struct Allocation
+    {
+        uint32_t offset = 0;     // obt@擪̃oCgʒu
+        uint32_t generation = 0; // mێ̐
+        bool     discard = false; // true Ȃ DISCARD  Map 
+    };
+
+    explicit FrameRing(uint32_t capacity = 0);
+
+    // eʂςiobt@蒼jB̊mۂ DISCARD
+    void Reset(uint32_t capacity);
+
+    // t[JnB̊mۂ DISCARD
+    void BeginFrame();
+
+    // alignment  2 ׂ̂Bsize == 0 eʒȂ false
+    bool Allocate(uint32_t size, uint32_t alignment, Allocation* out);
+
+    bool IsValid(const Allocation& allocation) const { return allocation.generation == m_generation; }
+
+    uint32_t Capacity() const { return m_capacity; }
+    uint32_t Head() const { return m_head; }
+    uint32_t Generation() const { return m_generation; }
+    uint32_t FrameBytes() const { return m_frameBytes; }
+    uint32_t FrameWrapCount() const { return m_frameWrapCount; }
+
+private:
+    uint32_t m_capacity = 0;
+    uint32_t m_head = 0;
+    uint32_t m_generation = 0;
+    uint32_t m_frameBytes = 0;      // ̃t[ŊmۂoCg
+    uint32_t m_frameWrapCount = 0;  // ̃t[ŗeʕsɂ擪ɖ߂
+    bool     m_discardPending = true;
+};
+
+#endif // FRAME_RING_H
@@ -0,0 +1,110 @@
+/*==============================================================================
+
+@@@t[Õ`FbN[frame_ring_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D Ȃőg߂B
+        g++ -std=c++17 frame_ring_test.cpp frame_ring.cpp
+    mۂǂdȂȂƁADISCARD  NO_OVERWRITE ̎gA
+    eʕsŐ擪ɖ߂ƂɌÂmۂgȂȂ邱ƂB
+
+==============================================================================*/
+#include "frame_ring.h"
+#include "test_check.h"
+#include <vector>
+
+namespace
+{
+    struct Range
+    {
+        uint32_t begin, end;
+    };
+
+    bool Overlaps(const std::vector<Range>& ranges)
+    {
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            for (size_t j = i + 1; j < ranges.size(); ++j) {
+                if (ranges[i].begin < ranges[j].end && ranges[j].begin < ranges[i].end) return true;
+            }
+        }
+        return false;
+    }
+
+    // 1t[̒ł͍ŏ DISCARDAƂ NO_OVERWRITE ŏdȂ炸ɕ
+    void CheckFrame()
+    {
+        FrameRing ring(1024);
+        FrameRing::Allocation a;
+        std::vector<Range> ranges;
+        bool firstDiscard = false, laterNoOverwrite = true, aligned = true;
+
+        for (int frame = 0; frame < 3; ++frame) {
+            ring.BeginFrame();
+            ranges.clear();
+            for (int i = 0; i < 6; ++i) {
+                const uint32_t size = 20 + i * 12;
+                if (!ring.Allocate(size, 16, &a)) break;
+                if (i == 0) firstDiscard = a.discard;
+                else laterNoOverwrite = laterNoOverwrite && !a.discard;
+                aligned = aligned && (a.offset % 16) == 0;
+                ranges.push_back({ a.offset, a.offset + size });
+            }
+        }
+        TestCheck_True(firstDiscard, "first allocation of a frame maps with DISCARD");
+        TestCheck_True(laterNoOverwrite, "later allocations in the frame map with NO_OVERWRITE");
+        TestCheck_True(aligned, "offsets respect the alignment");
+        TestCheck_True(!Overlaps(ranges), "allocations within a frame do not overlap");
+        TestCheck_True(ring.FrameWrapCount() == 0, "no wrap while the frame fits");
+    }
+
+    // eʂ𒴂擪ɖ߂ DISCARD AオiőO̊mۂ͖ɂȂ
+    void CheckWrap()
+    {
+        FrameRing ring(256);
+        ring.BeginFrame();
+        FrameRing::Allocation first, second, wrapped;
+        ring.Allocate(100, 4, &first);
+        ring.Allocate(100, 4, &second);
+        const bool ok = ring.Allocate(100, 4, &wrapped);
+
+        TestCheck_True(ok && wrapped.offset == 0 && wrapped.discard, "wrap restarts at offset 0 with DISCARD");
+        TestCheck_True(ring.FrameWrapCount() == 1, "wrap is counted for the frame");
+        TestCheck_True(!ring.IsValid(first) && !ring.IsValid(second), "allocations before the wrap become invalid");
+        TestCheck_True(ring.IsValid(wrapped), "allocation after the wrap is valid");
+        TestCheck_True(ring.FrameBytes() == 300, "frame bytes include the wrapped allocation");
+
+        //  NO_OVERWRITE Ōɕ
+        FrameRing::Allocation next;
+        ring.Allocate(50, 4, &next);
+        TestCheck_True(!next.discard && next.offset >= wrapped.offset + 100, "allocation after a wrap continues with NO_OVERWRITE");
+
+        // t[ςƑÕt[̊mۂ͎gȂ
+        ring.BeginFrame();
+        TestCheck_True(!ring.IsValid(next), "BeginFrame invalidates the previous frame");
+        TestCheck_True(ring.FrameWrapCount() == 0 && ring.FrameBytes() == 0, "BeginFrame resets the frame counters");
+    }
+
+    void CheckLimits()
+    {
+        FrameRing ring(128);
+        FrameRing::Allocation a;
+        TestCheck_True(!ring.Allocate(0, 4, &a), "zero-sized allocation is rejected");
+        TestCheck_True(!ring.Allocate(129, 4, &a), "allocation larger than the ring is rejected");
+        TestCheck_True(ring.Allocate(128, 4, &a) && a.offset == 0 && a.discard, "allocation of the whole ring succeeds");
+
+        // 蒼̍ŏ̊mۂ DISCARD
+        ring.Reset(64);
+        TestCheck_True(!ring.IsValid(a), "Reset invalidates earlier allocations");
+        TestCheck_True(ring.Allocate(8, 4, &a) && a.discard && ring.Capacity() == 64, "first allocation after Reset maps with DISCARD");
+    }
+}
+
+int main()
+{
+    CheckFrame();
+    CheckWrap();
+    CheckLimits();
+    return TestCheck_Result();
+}
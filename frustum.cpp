@@ -0,0 +1,50 @@
+/*==============================================================================
+
+@@@JO[frustum.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "frustum.h"
+
+using namespace DirectX;
+
+Frustum Frustum_FromViewProjection(const XMMATRIX& viewProjection)
+{
+    XMFLOAT4X4 m;
+    XMStoreFloat4x4(&m, viewProjection);
+
+    // clip = v * M Ȃ̂ŁAM ̊e clip  x,y,z,w ɂȂ
+    const XMFLOAT4 colX{ m._11, m._21, m._31, m._41 };
+    const XMFLOAT4 colY{ m._12, m._22, m._32, m._42 };
+    const XMFLOAT4 colZ{ m._13, m._23, m._33, m._43 };
+    const XMFLOAT4 colW{ m._14, m._24, m._34, m._44 };
+
+    Frustum f{};
+    f.planes[0] = { colW.x + colX.x, colW.y + colX.y, colW.z + colX.z, colW.w + colX.w }; //    :  x >= -w
+    f.planes[1] = { colW.x - colX.x, colW.y - colX.y, colW.z - colX.z, colW.w - colX.w }; // E   :  x <=  w
+    f.planes[2] = { colW.x + colY.x, colW.y + colY.y, colW.z + colY.z, colW.w + colY.w }; //    :  y >= -w
+    f.planes[3] = { colW.x - colY.x, colW.y - colY.y, colW.z - colY.z, colW.w - colY.w }; //    :  y <=  w
+    f.planes[4] = colZ;                                                                   // O :  z >=  0
+    f.planes[5] = { colW.x - colZ.x, colW.y - colZ.y, colW.z - colZ.z, colW.w - colZ.w }; //    :  z <=  w
+
+    return f;
+}
+
+bool Frustum_IntersectsAabb(const Frustum& frustum, const XMFLOAT3& min, const XMFLOAT3& max)
+{
+    for (const auto& p : frustum.planes)
+    {
+        // @ɈԏoĂpip-vertexjOȂAŜO
+        const float x = (p.x >= 0.0f) ? max.x : min.x;
+        const float y = (p.y >= 0.0f) ? max.y : min.y;
+        const float z = (p.z >= 0.0f) ? max.z : min.z;
+
+        if (p.x * x + p.y * y + p.z * z + p.w < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
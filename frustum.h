@@ -0,0 +1,28 @@
+/*==============================================================================
+
+@@@JO[frustum.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    view * projectionisxNgAD3D  z  0`1j6ʂo
+    AABB ƓĂBD3D ɈˑȂ̂ŃQ[OłB
+
+==============================================================================*/
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <DirectXMath.h>
+
+struct Frustum
+{
+    // (a,b,c,d) : a*x + b*y + c*z + d >= 0 
+    DirectX::XMFLOAT4 planes[6];
+};
+
+Frustum Frustum_FromViewProjection(const DirectX::XMMATRIX& viewProjection);
+
+// łɓĂ trueiێIFpt߂͓Ă鈵ɂȂ邱Ƃj
+bool Frustum_IntersectsAabb(const Frustum& frustum, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max);
+
+#endif // FRUSTUM_H
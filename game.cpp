@@ -13,6 +13,8 @@
 #include "staga_system.h"
 #include "title.h"
 #include "stage_registry.h"
+#include "render_stats.h"
+#include "texture.h"
 
 namespace
 {
@@ -76,6 +78,9 @@ void Game_ChangeStage(StageId next)
 
 void Game_Update(float elapsedTime)
 {
+    // 非同期で読み込んだテクスチャの差し替え
+    Texture_Update();
+
     if (!g_stageInitialized)
     {
         Title_Update(elapsedTime);
@@ -93,6 +98,8 @@ void Game_Update(float elapsedTime)
 
 void Game_Draw()
 {
+    RenderStats_BeginFrame();
+
     if (!g_stageInitialized)
     {
         Title_Draw();
@@ -15,6 +15,7 @@
 #include "key_logger.h"
 #include "game.h"
 #include "sprite.h"
+#include "sprite_atlas.h"
 #include "texture.h"
 #include "direct3d.h"
 #include "stage_registry.h"
@@ -67,6 +68,7 @@ namespace
     {
         if (g_clearTex >= 0) return true;
         g_clearTex = Texture_Load(L"stage_clear.png");
+        if (g_clearTex >= 0) SpriteAtlas_Add(&g_clearTex, 1);
         return (g_clearTex >= 0);
     }
 
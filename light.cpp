@@ -9,13 +9,18 @@
 
 #include "light.h"
 #include"direct3d.h"
+#include "constant_ring.h"
+#include "clustered_light.h"
 
 using namespace DirectX;
 
 static ID3D11Buffer* g_pPSConstantBuffer1 = nullptr;//萔obt@1 //ambient
 static ID3D11Buffer* g_pPSConstantBuffer2 = nullptr;//萔obt@2 //@xNg
 static ID3D11Buffer* g_pPSConstantBuffer3 = nullptr;//萔obt@3
-static ID3D11Buffer* g_pPSConstantBuffer4 = nullptr;//萔obt@4
+// b4i_j clustered_light 
+
+// giCgȂ瑗蒼Ȃj
+static ConstantCache g_ambientCache, g_directionalCache, g_specularCache;
 
 // ӁIŊOݒ肳́BReleasesvB
 static ID3D11Device* g_pDevice = nullptr;
@@ -34,21 +39,6 @@ struct SpecularLight {
 	XMFLOAT4 color;
 };
 
-//_i|CgCgj
-struct PointLight {
-	XMFLOAT3 position;
-	float range;
-	XMFLOAT4 color;
-	//float specular_power;
-	//XMFLOAT3 dummy;
-};
-struct PointLightList {
-	PointLight light[4];
-	int count;
-	XMFLOAT3 dummy;
-};
-static PointLightList g_PointLights{};
-
 void Light_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 {
 	// foCXƃfoCXReLXg̕ۑ
@@ -69,8 +59,10 @@ void Light_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 	buffer_desc.ByteWidth = sizeof(SpecularLight); // obt@̃TCY
 	g_pDevice->CreateBuffer(&buffer_desc, nullptr, &g_pPSConstantBuffer3);//specular
 
-	buffer_desc.ByteWidth = sizeof(PointLightList); // obt@̃TCY
-	g_pDevice->CreateBuffer(&buffer_desc, nullptr, &g_pPSConstantBuffer4);//point
+	//_͐̂ŃNX^[ɕđ
+	ClusteredLight_Initialize(g_pDevice, g_pContext);
+
+	g_ambientCache.valid = g_directionalCache.valid = g_specularCache.valid = false;
 
 	/*PointLightList list{
 		{
@@ -90,14 +82,14 @@ void Light_Finalize()
 	SAFE_RELEASE(g_pPSConstantBuffer1);
 	SAFE_RELEASE(g_pPSConstantBuffer2);
 	SAFE_RELEASE(g_pPSConstantBuffer3);
-	SAFE_RELEASE(g_pPSConstantBuffer4);
+	ClusteredLight_Finalize();
 }
 
 void Light_SetAmbient(const DirectX::XMFLOAT3& color)
 {
 	XMFLOAT4 ambient = { color.x, color.y, color.z, 1.0f };
 	// 萔obt@ɃArGgZbg
-	g_pContext->UpdateSubresource(g_pPSConstantBuffer1, 0, nullptr, &ambient, 0, 0);
+	ConstantRing_UpdateCached(g_pPSConstantBuffer1, &g_ambientCache, &ambient, sizeof(ambient));
 	g_pContext->PSSetConstantBuffers(1, 1, &g_pPSConstantBuffer1);
 }
 
@@ -108,7 +100,7 @@ void Light_SetDirectionalWorld(const DirectX::XMFLOAT4& worldDirectional, const
 		worldDirectional,
 		color
 	};
-	g_pContext->UpdateSubresource(g_pPSConstantBuffer2, 0, nullptr, &dlight, 0, 0);
+	ConstantRing_UpdateCached(g_pPSConstantBuffer2, &g_directionalCache, &dlight, sizeof(dlight));
 	g_pContext->PSSetConstantBuffers(2, 1, &g_pPSConstantBuffer2);
 }
 
@@ -118,24 +110,17 @@ void Light_SetSpecularWorld(const DirectX::XMFLOAT3& cameraPosition, float power
 		cameraPosition,power, color
 	};
 
-	g_pContext->UpdateSubresource(g_pPSConstantBuffer3, 0, nullptr, &slight, 0, 0);
+	ConstantRing_UpdateCached(g_pPSConstantBuffer3, &g_specularCache, &slight, sizeof(slight));
 	g_pContext->PSSetConstantBuffers(3, 1, &g_pPSConstantBuffer3);
 }
 
+// _ CLUSTERED_LIGHT_MAX ܂ŁBۂɑ͎̂ Shader3D_Begin ̎
 void Light_SetPointLightCount(int count)
 {
-	g_PointLights.count = count;
-
-	g_pContext->UpdateSubresource(g_pPSConstantBuffer4, 0, nullptr, &g_PointLights, 0, 0);
-	g_pContext->PSSetConstantBuffers(4, 1, &g_pPSConstantBuffer4);
+	ClusteredLight_SetCount(count);
 }
 
 void Light_SetPointLight(int n, const DirectX::XMFLOAT3& position, float range, const DirectX::XMFLOAT3& color)
 {
-	g_PointLights.light[n].position = position;
-	g_PointLights.light[n].range = range;
-	g_PointLights.light[n].color = { color.x,color.y,color.z,1.0f };
-
-	g_pContext->UpdateSubresource(g_pPSConstantBuffer4, 0, nullptr, &g_PointLights, 0, 0);
-	g_pContext->PSSetConstantBuffers(4, 1, &g_pPSConstantBuffer4);
+	ClusteredLight_Set(n, position, range, color);
 }
@@ -0,0 +1,232 @@
+/*==============================================================================
+
+@@@_̃NX^[[light_cluster.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "light_cluster.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+    constexpr float kMinNearZ = 1.0e-3f;
+
+    // sxNg p * M  xyziw=1 ̓_j
+    void TransformPoint(const DirectX::XMFLOAT4X4& m, const DirectX::XMFLOAT3& p, float out[3])
+    {
+        out[0] = p.x * m._11 + p.y * m._21 + p.z * m._31 + m._41;
+        out[1] = p.x * m._12 + p.y * m._22 + p.z * m._32 + m._42;
+        out[2] = p.x * m._13 + p.y * m._23 + p.z * m._33 + m._43;
+    }
+
+    int ClampInt(int v, int lo, int hi) { return v < lo ? lo : (v > hi ? hi : v); }
+}
+
+LightClusterGrid::LightClusterGrid(int tilesX, int tilesY, int slices)
+    : m_tilesX(std::max(tilesX, 1))
+    , m_tilesY(std::max(tilesY, 1))
+    , m_slices(std::max(slices, 1))
+{
+    m_bounds.resize(ClusterCount());
+    m_ranges.assign(ClusterCount(), LightClusterRange{ 0, 0 });
+}
+
+float LightClusterGrid::SliceDepth(int slice) const
+{
+    const float t = (float)slice / (float)m_slices;
+    if (m_perspective)
+    {
+        return m_nearZ * std::pow(m_farZ / m_nearZ, t);
+    }
+    return m_nearZ + (m_farZ - m_nearZ) * t;
+}
+
+int LightClusterGrid::SliceOf(float viewZ) const
+{
+    float s;
+    if (m_perspective)
+    {
+        s = std::log(std::max(viewZ, kMinNearZ)) * m_depthScale + m_depthBias;
+    }
+    else
+    {
+        s = viewZ * m_depthScale + m_depthBias;
+    }
+    return ClampInt((int)std::floor(s), 0, m_slices - 1);
+}
+
+void LightClusterGrid::ViewToNdc(float x, float y, float z, float* outX, float* outY) const
+{
+    const DirectX::XMFLOAT4X4& p = m_projection;
+    const float cx = x * p._11 + y * p._21 + z * p._31 + p._41;
+    const float cy = x * p._12 + y * p._22 + z * p._32 + p._42;
+    const float cw = x * p._14 + y * p._24 + z * p._34 + p._44;
+    const float invW = 1.0f / std::max(cw, kMinNearZ);
+    *outX = cx * invW;
+    *outY = cy * invW;
+}
+
+void LightClusterGrid::SetView(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection)
+{
+    m_view = view;
+    m_projection = projection;
+
+    // XMMatrixPerspective*LH / XMMatrixOrthographic*LH ̌`Oɂ
+    //   z_ndc = (z * _33 + _43) / (z * _34 + _44)Ax  y ͂˂Ȃ
+    const DirectX::XMFLOAT4X4& p = projection;
+    m_perspective = (p._34 != 0.0f);
+    m_nearZ = -p._43 / p._33;
+    m_farZ = (p._44 - p._43) / (p._33 - p._34);
+    if (m_perspective) m_nearZ = std::max(m_nearZ, kMinNearZ);
+    if (!(m_farZ > m_nearZ)) m_farZ = m_nearZ + 1.0f;
+
+    if (m_perspective)
+    {
+        m_depthScale = (float)m_slices / std::log(m_farZ / m_nearZ);
+        m_depthBias = -std::log(m_nearZ) * m_depthScale;
+    }
+    else
+    {
+        m_depthScale = (float)m_slices / (m_farZ - m_nearZ);
+        m_depthBias = -m_nearZ * m_depthScale;
+    }
+
+    // NDC  (nx, ny) ƃr[Ԃ z r[Ԃ x, y ߂
+    auto unproject = [&p](float nx, float ny, float z, float* x, float* y)
+    {
+        const float w = z * p._34 + p._44;
+        *x = (nx * w - z * p._31 - p._41) / p._11;
+        *y = (ny * w - z * p._32 - p._42) / p._22;
+    };
+
+    for (int k = 0; k < m_slices; ++k)
+    {
+        const float z[2] = { SliceDepth(k), SliceDepth(k + 1) };
+        for (int ty = 0; ty < m_tilesY; ++ty)
+        {
+            // ^C̍s͉ʂ̏ォ琔
+            const float ny[2] = { 1.0f - 2.0f * (ty + 1) / m_tilesY, 1.0f - 2.0f * ty / m_tilesY };
+            for (int tx = 0; tx < m_tilesX; ++tx)
+            {
+                const float nx[2] = { -1.0f + 2.0f * tx / m_tilesX, -1.0f + 2.0f * (tx + 1) / m_tilesX };
+
+                Bounds& b = m_bounds[ClusterIndex(tx, ty, k)];
+                b.min[0] = b.min[1] = FLT_MAX;
+                b.max[0] = b.max[1] = -FLT_MAX;
+                b.min[2] = z[0];
+                b.max[2] = z[1];
+
+                for (int c = 0; c < 8; ++c)
+                {
+                    float x, y;
+                    unproject(nx[c & 1], ny[(c >> 1) & 1], z[(c >> 2) & 1], &x, &y);
+                    b.min[0] = std::min(b.min[0], x); b.max[0] = std::max(b.max[0], x);
+                    b.min[1] = std::min(b.min[1], y); b.max[1] = std::max(b.max[1], y);
+                }
+            }
+        }
+    }
+}
+
+void LightClusterGrid::Build(const LightClusterSphere* spheres, int count, uint32_t maxIndices)
+{
+    const int clusterCount = ClusterCount();
+    m_ranges.assign(clusterCount, LightClusterRange{ 0, 0 });
+    m_pairs.clear();
+    m_dropped = 0;
+
+    for (int i = 0; i < count; ++i)
+    {
+        const float r = spheres[i].range;
+        if (!(r > 0.0f)) continue;
+
+        float c[3];
+        TransformPoint(m_view, spheres[i].position, c);
+
+        const float z0 = std::max(c[2] - r, m_nearZ);
+        const float z1 = std::min(c[2] + r, m_farZ);
+        if (z0 > z1) continue; // O/
+
+        // ͂ޔ̊p NDC A^C͈̔͂oi̊Oɂ͏oȂj
+        float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+        for (int k = 0; k < 8; ++k)
+        {
+            float nx, ny;
+            ViewToNdc(c[0] + ((k & 1) ? r : -r), c[1] + ((k & 2) ? r : -r), (k & 4) ? z1 : z0, &nx, &ny);
+            minX = std::min(minX, nx); maxX = std::max(maxX, nx);
+            minY = std::min(minY, ny); maxY = std::max(maxY, ny);
+        }
+        if (maxX < -1.0f || minX > 1.0f || maxY < -1.0f || minY > 1.0f) continue;
+
+        const int tx0 = ClampInt((int)std::floor((minX * 0.5f + 0.5f) * m_tilesX), 0, m_tilesX - 1);
+        const int tx1 = ClampInt((int)std::floor((maxX * 0.5f + 0.5f) * m_tilesX), 0, m_tilesX - 1);
+        const int ty0 = ClampInt((int)std::floor((0.5f - maxY * 0.5f) * m_tilesY), 0, m_tilesY - 1);
+        const int ty1 = ClampInt((int)std::floor((0.5f - minY * 0.5f) * m_tilesY), 0, m_tilesY - 1);
+        const int k0 = SliceOf(z0);
+        const int k1 = SliceOf(z1);
+
+        const float rr = r * r;
+        for (int k = k0; k <= k1; ++k)
+        {
+            for (int ty = ty0; ty <= ty1; ++ty)
+            {
+                for (int tx = tx0; tx <= tx1; ++tx)
+                {
+                    const int cluster = ClusterIndex(tx, ty, k);
+                    const Bounds& b = m_bounds[cluster];
+
+                    // ̒S甠܂ł̋
+                    float d2 = 0.0f;
+                    for (int a = 0; a < 3; ++a)
+                    {
+                        const float v = c[a] < b.min[a] ? b.min[a] - c[a] : (c[a] > b.max[a] ? c[a] - b.max[a] : 0.0f);
+                        d2 += v * v;
+                    }
+                    if (d2 > rr) continue;
+
+                    if (m_pairs.size() >= maxIndices)
+                    {
+                        ++m_dropped;
+                        continue;
+                    }
+                    m_pairs.emplace_back((uint32_t)cluster, (uint32_t)i);
+                    ++m_ranges[cluster].count;
+                }
+            }
+        }
+    }
+
+    // Ol߂āACg̔ԍ̂܂ܕׂ
+    uint32_t offset = 0;
+    for (auto& range : m_ranges)
+    {
+        range.offset = offset;
+        offset += range.count;
+    }
+
+    m_indices.resize(m_pairs.size());
+    std::vector<uint32_t>& cursor = m_cursor;
+    cursor.resize(clusterCount);
+    for (int i = 0; i < clusterCount; ++i) cursor[i] = m_ranges[i].offset;
+    for (const auto& pair : m_pairs)
+    {
+        m_indices[cursor[pair.first]++] = pair.second;
+    }
+}
+
+int LightClusterGrid::ClusterAt(const DirectX::XMFLOAT3& worldPosition) const
+{
+    float v[3];
+    TransformPoint(m_view, worldPosition, v);
+
+    float nx, ny;
+    ViewToNdc(v[0], v[1], v[2], &nx, &ny);
+
+    const int tx = ClampInt((int)std::floor((nx * 0.5f + 0.5f) * m_tilesX), 0, m_tilesX - 1);
+    const int ty = ClampInt((int)std::floor((0.5f - ny * 0.5f) * m_tilesY), 0, m_tilesY - 1);
+    return ClusterIndex(tx, ty, SliceOf(v[2]));
+}
@@ -0,0 +1,104 @@
+/*==============================================================================
+
+@@@_̃NX^[[light_cluster.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    ʂ̃^C ~ s̃XCXitX^̃{NZjɋ؂A
+    _̋͂NX^[ƂɃCgԍ̕тB
+    sNZVF[_[͎̃NX^[̕т񂹂΂悢B
+    D3D ɈˑȂ̂ŃQ[OłB
+
+    view / projection ͍sxNgiDirectXMath  LHjBłseł悢B
+    s͓ȂΐAseȂ瓙Ԋuɐ؂B
+
+==============================================================================*/
+#ifndef LIGHT_CLUSTER_H
+#define LIGHT_CLUSTER_H
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+struct LightClusterSphere
+{
+    DirectX::XMFLOAT3 position; // [hW
+    float range;                // 0ȉȂ疳
+};
+
+// NX^[Ƃ̕т̏ꏊiVF[_[ uint2 Ɠсj
+struct LightClusterRange
+{
+    uint32_t offset;
+    uint32_t count;
+};
+
+class LightClusterGrid
+{
+public:
+    static constexpr int kDefaultTilesX = 16;
+    static constexpr int kDefaultTilesY = 9;
+    static constexpr int kDefaultSlices = 24;
+
+    explicit LightClusterGrid(int tilesX = kDefaultTilesX, int tilesY = kDefaultTilesY, int slices = kDefaultSlices);
+
+    // NX^[̋E蒼iJςł悢j
+    void SetView(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection);
+
+    // NX^[ɐU蕪Bт maxIndices 𒴂͎̂Ă
+    void Build(const LightClusterSphere* spheres, int count, uint32_t maxIndices = UINT32_MAX);
+
+    int TilesX() const { return m_tilesX; }
+    int TilesY() const { return m_tilesY; }
+    int Slices() const { return m_slices; }
+    int ClusterCount() const { return m_tilesX * m_tilesY * m_slices; }
+    int ClusterIndex(int tx, int ty, int slice) const { return (slice * m_tilesY + ty) * m_tilesX + tx; }
+
+    // [hW̓_NX^[iVF[_[ƓvZB͈͊O͒[Ɋ񂹂j
+    int ClusterAt(const DirectX::XMFLOAT3& worldPosition) const;
+
+    const std::vector<LightClusterRange>& Ranges() const { return m_ranges; }
+    const std::vector<uint32_t>& Indices() const { return m_indices; }
+    uint32_t DroppedIndices() const { return m_dropped; }
+
+    // VF[_[֓nlBslice = ( ? log(z) : z) * DepthScale() + DepthBias()
+    float NearZ() const { return m_nearZ; }
+    float FarZ() const { return m_farZ; }
+    float DepthScale() const { return m_depthScale; }
+    float DepthBias() const { return m_depthBias; }
+    bool IsPerspective() const { return m_perspective; }
+
+private:
+    struct Bounds
+    {
+        float min[3];
+        float max[3];
+    };
+
+    float SliceDepth(int slice) const;
+    int SliceOf(float viewZ) const;
+    void ViewToNdc(float x, float y, float z, float* outX, float* outY) const;
+
+    int m_tilesX = 0;
+    int m_tilesY = 0;
+    int m_slices = 0;
+
+    DirectX::XMFLOAT4X4 m_view{};
+    DirectX::XMFLOAT4X4 m_projection{};
+    bool  m_perspective = true;
+    float m_nearZ = 0.0f;
+    float m_farZ = 0.0f;
+    float m_depthScale = 0.0f;
+    float m_depthBias = 0.0f;
+
+    std::vector<Bounds> m_bounds;              // NX^[Ƃ̃r[Ԃ̔
+    std::vector<LightClusterRange> m_ranges;
+    std::vector<uint32_t> m_indices;
+    std::vector<std::pair<uint32_t, uint32_t>> m_pairs; // (NX^[, Cg)
+    std::vector<uint32_t> m_cursor;
+    uint32_t m_dropped = 0;
+};
+
+#endif // LIGHT_CLUSTER_H
@@ -0,0 +1,93 @@
+/*==============================================================================
+
+@@@ItXN[̃}bv`̊Ԉ[map_pass.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "map_pass.h"
+#include "direct3d.h"
+#include "render_stats.h"
+#include "system_timer.h"
+
+namespace
+{
+    PassScheduler g_scheduler;
+
+    bool     g_inPass = false;
+    double   g_beginSeconds = 0.0;
+    uint64_t g_beginKey = 0;
+}
+
+void MapPass_SetPolicy(PassScheduler::Policy policy)
+{
+    g_scheduler.SetPolicy(policy);
+}
+
+PassScheduler::Policy MapPass_GetPolicy()
+{
+    return g_scheduler.GetPolicy();
+}
+
+void MapPass_SetFrameInterval(int frames)
+{
+    g_scheduler.SetFrameInterval(frames);
+}
+
+int MapPass_GetFrameInterval()
+{
+    return g_scheduler.GetFrameInterval();
+}
+
+void MapPass_SetBudgetMsPerSecond(float ms)
+{
+    g_scheduler.SetBudgetMsPerSecond(ms);
+}
+
+float MapPass_GetBudgetMsPerSecond()
+{
+    return g_scheduler.GetBudgetMsPerSecond();
+}
+
+void MapPass_Invalidate()
+{
+    g_scheduler.Invalidate();
+}
+
+bool MapPass_Begin(uint64_t contentKey)
+{
+    const double now = SystemTimer_GetAbsoluteTime();
+
+    if (!g_scheduler.ShouldRun(now, contentKey))
+    {
+        RenderStats_AddPassSkip(RENDER_STATS_PASS_MAP);
+        return false;
+    }
+
+    g_inPass = true;
+    g_beginSeconds = now;
+    g_beginKey = contentKey;
+
+    // _[^[QbgeNX`ցiNA͂1񂾂j
+    Direct3D_SetOffscreen();
+    Direct3D_ClearOffscreen();
+    return true;
+}
+
+void MapPass_End()
+{
+    if (!g_inPass) return;
+    g_inPass = false;
+
+    const double now = SystemTimer_GetAbsoluteTime();
+    const double costMs = (now - g_beginSeconds) * 1000.0;
+
+    g_scheduler.OnRan(now, costMs, g_beginKey);
+    RenderStats_AddPassTime(RENDER_STATS_PASS_MAP, costMs);
+}
+
+const PassScheduler& MapPass_GetScheduler()
+{
+    return g_scheduler;
+}
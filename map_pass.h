@@ -0,0 +1,43 @@
+/*==============================================================================
+
+@@@ItXN[̃}bv`̊Ԉ[map_pass.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    ItXN[̃}bv͖t[`ȂĂڂقڕςȂ̂ŁA
+    PassScheduler ŕ`t[IԁB`Ȃt[̓^[QbgɐG炸A
+    Ǒʂ̂܂܎cB
+
+    gF
+        if (!MapPass_Begin(key)) return;   // false ȂǑʂg
+        ...`...
+        MapPass_End();
+
+==============================================================================*/
+#ifndef MAP_PASS_H
+#define MAP_PASS_H
+
+#include <cstdint>
+#include "pass_scheduler.h"
+
+void MapPass_SetPolicy(PassScheduler::Policy policy);
+PassScheduler::Policy MapPass_GetPolicy();
+
+void MapPass_SetFrameInterval(int frames);
+int  MapPass_GetFrameInterval();
+
+void  MapPass_SetBudgetMsPerSecond(float ms);
+float MapPass_GetBudgetMsPerSecond();
+
+// ̃t[ŕK`iXe[WؑւȂǁj
+void MapPass_Invalidate();
+
+// contentKey ̓}bvɉf钆g̃nbViOnChange ̎j
+// true ԂItXN[oChNAς݁B` MapPass_End Ă
+bool MapPass_Begin(uint64_t contentKey);
+void MapPass_End();
+
+const PassScheduler& MapPass_GetScheduler();
+
+#endif // MAP_PASS_H
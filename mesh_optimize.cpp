@@ -0,0 +1,359 @@
+/*==============================================================================
+
+@@@bV̍œK[mesh_optimize.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    _LbV : Tom Forsyth "Linear-Speed Vertex Cache Optimisation" ̓_tB
+                     LbV̒_ɕtĂOp`ԓ_̍̂IёB
+    d˓h       : Sander  "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw"
+                     ƓALbVɂȂ鏊i3_ƂOjł܂؂A
+                      ACMR ̈ threshold ȓɎ܂鏊ł؂B
+                     NX^̓bV̒S猩ĊOĂ鏇ɕׂB
+
+==============================================================================*/
+#include "mesh_optimize.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    //=====Forsyth ̓_=====
+    const int kScoreCacheSize = 32;
+
+    const uint32_t kValenceTableSize = 32;
+
+    // pow  sqrt ͖vZƏd̂ŕ\ɂĂ
+    struct ScoreTable
+    {
+        float cache[kScoreCacheSize];
+        float valence[kValenceTableSize];
+
+        ScoreTable()
+        {
+            for (int i = 0; i < kScoreCacheSize; ++i) {
+                // O̎Op`3_́AĎgƐVOp`ɂ̂ŏ
+                cache[i] = i < 3 ? 0.75f : std::pow(1.0f - (i - 3) * (1.0f / (kScoreCacheSize - 3)), 1.5f);
+            }
+            for (uint32_t i = 1; i < kValenceTableSize; ++i) {
+                // c̏Ȃ_𑁂Еt
+                valence[i] = 2.0f / std::sqrt((float)i);
+            }
+            valence[0] = 0.0f;
+        }
+    };
+
+    float VertexScore(int cachePos, uint32_t remaining)
+    {
+        static const ScoreTable table;
+
+        if (remaining == 0) return -1.0f; // gȂ
+
+        const float score = cachePos >= 0 ? table.cache[cachePos] : 0.0f;
+        return score + (remaining < kValenceTableSize ? table.valence[remaining] : 2.0f / std::sqrt((float)remaining));
+    }
+
+    // õLbV1i߂BOȂ true
+    // iŌɓoĂAꂩ size ȏւĂΊOj
+    bool CacheMiss(std::vector<uint32_t>& stamps, uint32_t& clock, uint32_t v, uint32_t size)
+    {
+        if (clock - stamps[v] < size) return false;
+        stamps[v] = clock++;
+        return true;
+    }
+
+    std::vector<uint32_t> NewStamps(uint32_t vertexCount, uint32_t size, uint32_t* clock)
+    {
+        *clock = size + 1;
+        return std::vector<uint32_t>(vertexCount, 0);
+    }
+
+    const uint32_t kOverdrawCacheSize = 16;
+}
+
+void MeshOptimize_VertexCache(uint32_t* indices, size_t indexCount, uint32_t vertexCount)
+{
+    const size_t triCount = indexCount / 3;
+    if (triCount == 0 || vertexCount == 0) return;
+
+    // _  Op`̑ΉiCSRj
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (size_t i = 0; i < triCount * 3; ++i) ++offsets[indices[i] + 1];
+    for (uint32_t v = 0; v < vertexCount; ++v) offsets[v + 1] += offsets[v];
+
+    std::vector<uint32_t> adjacency(triCount * 3);
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t t = 0; t < triCount; ++t) {
+        for (int k = 0; k < 3; ++k) adjacency[fill[indices[t * 3 + k]]++] = (uint32_t)t;
+    }
+
+    std::vector<uint32_t> remaining(vertexCount);
+    for (uint32_t v = 0; v < vertexCount; ++v) remaining[v] = offsets[v + 1] - offsets[v];
+
+    std::vector<int> cachePos(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (uint32_t v = 0; v < vertexCount; ++v) vertexScore[v] = VertexScore(-1, remaining[v]);
+
+    std::vector<float> triScore(triCount);
+    std::vector<uint8_t> emitted(triCount, 0);
+    size_t best = 0;
+    for (size_t t = 0; t < triCount; ++t) {
+        triScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+        if (triScore[t] > triScore[best]) best = t;
+    }
+
+    std::vector<uint32_t> out;
+    out.reserve(triCount * 3);
+
+    uint32_t cache[kScoreCacheSize + 3];
+    int cacheCount = 0;
+    size_t scan = 0; // LbV₪oȂƂɁA܂oĂȂOp`Tʒu
+
+    for (;;) {
+        emitted[best] = 1;
+        const uint32_t* tri = indices + best * 3;
+        out.insert(out.end(), tri, tri + 3);
+        for (int k = 0; k < 3; ++k) {
+            // oOp`͒_̑ΉOi[offsets[v], offsets[v] + remaining[v]) cj
+            const uint32_t v = tri[k];
+            uint32_t* first = &adjacency[offsets[v]];
+            uint32_t* last = first + remaining[v] - 1;
+            std::iter_swap(std::find(first, last, (uint32_t)best), last);
+            --remaining[v];
+        }
+
+        // VLbVF3_擪ɁAc͌Â̂܂܌
+        uint32_t next[kScoreCacheSize + 3];
+        int nextCount = 0;
+        for (int k = 0; k < 3; ++k) {
+            if (std::find(next, next + nextCount, tri[k]) == next + nextCount) next[nextCount++] = tri[k];
+        }
+        const int head = nextCount;
+        for (int i = 0; i < cacheCount; ++i) {
+            // ÂLbVɏd͂Ȃ̂ŁA3_Ƃׂ΂悢
+            if (std::find(next, next + head, cache[i]) == next + head) next[nextCount++] = cache[i];
+        }
+
+        // _̕ς_ƁA̎Op`̓_𒼂i͂ݏo_܂ށj
+        for (int i = 0; i < nextCount; ++i) {
+            const uint32_t v = next[i];
+            cachePos[v] = i < kScoreCacheSize ? i : -1;
+
+            const float score = VertexScore(cachePos[v], remaining[v]);
+            const float delta = score - vertexScore[v];
+            vertexScore[v] = score;
+            for (uint32_t a = offsets[v]; a < offsets[v] + remaining[v]; ++a) {
+                triScore[adjacency[a]] += delta;
+            }
+        }
+
+        cacheCount = std::min(nextCount, kScoreCacheSize);
+        for (int i = 0; i < cacheCount; ++i) cache[i] = next[i];
+
+        // LbV̒_ɕtĂOp`ԓ_̍
+        float bestScore = -FLT_MAX;
+        bool found = false;
+        for (int i = 0; i < cacheCount; ++i) {
+            const uint32_t v = cache[i];
+            for (uint32_t a = offsets[v]; a < offsets[v] + remaining[v]; ++a) {
+                const uint32_t t = adjacency[a];
+                if (triScore[t] > bestScore) {
+                    bestScore = triScore[t];
+                    best = t;
+                    found = true;
+                }
+            }
+        }
+
+        if (!found) {
+            while (scan < triCount && emitted[scan]) ++scan;
+            if (scan == triCount) break;
+            best = scan;
+        }
+    }
+
+    std::memcpy(indices, out.data(), out.size() * sizeof(uint32_t));
+}
+
+void MeshOptimize_Overdraw(uint32_t* indices, size_t indexCount,
+    const float* positions, size_t stride, uint32_t vertexCount, float threshold)
+{
+    const size_t triCount = indexCount / 3;
+    if (triCount < 2 || vertexCount == 0) return;
+
+    // ܂LbVɂȂ鏊i3_ƂOjŋ؂
+    std::vector<size_t> hard;
+    {
+        uint32_t clock;
+        std::vector<uint32_t> stamps = NewStamps(vertexCount, kOverdrawCacheSize, &clock);
+        for (size_t t = 0; t < triCount; ++t) {
+            int misses = 0;
+            for (int k = 0; k < 3; ++k) misses += CacheMiss(stamps, clock, indices[t * 3 + k], kOverdrawCacheSize);
+            if (t == 0 || misses == 3) hard.push_back(t);
+        }
+    }
+    hard.push_back(triCount);
+
+    // ɁA؂ẴNX^ ACMR  threshold {ȓɎ܂鏊ŋ؂
+    std::vector<size_t> starts;
+    for (size_t c = 0; c + 1 < hard.size(); ++c) {
+        const size_t begin = hard[c], end = hard[c + 1];
+
+        uint32_t clock;
+        std::vector<uint32_t> stamps = NewStamps(vertexCount, kOverdrawCacheSize, &clock);
+        size_t misses = 0;
+        for (size_t i = begin * 3; i < end * 3; ++i) misses += CacheMiss(stamps, clock, indices[i], kOverdrawCacheSize);
+        const float limit = threshold * (float)misses / (float)(end - begin);
+
+        stamps = NewStamps(vertexCount, kOverdrawCacheSize, &clock);
+        size_t runMisses = 0, runTris = 0;
+        starts.push_back(begin);
+        for (size_t t = begin; t < end; ++t) {
+            for (int k = 0; k < 3; ++k) runMisses += CacheMiss(stamps, clock, indices[t * 3 + k], kOverdrawCacheSize);
+            ++runTris;
+
+            if (t + 1 < end && (float)runMisses / (float)runTris <= limit) {
+                starts.push_back(t + 1);
+                stamps = NewStamps(vertexCount, kOverdrawCacheSize, &clock);
+                runMisses = 0;
+                runTris = 0;
+            }
+        }
+    }
+    starts.push_back(triCount);
+
+    const size_t clusterCount = starts.size() - 1;
+    if (clusterCount < 2) return;
+
+    auto position = [&](uint32_t v) {
+        return (const float*)((const uint8_t*)positions + v * stride);
+    };
+
+    // bVŜ̒Siʐςŏdݕtj
+    float center[3] = {};
+    float totalArea = 0.0f;
+    std::vector<float> clusterData(clusterCount * 6, 0.0f); // S xyziʐϏd݁jA@ xyz
+    std::vector<float> clusterArea(clusterCount, 0.0f);
+    for (size_t c = 0; c < clusterCount; ++c) {
+        float* cd = &clusterData[c * 6];
+        for (size_t t = starts[c]; t < starts[c + 1]; ++t) {
+            const float* p0 = position(indices[t * 3 + 0]);
+            const float* p1 = position(indices[t * 3 + 1]);
+            const float* p2 = position(indices[t * 3 + 2]);
+
+            const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+            const float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+            const float area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+            for (int k = 0; k < 3; ++k) {
+                const float mid = (p0[k] + p1[k] + p2[k]) / 3.0f;
+                cd[k] += mid * area;
+                cd[3 + k] += n[k];
+                center[k] += mid * area;
+            }
+            clusterArea[c] += area;
+            totalArea += area;
+        }
+    }
+    if (totalArea <= 0.0f) return;
+    for (float& v : center) v /= totalArea;
+
+    // O̓x = (NX^S - bVS)ENX^̖@
+    std::vector<float> sortKey(clusterCount, 0.0f);
+    for (size_t c = 0; c < clusterCount; ++c) {
+        const float* cd = &clusterData[c * 6];
+        if (clusterArea[c] <= 0.0f) continue;
+
+        const float nl = std::sqrt(cd[3] * cd[3] + cd[4] * cd[4] + cd[5] * cd[5]);
+        if (nl <= 0.0f) continue;
+        for (int k = 0; k < 3; ++k) {
+            sortKey[c] += (cd[k] / clusterArea[c] - center[k]) * (cd[3 + k] / nl);
+        }
+    }
+
+    std::vector<size_t> order(clusterCount);
+    for (size_t c = 0; c < clusterCount; ++c) order[c] = c;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sortKey[a] > sortKey[b]; });
+
+    std::vector<uint32_t> out;
+    out.reserve(triCount * 3);
+    for (size_t c : order) {
+        out.insert(out.end(), indices + starts[c] * 3, indices + starts[c + 1] * 3);
+    }
+    std::memcpy(indices, out.data(), out.size() * sizeof(uint32_t));
+}
+
+uint32_t MeshOptimize_VertexFetch(void* vertices, uint32_t vertexCount, size_t vertexSize,
+    uint32_t* indices, size_t indexCount)
+{
+    const uint32_t unused = 0xffffffffu;
+    std::vector<uint32_t> remap(vertexCount, unused);
+
+    uint32_t next = 0;
+    for (size_t i = 0; i < indexCount; ++i) {
+        uint32_t& r = remap[indices[i]];
+        if (r == unused) r = next++;
+        indices[i] = r;
+    }
+
+    uint8_t* dst = (uint8_t*)vertices;
+    const std::vector<uint8_t> src(dst, dst + vertexCount * vertexSize);
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+        if (remap[v] != unused) std::memcpy(dst + remap[v] * vertexSize, src.data() + v * vertexSize, vertexSize);
+    }
+    return next;
+}
+
+MeshOptimizeCacheStats MeshOptimize_AnalyzeCache(const uint32_t* indices, size_t indexCount,
+    uint32_t vertexCount, uint32_t cacheSize)
+{
+    MeshOptimizeCacheStats stats;
+    if (indexCount < 3 || vertexCount == 0) return stats;
+
+    uint32_t clock;
+    std::vector<uint32_t> stamps = NewStamps(vertexCount, cacheSize, &clock);
+    std::vector<uint8_t> used(vertexCount, 0);
+    size_t misses = 0, unique = 0;
+    for (size_t i = 0; i < indexCount; ++i) {
+        misses += CacheMiss(stamps, clock, indices[i], cacheSize);
+        if (!used[indices[i]]) { used[indices[i]] = 1; ++unique; }
+    }
+
+    stats.acmr = (float)misses / (float)(indexCount / 3);
+    stats.atvr = (float)misses / (float)unique;
+    return stats;
+}
+
+MeshOptimizeFetchStats MeshOptimize_AnalyzeFetch(const uint32_t* indices, size_t indexCount,
+    uint32_t vertexCount, size_t vertexSize)
+{
+    const size_t kLineSize = 64;
+    const uint32_t kLines = 64;
+
+    MeshOptimizeFetchStats stats;
+    if (indexCount == 0 || vertexCount == 0) return stats;
+
+    const uint32_t lineCount = (uint32_t)((vertexCount * vertexSize + kLineSize - 1) / kLineSize);
+    uint32_t clock;
+    std::vector<uint32_t> stamps = NewStamps(lineCount, kLines, &clock);
+    std::vector<uint8_t> used(vertexCount, 0);
+    size_t unique = 0;
+    for (size_t i = 0; i < indexCount; ++i) {
+        const uint32_t v = indices[i];
+        if (!used[v]) { used[v] = 1; ++unique; }
+
+        const size_t first = v * vertexSize / kLineSize;
+        const size_t last = ((size_t)v * vertexSize + vertexSize - 1) / kLineSize;
+        for (size_t line = first; line <= last; ++line) {
+            if (CacheMiss(stamps, clock, (uint32_t)line, kLines)) stats.bytesFetched += kLineSize;
+        }
+    }
+
+    stats.overfetch = (float)stats.bytesFetched / (float)(unique * vertexSize);
+    return stats;
+}
@@ -0,0 +1,59 @@
+/*==============================================================================
+
+@@@bV̍œK[mesh_optimize.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    f̕ϊimodel_cookj1񂾂BԂɌĂԁF
+
+      1. MeshOptimize_VertexCache : _LbVɓ₷Op`̏iForsyth @j
+      2. MeshOptimize_Overdraw    : 1 ̏ȂׂɃNX^ɕA
+                                    OĂNX^ɕ`id˓h炷j
+      3. MeshOptimize_VertexFetch : _ŏɎg鏇ɕבւACfbNXU蒼
+                                    igȂ_͋l߂Ď̂Ăj
+
+    MeshOptimize_Analyze* ͊mFp̓viACMR = Op`̒_VF[_sA
+    ATVR = _Aoverfetch = ۂɓǂ񂾃oCg / _f[^̑傫jB
+
+    CPU ŊBCfbNX̓bV̔ԍi0 ` vertexCount-1jB
+
+==============================================================================*/
+#ifndef MESH_OPTIMIZE_H
+#define MESH_OPTIMIZE_H
+
+#include <cstddef>
+#include <cstdint>
+
+struct MeshOptimizeCacheStats
+{
+    float acmr = 0.0f;
+    float atvr = 0.0f;
+};
+
+struct MeshOptimizeFetchStats
+{
+    uint64_t bytesFetched = 0;
+    float overfetch = 0.0f;
+};
+
+// Op`̏בւî indices ̂݁j
+void MeshOptimize_VertexCache(uint32_t* indices, size_t indexCount, uint32_t vertexCount);
+
+// VertexCache ̌ɌĂԁBthreshold ̓NX^ɕƂɋ ACMR ̈i1.05  5%j
+// positions  float3 ̈ʒu̐擪Astride ͒_̑傫ioCgj
+void MeshOptimize_Overdraw(uint32_t* indices, size_t indexCount,
+    const float* positions, size_t stride, uint32_t vertexCount, float threshold = 1.05f);
+
+// _g鏇ɕבւB߂l͎c_̐ǐ͖`j
+uint32_t MeshOptimize_VertexFetch(void* vertices, uint32_t vertexCount, size_t vertexSize,
+    uint32_t* indices, size_t indexCount);
+
+// o̒_LbVicacheSize jŐ
+MeshOptimizeCacheStats MeshOptimize_AnalyzeCache(const uint32_t* indices, size_t indexCount,
+    uint32_t vertexCount, uint32_t cacheSize = 16);
+// 64 oCg̃C 64 {LbVŐ
+MeshOptimizeFetchStats MeshOptimize_AnalyzeFetch(const uint32_t* indices, size_t indexCount,
+    uint32_t vertexCount, size_t vertexSize);
+
+#endif//MESH_OPTIMIZE_H
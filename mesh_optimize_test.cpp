@@ -0,0 +1,214 @@
+/*==============================================================================
+
+@@@bV̍œK̃`FbN[mesh_optimize_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D Ȃőg߂B
+        g++ -std=c++17 -O2 mesh_optimize_test.cpp mesh_optimize.cpp
+    Op`ObhƋ model_cook Ɠ3A
+    ǂ̒iłOp`̏W܂i݁jςȂƁAACMR 邱ƁA
+    d˓h̕בւ ACMR  threshold ȏɈȂȂƁA
+    _ŏɎg鏇ɋl߂Aoverfetch ȂƂB
+
+==============================================================================*/
+#include "mesh_optimize.h"
+#include "test_check.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    struct Vertex
+    {
+        float position[3];
+        uint32_t id;        // ̒_ԍiבւŌ̎Op`ɖ߂߁j
+    };
+
+    struct Mesh
+    {
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    uint32_t Next(uint32_t& state)
+    {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+
+    // Op`̏i͂̂܂܁j
+    void ShuffleTriangles(std::vector<uint32_t>* indices, uint32_t seed)
+    {
+        const size_t triCount = indices->size() / 3;
+        for (size_t i = triCount - 1; i > 0; --i)
+        {
+            const size_t j = Next(seed) % (i + 1);
+            for (int k = 0; k < 3; ++k) std::swap((*indices)[i * 3 + k], (*indices)[j * 3 + k]);
+        }
+    }
+
+    Mesh MakeGrid(int n)
+    {
+        Mesh m;
+        for (int z = 0; z <= n; ++z)
+        {
+            for (int x = 0; x <= n; ++x)
+            {
+                m.vertices.push_back({ { (float)x, 0.0f, (float)z }, (uint32_t)m.vertices.size() });
+            }
+        }
+        const uint32_t pitch = n + 1;
+        for (int z = 0; z < n; ++z)
+        {
+            for (int x = 0; x < n; ++x)
+            {
+                const uint32_t v = x + z * pitch;
+                m.indices.insert(m.indices.end(), { v, v + pitch + 1, v + 1, v, v + pitch, v + pitch + 1 });
+            }
+        }
+        return m;
+    }
+
+    Mesh MakeSphere(int rings, int segments)
+    {
+        Mesh m;
+        for (int r = 0; r <= rings; ++r)
+        {
+            const float phi = 3.14159265f * r / rings;
+            for (int s = 0; s <= segments; ++s)
+            {
+                const float theta = 6.28318531f * s / segments;
+                m.vertices.push_back({ { std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta) },
+                                       (uint32_t)m.vertices.size() });
+            }
+        }
+        const uint32_t pitch = segments + 1;
+        for (int r = 0; r < rings; ++r)
+        {
+            for (int s = 0; s < segments; ++s)
+            {
+                const uint32_t v = s + r * pitch;
+                m.indices.insert(m.indices.end(), { v, v + 1, v + pitch + 1, v, v + pitch + 1, v + pitch });
+            }
+        }
+        return m;
+    }
+
+    // ̒_ԍł̎Op`Aԏԍ擪ɂȂ悤񂵂ĕׂi͕ۂj
+    std::vector<std::array<uint32_t, 3>> TriangleSet(const Mesh& m)
+    {
+        std::vector<std::array<uint32_t, 3>> tris;
+        for (size_t i = 0; i + 2 < m.indices.size(); i += 3)
+        {
+            std::array<uint32_t, 3> t = { m.vertices[m.indices[i]].id, m.vertices[m.indices[i + 1]].id,
+                                          m.vertices[m.indices[i + 2]].id };
+            std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+            tris.push_back(t);
+        }
+        std::sort(tris.begin(), tris.end());
+        return tris;
+    }
+
+    // _ԍŏɎg鏇 0,1,2,... ƏoĂ
+    bool FirstUseOrder(const std::vector<uint32_t>& indices, uint32_t vertexCount)
+    {
+        uint32_t next = 0;
+        for (uint32_t i : indices)
+        {
+            if (i > next) return false;
+            if (i == next) ++next;
+        }
+        return next == vertexCount;
+    }
+
+    float Acmr(const Mesh& m, uint32_t vertexCount)
+    {
+        return MeshOptimize_AnalyzeCache(m.indices.data(), m.indices.size(), vertexCount).acmr;
+    }
+
+    // model_cook Ɠ3āAiƂɊm߂
+    void Check(const char* name, Mesh m, float maxAcmr, int unusedVertices)
+    {
+        char what[128];
+        const auto reference = TriangleSet(m);
+        uint32_t vertexCount = (uint32_t)m.vertices.size();
+        for (int i = 0; i < unusedVertices; ++i)
+        {
+            m.vertices.push_back({ { 0.0f, 0.0f, 0.0f }, vertexCount + i });
+        }
+        vertexCount = (uint32_t)m.vertices.size();
+        const uint32_t usedCount = vertexCount - unusedVertices;
+
+        const float acmrBefore = Acmr(m, vertexCount);
+        const float overfetchBefore =
+            MeshOptimize_AnalyzeFetch(m.indices.data(), m.indices.size(), vertexCount, sizeof(Vertex)).overfetch;
+
+        MeshOptimize_VertexCache(m.indices.data(), m.indices.size(), vertexCount);
+        const float acmrCache = Acmr(m, vertexCount);
+        std::snprintf(what, sizeof(what), "%s: VertexCache keeps the triangles", name);
+        TestCheck_True(TriangleSet(m) == reference, what);
+        std::snprintf(what, sizeof(what), "%s: ACMR after VertexCache (before %.2f)", name, acmrBefore);
+        TestCheck_Expect(acmrCache <= maxAcmr, what, acmrCache, maxAcmr);
+
+        const float threshold = 1.05f;
+        MeshOptimize_Overdraw(m.indices.data(), m.indices.size(), m.vertices[0].position, sizeof(Vertex),
+                              vertexCount, threshold);
+        const float acmrOverdraw = Acmr(m, vertexCount);
+        std::snprintf(what, sizeof(what), "%s: Overdraw keeps the triangles", name);
+        TestCheck_True(TriangleSet(m) == reference, what);
+        std::snprintf(what, sizeof(what), "%s: ACMR after Overdraw", name);
+        TestCheck_Expect(acmrOverdraw <= acmrCache * threshold, what, acmrOverdraw, acmrCache * threshold);
+
+        vertexCount = MeshOptimize_VertexFetch(m.vertices.data(), vertexCount, sizeof(Vertex),
+                                               m.indices.data(), m.indices.size());
+        m.vertices.resize(vertexCount);
+        std::snprintf(what, sizeof(what), "%s: VertexFetch keeps the triangles", name);
+        TestCheck_True(TriangleSet(m) == reference, what);
+        std::snprintf(what, sizeof(what), "%s: VertexFetch drops unused vertices and orders by first use", name);
+        TestCheck_True(vertexCount == usedCount && FirstUseOrder(m.indices, vertexCount), what);
+
+        const float acmrFetch = Acmr(m, vertexCount);
+        std::snprintf(what, sizeof(what), "%s: VertexFetch leaves ACMR alone", name);
+        TestCheck_Expect(std::fabs(acmrFetch - acmrOverdraw) <= 1e-6f, what, std::fabs(acmrFetch - acmrOverdraw), 1e-6);
+
+        const float overfetchAfter =
+            MeshOptimize_AnalyzeFetch(m.indices.data(), m.indices.size(), vertexCount, sizeof(Vertex)).overfetch;
+        std::snprintf(what, sizeof(what), "%s: overfetch after VertexFetch", name);
+        TestCheck_Expect(overfetchAfter <= overfetchBefore, what, overfetchAfter, overfetchBefore);
+    }
+}
+
+int main()
+{
+    // Obh ACMR ق 3i1Op`Ƃ3_ƂOjBz 0.5 ɋ߂
+    Mesh grid = MakeGrid(100);
+    ShuffleTriangles(&grid.indices, 1);
+    Check("grid", grid, 0.75f, 37);
+
+    // Fɂ̐`ƁAd˓h̕בւ`
+    Mesh sphere = MakeSphere(48, 96);
+    ShuffleTriangles(&sphere.indices, 2);
+    Check("sphere", sphere, 0.8f, 0);
+
+    // ǂ̂̂Ȃ
+    Mesh ordered = MakeGrid(64);
+    const float acmrOrdered = Acmr(ordered, (uint32_t)ordered.vertices.size());
+    Mesh optimized = ordered;
+    MeshOptimize_VertexCache(optimized.indices.data(), optimized.indices.size(), (uint32_t)optimized.vertices.size());
+    const float acmrOptimized = Acmr(optimized, (uint32_t)optimized.vertices.size());
+    TestCheck_Expect(acmrOptimized <= acmrOrdered, "ordered grid: VertexCache does not make it worse",
+                     acmrOptimized, acmrOrdered);
+
+    // ̃bV
+    MeshOptimize_VertexCache(nullptr, 0, 0);
+    MeshOptimize_Overdraw(nullptr, 0, nullptr, sizeof(Vertex), 0);
+    TestCheck_True(MeshOptimize_VertexFetch(nullptr, 0, sizeof(Vertex), nullptr, 0) == 0 &&
+                   MeshOptimize_AnalyzeCache(nullptr, 0, 0).acmr == 0.0f, "empty mesh");
+
+    return TestCheck_Result();
+}
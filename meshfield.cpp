@@ -12,20 +12,27 @@
 #include"texture.h"
 #include"shader_field.h"
 #include"camera.h"
+#include "field_tiles.h"
+#include "frustum.h"
+#include "render_stats.h"
 #include<DirectXMath.h>
+#include <vector>
 
 using namespace DirectX;
 
-static constexpr float FIELD_MESH_SIZE = 1.0f;//bVtB[h̕
-static constexpr int FIELD_MESH_W_COUNT = 160;//}X
-static constexpr int FIELD_MESH_H_COUNT = 160;//}X
-static constexpr int NUM_VERTEX_W = FIELD_MESH_W_COUNT + 1;// _@i}X{Pji}X{Pj
-static constexpr int NUM_VERTEX_H = FIELD_MESH_H_COUNT + 1;
-static constexpr int NUM_VERTEX = NUM_VERTEX_W * NUM_VERTEX_H;
-static constexpr int NUM_INDEX = 3 * 2 * FIELD_MESH_W_COUNT * FIELD_MESH_H_COUNT;
+//^CɕāAĂ^Cɉׂŕ`ifield_tiles.hj
+//ǂ̃^C_Obh𕽍sړĎginʂ͕Ȃ̂Łj
+static FieldTileGrid g_tiles;
 
-static ID3D11Buffer* g_pVertexBuffer = nullptr; // _obt@
-static ID3D11Buffer* g_pIndexBuffer = nullptr; // CfbNXobt@
+static ID3D11Buffer* g_pVertexBuffer = nullptr; // _obt@i1^Cj
+static ID3D11Buffer* g_pIndexBuffer = nullptr; // CfbNXobt@iLOD~D킹̑Sށj
+
+//LOD~D킹Ƃ̃CfbNX̏ꏊ
+struct IndexRange {
+	UINT start;
+	UINT count;
+};
+static std::vector<IndexRange> g_indexRanges;
 
 static ID3D11ShaderResourceView* g_pTexture = nullptr; //eNX`
 
@@ -43,72 +50,63 @@ struct Vertex3d {
 	XMFLOAT2 texcoord;//uv
 };
 
-//ȃoJł̂̓[J̗̈iPMBȂ)ɒuȂ
-static Vertex3d g_meshFieldVertex[NUM_VERTEX]{
-	    {{-0.5f,  0.5f, -0.5f}, { 0.0f,1.0f,0.0f, },{1,1,1,1}, {0,0}},//TL  //0 
-		{{ 0.5f,  0.5f, -0.5f}, { 0.0f,1.0f,0.0f, },{1,1,1,1}, {0.25f,0}},//TR //1
-		{{ 0.5f, -0.5f, -0.5f}, { 0.0f,1.0f,0.0f, },{1,1,1,1}, {0.25,0.25}},//BR //2
-		{{-0.5f, -0.5f, -0.5f}, { 0.0f,1.0f,0.0f, },{1,1,1,1}, {0,0.25f}},//BL //3
-};
-
-static unsigned short g_meshFieldIndex[NUM_INDEX];
-
 void MeshField_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
+{
+	MeshField_Initialize(pDevice, pContext, FieldTileDesc{});
+}
+
+void MeshField_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, const FieldTileDesc& desc)
 {
 	// foCXƃfoCXReLXg̕ۑ
 	g_pDevice = pDevice;
 	g_pContext = pContext;
 
+	g_tiles.Setup(desc);
+	const FieldTileDesc& d = g_tiles.Desc();
+	const int pitch = d.tileCells + 1;
+
 	// _obt@
 	D3D11_BUFFER_DESC bd = {};
 	bd.Usage = D3D11_USAGE_DEFAULT;//DEFAULTCPUł͏s
-	bd.ByteWidth = sizeof(Vertex3d) * NUM_VERTEX;//sizeof(g_CubeVertex);ł
+	bd.ByteWidth = sizeof(Vertex3d) * pitch * pitch;
 	bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 	bd.CPUAccessFlags = 0;//CPU̓ANZXłȂ
 
-	//_zɍ
-	for (int z = 0; z < NUM_VERTEX_H; z++) {
-		for (int x = 0; x < NUM_VERTEX_W; x++) {
+	//_zɍi1^CBuv̓}XPʂȂ̂WRAPŃ^C܂łȂj
+	std::vector<Vertex3d> vertices(pitch * pitch);
+	for (int z = 0; z < pitch; z++) {
+		for (int x = 0; x < pitch; x++) {
 			//{̍ő吔c PQւ̕ϊCfbNXĂ
-			int index = x + NUM_VERTEX_H * z;
-			g_meshFieldVertex[index].position = { x * FIELD_MESH_SIZE,0.0f,z * FIELD_MESH_SIZE };
-			g_meshFieldVertex[index].normalVector = { 0.0f,1.0f,0.0f, };
-			g_meshFieldVertex[index].color = { 0.0f,1.0f,0.0f,1.0f };
-			g_meshFieldVertex[index].texcoord = { x * 1.0f,z * 1.0f };
+			int index = x + pitch * z;
+			vertices[index].position = { x * d.cellSize,0.0f,z * d.cellSize };
+			vertices[index].normalVector = { 0.0f,1.0f,0.0f, };
+			vertices[index].color = { 0.0f,1.0f,0.0f,1.0f };
+			vertices[index].texcoord = { x * 1.0f,z * 1.0f };
 		}
 	}
 
-	//_J[ςƂP̃h[R[ŃI[v[hɓۂ`
-	for (int z = 0; z < NUM_VERTEX_H; z++) {
-		int index = 26 + FIELD_MESH_H_COUNT * z;
-		g_meshFieldVertex[index].color = { 1.0f,0.0f,1.0f,1.0f };
-	}
-
-
 	D3D11_SUBRESOURCE_DATA sd{};
-	sd.pSysMem = g_meshFieldVertex;
+	sd.pSysMem = vertices.data();
 
 	g_pDevice->CreateBuffer(&bd, &sd, &g_pVertexBuffer);
 
-	//CfbNXobt@쐬
-	bd.ByteWidth = sizeof(unsigned short) * NUM_INDEX;
-	bd.BindFlags = D3D11_BIND_INDEX_BUFFER;
-
-	//CfbNXzɍ //}Ɩ@
-	int index = 0;
-	for (int w = 0; w < FIELD_MESH_W_COUNT; w++) {
-		for (int h = 0; h < FIELD_MESH_H_COUNT; h++) {
-			g_meshFieldIndex[index + 0] = h + (w + 0) * NUM_VERTEX_W;      //0 1  5
-			g_meshFieldIndex[index + 1] = h + (w + 1) * NUM_VERTEX_W + 1;  //5 6  10
-			g_meshFieldIndex[index + 2] = g_meshFieldIndex[index + 0] + 1; //1 2  6
-			g_meshFieldIndex[index + 3] = g_meshFieldIndex[index + 0];     //0 1  5
-			g_meshFieldIndex[index + 4] = g_meshFieldIndex[index + 1] - 1; //4 5  9
-			g_meshFieldIndex[index + 5] = g_meshFieldIndex[index + 1];     //5 6  10Ċ̃CfbNXɂȂ
-			index += 6;
+	//CfbNXLOD~D킹̑SނԂ1{ɂ܂Ƃ߂
+	std::vector<uint16_t> indices;
+	std::vector<uint16_t> variant;
+	g_indexRanges.clear();
+	for (int lod = 0; lod < d.lodCount; lod++) {
+		for (unsigned stitch = 0; stitch < FIELD_TILE_STITCH_VARIANTS; stitch++) {
+			FieldTileGrid::BuildIndices(d.tileCells, lod, stitch, &variant);
+			g_indexRanges.push_back({ (UINT)indices.size(), (UINT)variant.size() });
+			indices.insert(indices.end(), variant.begin(), variant.end());
 		}
 	}
 
-	sd.pSysMem = g_meshFieldIndex;
+	//CfbNXobt@쐬
+	bd.ByteWidth = (UINT)(sizeof(uint16_t) * indices.size());
+	bd.BindFlags = D3D11_BIND_INDEX_BUFFER;
+
+	sd.pSysMem = indices.data();
 
 	g_pDevice->CreateBuffer(&bd, &sd, &g_pIndexBuffer);
 
@@ -123,10 +121,17 @@ void MeshField_Finalize()
 {
 	SAFE_RELEASE(g_pVertexBuffer);
 	SAFE_RELEASE(g_pIndexBuffer);
+	g_indexRanges.clear();
 	Shader_field_Finalize();
+
+	Texture_Release(g_meshFieldTexId1);
+	Texture_Release(g_meshFieldTexId2);
+	g_meshFieldTexId1 = -1;
+	g_meshFieldTexId2 = -1;
 }
 
-void MeshField_Draw(DirectX::XMMATRIX& mtrWorld)
+//I΂ꂽ^C`
+static void drawTiles(const XMMATRIX& mtrWorld)
 {
 	// VF[_[`pCvCɐݒ
 	Shader_field_Begin();
@@ -139,10 +144,6 @@ void MeshField_Draw(DirectX::XMMATRIX& mtrWorld)
 	// CfbNXobt@`pCvCɐݒ
 	g_pContext->IASetIndexBuffer(g_pIndexBuffer, DXGI_FORMAT_R16_UINT, 0);//unsigned shortR16Aunsigned intR32
 
-
-	Shader_field_SetWorldMatrix(mtrWorld);
-
-
 	//eNX`ݒ
 	Texture_SetTexture(g_meshFieldTexId1, 0);
 	Texture_SetTexture(g_meshFieldTexId2,1);
@@ -150,13 +151,47 @@ void MeshField_Draw(DirectX::XMMATRIX& mtrWorld)
 	// v~eBug|Wݒ
 	g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-	// |S`施ߔs
-				/*============ʂ̐(₷т6_K)==============*/
-	//g_pContext->Draw(NUM_VERTEX, 0);
-	g_pContext->DrawIndexed(NUM_INDEX, 0, 0);
+	const float size = g_tiles.TileSize();
+	for (const FieldTileDraw& tile : g_tiles.Visible())
+	{
+		const IndexRange& range = g_indexRanges[tile.lod * FIELD_TILE_STITCH_VARIANTS + tile.stitch];
+		if (range.count == 0) continue;
+
+		Shader_field_SetWorldMatrix(XMMatrixTranslation(tile.tileX * size, 0.0f, tile.tileZ * size) * mtrWorld);
+
+		// |S`施ߔs
+		g_pContext->DrawIndexed(range.count, range.start, 0);
+	}
+
+	RenderStats_AddCounter(RENDER_STATS_FIELD_TILES_DRAWN, g_tiles.Visible().size());
+}
+
+void MeshField_Draw(DirectX::XMMATRIX& mtrWorld)
+{
+	// JȂ̂őS^Cԍׂ`
+	g_tiles.SelectAll();
+	drawTiles(mtrWorld);
+}
+
+void MeshField_Draw(const DirectX::XMMATRIX& mtrWorld, const DirectX::XMMATRIX& view, const DirectX::XMMATRIX& projection)
+{
+	XMFLOAT4X4 world;
+	XMStoreFloat4x4(&world, mtrWorld);
+
+	XMFLOAT3 eye;
+	XMStoreFloat3(&eye, XMMatrixInverse(nullptr, view).r[3]);
+
+	const Frustum frustum = Frustum_FromViewProjection(view * projection);
+	g_tiles.Select(eye, &frustum, world);
+	drawTiles(mtrWorld);
+}
+
+const FieldTileGrid& MeshField_GetTiles()
+{
+	return g_tiles;
 }
 
 float MeshField_GetHalf()
 {
-	return FIELD_MESH_SIZE * FIELD_MESH_W_COUNT * 0.5f;
+	return g_tiles.Desc().cellSize * g_tiles.Desc().cellsX * 0.5f;
 }
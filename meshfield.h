@@ -13,9 +13,18 @@
 #include<d3d11.h>
 #include<DirectXMath.h>
 
+struct FieldTileDesc;
+class FieldTileGrid;
+
 void MeshField_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
+// }XE^C̑傫ELODw肷i16bitCfbNX̏͋CɂȂĂ悢j
+void MeshField_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, const FieldTileDesc& desc);
 void MeshField_Finalize();
 void MeshField_Draw(DirectX::XMMATRIX& mtrWorld);
+// ̊Õ^CȂA^C͊Ԉĕ`
+void MeshField_Draw(const DirectX::XMMATRIX& mtrWorld, const DirectX::XMMATRIX& view, const DirectX::XMMATRIX& projection);
+
+const FieldTileGrid& MeshField_GetTiles();
 
 float MeshField_GetHalf();
 
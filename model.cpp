@@ -14,141 +14,313 @@
 #include "WICTextureLoader11.h"
 #include"shader3d_unlit.h"
 #include"shader_depth.h"
+#include "model_cook.h"
+#include "asset_cache.h"
+#include "mesh_optimize.h"
+#include "debug_ostream.h"
 #include<assert.h>
 #include<algorithm>
+#include<cfloat>
+#include<fstream>
+#include<string>
+#include<vector>
 #include<DirectXMath.h>
 
 using namespace DirectX;
 
-// 3D_\
-struct Vertex3d
+static int g_TextureWhite = -1;
+
+// pXEg嗦EWñf1LiXe[W܂ł Purge ܂Ŏcj
+static AssetCache<MODEL> g_ModelCache;
+
+//ϊς݃f̒uꏊiO͌t@CƓǂݍݐݒ肩j
+static const wchar_t* const COOKED_DIR = L"cooked";
+
+static std::wstring ToWide(const std::string& str)
+{
+	const int len = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, nullptr, 0);
+	if (len <= 1) return std::wstring();
+
+	std::wstring wide(len - 1, L'\0');
+	MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, &wide[0], len);
+	return wide;
+}
+
+//t@C̑傫ƍXVAǂݍݐݒiϊς݂ÂȂ̊mFpj
+static bool GetModelSource(const std::wstring& path, float scale, bool isBrender, ModelCookSource* out)
 {
-	XMFLOAT3 position; // _W
-	XMFLOAT3 normalVector;//@
-	XMFLOAT4  color;
-	XMFLOAT2 texcoord;//uv
+	WIN32_FILE_ATTRIBUTE_DATA fad;
+	if (!GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &fad)) return false;
+
+	out->fileSize = ((uint64_t)fad.nFileSizeHigh << 32) | fad.nFileSizeLow;
+	out->writeTime = ((uint64_t)fad.ftLastWriteTime.dwHighDateTime << 32) | fad.ftLastWriteTime.dwLowDateTime;
+	out->scale = scale;
+	out->flags = isBrender ? 1u : 0u;
+	return true;
+}
+
+//ǂݎpŃɃ}bv
+struct MappedFile
+{
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = nullptr;
+	const uint8_t* data = nullptr;
+	size_t size = 0;
 };
-static int g_TextureWhite = -1;
 
-MODEL* ModelLoad( const char *FileName ,float scale, bool isBrender)
+static void UnmapFile(MappedFile* mapped)
 {
-	MODEL* model = new MODEL;
+	if (mapped->data) UnmapViewOfFile(mapped->data);
+	if (mapped->mapping) CloseHandle(mapped->mapping);
+	if (mapped->file != INVALID_HANDLE_VALUE) CloseHandle(mapped->file);
+	*mapped = MappedFile{};
+}
 
-	model->AiScene = aiImportFile(FileName, aiProcessPreset_TargetRealtime_MaxQuality | aiProcess_ConvertToLeftHanded);
-	assert(model->AiScene);
+static bool MapFile(const std::wstring& path, MappedFile* out)
+{
+	out->file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (out->file == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(out->file, &size) && size.QuadPart > 0) {
+		out->size = (size_t)size.QuadPart;
+		out->mapping = CreateFileMappingW(out->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (out->mapping) out->data = (const uint8_t*)MapViewOfFile(out->mapping, FILE_MAP_READ, 0, 0, 0);
+	}
 
-	model->VertexBuffer = new ID3D11Buffer*[model->AiScene->mNumMeshes];
-	model->IndexBuffer = new ID3D11Buffer*[model->AiScene->mNumMeshes];
+	if (!out->data) {
+		UnmapFile(out);
+		return false;
+	}
+	return true;
+}
 
-	model->local_aabb.min;
+//ꎞt@CɏĂ獷ւirŗĂꂽt@CcȂj
+static void WriteCooked(const std::wstring& path, const std::vector<uint8_t>& blob)
+{
+	CreateDirectoryW(COOKED_DIR, nullptr);
 
+	const std::wstring tmpPath = path + L".tmp";
+	{
+		std::ofstream ofs(tmpPath, std::ios::binary | std::ios::trunc);
+		if (!ofs || !ofs.write((const char*)blob.data(), blob.size())) return;
+	}
+	if (!MoveFileExW(tmpPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) DeleteFileW(tmpPath.c_str());
+}
 
-	for (unsigned int m = 0; m < model->AiScene->mNumMeshes; m++)
+//Assimp œǂŁAϊς݂Ɠ`ɋl߂
+static bool ImportWithAssimp(const char* FileName, float scale, bool isBrender, ModelCookData* out)
+{
+	const aiScene* scene = aiImportFile(FileName, aiProcessPreset_TargetRealtime_MaxQuality | aiProcess_ConvertToLeftHanded);
+	if (!scene) return false;
+
+	XMFLOAT3 aabbMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+	XMFLOAT3 aabbMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+	// בւO̔rpiSbV̍vj
+	double missesBefore = 0.0, missesAfter = 0.0, fetchBefore = 0.0, fetchAfter = 0.0;
+
+	for (unsigned int m = 0; m < scene->mNumMeshes; m++)
 	{
-		aiMesh* mesh = model->AiScene->mMeshes[m];
+		const aiMesh* mesh = scene->mMeshes[m];
+
+		std::vector<ModelCookVertex> vertices;
+		std::vector<uint32_t> indices;
+		vertices.reserve(mesh->mNumVertices);
+		indices.reserve(mesh->mNumFaces * 3);
 
-		// _obt@
+		// _
+		for (unsigned int v = 0; v < mesh->mNumVertices; v++)
 		{
-			Vertex3d* vertex = new Vertex3d[mesh->mNumVertices];
+			const aiVector3D& p = mesh->mVertices[v];
+			const aiVector3D& n = mesh->mNormals[v];
 
-			for (unsigned int v = 0; v < mesh->mNumVertices; v++)
+			XMFLOAT3 position, normal;
+			if (isBrender)//BrenderWn
 			{
-				if (isBrender)//BrenderWn
-				{
-					vertex[v].position = XMFLOAT3(mesh->mVertices[v].x*scale, mesh->mVertices[v].z*scale, -mesh->mVertices[v].y*scale);
-					vertex[v].normalVector = XMFLOAT3(mesh->mNormals[v].x, mesh->mNormals[v].z, -mesh->mNormals[v].y);
-
-				}
-				else if(!isBrender) //MAYAWn
-				{
-					vertex[v].position = XMFLOAT3(mesh->mVertices[v].x * scale, mesh->mVertices[v].y * scale, mesh->mVertices[v].z * scale);
-					vertex[v].normalVector = XMFLOAT3(mesh->mNormals[v].x, mesh->mNormals[v].y, mesh->mNormals[v].z);
-				}
-
-				vertex[v].texcoord = XMFLOAT2( mesh->mTextureCoords[0][v].x, mesh->mTextureCoords[0][v].y);
-				vertex[v].color = XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f);
-
-
-				if (v == 0 && m == 0) {
-					model->local_aabb.min = vertex[v].position;
-					model->local_aabb.max = vertex[v].position;
-				}
-				else {
-					model->local_aabb.min.x = std::min(model->local_aabb.min.x, vertex[v].position.x);
-					model->local_aabb.min.y = std::min(model->local_aabb.min.y, vertex[v].position.y);
-					model->local_aabb.min.z = std::min(model->local_aabb.min.z, vertex[v].position.z);
-					model->local_aabb.max.x = std::max(model->local_aabb.max.x, vertex[v].position.x);
-					model->local_aabb.max.y = std::max(model->local_aabb.max.y, vertex[v].position.y);
-					model->local_aabb.max.z = std::max(model->local_aabb.max.z, vertex[v].position.z);
-				}
+				position = XMFLOAT3(p.x * scale, p.z * scale, -p.y * scale);
+				normal = XMFLOAT3(n.x, n.z, -n.y);
+			}
+			else //MAYAWn
+			{
+				position = XMFLOAT3(p.x * scale, p.y * scale, p.z * scale);
+				normal = XMFLOAT3(n.x, n.y, n.z);
 			}
 
-			D3D11_BUFFER_DESC bd;
-			ZeroMemory(&bd, sizeof(bd));
-			bd.Usage = D3D11_USAGE_DEFAULT;
-			bd.ByteWidth = sizeof(Vertex3d) * mesh->mNumVertices;
-			bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-			bd.CPUAccessFlags = 0;
+			ModelCookVertex vertex = {
+				{ position.x, position.y, position.z },
+				{ normal.x, normal.y, normal.z },
+				{ 1.0f, 1.0f, 1.0f, 1.0f },
+				{ 0.0f, 0.0f },
+			};
+			if (mesh->mTextureCoords[0]) {
+				vertex.texcoord[0] = mesh->mTextureCoords[0][v].x;
+				vertex.texcoord[1] = mesh->mTextureCoords[0][v].y;
+			}
+			vertices.push_back(vertex);
+
+			aabbMin.x = std::min(aabbMin.x, position.x);
+			aabbMin.y = std::min(aabbMin.y, position.y);
+			aabbMin.z = std::min(aabbMin.z, position.z);
+			aabbMax.x = std::max(aabbMax.x, position.x);
+			aabbMax.y = std::max(aabbMax.y, position.y);
+			aabbMax.z = std::max(aabbMax.z, position.z);
+		}
 
-			D3D11_SUBRESOURCE_DATA sd;
-			ZeroMemory(&sd, sizeof(sd));
-			sd.pSysMem = vertex;
+		// CfbNXibV̔ԍ̂܂܁B`掞 baseVertex 𑫂j
+		for (unsigned int f = 0; f < mesh->mNumFaces; f++)
+		{
+			const aiFace* face = &mesh->mFaces[f];
 
-			Direct3D_GetDevice()->CreateBuffer(&bd, &sd, &model->VertexBuffer[m]);
+			assert(face->mNumIndices == 3);
 
-			delete[] vertex;
+			indices.push_back(face->mIndices[0]);
+			indices.push_back(face->mIndices[1]);
+			indices.push_back(face->mIndices[2]);
 		}
 
+		// _LbV  I[o[h[  _tFb`̏ɕבւ
+		const size_t triangles = indices.size() / 3;
+		uint32_t vertexCount = (uint32_t)vertices.size();
+		const MeshOptimizeCacheStats cacheBefore = MeshOptimize_AnalyzeCache(indices.data(), indices.size(), vertexCount);
+		const MeshOptimizeFetchStats fetchStatsBefore = MeshOptimize_AnalyzeFetch(indices.data(), indices.size(), vertexCount, sizeof(PackedVertex3d)); // GPU ǂނ̂͋l߂̒_
+
+		MeshOptimize_VertexCache(indices.data(), indices.size(), vertexCount);
+		MeshOptimize_Overdraw(indices.data(), indices.size(), vertices.empty() ? nullptr : vertices[0].position, sizeof(ModelCookVertex), vertexCount);
+		vertexCount = MeshOptimize_VertexFetch(vertices.data(), vertexCount, sizeof(ModelCookVertex), indices.data(), indices.size());
+		vertices.resize(vertexCount);
+
+		const MeshOptimizeCacheStats cacheAfter = MeshOptimize_AnalyzeCache(indices.data(), indices.size(), vertexCount);
+		const MeshOptimizeFetchStats fetchStatsAfter = MeshOptimize_AnalyzeFetch(indices.data(), indices.size(), vertexCount, sizeof(PackedVertex3d));
+		missesBefore += cacheBefore.acmr * triangles;
+		missesAfter += cacheAfter.acmr * triangles;
+		fetchBefore += fetchStatsBefore.bytesFetched;
+		fetchAfter += fetchStatsAfter.bytesFetched;
+
+		ModelCookMesh cookMesh{};
+		cookMesh.baseVertex = (uint32_t)out->vertices.size();
+		cookMesh.vertexCount = vertexCount;
+		cookMesh.startIndex = (uint32_t)out->indices.size();
+		cookMesh.indexCount = (uint32_t)indices.size();
+		cookMesh.material = mesh->mMaterialIndex;
+
+		out->vertices.insert(out->vertices.end(), vertices.begin(), vertices.end());
+		out->indices.insert(out->indices.end(), indices.begin(), indices.end());
+		out->meshes.push_back(cookMesh);
+	}
 
-		// CfbNXobt@
-		{
-			unsigned int* index = new unsigned int[mesh->mNumFaces * 3];
+	if (!out->indices.empty())
+	{
+		const double triangles = out->indices.size() / 3.0;
+		const double vertexBytes = (double)out->vertices.size() * sizeof(PackedVertex3d);
+		hal::dout << "ModelLoad() : " << FileName
+			<< " ACMR " << missesBefore / triangles << " -> " << missesAfter / triangles
+			<< " / overfetch " << fetchBefore / vertexBytes << " -> " << fetchAfter / vertexBytes << std::endl;
+	}
 
-			for (unsigned int f = 0; f < mesh->mNumFaces; f++)
-			{
-				const aiFace* face = &mesh->mFaces[f];
+	if (out->vertices.empty()) {
+		aabbMin = aabbMax = { 0.0f, 0.0f, 0.0f };
+	}
+	out->aabbMin[0] = aabbMin.x; out->aabbMin[1] = aabbMin.y; out->aabbMin[2] = aabbMin.z;
+	out->aabbMax[0] = aabbMax.x; out->aabbMax[1] = aabbMax.y; out->aabbMax[2] = aabbMax.z;
 
-				assert(face->mNumIndices == 3);
+	// }eAifBt[ỸeNX`ƐFj
+	for (unsigned int i = 0; i < scene->mNumMaterials; i++)
+	{
+		const aiMaterial* aimaterial = scene->mMaterials[i];
 
-				index[f * 3 + 0] = face->mIndices[0];
-				index[f * 3 + 1] = face->mIndices[1];
-				index[f * 3 + 2] = face->mIndices[2];
-			}
+		aiString texture;
+		aimaterial->GetTexture(aiTextureType_DIFFUSE, 0, &texture);
+
+		aiColor3D diffuse;
+		aimaterial->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse);
+
+		out->materials.push_back({ texture.C_Str(), { diffuse.r, diffuse.g, diffuse.b, 1.0f } });
+	}
 
-			D3D11_BUFFER_DESC bd;
-			ZeroMemory(&bd, sizeof(bd));
-			bd.Usage = D3D11_USAGE_DEFAULT;
-			bd.ByteWidth = sizeof(unsigned int) * mesh->mNumFaces * 3;
-			bd.BindFlags = D3D11_BIND_INDEX_BUFFER;
-			bd.CPUAccessFlags = 0;
+	//FBXɃeNX`Ăꍇikꂽ܂܂̒gĂj
+	for (unsigned int i = 0; i < scene->mNumTextures; i++)
+	{
+		const aiTexture* aitexture = scene->mTextures[i];
+		const uint8_t* data = (const uint8_t*)aitexture->pcData;
+		out->textures.push_back({ aitexture->mFilename.C_Str(), std::vector<uint8_t>(data, data + aitexture->mWidth) });
+	}
 
-			D3D11_SUBRESOURCE_DATA sd;
-			ZeroMemory(&sd, sizeof(sd));
-			sd.pSysMem = index;
+	aiReleaseImport(scene);
+	return true;
+}
 
-			Direct3D_GetDevice()->CreateBuffer(&bd, &sd, &model->IndexBuffer[m]);
+//ϊς݂̌`obt@ƃeNX`i_ECfbNX view ̎ŵ܂܏f[^ɂj
+static MODEL* CreateModel(const ModelCookView& view, const std::string& directory)
+{
+	const ModelCookHeader& header = *view.header;
+	MODEL* model = new MODEL;
 
-			delete[] index;
-		}
+	// _obt@
+	if (header.vertexCount > 0)
+	{
+		D3D11_BUFFER_DESC bd;
+		ZeroMemory(&bd, sizeof(bd));
+		bd.Usage = D3D11_USAGE_IMMUTABLE;
+		bd.ByteWidth = sizeof(PackedVertex3d) * header.vertexCount;
+		bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		bd.CPUAccessFlags = 0;
+
+		D3D11_SUBRESOURCE_DATA sd;
+		ZeroMemory(&sd, sizeof(sd));
+		sd.pSysMem = view.vertices;
+
+		Direct3D_GetDevice()->CreateBuffer(&bd, &sd, &model->VertexBuffer);
+	}
 
+	// CfbNXobt@
+	if (header.indexCount > 0)
+	{
+		D3D11_BUFFER_DESC bd;
+		ZeroMemory(&bd, sizeof(bd));
+		bd.Usage = D3D11_USAGE_IMMUTABLE;
+		bd.ByteWidth = header.indexSize * header.indexCount;
+		bd.BindFlags = D3D11_BIND_INDEX_BUFFER;
+		bd.CPUAccessFlags = 0;
+
+		D3D11_SUBRESOURCE_DATA sd;
+		ZeroMemory(&sd, sizeof(sd));
+		sd.pSysMem = view.indices;
+
+		Direct3D_GetDevice()->CreateBuffer(&bd, &sd, &model->IndexBuffer);
 	}
+	model->IndexFormat = header.indexSize == 2 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+	model->PackBounds = VertexPack_MakeBounds(header.aabbMin, header.aabbMax);
 
-		g_TextureWhite = Texture_Load(L"white.png");
+	for (uint32_t m = 0; m < header.meshCount; m++)
+	{
+		const ModelCookMesh& src = view.meshes[m];
+		const ModelCookMaterialRecord& material = view.materials[src.material];
+
+		MODEL_MESH mesh;
+		mesh.StartIndex = src.startIndex;
+		mesh.IndexCount = src.indexCount;
+		mesh.BaseVertex = (int)src.baseVertex;
+		mesh.TextureName = view.MaterialTexture(src.material);
+		mesh.Diffuse = { material.diffuse[0], material.diffuse[1], material.diffuse[2], material.diffuse[3] };
+		model->Mesh.push_back(mesh);
+	}
+
+	model->local_aabb.min = { header.aabbMin[0], header.aabbMin[1], header.aabbMin[2] };
+	model->local_aabb.max = { header.aabbMax[0], header.aabbMax[1], header.aabbMax[2] };
 
 	//=====eNX`ǂݍ========
 		//FBXɃeNX`Ăꍇ
-	for(unsigned int i = 0; i < model->AiScene->mNumTextures; i++)
+	for (uint32_t i = 0; i < header.textureCount; i++)
 	{
-		aiTexture* aitexture = model->AiScene->mTextures[i];
-
-		ID3D11ShaderResourceView* texture;
-		ID3D11Resource* resource;
+		ID3D11ShaderResourceView* texture = nullptr;
+		ID3D11Resource* resource = nullptr;
 
 		CreateWICTextureFromMemory(
 			Direct3D_GetDevice(),
 			Direct3D_GetContext(),
-			(const uint8_t*)aitexture->pcData,
-			(size_t)aitexture->mWidth,
+			view.TextureData(i),
+			(size_t)view.textures[i].dataSize,
 			&resource, // release!!!!!
 			&texture);
 
@@ -156,10 +328,36 @@ MODEL* ModelLoad( const char *FileName ,float scale, bool isBrender)
 
 		resource->Release();//!!!!!!!!!!!!
 
-		model->Texture[aitexture->mFilename.data] = texture;
+		model->Texture[view.TextureName(i)] = texture;
+	}
+
+	// eNX`FBXƂ͕ʂɗpӂĂꍇ
+	//FBXt@CɏĂ geNX`摜h ɁAtH_ł̉摜T
+	for (const MODEL_MESH& mesh : model->Mesh)
+	{
+		const std::string& filename = mesh.TextureName;
+		if (filename.empty()) {
+			continue;
+		}
+
+		if (model->Texture.count(filename) || model->TextureId.count(filename)) {
+			continue;
+		}
 
+		// WJ͗ōsA͂܂ł͔\i摜͑̃fƋLj
+		const int texid = Texture_LoadAsync(ToWide(directory + "/" + filename).c_str());
+
+		assert(texid >= 0);
+
+		model->TextureId[filename] = texid;
 	}
 
+	return model;
+}
+
+static MODEL* LoadModelUncached(const char* FileName, float scale, bool isBrender)
+{
+	g_TextureWhite = Texture_Load(L"white.png");
 
 	// fbx̃t@CpX擾
 	const std::string modelPath(FileName);
@@ -174,107 +372,158 @@ MODEL* ModelLoad( const char *FileName ,float scale, bool isBrender)
 		directory = "";   // pXɋ؂肪Ȃꍇit@Ĉ݁j
 	}
 
-	// eNX`FBXƂ͕ʂɗpӂĂꍇ
-	//FBXt@CɏĂ geNX`摜h ɁAtH_ł̉摜TADirectXGPU\[Xɓo^鏈
-	for (unsigned int m = 0; m < model->AiScene->mNumMeshes; m++)
-	{
-		aiString filename;
-		aiMaterial* aimaterial = model->AiScene->mMaterials[model->AiScene->mMeshes[m]->mMaterialIndex];
-		aimaterial->GetTexture(aiTextureType_DIFFUSE, 0, &filename);
+	//ϊς݂΃}bvāÂ܂܃obt@ɂ
+	ModelCookSource source{};
+	const bool hasSource = GetModelSource(ToWide(modelPath), scale, isBrender, &source);
+	const std::wstring cookedPath = ModelCook_CachePath(COOKED_DIR, FileName, scale, isBrender ? 1u : 0u);
 
-		if (filename.length == 0) {
-			continue;
+	ModelCookView view;
+	MappedFile mapped;
+	if (hasSource && MapFile(cookedPath, &mapped))
+	{
+		MODEL* model = nullptr;
+		if (ModelCook_Read(mapped.data, mapped.size, &view) && ModelCook_SourceMatches(view, source)) {
+			model = CreateModel(view, directory);
 		}
+		UnmapFile(&mapped);
 
-		if (model->Texture.count(filename.C_Str())) {
-			continue;
-		}
+		if (model) return model;
+	}
 
-		ID3D11ShaderResourceView* texture;
-		ID3D11Resource* resource;
+	//Ȃ Assimp œǂ݁i㏈݂ŏdjÂ߂ɏoĂ
+	ModelCookData data;
+	const bool imported = ImportWithAssimp(FileName, scale, isBrender, &data);
+	assert(imported);
 
-		std::string texfilename = directory + "/" + filename.C_Str();
+	std::vector<uint8_t> blob;
+	const bool written = ModelCook_Write(data, source, &blob) && ModelCook_Read(blob.data(), blob.size(), &view);
+	assert(written);
 
-		int len = MultiByteToWideChar(CP_UTF8, 0, texfilename.c_str(), -1, nullptr, 0);
-		wchar_t* pWideFilename = new wchar_t[len];
-		MultiByteToWideChar(CP_UTF8, 0, texfilename.c_str(), -1, pWideFilename, len);
+	if (hasSource) WriteCooked(cookedPath, blob);
 
-		CreateWICTextureFromFile(
-			Direct3D_GetDevice(),
-			Direct3D_GetContext(),
-			pWideFilename,
-			&resource,
-			&texture);
+	return CreateModel(view, directory);
+}
 
-		delete[] pWideFilename;
 
-		assert(texture);
 
-		resource->Release(); // !!!!!!!!!!
 
-		model->Texture[filename.C_Str()] = texture;
+static void DestroyModel(MODEL* model)
+{
+	SAFE_RELEASE(model->VertexBuffer);
+	SAFE_RELEASE(model->IndexBuffer);
+
+
+	for (std::pair<const std::string, ID3D11ShaderResourceView*> pair : model->Texture)
+	{
+		pair.second->Release();
+	}
+
+	for (const std::pair<const std::string, int>& pair : model->TextureId)
+	{
+		Texture_Release(pair.second);
 	}
 
-	return model;
+	Texture_Release(g_TextureWhite);
+
+
+	delete model;
 }
 
+//obt@̑傫i풓ʂ̕\pj
+static unsigned long long ModelBytes(const MODEL* model)
+{
+	unsigned long long bytes = 0;
+	D3D11_BUFFER_DESC bd;
+	if (model->VertexBuffer) { model->VertexBuffer->GetDesc(&bd); bytes += bd.ByteWidth; }
+	if (model->IndexBuffer) { model->IndexBuffer->GetDesc(&bd); bytes += bd.ByteWidth; }
+	return bytes;
+}
 
+MODEL* ModelLoad( const char *FileName ,float scale, bool isBrender)
+{
+	const std::string key = AssetCache_MakeKey(FileName, scale, isBrender);
+	if (MODEL* shared = g_ModelCache.Acquire(key)) return shared;
 
+	MODEL* model = LoadModelUncached(FileName, scale, isBrender);
+	if (model) g_ModelCache.Insert(key, model, ModelBytes(model));
+	return model;
+}
 
 void ModelRelease(MODEL* model)
 {
-	for (unsigned int m = 0; m < model->AiScene->mNumMeshes; m++)
-	{
-		model->VertexBuffer[m]->Release();
-		model->IndexBuffer[m]->Release();
-	}
+	if (!model) return;
+
+	//LĂ͎̂QƂԂî Model_PurgeUnusedj
+	if (!g_ModelCache.Release(model)) DestroyModel(model);
+}
 
-	delete[] model->VertexBuffer;
-	delete[] model->IndexBuffer;
+int Model_PurgeUnused()
+{
+	return g_ModelCache.Purge(DestroyModel);
+}
 
+int Model_GetResidentCount()
+{
+	return g_ModelCache.Count();
+}
 
-	for (std::pair<const std::string, ID3D11ShaderResourceView*> pair : model->Texture)
-	{
-		pair.second->Release();
-	}
+int Model_GetUnusedCount()
+{
+	return g_ModelCache.UnusedCount();
+}
 
+unsigned long long Model_GetResidentBytes()
+{
+	return g_ModelCache.Bytes();
+}
 
-	aiReleaseImport(model->AiScene);
+//}eÃeNX`Zbgiʃt@Ĉ̂̓eNX`Ǘ̔ԍÂ̂̓r[𒼐ځj
+static void SetModelTexture(MODEL* model, const char* name)
+{
+	const auto id = model->TextureId.find(name);
+	if (id != model->TextureId.end()) {
+		Texture_SetTexture(id->second);
+		return;
+	}
 
+	const auto view = model->Texture.find(name);
+	if (view != model->Texture.end()) {
+		Direct3D_GetContext()->PSSetShaderResources(0, 1, &view->second);
+		return;
+	}
 
-	delete model;
+	Texture_SetTexture(g_TextureWhite);
 }
 
 void ModelDraw(MODEL* model, const XMMATRIX& mtxWorld)
 {
 	// VF[_[`pCvCɐݒ
-	Shader3D_Begin();
+	Shader3D_BeginPacked();
 
 	// v~eBug|Wݒ
 	Direct3D_GetContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 	Shader3D_SetWorldMatrix(mtxWorld);
+	Shader3D_SetPackedBounds(model->PackBounds);
+
+	// _ECfbNX͑SbV1{ibVƂ̈ʒu DrawIndexed Ŏwj
+	UINT stride = sizeof(PackedVertex3d);
+	UINT offset = 0;
+	Direct3D_GetContext()->IASetVertexBuffers(0, 1, &model->VertexBuffer, &stride, &offset);
+	Direct3D_GetContext()->IASetIndexBuffer(model->IndexBuffer, model->IndexFormat, 0);//unsigned shortR16Aunsigned intR32
 
-	for (unsigned int m = 0; m < model->AiScene->mNumMeshes; m++)//mbV(f̕)̔ԍ
+	for (const MODEL_MESH& mesh : model->Mesh)//bV(f̕)
 	{
 		// eNX`̐ݒ
-			aiString texture;
-			aiMaterial* aimaterial = model->AiScene->mMaterials[model->AiScene->mMeshes[m]->mMaterialIndex];
-			aimaterial->GetTexture(aiTextureType_DIFFUSE, 0, &texture);
-
-			if (texture.length != 0) {
+			if (!mesh.TextureName.empty()) {
 				//if (texture != aiString("")) {
-				Direct3D_GetContext()->PSSetShaderResources(0, 1, &model->Texture[texture.data]);
-
-				aiMaterial* aimaterial = model->AiScene->mMaterials[model->AiScene->mMeshes[m]->mMaterialIndex];
+				SetModelTexture(model, mesh.TextureName.c_str());
 			}
 			else {
 				Texture_SetTexture(g_TextureWhite);
 
-				aiColor3D diffuse;
 //Q[J̃fʁAp[cʁAsNZʂɃ_Oς@́uXyL[}bvvBueNX`}bvv̒̂P큁
-				aimaterial->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse);//AI_MATKEY_COLOR_SPECULARƂp[cƂɃ_Oς邩
-				Shader3d_SetColor({ diffuse.r, diffuse.g, diffuse.b, 1.0f });//shader3d.h/cpp
+				Shader3d_SetColor({ mesh.Diffuse.x, mesh.Diffuse.y, mesh.Diffuse.z, 1.0f });//shader3d.h/cpp
 			}
 
 		//}eAݒ J[rB̑sNԐFɖ߂fbxł͌XԐF
@@ -284,51 +533,42 @@ void ModelDraw(MODEL* model, const XMMATRIX& mtxWorld)
 		Shader3d_SetColor({ diffuse.r, diffuse.g, diffuse.b, 1.0f });//shader3d.h/cpp*/
 
 
-		// _obt@`pCvCɐݒ
-		UINT stride = sizeof(Vertex3d);
-		UINT offset = 0;
-		Direct3D_GetContext()->IASetVertexBuffers(0, 1, &model->VertexBuffer[m], &stride, &offset);
-
-		// CfbNXobt@`pCvCɐݒ
-		Direct3D_GetContext()->IASetIndexBuffer(model->IndexBuffer[m], DXGI_FORMAT_R32_UINT, 0);//unsigned shortR16Aunsigned intR32
-
 		// |S`施ߔs
 					/*============ʂ̐(₷т6_K)==============*/
 		//g_pContext->Draw(NUM_VERTEX, 0);
-		Direct3D_GetContext()->DrawIndexed(model->AiScene->mMeshes[m]->mNumFaces * 3 , 0, 0);
+		Direct3D_GetContext()->DrawIndexed(mesh.IndexCount, mesh.StartIndex, mesh.BaseVertex);
 	}
 }
 
 void ModelDepthDraw(MODEL* model, const DirectX::XMMATRIX& mtxWorld)
 {
 	// VF[_[`pCvCɐݒ
-	ShaderDepth_Begin();
+	ShaderDepth_BeginPacked();
 
 	// v~eBug|Wݒ
 	Direct3D_GetContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 	ShaderDepth_SetWorldMatrix(mtxWorld);
+	Shader3D_SetPackedBounds(model->PackBounds);
+
+	// _ECfbNX͑SbV1{ibVƂ̈ʒu DrawIndexed Ŏwj
+	UINT stride = sizeof(PackedVertex3d);
+	UINT offset = 0;
+	Direct3D_GetContext()->IASetVertexBuffers(0, 1, &model->VertexBuffer, &stride, &offset);
+	Direct3D_GetContext()->IASetIndexBuffer(model->IndexBuffer, model->IndexFormat, 0);//unsigned shortR16Aunsigned intR32
 
-	for (unsigned int m = 0; m < model->AiScene->mNumMeshes; m++)//mbV(f̕)̔ԍ
+	for (const MODEL_MESH& mesh : model->Mesh)//bV(f̕)
 	{
 		// eNX`̐ݒ
-		aiString texture;
-		aiMaterial* aimaterial = model->AiScene->mMaterials[model->AiScene->mMeshes[m]->mMaterialIndex];
-		aimaterial->GetTexture(aiTextureType_DIFFUSE, 0, &texture);
-
-		if (texture.length != 0) {
+		if (!mesh.TextureName.empty()) {
 			//if (texture != aiString("")) {
-			Direct3D_GetContext()->PSSetShaderResources(0, 1, &model->Texture[texture.data]);
-
-			aiMaterial* aimaterial = model->AiScene->mMaterials[model->AiScene->mMeshes[m]->mMaterialIndex];
+			SetModelTexture(model, mesh.TextureName.c_str());
 		}
 		else {
 			Texture_SetTexture(g_TextureWhite);
 
-			aiColor3D diffuse;
 			//Q[J̃fʁAp[cʁAsNZʂɃ_Oς@́uXyL[}bvvBueNX`}bvv̒̂P큁
-			aimaterial->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse);//AI_MATKEY_COLOR_SPECULARƂp[cƂɃ_Oς邩
-			ShaderDepth_SetColor({ diffuse.r, diffuse.g, diffuse.b, 1.0f });//shader3d.h/cpp
+			ShaderDepth_SetColor({ mesh.Diffuse.x, mesh.Diffuse.y, mesh.Diffuse.z, 1.0f });//shader3d.h/cpp
 		}
 
 		//}eAݒ J[rB̑sNԐFɖ߂fbxł͌XԐF
@@ -338,52 +578,43 @@ void ModelDepthDraw(MODEL* model, const DirectX::XMMATRIX& mtxWorld)
 		Shader3d_SetColor({ diffuse.r, diffuse.g, diffuse.b, 1.0f });//shader3d.h/cpp*/
 
 
-		// _obt@`pCvCɐݒ
-		UINT stride = sizeof(Vertex3d);
-		UINT offset = 0;
-		Direct3D_GetContext()->IASetVertexBuffers(0, 1, &model->VertexBuffer[m], &stride, &offset);
-
-		// CfbNXobt@`pCvCɐݒ
-		Direct3D_GetContext()->IASetIndexBuffer(model->IndexBuffer[m], DXGI_FORMAT_R32_UINT, 0);//unsigned shortR16Aunsigned intR32
-
 		// |S`施ߔs
 					/*============ʂ̐(₷т6_K)==============*/
 		//g_pContext->Draw(NUM_VERTEX, 0);
-		Direct3D_GetContext()->DrawIndexed(model->AiScene->mMeshes[m]->mNumFaces * 3, 0, 0);
+		Direct3D_GetContext()->DrawIndexed(mesh.IndexCount, mesh.StartIndex, mesh.BaseVertex);
 	}
 }
 
 void ModelUnlitDraw(MODEL* model, const XMMATRIX& mtxWorld)
 {
 	// VF[_[`pCvCɐݒ
-	Shader3DUnlit_Begin();
+	Shader3DUnlit_BeginPacked();
 
 	// v~eBug|Wݒ
 	Direct3D_GetContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 	Shader3DUnlit_SetWorldMatrix(mtxWorld);
+	Shader3D_SetPackedBounds(model->PackBounds);
+
+	// _ECfbNX͑SbV1{ibVƂ̈ʒu DrawIndexed Ŏwj
+	UINT stride = sizeof(PackedVertex3d);
+	UINT offset = 0;
+	Direct3D_GetContext()->IASetVertexBuffers(0, 1, &model->VertexBuffer, &stride, &offset);
+	Direct3D_GetContext()->IASetIndexBuffer(model->IndexBuffer, model->IndexFormat, 0);//unsigned shortR16Aunsigned intR32
 
-	for (unsigned int m = 0; m < model->AiScene->mNumMeshes; m++)//mbV(f̕)̔ԍ
+	for (const MODEL_MESH& mesh : model->Mesh)//bV(f̕)
 	{
 		Shader3DUnlit_SetColor({ 1.0f, 1.0f, 1.0f, 1.0f });
 		// eNX`̐ݒ
-		aiString texture;
-		aiMaterial* aimaterial = model->AiScene->mMaterials[model->AiScene->mMeshes[m]->mMaterialIndex];
-		aimaterial->GetTexture(aiTextureType_DIFFUSE, 0, &texture);
-
-		if (texture.length != 0) {
+		if (!mesh.TextureName.empty()) {
 			//if (texture != aiString("")) {
-			Direct3D_GetContext()->PSSetShaderResources(0, 1, &model->Texture[texture.data]);
-
-			aiMaterial* aimaterial = model->AiScene->mMaterials[model->AiScene->mMeshes[m]->mMaterialIndex];
+			SetModelTexture(model, mesh.TextureName.c_str());
 		}
 		else {
 			Texture_SetTexture(g_TextureWhite);
 
-			aiColor3D diffuse;
 			//Q[J̃fʁAp[cʁAsNZʂɃ_Oς@́uXyL[}bvvBueNX`}bvv̒̂P큁
-			aimaterial->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse);//AI_MATKEY_COLOR_SPECULARƂp[cƂɃ_Oς邩
-			Shader3DUnlit_SetColor({ diffuse.r, diffuse.g, diffuse.b, 1.0f });//shader3d.h/cpp
+			Shader3DUnlit_SetColor({ mesh.Diffuse.x, mesh.Diffuse.y, mesh.Diffuse.z, 1.0f });//shader3d.h/cpp
 		}
 
 		//}eAݒ J[rB̑sNԐFɖ߂fbxł͌XԐF
@@ -393,18 +624,10 @@ void ModelUnlitDraw(MODEL* model, const XMMATRIX& mtxWorld)
 		Shader3d_SetColor({ diffuse.r, diffuse.g, diffuse.b, 1.0f });//shader3d.h/cpp*/
 
 
-		// _obt@`pCvCɐݒ
-		UINT stride = sizeof(Vertex3d);
-		UINT offset = 0;
-		Direct3D_GetContext()->IASetVertexBuffers(0, 1, &model->VertexBuffer[m], &stride, &offset);
-
-		// CfbNXobt@`pCvCɐݒ
-		Direct3D_GetContext()->IASetIndexBuffer(model->IndexBuffer[m], DXGI_FORMAT_R32_UINT, 0);//unsigned shortR16Aunsigned intR32
-
 		// |S`施ߔs
 					/*============ʂ̐(₷т6_K)==============*/
 		//g_pContext->Draw(NUM_VERTEX, 0);
-		Direct3D_GetContext()->DrawIndexed(model->AiScene->mMeshes[m]->mNumFaces * 3, 0, 0);
+		Direct3D_GetContext()->DrawIndexed(mesh.IndexCount, mesh.StartIndex, mesh.BaseVertex);
 	}
 }
 
@@ -17,28 +17,53 @@
 #include "Assimp/assimp/matrix4x4.h"
 #pragma comment (lib, "assimp-vc143-mt.lib")
 #include <unordered_map>
+#include <string>
+#include <vector>
 
 #include"collision.h"
+#include "vertex_pack.h"
 #include<d3d11.h>
 #include<DirectXMath.h>
 
 
 
-struct MODEL
+// ʂƂ̕`͈͂ƃ}eA
+struct MODEL_MESH
 {
-	const aiScene* AiScene = nullptr;
+	unsigned int StartIndex = 0;
+	unsigned int IndexCount = 0;
+	int BaseVertex = 0;
+	std::string TextureName;              // fBt[ỸeNX`iȂ΋j
+	DirectX::XMFLOAT4 Diffuse{ 1.0f, 1.0f, 1.0f, 1.0f }; // eNX`ȂƂ̐F
+};
 
-	ID3D11Buffer** VertexBuffer;
-	ID3D11Buffer** IndexBuffer;
+struct MODEL
+{
+	ID3D11Buffer* VertexBuffer = nullptr; // SbV܂Ƃ߂1{
+	ID3D11Buffer* IndexBuffer = nullptr;
+	DXGI_FORMAT IndexFormat = DXGI_FORMAT_R32_UINT; // ϊ 16bit Ɏ܂ R16
+	VertexPackBounds PackBounds{};                  // _ PackedVertex3dBʒu͂̔ɑ΂ċl߂Ă
+	std::vector<MODEL_MESH> Mesh;
 
-	std::unordered_map<std::string, ID3D11ShaderResourceView*> Texture;
+	std::unordered_map<std::string, ID3D11ShaderResourceView*> Texture;   // FBXɓĂ
+	std::unordered_map<std::string, int> TextureId;                      // ʃt@Ĉ́ieNX`Ǘ̔ԍj
 
 	AABB local_aabb{};
 };
 
 
+// cooked/ ɕϊς݂̂̂΂}bvēǂށBȂ Assimp œǂŏo
+//  FileNameEscaleEisBrender Ȃǂݍݍς݂̂̂LiQƐj
 MODEL* ModelLoad(const char* FileName, float scale, bool isBrender=false);
+// QƂԂB0 ɂȂĂ Model_PurgeUnused ܂ł͎ci蒼ΓǂݍݒȂj
 void ModelRelease(MODEL* model);
+
+// QƂ 0 ̃fB߂l͏iXe[W؂ւ̌ɌĂԁj
+int Model_PurgeUnused();
+// ǂݍ܂Ă郂f̐igpjƁA_ECfbNXobt@̃oCg
+int Model_GetResidentCount();
+int Model_GetUnusedCount();
+unsigned long long Model_GetResidentBytes();
 void ModelDraw(MODEL* model ,const DirectX::XMMATRIX& mtxWorld);
 void ModelDepthDraw(MODEL* model, const DirectX::XMMATRIX& mtxWorld);
 void ModelUnlitDraw(MODEL* model, const DirectX::XMMATRIX& mtxWorld);
@@ -0,0 +1,207 @@
+/*==============================================================================
+
+@@@f̎OϊioCi`j[model_cook.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "model_cook.h"
+#include <cstring>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<ModelCookHeader>::value, "header is written as bytes");
+
+namespace
+{
+    const uint32_t kMagic = 0x4c444d41; // "AMDL"
+
+    uint32_t Align16(size_t v)
+    {
+        return (uint32_t)((v + 15) & ~(size_t)15);
+    }
+
+    //  16 oCgEɒǉāÄʒuԂ
+    uint32_t Append(std::vector<uint8_t>* out, const void* data, size_t bytes)
+    {
+        const uint32_t offset = Align16(out->size());
+        out->resize(offset + bytes);
+        if (data && bytes) std::memcpy(out->data() + offset, data, bytes);
+        return offset;
+    }
+
+    bool InRange(size_t size, uint64_t offset, uint64_t bytes)
+    {
+        return offset <= size && bytes <= size - offset;
+    }
+
+    uint64_t Fnv1a(const void* data, size_t size, uint64_t h)
+    {
+        const uint8_t* p = (const uint8_t*)data;
+        for (size_t i = 0; i < size; ++i) {
+            h ^= p[i];
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+}
+
+bool ModelCook_Write(const ModelCookData& data, const ModelCookSource& source, std::vector<uint8_t>* out)
+{
+    out->clear();
+    for (const ModelCookMesh& m : data.meshes) {
+        if ((uint64_t)m.baseVertex + m.vertexCount > data.vertices.size()) return false;
+        if ((uint64_t)m.startIndex + m.indexCount > data.indices.size()) return false;
+        if (m.material >= data.materials.size()) return false;
+    }
+
+    ModelCookHeader header{};
+    header.magic = kMagic;
+    header.version = MODEL_COOK_VERSION;
+    header.source = source;
+    std::memcpy(header.aabbMin, data.aabbMin, sizeof(header.aabbMin));
+    std::memcpy(header.aabbMax, data.aabbMax, sizeof(header.aabbMax));
+    header.vertexCount = (uint32_t)data.vertices.size();
+    header.indexCount = (uint32_t)data.indices.size();
+    header.meshCount = (uint32_t)data.meshes.size();
+    header.materialCount = (uint32_t)data.materials.size();
+    header.textureCount = (uint32_t)data.textures.size();
+
+    Append(out, &header, sizeof(header)); // ʒu͍Ōɏ
+
+    // ʒu̓fŜ̋Eɑ΂ċl߂
+    const VertexPackBounds bounds = VertexPack_MakeBounds(data.aabbMin, data.aabbMax);
+    std::vector<PackedVertex3d> packed(data.vertices.size());
+    for (size_t i = 0; i < data.vertices.size(); ++i) {
+        const ModelCookVertex& src = data.vertices[i];
+        VertexPack_Pack(bounds, src.position, src.normal, src.color, src.texcoord, &packed[i]);
+    }
+    header.vertexOffset = Append(out, packed.data(), packed.size() * sizeof(PackedVertex3d));
+
+    // bV̔ԍȂ̂ŁAǂ̃bV 65536 _ȉȂ 16bit ő
+    bool small = true;
+    for (const ModelCookMesh& m : data.meshes) small = small && m.vertexCount <= 0x10000;
+    header.indexSize = small ? 2 : 4;
+    if (small) {
+        std::vector<uint16_t> indices16(data.indices.begin(), data.indices.end());
+        header.indexOffset = Append(out, indices16.data(), indices16.size() * sizeof(uint16_t));
+    }
+    else {
+        header.indexOffset = Append(out, data.indices.data(), data.indices.size() * sizeof(uint32_t));
+    }
+    header.meshOffset = Append(out, data.meshes.data(), data.meshes.size() * sizeof(ModelCookMesh));
+
+    // ϒ͕̂̂\̌ɒûŁA\͐ɏꏊ
+    header.materialOffset = Append(out, nullptr, data.materials.size() * sizeof(ModelCookMaterialRecord));
+    header.textureOffset = Append(out, nullptr, data.textures.size() * sizeof(ModelCookTextureRecord));
+
+    for (size_t i = 0; i < data.materials.size(); ++i) {
+        const ModelCookMaterial& src = data.materials[i];
+        ModelCookMaterialRecord r{};
+        r.textureName = Append(out, src.texture.data(), src.texture.size());
+        r.textureNameLength = (uint32_t)src.texture.size();
+        std::memcpy(r.diffuse, src.diffuse, sizeof(r.diffuse));
+        std::memcpy(out->data() + header.materialOffset + i * sizeof(r), &r, sizeof(r));
+    }
+
+    for (size_t i = 0; i < data.textures.size(); ++i) {
+        const ModelCookTexture& src = data.textures[i];
+        ModelCookTextureRecord r{};
+        r.name = Append(out, src.name.data(), src.name.size());
+        r.nameLength = (uint32_t)src.name.size();
+        r.data = Append(out, src.data.data(), src.data.size());
+        r.dataSize = (uint32_t)src.data.size();
+        std::memcpy(out->data() + header.textureOffset + i * sizeof(r), &r, sizeof(r));
+    }
+
+    out->resize(Align16(out->size()));
+    header.fileSize = (uint32_t)out->size();
+    std::memcpy(out->data(), &header, sizeof(header));
+    return true;
+}
+
+bool ModelCook_Read(const uint8_t* data, size_t size, ModelCookView* out)
+{
+    *out = ModelCookView{};
+    if (!data || size < sizeof(ModelCookHeader)) return false;
+
+    const ModelCookHeader* h = (const ModelCookHeader*)data;
+    if (h->magic != kMagic || h->version != MODEL_COOK_VERSION || h->fileSize != size) return false;
+
+    // \t@CɎ܂ĂāA16 oCgEɂ邱
+    const uint32_t offsets[] = { h->vertexOffset, h->indexOffset, h->meshOffset, h->materialOffset, h->textureOffset };
+    for (uint32_t o : offsets) {
+        if (o % 16 != 0) return false;
+    }
+    if (!InRange(size, h->vertexOffset, (uint64_t)h->vertexCount * sizeof(PackedVertex3d))) return false;
+    if (h->indexSize != 2 && h->indexSize != 4) return false;
+    if (!InRange(size, h->indexOffset, (uint64_t)h->indexCount * h->indexSize)) return false;
+    if (!InRange(size, h->meshOffset, (uint64_t)h->meshCount * sizeof(ModelCookMesh))) return false;
+    if (!InRange(size, h->materialOffset, (uint64_t)h->materialCount * sizeof(ModelCookMaterialRecord))) return false;
+    if (!InRange(size, h->textureOffset, (uint64_t)h->textureCount * sizeof(ModelCookTextureRecord))) return false;
+
+    ModelCookView v;
+    v.base = data;
+    v.header = h;
+    v.vertices = (const PackedVertex3d*)(data + h->vertexOffset);
+    v.indices = data + h->indexOffset;
+    v.meshes = (const ModelCookMesh*)(data + h->meshOffset);
+    v.materials = (const ModelCookMaterialRecord*)(data + h->materialOffset);
+    v.textures = (const ModelCookTextureRecord*)(data + h->textureOffset);
+
+    // \̒gwm߂
+    for (uint32_t i = 0; i < h->meshCount; ++i) {
+        const ModelCookMesh& m = v.meshes[i];
+        if ((uint64_t)m.baseVertex + m.vertexCount > h->vertexCount) return false;
+        if ((uint64_t)m.startIndex + m.indexCount > h->indexCount) return false;
+        if (m.material >= h->materialCount) return false;
+        for (uint32_t k = 0; k < m.indexCount; ++k) {
+            if (v.Index(m.startIndex + k) >= m.vertexCount) return false;
+        }
+    }
+    for (uint32_t i = 0; i < h->materialCount; ++i) {
+        if (!InRange(size, v.materials[i].textureName, v.materials[i].textureNameLength)) return false;
+    }
+    for (uint32_t i = 0; i < h->textureCount; ++i) {
+        if (!InRange(size, v.textures[i].name, v.textures[i].nameLength)) return false;
+        if (!InRange(size, v.textures[i].data, v.textures[i].dataSize)) return false;
+    }
+
+    *out = v;
+    return true;
+}
+
+bool ModelCook_SourceMatches(const ModelCookView& view, const ModelCookSource& source)
+{
+    const ModelCookSource& s = view.header->source;
+    return s.fileSize == source.fileSize && s.writeTime == source.writeTime
+        && s.scale == source.scale && s.flags == source.flags;
+}
+
+std::string ModelCookView::MaterialTexture(uint32_t material) const
+{
+    const ModelCookMaterialRecord& r = materials[material];
+    return std::string((const char*)base + r.textureName, r.textureNameLength);
+}
+
+std::string ModelCookView::TextureName(uint32_t texture) const
+{
+    const ModelCookTextureRecord& r = textures[texture];
+    return std::string((const char*)base + r.name, r.nameLength);
+}
+
+std::wstring ModelCook_CachePath(const std::wstring& dir, const char* fileName, float scale, uint32_t flags)
+{
+    uint64_t key = Fnv1a(fileName, std::strlen(fileName), 14695981039346656037ull);
+    key = Fnv1a(&scale, sizeof(scale), key);
+    key = Fnv1a(&flags, sizeof(flags), key);
+
+    wchar_t name[17];
+    static const wchar_t kHex[] = L"0123456789abcdef";
+    for (int i = 0; i < 16; ++i) name[i] = kHex[(key >> ((15 - i) * 4)) & 15];
+    name[16] = L'\0';
+
+    std::wstring path = dir;
+    if (!path.empty() && path.back() != L'/' && path.back() != L'\\') path += L'/';
+    return path + name + L".amdl";
+}
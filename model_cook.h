@@ -0,0 +1,143 @@
+/*==============================================================================
+
+@@@f̎OϊioCi`j[model_cook.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Assimp œǂŌ㏈܂ōς܂ʂÂ܂ GPU ɓn`1t@Cɂ܂Ƃ߂B
+    񂩂̓t@CɃ}bvāA_ECfbNX̉̂܂
+    obt@̏f[^ɓnōςށB
+
+      wb_ / _ / CfbNX / bV / }eA / eNX` / ƃeNX`̒g
+
+    e 16 oCgEɒuB_͊g嗦ƍWn̕ϊς܂
+    PackedVertex3di20 oCgAʒu̓wb_̋Eɑ΂ UNORM16jɋl߂́A
+    CfbNX̓bVƂ̔ԍi`掞 baseVertex 𑫂jB
+    ǂ̃bV_ 65536 ȉȂACfbNX 16bit ŎB
+
+    t@C̑傫EXVƓǂݍݐݒwb_ɎAvȂΎgȂB
+    CPU ŊiD3DEAssimp ɈˑȂjB
+
+==============================================================================*/
+#ifndef MODEL_COOK_H
+#define MODEL_COOK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "vertex_pack.h"
+
+// ϊ킩`ςグ
+static const uint32_t MODEL_COOK_VERSION = 3;
+
+// ϊ̒_ioƂ PackedVertex3d ɋl߂j
+struct ModelCookVertex
+{
+    float position[3];
+    float normal[3];
+    float color[4];
+    float texcoord[2];
+};
+
+struct ModelCookMesh
+{
+    uint32_t baseVertex;
+    uint32_t vertexCount;
+    uint32_t startIndex;
+    uint32_t indexCount;
+    uint32_t material;
+};
+
+// t@CƓǂݍݐݒiǂꂩς΍蒼j
+struct ModelCookSource
+{
+    uint64_t fileSize;
+    uint64_t writeTime;
+    float scale;
+    uint32_t flags;
+};
+
+//=====opiAssimp l߂j=====
+struct ModelCookMaterial
+{
+    std::string texture;   // fBt[ỸeNX`iȂ΋j
+    float diffuse[4];
+};
+
+struct ModelCookTexture
+{
+    std::string name;          // }eAQƂ閼O
+    std::vector<uint8_t> data; // PNG Ȃǂ̈kꂽ܂܂̒g
+};
+
+struct ModelCookData
+{
+    std::vector<ModelCookVertex> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<ModelCookMesh> meshes;
+    std::vector<ModelCookMaterial> materials;
+    std::vector<ModelCookTexture> textures;
+    float aabbMin[3] = {};
+    float aabbMax[3] = {};
+};
+
+bool ModelCook_Write(const ModelCookData& data, const ModelCookSource& source, std::vector<uint8_t>* out);
+
+//=====ǂݍݗpit@C̒𒼐ڎwB̃ĂԂLj=====
+struct ModelCookHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    ModelCookSource source;
+    float aabbMin[3];
+    float aabbMax[3];
+    uint32_t vertexCount, indexCount, meshCount, materialCount, textureCount;
+    uint32_t vertexOffset, indexOffset, meshOffset, materialOffset, textureOffset;
+    uint32_t indexSize; // 2  4
+    uint32_t fileSize;
+};
+
+struct ModelCookMaterialRecord
+{
+    uint32_t textureName;      // ̈ʒuit@C擪j
+    uint32_t textureNameLength;
+    float diffuse[4];
+};
+
+struct ModelCookTextureRecord
+{
+    uint32_t name;
+    uint32_t nameLength;
+    uint32_t data;
+    uint32_t dataSize;
+};
+
+struct ModelCookView
+{
+    const uint8_t* base = nullptr;
+    const ModelCookHeader* header = nullptr;
+    const PackedVertex3d* vertices = nullptr; // header  aabbMin/Max ɑ΂ċl߂Ă
+    const void* indices = nullptr; // header->indexSize oCg
+    const ModelCookMesh* meshes = nullptr;
+    const ModelCookMaterialRecord* materials = nullptr;
+    const ModelCookTextureRecord* textures = nullptr;
+
+    uint32_t Index(uint32_t i) const
+    {
+        return header->indexSize == 2 ? ((const uint16_t*)indices)[i] : ((const uint32_t*)indices)[i];
+    }
+    std::string MaterialTexture(uint32_t material) const;
+    std::string TextureName(uint32_t texture) const;
+    const uint8_t* TextureData(uint32_t texture) const { return base + textures[texture].data; }
+};
+
+// g͈̔͂m߂Ă view 𖄂߂BĂ false
+bool ModelCook_Read(const uint8_t* data, size_t size, ModelCookView* out);
+bool ModelCook_SourceMatches(const ModelCookView& view, const ModelCookSource& source);
+
+// ϊς݃t@C̖Oit@CƓǂݍݐݒ肩j
+std::wstring ModelCook_CachePath(const std::wstring& dir, const char* fileName, float scale, uint32_t flags);
+
+#endif//MODEL_COOK_H
@@ -8,6 +8,13 @@
     VF[_𑝂₳A shader3d ŕ`ł悤
     CPU ŃXLjO VertexBuffer 𖈃t[XVȈՎB
 
+    ǂݍ񂾒giSKINNED_ASSETFbVEEAjEeNX`j͓t@CȂ1LA
+    SKINNED_MODEL ̓|[Yƒ_obt@CX^XB
+
+    |[Ýum[hƂ̃[JpiAnimLocalTRSjvōčianim_blend.hjA
+    siboneFinaljɂ͍̂Ō1񂾂BUpdate ñ͍t[̃Aj߂邾ŁA
+    ] SkinnedModel_Animate `̎1B
+
 ==============================================================================*/
 
 #include "model_skinned_fixed.h"
@@ -20,23 +27,24 @@
 #include "shader3d.h"
 #include "WICTextureLoader11.h"
 #include "shader_depth.h"
+#include "asset_cache.h"
+#include "vertex_pack.h"
+#include "anim_bake.h"
+#include "anim_compress.h"
+#include "anim_blend.h"
+#include "skinning.h"
+#include "worker_pool.h"
+#include "debug_ostream.h"
 #include <cassert>
 #include <algorithm>
 #include <cstdint>
 #include <cmath>
+#include <cfloat>
+#include <thread>
 
 using namespace DirectX;
 
-//  shader3d  InputLayout ɍ킹邽߂̃tH[}bg
-struct SkinnedVertex3d
-{
-    XMFLOAT3 position;
-    XMFLOAT3 normalVector;
-    XMFLOAT4 color;
-    XMFLOAT2 texcoord;
-};
-
-
+// ǂݍݎ̍ƗpiSkinningStream ɋlߒj
 struct BaseVertex
 {
     XMFLOAT3 position;
@@ -80,7 +88,7 @@ struct Influence4
         if (sum <= 0.0f)
         {
             // 񂪂Ȃ_́Â܂܁iS0jɂĂ
-            //  Update() ŁuoCh|[Ŷ܂܁vɃtH[obN
+            //  Skinning_Build ŁuoCh|[Ŷ܂܁vɃtH[obN
             return;
         }
         float inv = 1.0f / sum;
@@ -88,23 +96,67 @@ struct Influence4
     }
 };
 
+// ǂݍ݌͕ςȂiCX^XŋLj
 struct SKINNED_MESH
 {
-    ID3D11Buffer* vb = nullptr; // dynamic
     ID3D11Buffer* ib = nullptr; // static
 
-    std::vector<BaseVertex> baseVerts;
-    std::vector<Influence4> influences;
+    SkinningStream stream;      // oCh̒_ƍ̏d݁iskinning.hj
 
     uint32_t numIndices = 0;
     uint32_t materialIndex = 0;
+};
 
-    // CPU skinning p̈ꎞƗ̈
-    std::vector<SkinnedVertex3d> skinnedVerts;
+// CX^XƂ̒_̒uꏊBSKINNED_ASSET::meshes Ɠ
+struct SKINNED_INSTANCE_MESH
+{
+    UINT vbOffset = 0;             // SKINNED_MODEL::vb ̒̐擪ioCgj
+    VertexPackBounds packBounds{}; // _̈ʒul߂Ei|[YƂɕςj
 };
-struct SKINNED_MODEL
+
+// L[̈ʒůoB擪TAÕL[i߂
+struct KeyCursor
+{
+    uint32_t position = 0;
+    uint32_t rotation = 0;
+    uint32_t scaling = 0;
+};
+
+// (f, Aj) ƂɓǂݍݎɈxΉ\Bm[hԍň
+// L[ʒuiKeyCursorj̓CX^XiSkinnedCursorSetj
+struct AnimBinding
+{
+    std::vector<const aiNodeAnim*> channel; // m[hƂ̃`liȂm[h nullptrj
+};
+
+// ԊuŏĂAjianim_bake.hjBgbN͓m[h
+struct BakedAnim
+{
+    AnimBakedClip clip;
+    std::vector<int32_t> trackNode; // gbN  m[hԍ
+};
+
+// kAjianim_compress.hjB̃L[͎̂ĂĂBL[ʒu̓CX^X
+struct CompressedAnim
+{
+    AnimCompressedClip clip;
+    std::vector<int32_t> trackNode;         // gbN  m[hԍ
+};
+
+// AjƂ̋EBǂݍݎɈԊuŎpāAƂ̔狁߂Ԃ̋؂育Ƃɂ܂Ƃ߂B
+// `悵ȂiJOŗƂjLN^͎pXLjOvȂ
+struct ClipBounds
+{
+    double ticksPerSegment = 0.0;   // ؂̒itickj
+    AABB whole{};                   // AjS
+    std::vector<AABB> segments;     // ؂育
+};
+
+// ǂݍ񂾒gBǂݍ݌͕ςȂ̂ŁA̃CX^XłLł
+struct SKINNED_ASSET
 {
     const aiScene* scene = nullptr;
+    std::string cacheKey;                    // g_SkinnedCache ̃L[iCX^X𑝂₷Ɏ蒼j
 
     std::vector<SKINNED_MESH> meshes;
     std::unordered_map<std::string, ID3D11ShaderResourceView*> textures;
@@ -112,13 +164,27 @@ struct SKINNED_MODEL
     // bone
     std::unordered_map<std::string, uint32_t> boneMap; // name->index
     std::vector<XMMATRIX> boneOffset;                  // aiBone::mOffsetMatrix
-    std::vector<XMMATRIX> boneFinal;                   // ŏIsiCPU skinning Ŏgj
 
     XMMATRIX globalInverse = XMMatrixIdentity();
 
-    // ȈՃLbV
-    int lastAnimIndex = -1;
-    double lastAnimTime = -1.0;
+    // m[hKweq̏ɕɂ́ie̔ԍ͕K菬j
+    std::vector<std::string> nodeName;
+    std::vector<int32_t> nodeParent;         //  -1
+    std::vector<int32_t> nodeBone;           // {[łȂ -1
+    std::vector<XMMATRIX> nodeLocal;         // ǂݍݎibind/restj̃[Js
+    std::vector<AnimLocalTRS> nodeRest;      // nodeLocal ʒuE]Egkɕ́i|[Y̏lj
+    std::vector<AnimBinding> animBindings;   // scene->mAnimations Ɠ
+    std::vector<BakedAnim> bakedAnims;       // сBĂĂȂ΋
+    size_t bakedPoseFloats = 0;              // AnimBake_Sample ̏ݐ̑傫iԑ傫Ajɍ킹j
+    std::vector<CompressedAnim> compressedAnims; // сBkĂȂ΋
+    uint32_t compressedPoseTracks = 0;           // AnimCompress_Sample ̏ݐ̑傫
+
+    std::vector<ClipBounds> clipBounds;      // scene->mAnimations Ɠ
+    AABB restBounds{};                       // ǂݍݎibind/restj̃|[Y̔iResetPose ̌j
+
+    // gɍiCXbhBǂ̃CX^XẮj
+    std::vector<std::vector<float>> boneMasks;            // SkinnedModel_CreateBodyMask ōm[hƂ̏d
+    std::vector<std::vector<AnimLocalTRS>> additiveBase;  // AjƂ̉Z̊iŏ̃R}jBȂ疢쐬
 
     // collision
     AABB local_aabb{};
@@ -126,8 +192,97 @@ struct SKINNED_MODEL
     float importScale = 1.0f;
 };
 
+// ǂ̃Aĵǂ̎itickjgBanimationIndex  -1 Ȃǂݍݎ̃|[Y
+struct SkinnedClipRequest
+{
+    int animationIndex = -1;
+    double animTime = 0.0;
+};
+
+// L[ʒũ͍Aj̕iAjςŏj
+struct SkinnedCursorSet
+{
+    int animationIndex = -1;
+    std::vector<KeyCursor> key;               // m[hƁiL[̂܂ܕԂ鎞j
+    std::vector<AnimCompressCursor> compress; // gbNƁikj
+};
+
+// {̃Aj̏ɏd˂́iSkinnedModel_SetLayerj
+struct SkinnedLayer
+{
+    bool active = false;
+    SkinnedClipRequest clip;
+    float weight = 0.0f;
+    SkinnedBlendMode mode = SKINNED_BLEND_OVERRIDE;
+    int mask = -1;
+    bool invertMask = false;
+    SkinnedCursorSet cursor;
+};
+
+// CX^XB|[YiboneFinalEL[ʒujƒ_obt@
+struct SKINNED_MODEL
+{
+    SKINNED_ASSET* asset = nullptr;          // LiQƂ g_SkinnedCache j
+
+    std::vector<SKINNED_INSTANCE_MESH> meshes; // asset->meshes Ɠ
+    std::vector<XMMATRIX> boneFinal;           // ŏIsiCPU skinning Ŏgj
+
+    // SbV̒_ׂ DYNAMIC  VBB|[YςXLjOďA
+    // ~܂ĂEꎞ~̃CX^X͑Oɏ̂̂܂ܕ`
+    ID3D11Buffer* vb = nullptr;
+    UINT vbBytes = 0;
+    bool vbDirty = true;
+
+    SkinnedClipRequest base;                 // ̃t[̊{̃AjiUpdate nEResetPose Ō܂j
+    SkinnedClipRequest evaluated;            // boneFinal  base
+    SkinnedCursorSet baseCursor;
+    SkinnedLayer layers[SKINNED_MAX_LAYERS];
+    bool poseDirty = false;                  // baseEwEtF[hς boneFinal Â
+    bool hasPose = false;                    // xł]iŏ̓tF[hȂj
+
+    // NXtF[hBfadeFrom ͐؂ւ̎pig_PosePool ؂āAIԂj
+    float crossfadeSec = 0.0f;
+    float fadeElapsed = 0.0f;
+    float fadeDuration = 0.0f;
+    std::vector<AnimLocalTRS> fadeFrom;
+    AABB fadeBounds{};                       // fadeFrom ̎p̔itF[h͍̃Aj̔ƍ킹j
+
+    unsigned long long countedBytes = 0;     // g_InstanceBytes ɑĂ镪
+};
+
 static int g_TextureWhite = -1;
 
+// |[YvZƃXLjO̍ƗpBCX^Xɂ͎AvZ̊ԂgiCXbhĂԑOj
+static std::vector<XMMATRIX> g_NodeGlobal;          // m[h̃[J  O[os
+static std::vector<float> g_BakedPose;              // AnimBake_Sample ̏ݐ
+static std::vector<AnimLocalTRS> g_CompressedPose;  // AnimCompress_Sample ̏ݐ
+static SkinningPalette g_Palette;                   // boneFinal  Skinning pɕג
+
+// [Jpim[hԂ AnimLocalTRSj̎g񂵁B]̊Ԃ؂ĕԂ
+static std::vector<std::vector<AnimLocalTRS>> g_PosePool;
+
+// ĂCX^X̐ƁAꂼꂪ CPU ̃oCg̍v
+static int g_InstanceCount = 0;
+static unsigned long long g_InstanceBytes = 0;
+
+// XLjO𕪂[J[iŏ̓ǂݍ݂ŋNj
+static WorkerPool g_SkinningPool;
+
+// AjĂԊui1b̃R}jB0 ȂL[̂܂ܕԂ
+static float g_BakeSampleRate = 30.0f;
+
+// Aj̋E Hz Ŏ邩EbƂɋ؂邩i0 Ȃ؂炸ɃAjŜ1j
+static const float kBoundsSampleRate = 60.0f;
+static float g_BoundsSegmentSec = 0.25f;
+
+// AjkĎBkƏĂ݂͂Ȃ
+static bool g_CompressAnimations = false;
+static AnimCompressSettings g_CompressSettings;
+
+// pXEg嗦EWn̒g1LiXe[W܂ł Purge ܂ŎcjB
+// CX^X1ɂQ1
+static AssetCache<SKINNED_ASSET> g_SkinnedCache;
+
 //------------------------------------------------------------------------------
 // Utility
 //------------------------------------------------------------------------------
@@ -147,107 +302,117 @@ static XMMATRIX CalcNodeLocalTransform(const aiNode* node)
     return AiToXM(node->mTransformation);
 }
 
-static const aiNodeAnim* FindNodeAnim(const aiAnimation* anim, const std::string& nodeName)
+// keys[i].mTime <= animTime < keys[i + 1].mTime ƂȂ i Ԃi͈͊O͒[̋ԁjB
+// ʂ̍ĐȂÖʒu12iނB߂i[vEV[Nj傫񂾎͓񕪒T
+template<class Key>
+static unsigned int FindKeyIndex(double animTime, const Key* keys, unsigned int numKeys, uint32_t& cursor)
 {
-    for (unsigned int i = 0; i < anim->mNumChannels; ++i)
+    const unsigned int last = numKeys - 2; // Ԃ̍ŌinumKeys >= 2 ŌĂԁj
+    unsigned int i = (std::min)(cursor, last);
+
+    if (animTime >= keys[i].mTime)
     {
-        const aiNodeAnim* channel = anim->mChannels[i];
-        if (nodeName == channel->mNodeName.C_Str())
-            return channel;
+        for (int step = 0; step < 4 && i < last && animTime >= keys[i + 1].mTime; ++step)
+            ++i;
+        if (i < last && animTime >= keys[i + 1].mTime)
+            i = (unsigned int)(std::upper_bound(keys + i + 1, keys + numKeys, animTime,
+                [](double t, const Key& k) { return t < k.mTime; }) - keys) - 1;
     }
-    return nullptr;
-}
-
-static unsigned int FindKeyIndex(double animTime, const aiVectorKey* keys, unsigned int numKeys)
-{
-    for (unsigned int i = 0; i + 1 < numKeys; ++i)
+    else
     {
-        if (animTime < keys[i + 1].mTime)
-            return i;
+        const Key* found = std::upper_bound(keys, keys + i, animTime,
+            [](double t, const Key& k) { return t < k.mTime; });
+        i = found == keys ? 0 : (unsigned int)(found - keys) - 1;
     }
-    return (std::max)(0u, numKeys - 1);
 
+    i = (std::min)(i, last);
+    cursor = i;
+    return i;
 }
 
-static unsigned int FindKeyIndex(double animTime, const aiQuatKey* keys, unsigned int numKeys)
+template<class Key>
+static float KeyFactor(double animTime, const Key& a, const Key& b)
 {
-    for (unsigned int i = 0; i + 1 < numKeys; ++i)
-    {
-        if (animTime < keys[i + 1].mTime)
-            return i;
-    }
-    return (std::max)(0u, numKeys - 1);
-
+    if (b.mTime <= a.mTime) return 0.0f;
+    const double f = (animTime - a.mTime) / (b.mTime - a.mTime);
+    return (float)(std::max)(0.0, (std::min)(f, 1.0));
 }
 
-static XMMATRIX InterpolatePosition(double animTime, const aiNodeAnim* channel)
+// L[̂Ȃ͒Pʁiʒu 0E]ȂEgk 1j
+static void InterpolatePosition(double animTime, const aiNodeAnim* channel, uint32_t& cursor, float out3[3])
 {
-    if (!channel || channel->mNumPositionKeys == 0)
-        return XMMatrixIdentity();
+    if (channel->mNumPositionKeys == 0)
+    {
+        out3[0] = out3[1] = out3[2] = 0.0f;
+        return;
+    }
 
     if (channel->mNumPositionKeys == 1)
     {
         const aiVector3D& v = channel->mPositionKeys[0].mValue;
-        return XMMatrixTranslation(v.x, v.y, v.z);
+        out3[0] = v.x; out3[1] = v.y; out3[2] = v.z;
+        return;
     }
 
-    unsigned int idx = FindKeyIndex(animTime, channel->mPositionKeys, channel->mNumPositionKeys);
+    unsigned int idx = FindKeyIndex(animTime, channel->mPositionKeys, channel->mNumPositionKeys, cursor);
     unsigned int next = idx + 1;
 
-    double t1 = channel->mPositionKeys[idx].mTime;
-    double t2 = channel->mPositionKeys[next].mTime;
-    float factor = (t2 > t1) ? (float)((animTime - t1) / (t2 - t1)) : 0.0f;
+    float factor = KeyFactor(animTime, channel->mPositionKeys[idx], channel->mPositionKeys[next]);
 
     const aiVector3D& a = channel->mPositionKeys[idx].mValue;
     const aiVector3D& b = channel->mPositionKeys[next].mValue;
 
     aiVector3D out = a + (b - a) * factor;
-    return XMMatrixTranslation(out.x, out.y, out.z);
+    out3[0] = out.x; out3[1] = out.y; out3[2] = out.z;
 }
 
-static XMMATRIX InterpolateScaling(double animTime, const aiNodeAnim* channel)
+static void InterpolateScaling(double animTime, const aiNodeAnim* channel, uint32_t& cursor, float out3[3])
 {
-    if (!channel || channel->mNumScalingKeys == 0)
-        return XMMatrixIdentity();
+    if (channel->mNumScalingKeys == 0)
+    {
+        out3[0] = out3[1] = out3[2] = 1.0f;
+        return;
+    }
 
     if (channel->mNumScalingKeys == 1)
     {
         const aiVector3D& v = channel->mScalingKeys[0].mValue;
-        return XMMatrixScaling(v.x, v.y, v.z);
+        out3[0] = v.x; out3[1] = v.y; out3[2] = v.z;
+        return;
     }
 
-    unsigned int idx = FindKeyIndex(animTime, channel->mScalingKeys, channel->mNumScalingKeys);
+    unsigned int idx = FindKeyIndex(animTime, channel->mScalingKeys, channel->mNumScalingKeys, cursor);
     unsigned int next = idx + 1;
 
-    double t1 = channel->mScalingKeys[idx].mTime;
-    double t2 = channel->mScalingKeys[next].mTime;
-    float factor = (t2 > t1) ? (float)((animTime - t1) / (t2 - t1)) : 0.0f;
+    float factor = KeyFactor(animTime, channel->mScalingKeys[idx], channel->mScalingKeys[next]);
 
     const aiVector3D& a = channel->mScalingKeys[idx].mValue;
     const aiVector3D& b = channel->mScalingKeys[next].mValue;
 
     aiVector3D out = a + (b - a) * factor;
-    return XMMatrixScaling(out.x, out.y, out.z);
+    out3[0] = out.x; out3[1] = out.y; out3[2] = out.z;
 }
 
-static XMMATRIX InterpolateRotation(double animTime, const aiNodeAnim* channel)
+static void InterpolateRotation(double animTime, const aiNodeAnim* channel, uint32_t& cursor, float out4[4])
 {
-    if (!channel || channel->mNumRotationKeys == 0)
-        return XMMatrixIdentity();
+    if (channel->mNumRotationKeys == 0)
+    {
+        out4[0] = out4[1] = out4[2] = 0.0f;
+        out4[3] = 1.0f;
+        return;
+    }
 
     if (channel->mNumRotationKeys == 1)
     {
         const aiQuaternion& q = channel->mRotationKeys[0].mValue;
-        XMVECTOR rot = XMVectorSet(q.x, q.y, q.z, q.w);
-        return XMMatrixRotationQuaternion(rot);
+        out4[0] = q.x; out4[1] = q.y; out4[2] = q.z; out4[3] = q.w;
+        return;
     }
 
-    unsigned int idx = FindKeyIndex(animTime, channel->mRotationKeys, channel->mNumRotationKeys);
+    unsigned int idx = FindKeyIndex(animTime, channel->mRotationKeys, channel->mNumRotationKeys, cursor);
     unsigned int next = idx + 1;
 
-    double t1 = channel->mRotationKeys[idx].mTime;
-    double t2 = channel->mRotationKeys[next].mTime;
-    float factor = (t2 > t1) ? (float)((animTime - t1) / (t2 - t1)) : 0.0f;
+    float factor = KeyFactor(animTime, channel->mRotationKeys[idx], channel->mRotationKeys[next]);
 
     const aiQuaternion& a = channel->mRotationKeys[idx].mValue;
     const aiQuaternion& b = channel->mRotationKeys[next].mValue;
@@ -256,99 +421,509 @@ static XMMATRIX InterpolateRotation(double animTime, const aiNodeAnim* channel)
     aiQuaternion::Interpolate(out, a, b, factor);
     out.Normalize();
 
-    XMVECTOR rot = XMVectorSet(out.x, out.y, out.z, out.w);
-    return XMMatrixRotationQuaternion(rot);
+    out4[0] = out.x; out4[1] = out.y; out4[2] = out.z; out4[3] = out.w;
 }
 
-static void ReadNodeHierarchy(
-    double animTime,
-    const aiNode* node,
-    const XMMATRIX& parentTransform,
-    const aiAnimation* anim,
-    const std::unordered_map<std::string, uint32_t>& boneMap,
-    const std::vector<XMMATRIX>& boneOffset,
-    const XMMATRIX& globalInverse,
-    std::vector<XMMATRIX>& outFinal
-)
+//------------------------------------------------------------------------------
+// SkeletoniǂݍݎɈxOňāAƂ͔ԍŉ񂷁j
+//------------------------------------------------------------------------------
+static void FlattenNodes(SKINNED_ASSET* asset, const aiNode* node, int32_t parent, std::vector<std::string>& names)
 {
-    std::string nodeName = node->mName.C_Str();
+    const int32_t index = (int32_t)asset->nodeParent.size();
+    names.push_back(node->mName.C_Str());
+
+    auto bone = asset->boneMap.find(names.back());
+    asset->nodeParent.push_back(parent);
+    asset->nodeBone.push_back(bone != asset->boneMap.end() ? (int32_t)bone->second : -1);
+    asset->nodeLocal.push_back(CalcNodeLocalTransform(node));
+
+    for (unsigned int i = 0; i < node->mNumChildren; ++i)
+    {
+        FlattenNodes(asset, node->mChildren[i], index, names);
+    }
+}
+
+// {[̓o^iboneMapjςłĂ
+static void BuildSkeleton(SKINNED_ASSET* asset)
+{
+    std::vector<std::string>& names = asset->nodeName;
+    FlattenNodes(asset, asset->scene->mRootNode, -1, names);
+
+    // 鎞̏lBČ̍sɖ߂Ȃifjm[h͏o͂ɏo
+    asset->nodeRest.resize(names.size());
+    int skewed = 0;
+    for (size_t n = 0; n < names.size(); ++n)
+    {
+        XMVECTOR s, r, t;
+        AnimLocalTRS& rest = asset->nodeRest[n];
+        if (!XMMatrixDecompose(&s, &r, &t, asset->nodeLocal[n]))
+        {
+            rest = AnimBlend_Identity();
+            ++skewed;
+            continue;
+        }
+        XMStoreFloat3((XMFLOAT3*)rest.t, t);
+        XMStoreFloat4((XMFLOAT4*)rest.r, r);
+        XMStoreFloat3((XMFLOAT3*)rest.s, s);
+
+        const XMMATRIX back = XMMatrixScalingFromVector(s) * XMMatrixRotationQuaternion(r) * XMMatrixTranslationFromVector(t);
+        for (int row = 0; row < 4; ++row)
+        {
+            if (!XMVector4NearEqual(back.r[row], asset->nodeLocal[n].r[row], XMVectorReplicate(1e-3f)))
+            {
+                ++skewed;
+                break;
+            }
+        }
+    }
+    if (skewed > 0)
+        hal::dout << "SkinnedModel_Load() : ʒuE]EgkɕȂm[h " << skewed << " ipƂj" << std::endl;
+
+    asset->animBindings.resize(asset->scene->mNumAnimations);
+    for (unsigned int a = 0; a < asset->scene->mNumAnimations; ++a)
+    {
+        const aiAnimation* anim = asset->scene->mAnimations[a];
+
+        // Õ`lΐ̂
+        std::unordered_map<std::string, const aiNodeAnim*> channelByName;
+        for (unsigned int c = 0; c < anim->mNumChannels; ++c)
+        {
+            channelByName.emplace(anim->mChannels[c]->mNodeName.C_Str(), anim->mChannels[c]);
+        }
+
+        AnimBinding& binding = asset->animBindings[a];
+        binding.channel.assign(names.size(), nullptr);
+        for (size_t n = 0; n < names.size(); ++n)
+        {
+            auto it = channelByName.find(names[n]);
+            if (it != channelByName.end()) binding.channel[n] = it->second;
+        }
+    }
+}
+
+// g_NodeGlobal m[hɍ킹i߂̐񂾂mۂj
+static XMMATRIX* NodeGlobalScratch(const SKINNED_ASSET* asset)
+{
+    if (g_NodeGlobal.size() < asset->nodeParent.size())
+        g_NodeGlobal.resize(asset->nodeParent.size());
+    return g_NodeGlobal.data();
+}
+
+static std::vector<AnimLocalTRS> AcquirePose(size_t nodeCount)
+{
+    std::vector<AnimLocalTRS> pose;
+    if (!g_PosePool.empty())
+    {
+        pose = std::move(g_PosePool.back());
+        g_PosePool.pop_back();
+    }
+    pose.resize(nodeCount);
+    return pose;
+}
+
+static void ReleasePose(std::vector<AnimLocalTRS>& pose)
+{
+    if (pose.capacity() == 0) return;
+    g_PosePool.push_back(std::move(pose));
+    pose.clear();
+}
+
+// g_NodeGlobal Ƀ[JsĂĂԁBe珇Ɋ|āie͐ɍςłjboneFinal 
+static void ComposeHierarchy(SKINNED_MODEL* model)
+{
+    const SKINNED_ASSET* asset = model->asset;
+    XMMATRIX* nodeGlobal = g_NodeGlobal.data();
+
+    for (auto& mtx : model->boneFinal)
+    {
+        mtx = XMMatrixIdentity();
+    }
+
+    const size_t nodeCount = asset->nodeParent.size();
+    for (size_t n = 0; n < nodeCount; ++n)
+    {
+        // row-vectorFq̃[JɂāAe̕ϊɂ
+        const int32_t parent = asset->nodeParent[n];
+        if (parent >= 0)
+            nodeGlobal[n] = nodeGlobal[n] * nodeGlobal[parent];
 
-    XMMATRIX nodeTransform = CalcNodeLocalTransform(node);
+        const int32_t bone = asset->nodeBone[n];
+        if (bone >= 0)
+        {
+            // AssimpԂ row-vector ɒ`
+            model->boneFinal[bone] = asset->boneOffset[bone] * nodeGlobal[n] * asset->globalInverse;
+        }
+    }
+}
 
-    const aiNodeAnim* channel = FindNodeAnim(anim, nodeName);
-    if (channel)
+// I[Jp boneFinal i1t[1j
+static void ComposePose(SKINNED_MODEL* model, const AnimLocalTRS* pose)
+{
+    XMMATRIX* nodeGlobal = NodeGlobalScratch(model->asset);
+
+    const size_t nodeCount = model->asset->nodeParent.size();
+    for (size_t n = 0; n < nodeCount; ++n)
     {
         // row-vector Łupos * S * R * TvɂȂ悤ɂ
-        XMMATRIX S = InterpolateScaling(animTime, channel);
-        XMMATRIX R = InterpolateRotation(animTime, channel);
-        XMMATRIX T = InterpolatePosition(animTime, channel);
-        nodeTransform = S * R * T;
+        const AnimLocalTRS& trs = pose[n];
+        XMMATRIX S = XMMatrixScaling(trs.s[0], trs.s[1], trs.s[2]);
+        XMMATRIX R = XMMatrixRotationQuaternion(XMVectorSet(trs.r[0], trs.r[1], trs.r[2], trs.r[3]));
+        XMMATRIX T = XMMatrixTranslation(trs.t[0], trs.t[1], trs.t[2]);
+        nodeGlobal[n] = S * R * T;
     }
 
-    // row-vectorFq̃[JɂāAe̕ϊɂ
-    XMMATRIX globalTransform = nodeTransform * parentTransform;
+    ComposeHierarchy(model);
+}
 
-    auto it = boneMap.find(nodeName);
-    if (it != boneMap.end())
+// L[ʒuAjɍ킹BAjςŏicĂĂ񕪒TŖ߂邪AʂɒTȂj
+static void BindCursor(const SKINNED_ASSET* asset, int animationIndex, SkinnedCursorSet* cursor)
+{
+    if (cursor->animationIndex == animationIndex) return;
+    cursor->animationIndex = animationIndex;
+    cursor->key.assign(asset->nodeParent.size(), KeyCursor{});
+    cursor->compress.assign(asset->compressedPoseTracks, AnimCompressCursor{});
+}
+
+// L[̂܂ܕԂBm[hɔႷԂŁAmۂ͂Ȃ
+static void SampleKeys(const SKINNED_ASSET* asset, const AnimBinding& binding, double animTime,
+    KeyCursor* cursors, AnimLocalTRS* pose)
+{
+    const size_t nodeCount = asset->nodeParent.size();
+    for (size_t n = 0; n < nodeCount; ++n)
     {
-        uint32_t boneIndex = it->second;
-        // AssimpԂ row-vector ɒ`
-        outFinal[boneIndex] = boneOffset[boneIndex] * globalTransform * globalInverse;
+        const aiNodeAnim* channel = binding.channel[n];
+        if (!channel) continue;
+
+        KeyCursor& cursor = cursors[n];
+        InterpolatePosition(animTime, channel, cursor.position, pose[n].t);
+        InterpolateRotation(animTime, channel, cursor.rotation, pose[n].r);
+        InterpolateScaling(animTime, channel, cursor.scaling, pose[n].s);
     }
+}
 
-    for (unsigned int i = 0; i < node->mNumChildren; ++i)
+// Ă\BO2R}SgbN܂Ƃ߂ĕԂāAm[hւ
+static void SampleBaked(const SKINNED_ASSET* asset, const BakedAnim& baked, double animTime, AnimLocalTRS* pose)
+{
+    const AnimBakedClip& clip = baked.clip;
+    if (g_BakedPose.size() < asset->bakedPoseFloats)
+        g_BakedPose.resize(asset->bakedPoseFloats);
+    const float* sample = g_BakedPose.data();
+    AnimBake_Sample(clip, animTime, g_BakedPose.data());
+
+    const uint32_t stride = clip.trackStride;
+    for (uint32_t t = 0; t < clip.trackCount; ++t)
+    {
+        AnimLocalTRS& trs = pose[baked.trackNode[t]];
+        for (int i = 0; i < 3; ++i)
+        {
+            trs.t[i] = sample[(ANIM_TX + i) * stride + t];
+            trs.s[i] = sample[(ANIM_SX + i) * stride + t];
+        }
+        for (int i = 0; i < 4; ++i)
+        {
+            trs.r[i] = sample[(ANIM_RX + i) * stride + t];
+        }
+    }
+}
+
+// k\Bm[hւ
+static void SampleCompressed(const SKINNED_ASSET* asset, const CompressedAnim& compressed, double animTime,
+    AnimCompressCursor* cursors, AnimLocalTRS* pose)
+{
+    if (g_CompressedPose.size() < asset->compressedPoseTracks)
+        g_CompressedPose.resize(asset->compressedPoseTracks);
+    AnimLocalTRS* sample = g_CompressedPose.data();
+    AnimCompress_Sample(compressed.clip, animTime, cursors, sample);
+
+    for (uint32_t t = 0; t < compressed.clip.trackCount; ++t)
     {
-        ReadNodeHierarchy(animTime, node->mChildren[i], globalTransform, anim, boneMap, boneOffset, globalInverse, outFinal);
+        pose[compressed.trackNode[t]] = sample[t];
     }
 }
 
-static void ReadNodeHierarchyBindPose(
-    const aiNode* node,
-    const DirectX::XMMATRIX& parentTransform,
-    const std::unordered_map<std::string, uint32_t>& boneMap,
-    const std::vector<DirectX::XMMATRIX>& boneOffset,
-    const DirectX::XMMATRIX& globalInverse,
-    std::vector<DirectX::XMMATRIX>& outFinal
-)
+// request ̎p poseim[hԂjɏBȂm[h͓ǂݍݎ̂܂
+static void SampleClip(const SKINNED_ASSET* asset, const SkinnedClipRequest& request, SkinnedCursorSet* cursor, AnimLocalTRS* pose)
 {
-    using namespace DirectX;
+    std::copy(asset->nodeRest.begin(), asset->nodeRest.end(), pose);
+
+    const int a = request.animationIndex;
+    if (a < 0 || a >= (int)asset->animBindings.size()) return;
 
-    std::string nodeName = node->mName.C_Str();
+    BindCursor(asset, a, cursor);
+    if (a < (int)asset->compressedAnims.size() && asset->compressedAnims[a].clip.trackCount > 0)
+        SampleCompressed(asset, asset->compressedAnims[a], request.animTime, cursor->compress.data(), pose);
+    else if (a < (int)asset->bakedAnims.size() && asset->bakedAnims[a].clip.frameCount > 0)
+        SampleBaked(asset, asset->bakedAnims[a], request.animTime, pose);
+    else
+        SampleKeys(asset, asset->animBindings[a], request.animTime, cursor->key.data(), pose);
+}
 
-    // ǂݍݎibind/restj̃[Js
-    XMMATRIX nodeTransform = CalcNodeLocalTransform(node);
+// Z̊iAj̍ŏ̃R}jBAZbgƂɈx
+static const AnimLocalTRS* AdditiveBase(SKINNED_ASSET* asset, int animationIndex)
+{
+    if (asset->additiveBase.size() < asset->animBindings.size())
+        asset->additiveBase.resize(asset->animBindings.size());
 
-    // row-vector nȂ̂Łuq * ev
-    XMMATRIX globalTransform = nodeTransform * parentTransform;
+    std::vector<AnimLocalTRS>& base = asset->additiveBase[animationIndex];
+    if (base.empty())
+    {
+        base.resize(asset->nodeParent.size());
+        SkinnedCursorSet cursor;
+        SampleClip(asset, { animationIndex, 0.0 }, &cursor, base.data());
+    }
+    return base.data();
+}
 
-    auto it = boneMap.find(nodeName);
-    if (it != boneMap.end())
+static void AddToBounds(AABB* inout, const AABB& box)
+{
+    inout->min.x = (std::min)(inout->min.x, box.min.x);
+    inout->min.y = (std::min)(inout->min.y, box.min.y);
+    inout->min.z = (std::min)(inout->min.z, box.min.z);
+    inout->max.x = (std::max)(inout->max.x, box.max.x);
+    inout->max.y = (std::max)(inout->max.y, box.max.y);
+    inout->max.z = (std::max)(inout->max.z, box.max.z);
+}
+
+static AABB EmptyBounds()
+{
+    return { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+}
+
+// boneFinal  g_Palette ɕגiXLjOƋEŎgj
+static void FillPalette(const SKINNED_MODEL* model)
+{
+    const uint32_t boneCount = (uint32_t)model->boneFinal.size();
+    if (g_Palette.boneCount != boneCount)
+        Skinning_InitPalette(&g_Palette, boneCount);
+    for (uint32_t b = 0; b < boneCount; ++b)
     {
-        uint32_t boneIndex = it->second;
-        if (boneIndex < outFinal.size())
+        XMFLOAT4X4 m;
+        XMStoreFloat4x4(&m, model->boneFinal[b]);
+        Skinning_SetBone(&g_Palette, b, &m.m[0][0]);
+    }
+}
+
+//  boneFinal őSbV͂ޔBƂ̔𓮂ŁA_͉Ȃ
+static AABB PaletteBounds(const SKINNED_MODEL* model)
+{
+    FillPalette(model);
+
+    AABB bounds = EmptyBounds();
+    bool any = false;
+    for (const SKINNED_MESH& mesh : model->asset->meshes)
+    {
+        if (mesh.stream.vertexCount == 0) continue;
+
+        const VertexPackBounds b = Skinning_ComputeBounds(mesh.stream, g_Palette);
+        AddToBounds(&bounds, { { b.min[0], b.min[1], b.min[2] },
+            { b.min[0] + b.extent[0], b.min[1] + b.extent[1], b.min[2] + b.extent[2] } });
+        any = true;
+    }
+    return any ? bounds : model->asset->local_aabb;
+}
+
+// BuildSkeletonEĂ݁ikǰɌĂԁBĐƓoHŎpāAAjƁE؂育Ƃ̔ɂB
+// ؂̔ɂ͑ÕTv̔iTv̊Ԃ̎pقڕj
+static void BuildClipBounds(SKINNED_ASSET* asset, const char* fileName)
+{
+    SKINNED_MODEL probe; // ɓȂƗp̃CX^X
+    probe.asset = asset;
+    probe.boneFinal.assign(asset->boneOffset.size(), XMMatrixIdentity());
+
+    std::vector<AnimLocalTRS> pose = AcquirePose(asset->nodeParent.size());
+    SkinnedCursorSet cursor;
+    auto poseBounds = [&](int animationIndex, double animTime)
+    {
+        SampleClip(asset, { animationIndex, animTime }, &cursor, pose.data());
+        ComposePose(&probe, pose.data());
+        return PaletteBounds(&probe);
+    };
+
+    asset->restBounds = poseBounds(-1, 0.0);
+
+    size_t segmentTotal = 0;
+    asset->clipBounds.resize(asset->scene->mNumAnimations);
+    for (unsigned int a = 0; a < asset->scene->mNumAnimations; ++a)
+    {
+        const aiAnimation* anim = asset->scene->mAnimations[a];
+        ClipBounds& clip = asset->clipBounds[a];
+
+        const double ticksPerSecond = (anim->mTicksPerSecond != 0.0) ? anim->mTicksPerSecond : 25.0;
+        const double duration = (std::max)(0.0, anim->mDuration);
+        const double step = ticksPerSecond / kBoundsSampleRate;
+
+        clip.ticksPerSegment = (g_BoundsSegmentSec > 0.0f) ? g_BoundsSegmentSec * ticksPerSecond : duration;
+        const size_t segmentCount = (clip.ticksPerSegment > 0.0 && duration > 0.0)
+            ? (size_t)std::ceil(duration / clip.ticksPerSegment) : 1;
+        clip.segments.assign((std::max)((size_t)1, segmentCount), EmptyBounds());
+        clip.whole = EmptyBounds();
+
+        const int last = (int)clip.segments.size() - 1;
+        auto segmentOf = [&](double t)
+        {
+            if (clip.ticksPerSegment <= 0.0) return 0;
+            return (std::max)(0, (std::min)((int)(t / clip.ticksPerSegment), last));
+        };
+
+        const int sampleCount = (int)std::ceil(duration / step) + 1;
+        for (int i = 0; i < sampleCount; ++i)
         {
-            outFinal[boneIndex] = boneOffset[boneIndex] * globalTransform * globalInverse;
+            const double t = (std::min)(i * step, duration);
+            const AABB box = poseBounds((int)a, t);
+            AddToBounds(&clip.whole, box);
+            for (int seg = segmentOf(t - step); seg <= segmentOf(t + step); ++seg)
+            {
+                AddToBounds(&clip.segments[seg], box);
+            }
         }
+        segmentTotal += clip.segments.size();
     }
 
-    for (unsigned int i = 0; i < node->mNumChildren; ++i)
+    ReleasePose(pose);
+
+    hal::dout << "SkinnedModel_Load() : " << fileName << " Aj̋E " << asset->clipBounds.size() << " { "
+        << segmentTotal << " ؂i" << (segmentTotal * sizeof(AABB)) / 1024.0 << "KBj" << std::endl;
+}
+
+// request ̎p̔iǂݍݎɍ\Bp͍ȂjBhasPose łȂΓǂݍݎ̃bV̂܂
+static AABB RequestBounds(const SKINNED_MODEL* model, const SkinnedClipRequest& request)
+{
+    const SKINNED_ASSET* asset = model->asset;
+    const int a = request.animationIndex;
+    if (a < 0 || a >= (int)asset->clipBounds.size())
+        return model->hasPose ? asset->restBounds : asset->local_aabb;
+
+    const ClipBounds& clip = asset->clipBounds[a];
+    if (clip.ticksPerSegment <= 0.0) return clip.whole;
+
+    const int seg = (int)(request.animTime / clip.ticksPerSegment);
+    return clip.segments[(std::max)(0, (std::min)(seg, (int)clip.segments.size() - 1))];
+}
+
+static void CopyKeys(const aiNodeAnim* channel, AnimTrackKeys* out)
+{
+    for (unsigned int k = 0; k < channel->mNumPositionKeys; ++k)
+    {
+        const aiVectorKey& key = channel->mPositionKeys[k];
+        out->position.push_back({ key.mTime, { key.mValue.x, key.mValue.y, key.mValue.z } });
+    }
+    for (unsigned int k = 0; k < channel->mNumRotationKeys; ++k)
     {
-        ReadNodeHierarchyBindPose(
-            node->mChildren[i],
-            globalTransform,
-            boneMap,
-            boneOffset,
-            globalInverse,
-            outFinal
-        );
+        const aiQuatKey& key = channel->mRotationKeys[k];
+        out->rotation.push_back({ key.mTime, { key.mValue.x, key.mValue.y, key.mValue.z, key.mValue.w } });
+    }
+    for (unsigned int k = 0; k < channel->mNumScalingKeys; ++k)
+    {
+        const aiVectorKey& key = channel->mScalingKeys[k];
+        out->scaling.push_back({ key.mTime, { key.mValue.x, key.mValue.y, key.mValue.z } });
     }
 }
 
+// `l̂m[hgbNɂ
+static void CollectTracks(const AnimBinding& binding, std::vector<int32_t>* trackNode, std::vector<AnimTrackKeys>* tracks)
+{
+    for (size_t n = 0; n < binding.channel.size(); ++n)
+    {
+        if (!binding.channel[n]) continue;
+        trackNode->push_back((int32_t)n);
+        tracks->emplace_back();
+        CopyKeys(binding.channel[n], &tracks->back());
+    }
+}
+
+// BuildSkeleton ̌ɌĂԁBAjƂɏĂāÃL[ԂƂ̍o͂ɏo
+static void BakeAnimations(SKINNED_ASSET* asset, const char* fileName)
+{
+    if (g_BakeSampleRate <= 0.0f) return;
+
+    asset->bakedAnims.resize(asset->scene->mNumAnimations);
+    size_t poseFloats = 0;
+
+    for (unsigned int a = 0; a < asset->scene->mNumAnimations; ++a)
+    {
+        const aiAnimation* anim = asset->scene->mAnimations[a];
+        const AnimBinding& binding = asset->animBindings[a];
+        BakedAnim& baked = asset->bakedAnims[a];
+
+        std::vector<AnimTrackKeys> tracks;
+        CollectTracks(binding, &baked.trackNode, &tracks);
+
+        const double ticksPerSecond = (anim->mTicksPerSecond != 0.0) ? anim->mTicksPerSecond : 25.0;
+        if (!AnimBake_Bake(tracks, anim->mDuration, ticksPerSecond, g_BakeSampleRate, &baked.clip))
+        {
+            baked = BakedAnim{};
+            continue;
+        }
+        poseFloats = (std::max)(poseFloats, baked.clip.PoseFloats());
+
+        const AnimBakeReport report = AnimBake_Measure(baked.clip, tracks);
+        hal::dout << "SkinnedModel_Load() : " << fileName << " [" << a << "] " << anim->mName.C_Str()
+            << " " << g_BakeSampleRate << "Hz " << report.frameCount << "R} "
+            << report.bakedBytes / 1024 << "KBiL[ " << report.keyBytes / 1024 << "KBj"
+            << " 덷 ʒu " << report.maxPositionError << " ] " << report.maxRotationErrorDeg << "x"
+            << " gk " << report.maxScaleError << std::endl;
+    }
+
+    asset->bakedPoseFloats = poseFloats;
+}
+
+// BuildSkeleton ̌ɌĂԁBAjƂɈkāÃL[iaiNodeAnim ̔zĵ͎ĂB
+// 傫ẼL[ԂƂ̍E߂Ԃo͂ɏo
+static void CompressAnimations(SKINNED_ASSET* asset, const char* fileName)
+{
+    asset->compressedAnims.resize(asset->scene->mNumAnimations);
+    uint32_t maxTracks = 0;
+
+    for (unsigned int a = 0; a < asset->scene->mNumAnimations; ++a)
+    {
+        aiAnimation* anim = asset->scene->mAnimations[a];
+        CompressedAnim& compressed = asset->compressedAnims[a];
+
+        std::vector<AnimTrackKeys> tracks;
+        CollectTracks(asset->animBindings[a], &compressed.trackNode, &tracks);
+
+        if (!AnimCompress_Compress(tracks, anim->mDuration, g_CompressSettings, &compressed.clip))
+        {
+            compressed = CompressedAnim{};
+            continue;
+        }
+        maxTracks = (std::max)(maxTracks, compressed.clip.trackCount);
+
+        // 1/120 bƂɔׂ
+        const double ticksPerSecond = (anim->mTicksPerSecond != 0.0) ? anim->mTicksPerSecond : 25.0;
+        const AnimCompressReport report = AnimCompress_Measure(compressed.clip, tracks, ticksPerSecond / 120.0);
+        hal::dout << "SkinnedModel_Load() : " << fileName << " [" << a << "] " << anim->mName.C_Str()
+            << " k " << report.compressedBytes / 1024 << "KBiL[ " << report.keyBytes / 1024 << "KBj"
+            << " L[ " << report.keptKeys << "/" << report.sourceKeys
+            << " P " << report.identityChannels << "  " << report.constantChannels << "  " << report.animatedChannels
+            << "ifloat " << report.floatKeyChannels << "j"
+            << " 덷 ʒu " << report.maxPositionError << " ] " << report.maxRotationErrorDeg << "x"
+            << " gk " << report.maxScaleError
+            << " 1p " << report.decodeMicroseconds << "usiL[ " << report.keyMicroseconds << "usj" << std::endl;
+
+        // Đ͂kȂ̂ŁÃL[͎̂ĂBAssimp  CRT  new[] ŊmۂĂO
+        // iaiReleaseImport  aiNodeAnim ̃fXgN^ nullptr j
+        for (unsigned int c = 0; c < anim->mNumChannels; ++c)
+        {
+            aiNodeAnim* channel = anim->mChannels[c];
+            delete[] channel->mPositionKeys;
+            delete[] channel->mRotationKeys;
+            delete[] channel->mScalingKeys;
+            channel->mPositionKeys = nullptr;
+            channel->mRotationKeys = nullptr;
+            channel->mScalingKeys = nullptr;
+            channel->mNumPositionKeys = channel->mNumRotationKeys = channel->mNumScalingKeys = 0;
+        }
+    }
+
+    asset->compressedPoseTracks = maxTracks;
+}
+
 
 //------------------------------------------------------------------------------
 // Texture helper (model.cpp Ƃقړ)
 //------------------------------------------------------------------------------
-static void LoadEmbeddedTextures(SKINNED_MODEL* model)
+static void LoadEmbeddedTextures(SKINNED_ASSET* model)
 {
     for (unsigned int i = 0; i < model->scene->mNumTextures; ++i)
     {
@@ -372,7 +947,7 @@ static void LoadEmbeddedTextures(SKINNED_MODEL* model)
     }
 }
 
-static void LoadExternalTextures(SKINNED_MODEL* model, const char* fileName)
+static void LoadExternalTextures(SKINNED_ASSET* model, const char* fileName)
 {
     const std::string modelPath(fileName);
     size_t pos = modelPath.find_last_of("/\\");
@@ -415,9 +990,9 @@ static void LoadExternalTextures(SKINNED_MODEL* model, const char* fileName)
 //------------------------------------------------------------------------------
 // Load
 //------------------------------------------------------------------------------
-SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrender)
+static SKINNED_ASSET* LoadSkinnedAsset(const char* fileName, float scale, bool isBrender)
 {
-    SKINNED_MODEL* model = new SKINNED_MODEL;
+    SKINNED_ASSET* model = new SKINNED_ASSET;
 
     model->importScale = scale;
 
@@ -433,8 +1008,13 @@ SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrend
     LoadEmbeddedTextures(model);
     LoadExternalTextures(model, fileName);
 
-    // bV
+    // XLjOp̃[J[iCXbhƕ`̕cj
+    if (!g_SkinningPool.IsRunning())
+        g_SkinningPool.Start((std::max)(1, (std::min)(4, (int)std::thread::hardware_concurrency() - 1)));
+
+    // bVB̐S̃bVǂނ܂Ō܂Ȃ̂ŁASkinningStream ͍Ōɍ
     model->meshes.resize(model->scene->mNumMeshes);
+    std::vector<std::vector<SkinningSourceVertex>> sources(model->scene->mNumMeshes);
 
     bool aabbInit = false;
 
@@ -444,9 +1024,8 @@ SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrend
         SKINNED_MESH& out = model->meshes[m];
         out.materialIndex = mesh->mMaterialIndex;
 
-        out.baseVerts.resize(mesh->mNumVertices);
-        out.influences.resize(mesh->mNumVertices);
-        out.skinnedVerts.resize(mesh->mNumVertices);
+        std::vector<BaseVertex> baseVerts(mesh->mNumVertices);
+        std::vector<Influence4> influences(mesh->mNumVertices);
 
         // base vertices
         for (unsigned int v = 0; v < mesh->mNumVertices; ++v)
@@ -471,7 +1050,7 @@ SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrend
             else
                 bv.uv = XMFLOAT2(0, 0);
 
-            out.baseVerts[v] = bv;
+            baseVerts[v] = bv;
 
             // local AABB (bind pose)
             if (!aabbInit)
@@ -489,12 +1068,6 @@ SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrend
                 model->local_aabb.max.y = (std::max)(model->local_aabb.max.y, bv.position.y);
                 model->local_aabb.max.z = (std::max)(model->local_aabb.max.z, bv.position.z);
             }
-
-            // ̓oCh|[Ŷ܂ܓĂ
-            out.skinnedVerts[v].position = bv.position;
-            out.skinnedVerts[v].normalVector = bv.normal;
-            out.skinnedVerts[v].texcoord = bv.uv;
-            out.skinnedVerts[v].color = XMFLOAT4(1, 1, 1, 1);
         }
 
         // bones  _ê݂L^
@@ -511,7 +1084,6 @@ SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrend
                 model->boneMap[boneName] = boneIndex;
 
                 model->boneOffset.push_back(AiToXM(bone->mOffsetMatrix));
-                model->boneFinal.push_back(XMMatrixIdentity());
             }
             else
             {
@@ -521,13 +1093,33 @@ SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrend
             for (unsigned int w = 0; w < bone->mNumWeights; ++w)
             {
                 const aiVertexWeight& vw = bone->mWeights[w];
-                out.influences[vw.mVertexId].Add((uint16_t)boneIndex, vw.mWeight);
+                influences[vw.mVertexId].Add((uint16_t)boneIndex, vw.mWeight);
             }
         }
 
-        for (auto& inf : out.influences)
+        for (auto& inf : influences)
             inf.Normalize();
 
+        sources[m].resize(mesh->mNumVertices);
+        for (unsigned int v = 0; v < mesh->mNumVertices; ++v)
+        {
+            SkinningSourceVertex& src = sources[m][v];
+            src.position[0] = baseVerts[v].position.x;
+            src.position[1] = baseVerts[v].position.y;
+            src.position[2] = baseVerts[v].position.z;
+            src.normal[0] = baseVerts[v].normal.x;
+            src.normal[1] = baseVerts[v].normal.y;
+            src.normal[2] = baseVerts[v].normal.z;
+            src.color[0] = src.color[1] = src.color[2] = src.color[3] = 1.0f;
+            src.texcoord[0] = baseVerts[v].uv.x;
+            src.texcoord[1] = baseVerts[v].uv.y;
+            for (int i = 0; i < 4; ++i)
+            {
+                src.bone[i] = influences[v].idx[i];
+                src.weight[i] = influences[v].w[i];
+            }
+        }
+
         // index buffer
         std::vector<uint32_t> indices;
         indices.reserve(mesh->mNumFaces * 3);
@@ -543,21 +1135,7 @@ SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrend
 
         out.numIndices = (uint32_t)indices.size();
 
-        // create VB (dynamic) / IB (default)
-        {
-            D3D11_BUFFER_DESC bd{};
-            bd.Usage = D3D11_USAGE_DYNAMIC;
-            bd.ByteWidth = (UINT)(sizeof(SkinnedVertex3d) * out.skinnedVerts.size());
-            bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-            bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-
-            D3D11_SUBRESOURCE_DATA sd{};
-            sd.pSysMem = out.skinnedVerts.data();
-
-            HRESULT hr = Direct3D_GetDevice()->CreateBuffer(&bd, &sd, &out.vb);
-            assert(SUCCEEDED(hr));
-        }
-
+        // create IB (default)BVB ̓CX^XƁiCreateInstancej
         {
             D3D11_BUFFER_DESC bd{};
             bd.Usage = D3D11_USAGE_DEFAULT;
@@ -572,18 +1150,28 @@ SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrend
         }
     }
 
+    const uint32_t boneCount = (uint32_t)model->boneOffset.size();
+    for (unsigned int m = 0; m < model->scene->mNumMeshes; ++m)
+    {
+        Skinning_Build(sources[m].data(), (uint32_t)sources[m].size(), boneCount, &model->meshes[m].stream);
+    }
+
+    // m[hKwƃAj̑Ήit[OŒTȂ悤Ɂj
+    BuildSkeleton(model);
+    if (g_CompressAnimations)
+        CompressAnimations(model, fileName);
+    else
+        BakeAnimations(model, fileName);
+    BuildClipBounds(model, fileName);
+
     return model;
 }
 
-void SkinnedModel_Release(SKINNED_MODEL* model)
+static void DestroySkinnedAsset(SKINNED_ASSET* model)
 {
-    if (!model) return;
-
     for (auto& mesh : model->meshes)
     {
-        if (mesh.vb) mesh.vb->Release();
         if (mesh.ib) mesh.ib->Release();
-        mesh.vb = nullptr;
         mesh.ib = nullptr;
     }
 
@@ -599,108 +1187,296 @@ void SkinnedModel_Release(SKINNED_MODEL* model)
     delete model;
 }
 
+// CPU ̒_Ȅd݂ƁACfbNXobt@̃oCgi풓ʂ̕\pj
+static unsigned long long SkinnedBytes(const SKINNED_ASSET* model)
+{
+    unsigned long long bytes = 0;
+    for (const SKINNED_MESH& mesh : model->meshes)
+    {
+        bytes += mesh.stream.Bytes();
+        bytes += (unsigned long long)mesh.numIndices * sizeof(uint32_t);
+    }
+    for (const BakedAnim& baked : model->bakedAnims)
+    {
+        bytes += baked.clip.data.size() * sizeof(float);
+    }
+    for (const CompressedAnim& compressed : model->compressedAnims)
+    {
+        bytes += compressed.clip.Bytes();
+    }
+    for (const ClipBounds& clip : model->clipBounds)
+    {
+        bytes += clip.segments.size() * sizeof(AABB);
+    }
+    return bytes;
+}
+
+static unsigned long long CursorBytes(const SkinnedCursorSet& cursor)
+{
+    return cursor.key.capacity() * sizeof(KeyCursor) + cursor.compress.capacity() * sizeof(AnimCompressCursor);
+}
+
+// CX^XoCgi|[YEL[ʒu GPU ̒_obt@jBtF[h͎؂Ăp
+static unsigned long long InstanceBytes(const SKINNED_MODEL* model)
+{
+    unsigned long long bytes = sizeof(SKINNED_MODEL) + model->vbBytes
+        + model->meshes.size() * sizeof(SKINNED_INSTANCE_MESH)
+        + model->boneFinal.size() * sizeof(XMMATRIX)
+        + model->fadeFrom.capacity() * sizeof(AnimLocalTRS)
+        + CursorBytes(model->baseCursor);
+    for (const SkinnedLayer& layer : model->layers)
+    {
+        bytes += CursorBytes(layer.cursor);
+    }
+    return bytes;
+}
+
+// wtF[hő傫ς̂ŁA]̂тɍv킹
+static void UpdateInstanceBytes(SKINNED_MODEL* model)
+{
+    const unsigned long long bytes = InstanceBytes(model);
+    g_InstanceBytes += bytes - model->countedBytes;
+    model->countedBytes = bytes;
+}
+
+// asset ̎QƂ͌ĂяoŎĂ
+static SKINNED_MODEL* CreateInstance(SKINNED_ASSET* asset)
+{
+    SKINNED_MODEL* model = new SKINNED_MODEL;
+    model->asset = asset;
+    model->meshes.resize(asset->meshes.size());
+    model->boneFinal.assign(asset->boneOffset.size(), XMMatrixIdentity());
+
+    // _obt@͑SbV1{ŎiMap 1ōςށj
+    for (size_t m = 0; m < asset->meshes.size(); ++m)
+    {
+        model->meshes[m].vbOffset = model->vbBytes;
+        model->vbBytes += (UINT)(sizeof(PackedVertex3d) * asset->meshes[m].stream.vertexCount);
+    }
+    if (model->vbBytes > 0)
+    {
+        D3D11_BUFFER_DESC bd{};
+        bd.Usage = D3D11_USAGE_DYNAMIC;
+        bd.ByteWidth = model->vbBytes;
+        bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+        if (FAILED(Direct3D_GetDevice()->CreateBuffer(&bd, nullptr, &model->vb)))
+        {
+            hal::dout << "SkinnedModel : _obt@܂łi" << model->vbBytes << " oCgj" << std::endl;
+            model->vb = nullptr;
+            model->vbBytes = 0;
+        }
+    }
+
+    ++g_InstanceCount;
+    UpdateInstanceBytes(model);
+    return model;
+}
+
+static void DestroyInstance(SKINNED_MODEL* model)
+{
+    --g_InstanceCount;
+    g_InstanceBytes -= model->countedBytes;
+    ReleasePose(model->fadeFrom);
+    SAFE_RELEASE(model->vb);
+    delete model;
+}
+
+SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrender)
+{
+    const std::string key = AssetCache_MakeKey(fileName, scale, isBrender);
+    SKINNED_ASSET* asset = g_SkinnedCache.Acquire(key);
+    if (!asset)
+    {
+        asset = LoadSkinnedAsset(fileName, scale, isBrender);
+        if (!asset) return nullptr;
+        asset->cacheKey = key;
+        g_SkinnedCache.Insert(key, asset, SkinnedBytes(asset));
+    }
+
+    return CreateInstance(asset);
+}
+
+SKINNED_MODEL* SkinnedModel_CreateInstance(SKINNED_MODEL* source)
+{
+    if (!source) return nullptr;
+
+    SKINNED_ASSET* asset = g_SkinnedCache.Acquire(source->asset->cacheKey);
+    if (!asset) return nullptr;
+
+    return CreateInstance(asset);
+}
+
+void SkinnedModel_Release(SKINNED_MODEL* model)
+{
+    if (!model) return;
+
+    SKINNED_ASSET* asset = model->asset;
+    DestroyInstance(model);
+
+    // g͎QƂԂî SkinnedModel_PurgeUnusedj
+    if (!g_SkinnedCache.Release(asset)) DestroySkinnedAsset(asset);
+}
+
+int SkinnedModel_PurgeUnused()
+{
+    return g_SkinnedCache.Purge(DestroySkinnedAsset);
+}
+
+int SkinnedModel_GetResidentCount()
+{
+    return g_SkinnedCache.Count();
+}
+
+unsigned long long SkinnedModel_GetResidentBytes()
+{
+    return g_SkinnedCache.Bytes();
+}
+
+int SkinnedModel_GetInstanceCount()
+{
+    return g_InstanceCount;
+}
+
+unsigned long long SkinnedModel_GetInstanceBytes()
+{
+    return g_InstanceBytes;
+}
+
+unsigned long long SkinnedModel_GetInstanceBytes(const SKINNED_MODEL* model)
+{
+    return model ? InstanceBytes(model) : 0;
+}
+
 //------------------------------------------------------------------------------
 // Update (CPU skinning)
 //------------------------------------------------------------------------------
 static const aiAnimation* SkinnedModel_GetAnimation(SKINNED_MODEL* model, int& animationIndex)
 {
-    if (!model || !model->scene) return nullptr;
-    if (model->scene->mNumAnimations == 0) return nullptr;
+    if (!model || !model->asset->scene) return nullptr;
+    const aiScene* scene = model->asset->scene;
+    if (scene->mNumAnimations == 0) return nullptr;
 
-    animationIndex = (std::max)(0, (std::min)(animationIndex, (int)model->scene->mNumAnimations - 1));
-    return model->scene->mAnimations[animationIndex];
+    animationIndex = (std::max)(0, (std::min)(animationIndex, (int)scene->mNumAnimations - 1));
+    return scene->mAnimations[animationIndex];
 }
 
+// ̃t[̊{̃Aj߂邾i] EvaluatePose 1jBt[ŉxĂłŌ̂̂g
 static void SkinnedModel_ApplyAnimation(SKINNED_MODEL* model,
     const aiAnimation* anim,
     int animationIndex,
     double animTime)
 {
-    if (!model || !model->scene || !anim) return;
+    if (!model || !model->asset->scene || !anim) return;
 
-    if (model->lastAnimIndex == animationIndex && model->lastAnimTime == animTime)
+    if (model->base.animationIndex == animationIndex && model->base.animTime == animTime)
         return;
-    model->lastAnimIndex = animationIndex;
-    model->lastAnimTime = animTime;
+    model->base = { animationIndex, animTime };
+    model->poseDirty = true;
+}
 
-    // boneFinal XV
-    for (auto& mtx : model->boneFinal)
+// {̃AjςAĂ{̎p fadeFrom ɎĂāA獬n߂
+static void BeginCrossfade(SKINNED_MODEL* model)
+{
+    if (!model->hasPose || model->base.animationIndex == model->evaluated.animationIndex)
+        return;
+
+    if (model->crossfadeSec <= 0.0f || model->base.animationIndex < 0)
     {
-        mtx = XMMatrixIdentity();
+        ReleasePose(model->fadeFrom);
+        return;
     }
 
-    ReadNodeHierarchy(
-        animTime,
-        model->scene->mRootNode,
-        XMMatrixIdentity(),
-        anim,
-        model->boneMap,
-        model->boneOffset,
-        model->globalInverse,
-        model->boneFinal);
-
-    
-    ID3D11DeviceContext* ctx = Direct3D_GetContext();
-
-    for (unsigned int m = 0; m < model->meshes.size(); ++m)
+    // baseCursor ͂܂ÕAjɍĂ
+    const SKINNED_ASSET* asset = model->asset;
+    const size_t nodeCount = asset->nodeParent.size();
+    if (model->fadeFrom.empty())
     {
-        SKINNED_MESH& mesh = model->meshes[m];
-
-        // CPU skinning
-        for (size_t v = 0; v < mesh.baseVerts.size(); ++v)
-        {
-            const BaseVertex& bv = mesh.baseVerts[v];
-            const Influence4& inf = mesh.influences[v];
-
-            XMVECTOR p = XMLoadFloat3(&bv.position);
-            XMVECTOR n = XMLoadFloat3(&bv.normal);
-
-            XMVECTOR pOut = XMVectorZero();
-            XMVECTOR nOut = XMVectorZero();
-            float sumW = 0.0f;
-
-            for (int i = 0; i < 4; ++i)
-            {
-                float w = inf.w[i];
-                if (w <= 0.0f) continue;
-
-                sumW += w;
+        model->fadeFrom = AcquirePose(nodeCount);
+        SampleClip(asset, model->evaluated, &model->baseCursor, model->fadeFrom.data());
+        model->fadeBounds = RequestBounds(model, model->evaluated);
+    }
+    else
+    {
+        AddToBounds(&model->fadeBounds, RequestBounds(model, model->evaluated));
+
+        // tF[h̓rŐ؂ւF̎_̍p
+        std::vector<AnimLocalTRS> previous = AcquirePose(nodeCount);
+        SampleClip(asset, model->evaluated, &model->baseCursor, previous.data());
+        const float w = model->fadeDuration > 0.0f ? (std::min)(model->fadeElapsed / model->fadeDuration, 1.0f) : 1.0f;
+        AnimBlend_Lerp(model->fadeFrom.data(), previous.data(), (uint32_t)nodeCount, w);
+        ReleasePose(previous);
+    }
 
-                uint32_t bi = inf.idx[i];
-                if (bi >= model->boneFinal.size()) continue;
+    model->fadeElapsed = 0.0f;
+    model->fadeDuration = model->crossfadeSec;
+}
 
-                XMMATRIX M = model->boneFinal[bi];
+// baseEtF[hEw boneFinal BςĂȂΉȂBdt ̓tF[hi߂镪B
+// 1ɕ]̂ base ƓĂwi؂ւt[ÕAj1j
+static void EvaluatePose(SKINNED_MODEL* model, float dt)
+{
+    if (!model->poseDirty) return;
+    model->poseDirty = false;
 
-                XMVECTOR tp = XMVector3TransformCoord(p, M);
-                XMVECTOR tn = XMVector3TransformNormal(n, M);
+    BeginCrossfade(model);
+    if (!model->fadeFrom.empty())
+        model->fadeElapsed += dt;
 
-                pOut += tp * w;
-                nOut += tn * w;
-            }
+    SKINNED_ASSET* asset = model->asset;
+    const uint32_t nodeCount = (uint32_t)asset->nodeParent.size();
+    std::vector<AnimLocalTRS> pose = AcquirePose(nodeCount);
+    SampleClip(asset, model->base, &model->baseCursor, pose.data());
 
+    if (!model->fadeFrom.empty())
+    {
+        const float w = model->fadeDuration > 0.0f ? model->fadeElapsed / model->fadeDuration : 1.0f;
+        if (w >= 1.0f)
+            ReleasePose(model->fadeFrom);
+        else
+            AnimBlend_Lerp(pose.data(), model->fadeFrom.data(), nodeCount, 1.0f - w);
+    }
 
-            if (sumW <= 0.0f)
-            {
-                pOut = p;
-                nOut = n;
-            }
+    for (SkinnedLayer& layer : model->layers)
+    {
+        if (!layer.active || layer.weight <= 0.0f) continue;
 
-            nOut = XMVector3Normalize(nOut);
+        const float* mask = layer.mask >= 0 ? asset->boneMasks[layer.mask].data() : nullptr;
+        std::vector<AnimLocalTRS> layerPose = AcquirePose(nodeCount);
+        SampleClip(asset, layer.clip, &layer.cursor, layerPose.data());
 
-            XMStoreFloat3(&mesh.skinnedVerts[v].position, pOut);
-            XMStoreFloat3(&mesh.skinnedVerts[v].normalVector, nOut);
-            // uv/color ͕ςȂ
+        if (layer.mode == SKINNED_BLEND_ADDITIVE)
+        {
+            const AnimLocalTRS* reference = AdditiveBase(asset, layer.clip.animationIndex);
+            AnimBlend_Additive(pose.data(), layerPose.data(), reference, nodeCount, layer.weight, mask, layer.invertMask);
         }
-
-        // Map/Unmap
-        D3D11_MAPPED_SUBRESOURCE mapped{};
-        HRESULT hr = ctx->Map(mesh.vb, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
-        if (SUCCEEDED(hr))
+        else
         {
-            memcpy(mapped.pData, mesh.skinnedVerts.data(), sizeof(SkinnedVertex3d) * mesh.skinnedVerts.size());
-            ctx->Unmap(mesh.vb, 0);
+            AnimBlend_Lerp(pose.data(), layerPose.data(), nodeCount, layer.weight, mask, layer.invertMask);
         }
+        ReleasePose(layerPose);
     }
+
+    ComposePose(model, pose.data());
+    ReleasePose(pose);
+
+    model->evaluated = model->base;
+    model->hasPose = true;
+    UpdateInstanceBytes(model);
+
+    // XLjO͕`掞iPrepareSkinnedVerticesj VB ֒ڏ
+    model->vbDirty = true;
+}
+
+// b tick Ɂiloop Ȃ璷ŉ񂵁AłȂΗ[Ŏ~߂j
+static double ClipTicks(const aiAnimation* anim, float timeSec, bool loop)
+{
+    const double ticksPerSecond = (anim->mTicksPerSecond != 0.0) ? anim->mTicksPerSecond : 25.0;
+    const double timeInTicks = (double)timeSec * ticksPerSecond;
+    if (loop)
+        return anim->mDuration > 0.0 ? fmod(timeInTicks, anim->mDuration) : 0.0;
+    return (std::max)(0.0, (std::min)(timeInTicks, anim->mDuration));
 }
 
 //------------------------------------------------------------------------------
@@ -711,11 +1487,7 @@ void SkinnedModel_Update(SKINNED_MODEL* model, float timeSec, int animationIndex
     const aiAnimation* anim = SkinnedModel_GetAnimation(model, animationIndex);
     if (!anim) return;
 
-    double ticksPerSecond = (anim->mTicksPerSecond != 0.0) ? anim->mTicksPerSecond : 25.0;
-    double timeInTicks = (double)timeSec * ticksPerSecond;
-    double animTime = fmod(timeInTicks, anim->mDuration);
-
-    SkinnedModel_ApplyAnimation(model, anim, animationIndex, animTime);
+    SkinnedModel_ApplyAnimation(model, anim, animationIndex, ClipTicks(anim, timeSec, true));
 }
 
 void SkinnedModel_UpdateAtTime(SKINNED_MODEL* model, float timeSec, int animationIndex)
@@ -723,11 +1495,7 @@ void SkinnedModel_UpdateAtTime(SKINNED_MODEL* model, float timeSec, int animatio
     const aiAnimation* anim = SkinnedModel_GetAnimation(model, animationIndex);
     if (!anim) return;
 
-    double ticksPerSecond = (anim->mTicksPerSecond != 0.0) ? anim->mTicksPerSecond : 25.0;
-    double animTime = (double)timeSec * ticksPerSecond;
-    animTime = (std::max)(0.0, (std::min)(animTime, anim->mDuration));
-
-    SkinnedModel_ApplyAnimation(model, anim, animationIndex, animTime);
+    SkinnedModel_ApplyAnimation(model, anim, animationIndex, ClipTicks(anim, timeSec, false));
 }
 
 void SkinnedModel_UpdateClip(SKINNED_MODEL* model,
@@ -776,91 +1544,136 @@ void SkinnedModel_UpdateClip(SKINNED_MODEL* model,
 
 void SkinnedModel_ResetPose(SKINNED_MODEL* model)
 {
-    using namespace DirectX;
+    if (!model || !model->asset->scene) return;
 
-    if (!model || !model->scene) return;
+    // ǂݍݎ|[Yibind/restjɂBtF[h͂ɂ؂ւ
+    model->base = SkinnedClipRequest{};
+    ReleasePose(model->fadeFrom);
+    model->poseDirty = true;
+}
 
-    // LbVit[Ŗ߂Ɍj
-    model->lastAnimIndex = -1;
-    model->lastAnimTime = -1.0;
+void SkinnedModel_SetCrossfadeTime(SKINNED_MODEL* model, float fadeSec)
+{
+    if (!model) return;
+    model->crossfadeSec = (std::max)(0.0f, fadeSec);
+}
 
-    // boneFinal U
-    for (auto& mtx : model->boneFinal)
-        mtx = XMMatrixIdentity();
+void SkinnedModel_Animate(SKINNED_MODEL* model, float dt)
+{
+    if (!model || !model->asset->scene) return;
 
-    // ǂݍݎ|[Yibind/restj boneFinal 
-    ReadNodeHierarchyBindPose(
-        model->scene->mRootNode,
-        XMMatrixIdentity(),
-        model->boneMap,
-        model->boneOffset,
-        model->globalInverse,
-        model->boneFinal
-    );
+    // tF[h͖t[
+    if (!model->fadeFrom.empty())
+        model->poseDirty = true;
 
-    // boneFinal  CPU XLjO VB XViApplyAnimation Ɠj
-    ID3D11DeviceContext* ctx = Direct3D_GetContext();
+    EvaluatePose(model, (std::max)(0.0f, dt));
+}
 
-    for (unsigned int m = 0; m < model->meshes.size(); ++m)
+int SkinnedModel_CreateBodyMask(SKINNED_MODEL* model, const char* rootNodeName)
+{
+    if (!model || !rootNodeName) return -1;
+    SKINNED_ASSET* asset = model->asset;
+
+    const auto it = std::find(asset->nodeName.begin(), asset->nodeName.end(), rootNodeName);
+    if (it == asset->nodeName.end())
+    {
+        hal::dout << "SkinnedModel_CreateBodyMask() : " << rootNodeName << " Ƃm[h͂܂" << std::endl;
+        return -1;
+    }
+    const int32_t root = (int32_t)(it - asset->nodeName.begin());
+
+    // e͕KOɂ̂ŁAO1Ȃ߂Ύq킩
+    std::vector<float> mask(asset->nodeParent.size(), 0.0f);
+    mask[root] = 1.0f;
+    for (size_t n = (size_t)root + 1; n < mask.size(); ++n)
     {
-        SKINNED_MESH& mesh = model->meshes[m];
+        const int32_t parent = asset->nodeParent[n];
+        if (parent >= 0) mask[n] = mask[parent];
+    }
 
-        for (size_t v = 0; v < mesh.baseVerts.size(); ++v)
-        {
-            const BaseVertex& bv = mesh.baseVerts[v];
-            const Influence4& inf = mesh.influences[v];
+    // ̂΂ԂiCX^XƂɌĂłȂj
+    for (size_t i = 0; i < asset->boneMasks.size(); ++i)
+    {
+        if (asset->boneMasks[i] == mask) return (int)i;
+    }
+    asset->boneMasks.push_back(std::move(mask));
+    return (int)asset->boneMasks.size() - 1;
+}
 
-            XMVECTOR p = XMLoadFloat3(&bv.position);
-            XMVECTOR n = XMLoadFloat3(&bv.normal);
+void SkinnedModel_SetLayer(SKINNED_MODEL* model, int layer, int animationIndex, float timeSec, float weight,
+    SkinnedBlendMode mode, int mask, bool invertMask, bool loop)
+{
+    if (!model || layer < 0 || layer >= SKINNED_MAX_LAYERS) return;
 
-            XMVECTOR pOut = XMVectorZero();
-            XMVECTOR nOut = XMVectorZero();
-            float sumW = 0.0f;
+    const aiAnimation* anim = SkinnedModel_GetAnimation(model, animationIndex);
+    if (!anim) return;
 
-            for (int i = 0; i < 4; ++i)
-            {
-                float w = inf.w[i];
-                if (w <= 0.0f) continue;
+    const SkinnedClipRequest clip = { animationIndex, ClipTicks(anim, timeSec, loop) };
+    const float w = (std::max)(0.0f, (std::min)(weight, 1.0f));
+    const int m = (mask >= 0 && mask < (int)model->asset->boneMasks.size()) ? mask : -1;
 
-                uint32_t bi = inf.idx[i];
-                if (bi >= model->boneFinal.size()) continue;
+    // t[lŌĂ΂ĂAςĂȂΕ]XLjOȂ
+    SkinnedLayer& l = model->layers[layer];
+    if (l.active && l.clip.animationIndex == clip.animationIndex && l.clip.animTime == clip.animTime
+        && l.weight == w && l.mode == mode && l.mask == m && l.invertMask == invertMask)
+        return;
 
-                sumW += w;
+    l.active = true;
+    l.clip = clip;
+    l.weight = w;
+    l.mode = mode;
+    l.mask = m;
+    l.invertMask = invertMask;
+    model->poseDirty = true;
+}
 
-                XMMATRIX M = model->boneFinal[bi];
-                pOut += XMVector3TransformCoord(p, M) * w;
-                nOut += XMVector3TransformNormal(n, M) * w;
-            }
+void SkinnedModel_ClearLayer(SKINNED_MODEL* model, int layer)
+{
+    if (!model || layer < 0 || layer >= SKINNED_MAX_LAYERS) return;
+    if (!model->layers[layer].active) return;
 
-            if (sumW <= 0.0f)
-            {
-                // EFCg_͂̂܂
-                pOut = p;
-                nOut = n;
-            }
-            else
-            {
-                // ÔߐKiinf.Normalize() ς݂Ȃsvj
-                float inv = 1.0f / sumW;
-                pOut *= inv;
-                nOut *= inv;
-            }
+    model->layers[layer].active = false;
+    model->poseDirty = true;
+}
 
-            nOut = XMVector3Normalize(nOut);
+// |[YςSbVXLjOACX^X VB  Map ĒڏB
+// bV𒸓_͈̔͂ɐ؂ă[J[ŕB|[YȂi~܂ĂEꎞ~E
+// t[̉e{`ȂǁjOɏ_̂܂܎g
+static bool PrepareSkinnedVertices(SKINNED_MODEL* model)
+{
+    // Update n SkinnedModel_Animate Ă΂ȂgłA1]itF[h͐i܂Ȃj
+    EvaluatePose(model, 0.0f);
 
-            XMStoreFloat3(&mesh.skinnedVerts[v].position, pOut);
-            XMStoreFloat3(&mesh.skinnedVerts[v].normalVector, nOut);
-        }
+    if (!model->vb) return false;
+    if (!model->vbDirty) return true;
 
-        D3D11_MAPPED_SUBRESOURCE mapped{};
-        HRESULT hr = ctx->Map(mesh.vb, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
-        if (SUCCEEDED(hr))
-        {
-            memcpy(mapped.pData, mesh.skinnedVerts.data(),
-                sizeof(SkinnedVertex3d) * mesh.skinnedVerts.size());
-            ctx->Unmap(mesh.vb, 0);
-        }
+    const SKINNED_ASSET* asset = model->asset;
+
+    // pbg̓CX^XŎg񂷁iXLjO͂̊֐̒ŏIj
+    FillPalette(model);
+
+    ID3D11DeviceContext* ctx = Direct3D_GetContext();
+    D3D11_MAPPED_SUBRESOURCE msr{};
+    if (FAILED(ctx->Map(model->vb, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr)))
+        return false;
+
+    std::vector<SkinningJob> jobs;
+    jobs.reserve(model->meshes.size());
+    for (uint32_t m = 0; m < (uint32_t)model->meshes.size(); ++m)
+    {
+        const SkinningStream& stream = asset->meshes[m].stream;
+        SKINNED_INSTANCE_MESH& mesh = model->meshes[m];
+        if (stream.vertexCount == 0) continue;
+
+        // |[YŌ`ς̂ŁAE͂̓sxiƂ̔A_炸Ɂj蒼
+        mesh.packBounds = Skinning_ComputeBounds(stream, g_Palette);
+        jobs.push_back({ &stream, mesh.packBounds, (PackedVertex3d*)((uint8_t*)msr.pData + mesh.vbOffset) });
     }
+
+    Skinning_RunJobs(&g_SkinningPool, g_Palette, jobs.data(), jobs.size());
+    ctx->Unmap(model->vb, 0);
+    model->vbDirty = false;
+    return true;
 }
 
 
@@ -870,12 +1683,15 @@ void SkinnedModel_ResetPose(SKINNED_MODEL* model)
 //------------------------------------------------------------------------------
 void SkinnedModel_Draw(SKINNED_MODEL* model, const XMMATRIX& mtxWorld)
 {
-    if (!model || !model->scene) return;
+    if (!model || !model->asset->scene) return;
+    SKINNED_ASSET* asset = model->asset;
 
-    XMMATRIX S = XMMatrixScaling(model->importScale, model->importScale, model->importScale);
+    XMMATRIX S = XMMatrixScaling(asset->importScale, asset->importScale, asset->importScale);
     XMMATRIX world = S * mtxWorld;   //  gf̊ghɊ|iʒu͊g傳Ȃj
 
-    Shader3D_Begin();
+    if (!PrepareSkinnedVertices(model)) return;
+
+    Shader3D_BeginPacked();
     Shader3d_SetColor({ 1,1,1,1 });
     Direct3D_GetContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
     Shader3D_SetWorldMatrix(mtxWorld);
@@ -884,18 +1700,19 @@ void SkinnedModel_Draw(SKINNED_MODEL* model, const XMMATRIX& mtxWorld)
 
     for (unsigned int m = 0; m < model->meshes.size(); ++m)
     {
-        SKINNED_MESH& mesh = model->meshes[m];
+        const SKINNED_MESH& shared = asset->meshes[m];
+        const SKINNED_INSTANCE_MESH& mesh = model->meshes[m];
 
         // texture
-        aiMesh* aiMeshPtr = model->scene->mMeshes[m];
-        aiMaterial* mat = model->scene->mMaterials[aiMeshPtr->mMaterialIndex];
+        aiMesh* aiMeshPtr = asset->scene->mMeshes[m];
+        aiMaterial* mat = asset->scene->mMaterials[aiMeshPtr->mMaterialIndex];
 
         aiString tex;
         mat->GetTexture(aiTextureType_DIFFUSE, 0, &tex);
 
-        if (tex.length != 0 && model->textures.count(tex.C_Str()))
+        if (tex.length != 0 && asset->textures.count(tex.C_Str()))
         {
-            ID3D11ShaderResourceView* srv = model->textures[tex.C_Str()];
+            ID3D11ShaderResourceView* srv = asset->textures[tex.C_Str()];
             ctx->PSSetShaderResources(0, 1, &srv);
         }
         else
@@ -903,20 +1720,26 @@ void SkinnedModel_Draw(SKINNED_MODEL* model, const XMMATRIX& mtxWorld)
             Texture_SetTexture(g_TextureWhite);
         }
 
-        UINT stride = sizeof(SkinnedVertex3d);
-        UINT offset = 0;
-        ctx->IASetVertexBuffers(0, 1, &mesh.vb, &stride, &offset);
-        ctx->IASetIndexBuffer(mesh.ib, DXGI_FORMAT_R32_UINT, 0);
+        if (shared.stream.vertexCount == 0) continue;
+        Shader3D_SetPackedBounds(mesh.packBounds);
+
+        UINT stride = sizeof(PackedVertex3d);
+        UINT offset = mesh.vbOffset;
+        ctx->IASetVertexBuffers(0, 1, &model->vb, &stride, &offset);
+        ctx->IASetIndexBuffer(shared.ib, DXGI_FORMAT_R32_UINT, 0);
 
-        ctx->DrawIndexed(mesh.numIndices, 0, 0);
+        ctx->DrawIndexed(shared.numIndices, 0, 0);
     }
 }
 
 void SkinnedModel_DepthDraw(SKINNED_MODEL* model, const DirectX::XMMATRIX& mtxWorld)
 {
-    if (!model || !model->scene) return;
+    if (!model || !model->asset->scene) return;
+    SKINNED_ASSET* asset = model->asset;
+
+    if (!PrepareSkinnedVertices(model)) return;
 
-    ShaderDepth_Begin();
+    ShaderDepth_BeginPacked();
     Direct3D_GetContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
     ShaderDepth_SetWorldMatrix(mtxWorld);
 
@@ -924,18 +1747,19 @@ void SkinnedModel_DepthDraw(SKINNED_MODEL* model, const DirectX::XMMATRIX& mtxWo
 
     for (unsigned int m = 0; m < model->meshes.size(); ++m)
     {
-        SKINNED_MESH& mesh = model->meshes[m];
+        const SKINNED_MESH& shared = asset->meshes[m];
+        const SKINNED_INSTANCE_MESH& mesh = model->meshes[m];
 
         // textureidepthVF[_ȂKvj
-        aiMesh* aiMeshPtr = model->scene->mMeshes[m];
-        aiMaterial* mat = model->scene->mMaterials[aiMeshPtr->mMaterialIndex];
+        aiMesh* aiMeshPtr = asset->scene->mMeshes[m];
+        aiMaterial* mat = asset->scene->mMaterials[aiMeshPtr->mMaterialIndex];
 
         aiString tex;
         mat->GetTexture(aiTextureType_DIFFUSE, 0, &tex);
 
-        if (tex.length != 0 && model->textures.count(tex.C_Str()))
+        if (tex.length != 0 && asset->textures.count(tex.C_Str()))
         {
-            ID3D11ShaderResourceView* srv = model->textures[tex.C_Str()];
+            ID3D11ShaderResourceView* srv = asset->textures[tex.C_Str()];
             ctx->PSSetShaderResources(0, 1, &srv);
         }
         else
@@ -943,12 +1767,15 @@ void SkinnedModel_DepthDraw(SKINNED_MODEL* model, const DirectX::XMMATRIX& mtxWo
             Texture_SetTexture(g_TextureWhite);
         }
 
-        UINT stride = sizeof(SkinnedVertex3d);
-        UINT offset = 0;
-        ctx->IASetVertexBuffers(0, 1, &mesh.vb, &stride, &offset);
-        ctx->IASetIndexBuffer(mesh.ib, DXGI_FORMAT_R32_UINT, 0);
+        if (shared.stream.vertexCount == 0) continue;
+        Shader3D_SetPackedBounds(mesh.packBounds);
 
-        ctx->DrawIndexed(mesh.numIndices, 0, 0);
+        UINT stride = sizeof(PackedVertex3d);
+        UINT offset = mesh.vbOffset;
+        ctx->IASetVertexBuffers(0, 1, &model->vb, &stride, &offset);
+        ctx->IASetIndexBuffer(shared.ib, DXGI_FORMAT_R32_UINT, 0);
+
+        ctx->DrawIndexed(shared.numIndices, 0, 0);
     }
 }
 
@@ -956,8 +1783,65 @@ AABB SkinnedModel_GetAABB(SKINNED_MODEL* model, const DirectX::XMFLOAT3& positio
 {
     if (!model) return {};
 
+    AABB local;
+    bool layered = false;
+    for (const SkinnedLayer& layer : model->layers)
+    {
+        layered = layered || (layer.active && layer.weight > 0.0f);
+    }
+
+    if (layered)
+    {
+        // w̑gݍ킹͕\ɂȂ̂ŁApčƂ̔i`悷鎞͂ǂj
+        EvaluatePose(model, 0.0f);
+        local = PaletteBounds(model);
+    }
+    else
+    {
+        // ̃AjE̋؂̔BtF[h͑O̎p̔킹
+        local = RequestBounds(model, model->base);
+        if (!model->fadeFrom.empty())
+            AddToBounds(&local, model->fadeBounds);
+    }
+
     return {
-        {position.x + model->local_aabb.min.x, position.y + model->local_aabb.min.y, position.z + model->local_aabb.min.z},
-        {position.x + model->local_aabb.max.x, position.y + model->local_aabb.max.y, position.z + model->local_aabb.max.z}
+        {position.x + local.min.x, position.y + local.min.y, position.z + local.min.z},
+        {position.x + local.max.x, position.y + local.max.y, position.z + local.max.z}
     };
-}
\ No newline at end of file
+}
+
+void SkinnedModel_SetAnimBoundsSegment(float segmentSec)
+{
+    g_BoundsSegmentSec = (std::max)(0.0f, segmentSec);
+}
+
+void SkinnedModel_SetBakeSampleRate(float samplesPerSecond)
+{
+    g_BakeSampleRate = (std::max)(0.0f, samplesPerSecond);
+}
+
+void SkinnedModel_SetAnimCompression(bool enable, float positionTolerance, float rotationToleranceDeg, float scaleTolerance)
+{
+    g_CompressAnimations = enable;
+    g_CompressSettings.positionTolerance = (std::max)(0.0f, positionTolerance);
+    g_CompressSettings.rotationToleranceDeg = (std::max)(0.0f, rotationToleranceDeg);
+    g_CompressSettings.scaleTolerance = (std::max)(0.0f, scaleTolerance);
+}
+
+void SkinnedModel_LogSkinningBenchmark(SKINNED_MODEL* model, int iterations)
+{
+    if (!model) return;
+
+    uint32_t vertexCount = 0;
+    for (const SKINNED_MESH& mesh : model->asset->meshes)
+    {
+        vertexCount += mesh.stream.vertexCount;
+    }
+    const uint32_t boneCount = (std::max)(1u, (uint32_t)model->asset->boneOffset.size());
+
+    const SkinningBenchmarkResult r = Skinning_Benchmark(vertexCount, boneCount, iterations, &g_SkinningPool);
+    hal::dout << "SkinnedModel_LogSkinningBenchmark() : _ " << vertexCount << "  " << boneCount
+        << "  " << r.perInfluenceMs << "ms XJ[ " << r.scalarMs << "ms"
+        << " AVX2" << (Skinning_HasAVX2() ? " " : "iȂj ") << r.simdMs << "ms"
+        << " (" << r.threads << ") " << r.parallelMs << "ms ʒu̍ " << r.maxPositionError << std::endl;
+}
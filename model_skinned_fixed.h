@@ -33,13 +33,29 @@
 #pragma comment (lib, "assimp-vc143-mt.lib")
 
 
+// CX^XB|[Yƒ_obt@AbVEEAjEeNX`͓ǂݍ񂾂̂L
 struct SKINNED_MODEL;
 
-// ǂݍ
+// ǂݍ݁iVCX^XԂBRelease Ƒ΂Ŏgj
 SKINNED_MODEL* SkinnedModel_Load(const char* fileName, float scale, bool isBrender = false);
 void SkinnedModel_Release(SKINNED_MODEL* model);
 
-// AjXVitimeSecFbj
+// source Ɠg̃CX^X1iQOȂǁBǂݍ݂pX̏ƍȂj
+SKINNED_MODEL* SkinnedModel_CreateInstance(SKINNED_MODEL* source);
+
+//  fileNameEscaleEisBrender Ȃǂݍݍς݂̒gLiCX^X̐QƁjB
+// Release ŎQƂ 0 ɂȂĂ SkinnedModel_PurgeUnused ܂ł͎c
+int SkinnedModel_PurgeUnused();
+int SkinnedModel_GetResidentCount();
+unsigned long long SkinnedModel_GetResidentBytes();
+
+// CX^X̐ƁAꂼꂪoCgi|[YEL[ʒuȂ ƁAXLjOʂ̒_obt@j
+int SkinnedModel_GetInstanceCount();
+unsigned long long SkinnedModel_GetInstanceBytes();
+unsigned long long SkinnedModel_GetInstanceBytes(const SKINNED_MODEL* model);
+
+// AjXVitimeSecFbjB̃t[̊{̃Aj߂邾ŁAt[ŉxĂł
+// Ō̂̂gB] SkinnedModel_Animate AĂ΂ȂΕ`̎1
 void SkinnedModel_Update(SKINNED_MODEL* model, float timeSec, int animationIndex = 0);//[vĐ
 void SkinnedModel_UpdateAtTime(SKINNED_MODEL* model, float timeSec, int animationIndex = 0);//؂蔲Î~
 void SkinnedModel_UpdateClip(SKINNED_MODEL* model,//؂蔲Đ([vON/OFFL)
@@ -49,14 +65,55 @@ void SkinnedModel_UpdateClip(SKINNED_MODEL* model,//
     float clipEndSec,
     bool holdLastFrame = true);
 
-void SkinnedModel_ResetPose(SKINNED_MODEL* model);
+void SkinnedModel_ResetPose(SKINNED_MODEL* model);//ǂݍݎ̃|[YitF[hɐ؂ւj
+
+// {̃AjςɑO̎p獬鎞ԁibB 0 = ؂ւjB
+// tF[h SkinnedModel_Animate  dt Őiނ̂ŁAgȂ疈t[ Animate ĂԂ
+void SkinnedModel_SetCrossfadeTime(SKINNED_MODEL* model, float fadeSec);
+
+// ̃t[̎pi{̃AjEtF[hEwāA̍sɂ̂1񂾂jBUpdate ňɌĂ
+void SkinnedModel_Animate(SKINNED_MODEL* model, float dt);
+
+// {̃Aj̏ɏd˂wiԍ̏ɏd˂j
+constexpr int SKINNED_MAX_LAYERS = 4;
+
+enum SkinnedBlendMode
+{
+    SKINNED_BLEND_OVERRIDE, // weight u
+    SKINNED_BLEND_ADDITIVE, // Aj̍ŏ̃R}̍ weight 
+};
+
+// rootNodeName Ƃ̎q̃m[hɌ}XNi㔼gȂw̍ȂǁjB߂l SetLayer  maski-1 ŎsjB
+// f̑SCX^XŎg
+int SkinnedModel_CreateBodyMask(SKINNED_MODEL* model, const char* rootNodeName);
+
+// wuEit[njBmask  -1 ȂSgAinvertMask Ȃ mask ̊OigȂǁj
+void SkinnedModel_SetLayer(SKINNED_MODEL* model, int layer, int animationIndex, float timeSec, float weight,
+    SkinnedBlendMode mode = SKINNED_BLEND_OVERRIDE, int mask = -1, bool invertMask = false, bool loop = true);
+void SkinnedModel_ClearLayer(SKINNED_MODEL* model, int layer);
+
+// ǂݍݎɃAj Hz ŏĂi 30B0 ȂL[𖈉ԂjB
+// ȌɓǂރfBǂݍݎɊeAj̑傫ƌ덷o͂ɏo
+void SkinnedModel_SetBakeSampleRate(float samplesPerSecond);
+
+// ǂݍݎɃAjk邩i ȂjBkƌ̃L[͎̂āAĂ݂ȂB
+// e ʒuif̃[JPʁjE]ixjEgkBȌɓǂރf
+void SkinnedModel_SetAnimCompression(bool enable, float positionTolerance = 0.001f,
+    float rotationToleranceDeg = 0.02f, float scaleTolerance = 0.0001f);
+
+// model Ɠ_E̐̍蕨ŃXLjO̎Ԃ𑪂Ao͂ɏoiȑÔEXJ[EAVX2Ej
+void SkinnedModel_LogSkinningBenchmark(SKINNED_MODEL* model, int iterations = 50);
 
 // `i Shader3D ŕ`j
 void SkinnedModel_Draw(SKINNED_MODEL* model, const DirectX::XMMATRIX& mtxWorld);
 
 void SkinnedModel_DepthDraw(SKINNED_MODEL* model, const DirectX::XMMATRIX& mtxWorld);
 
-// AABB
+// ǂݍݎɍAj̋EbƂɋ؂邩i 0.25B0 ȂAjŜ1jBȌɓǂރf
+void SkinnedModel_SetAnimBoundsSegment(float segmentSec);
+
+// AABBĩAjE̎p͂ޔ position 炵́jB
+// ǂݍݎɍ\̂ŁAp̌vZXLjOȂiwd˂Ă鎞pj
 AABB SkinnedModel_GetAABB(SKINNED_MODEL* model, const DirectX::XMFLOAT3& position);
 
 #endif//MODLE_SKINNED_FIXED_H
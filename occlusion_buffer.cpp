@@ -0,0 +1,261 @@
+/*==============================================================================
+
+@@@\tgEFAՕJO[occlusion_buffer.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "occlusion_buffer.h"
+#include <emmintrin.h>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    constexpr float kClearDepth = 1.0f;
+    constexpr float kMinW = 1.0e-6f;
+    constexpr float kMinArea = 1.0e-6f;
+
+    // Pʗ̂̊pibit0 = x, bit1 = y, bit2 = z  +0.5j
+    constexpr float kCorner[2] = { -0.5f, +0.5f };
+
+    // 6ʁip鏇jBʂ`B
+    // O̖ʂǂ̋ڂ̃sNZ͓łǂɂȂA̖ʂ𖄂߂
+    constexpr int kBoxFaces[6][4] =
+    {
+        { 0, 2, 6, 4 },   // -X
+        { 1, 3, 7, 5 },   // +X
+        { 0, 1, 5, 4 },   // -Y
+        { 2, 3, 7, 6 },   // +Y
+        { 0, 1, 3, 2 },   // -Z
+        { 4, 5, 7, 6 },   // +Z
+    };
+
+    int RoundUp4(int v) { return (v + 3) & ~3; }
+}
+
+OcclusionBuffer::OcclusionBuffer(int width, int height)
+{
+    Resize(width, height);
+}
+
+void OcclusionBuffer::Resize(int width, int height)
+{
+    m_width = RoundUp4(std::max(width, 4));
+    m_height = std::max(height, 1);
+    m_depth.assign((size_t)m_width * m_height, kClearDepth);
+}
+
+void OcclusionBuffer::Begin(const DirectX::XMFLOAT4X4& viewProjection)
+{
+    std::memcpy(m_viewProjection, viewProjection.m, sizeof(m_viewProjection));
+    std::fill(m_depth.begin(), m_depth.end(), kClearDepth);
+    m_occluders = 0;
+    m_faces = 0;
+}
+
+bool OcclusionBuffer::Project(const float (&p)[3], ScreenVertex* out) const
+{
+    const float (&m)[4][4] = m_viewProjection;
+
+    // clip = (x, y, z, 1) * M
+    const float cx = p[0] * m[0][0] + p[1] * m[1][0] + p[2] * m[2][0] + m[3][0];
+    const float cy = p[0] * m[0][1] + p[1] * m[1][1] + p[2] * m[2][1] + m[3][1];
+    const float cz = p[0] * m[0][2] + p[1] * m[1][2] + p[2] * m[2][2] + m[3][2];
+    const float cw = p[0] * m[0][3] + p[1] * m[1][3] + p[2] * m[2][3] + m[3][3];
+
+    if (cw <= kMinW || cz < 0.0f) return false;
+
+    const float invW = 1.0f / cw;
+    out->x = (cx * invW * 0.5f + 0.5f) * (float)m_width;
+    out->y = (0.5f - cy * invW * 0.5f) * (float)m_height;
+    out->z = cz * invW;
+    return true;
+}
+
+bool OcclusionBuffer::RenderBox(const DirectX::XMFLOAT4X4& world)
+{
+    ScreenVertex v[8];
+    for (int i = 0; i < 8; ++i)
+    {
+        const float lx = kCorner[i & 1];
+        const float ly = kCorner[(i >> 1) & 1];
+        const float lz = kCorner[(i >> 2) & 1];
+
+        const float p[3] =
+        {
+            lx * world._11 + ly * world._21 + lz * world._31 + world._41,
+            lx * world._12 + ly * world._22 + lz * world._32 + world._42,
+            lx * world._13 + ly * world._23 + lz * world._33 + world._43,
+        };
+
+        // ߕʂ܂͐؂炸ɒ߂
+        if (!Project(p, &v[i])) return false;
+    }
+
+    for (const auto& f : kBoxFaces)
+    {
+        RasterizeQuad(v[f[0]], v[f[1]], v[f[2]], v[f[3]]);
+    }
+    ++m_occluders;
+    return true;
+}
+
+void OcclusionBuffer::RasterizeQuad(const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2, const ScreenVertex& v3)
+{
+    // ͂ǂł悢̂ŁAʐςɂȂ鏇ɂ낦
+    const ScreenVertex* q[4] = { &v0, &v1, &v2, &v3 };
+    float area = 0.0f;
+    for (int i = 0; i < 4; ++i)
+    {
+        const ScreenVertex& p = *q[i];
+        const ScreenVertex& n = *q[(i + 1) & 3];
+        area += p.x * n.y - n.x * p.y;
+    }
+    area *= 0.5f;
+    if (std::fabs(area) < kMinArea) return; // ^猩Ă
+    if (area < 0.0f)
+    {
+        std::swap(q[1], q[3]);
+    }
+
+    float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX, zMax = 0.0f;
+    for (const ScreenVertex* p : q)
+    {
+        minX = std::min(minX, p->x); maxX = std::max(maxX, p->x);
+        minY = std::min(minY, p->y); maxY = std::max(maxY, p->y);
+        zMax = std::max(zMax, p->z);
+    }
+
+    const int x0 = std::max(0, (int)std::floor(minX)) & ~3;
+    const int x1 = std::min(m_width, (int)std::ceil(maxX));
+    const int y0 = std::max(0, (int)std::floor(minY));
+    const int y1 = std::min(m_height, (int)std::ceil(maxY));
+    if (x0 >= x1 || y0 >= y1) return;
+
+    //  pq ̓ >= 0 ɂȂ鎮 E = A*x + B*y + CB
+    // sNZ̒S甼sNZ(|A|+|B|)/2 ƁAsNZŜ̎ >= 0 ɂȂB
+    // Op`2ɕƑΊp̃sNZǂɂȂ̂ŁAʂ͎lp̂܂ܓh
+    struct Edge { float A, B, C; };
+    Edge e[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        const ScreenVertex& p = *q[i];
+        const ScreenVertex& n = *q[(i + 1) & 3];
+        e[i].A = p.y - n.y;
+        e[i].B = n.x - p.x;
+        e[i].C = -(e[i].A * p.x + e[i].B * p.y) - 0.5f * (std::fabs(e[i].A) + std::fabs(e[i].B));
+    }
+
+    // ʂȂ̂ z/w ͉ʏŐ`B傫̎Op`X
+    const ScreenVertex* a = q[0];
+    const ScreenVertex* b = q[1];
+    const ScreenVertex* c = q[2];
+    float triArea = (b->x - a->x) * (c->y - a->y) - (c->x - a->x) * (b->y - a->y);
+    const float triArea2 = (c->x - a->x) * (q[3]->y - a->y) - (q[3]->x - a->x) * (c->y - a->y);
+    if (triArea2 > triArea)
+    {
+        b = q[2];
+        c = q[3];
+        triArea = triArea2;
+    }
+    const float dzdx = ((b->z - a->z) * (c->y - a->y) - (c->z - a->z) * (b->y - a->y)) / triArea;
+    const float dzdy = ((c->z - a->z) * (b->x - a->x) - (b->z - a->z) * (c->x - a->x)) / triArea;
+
+    // sNZňԉ̒li_̍ő艜ɂ͂Ȃj
+    const float zBias = 0.5f * (std::fabs(dzdx) + std::fabs(dzdy));
+
+    const __m128 laneX = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 vZMax = _mm_set1_ps(zMax);
+    const __m128 vDzdx = _mm_set1_ps(dzdx);
+    __m128 eA[4];
+    for (int i = 0; i < 4; ++i) eA[i] = _mm_set1_ps(e[i].A);
+
+    for (int y = y0; y < y1; ++y)
+    {
+        const float fy = (float)y + 0.5f;
+        __m128 eRow[4];
+        for (int i = 0; i < 4; ++i) eRow[i] = _mm_set1_ps(e[i].B * fy + e[i].C);
+        const __m128 rowZ = _mm_set1_ps(a->z - dzdx * a->x + dzdy * (fy - a->y) + zBias);
+
+        float* depthRow = &m_depth[(size_t)y * m_width];
+
+        // 4̔{ x0 4̔{Ȃ̂ŁAx+4 𒴂邱Ƃ͂Ȃ
+        for (int x = x0; x < x1; x += 4)
+        {
+            const __m128 px = _mm_add_ps(_mm_set1_ps((float)x), laneX);
+
+            __m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(eA[0], px), eRow[0]), zero);
+            for (int i = 1; i < 4; ++i)
+            {
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(eA[i], px), eRow[i]), zero));
+            }
+            if (_mm_movemask_ps(inside) == 0) continue;
+
+            const __m128 z = _mm_min_ps(_mm_add_ps(_mm_mul_ps(vDzdx, px), rowZ), vZMax);
+            const __m128 old = _mm_loadu_ps(depthRow + x);
+            const __m128 nearer = _mm_min_ps(old, z);
+            _mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, old)));
+        }
+    }
+    ++m_faces;
+}
+
+bool OcclusionBuffer::IsAabbVisible(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max) const
+{
+    float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+    float minZ = FLT_MAX;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        const float p[3] =
+        {
+            (i & 1) ? max.x : min.x,
+            (i & 2) ? max.y : min.y,
+            (i & 4) ? max.z : min.z,
+        };
+
+        ScreenVertex v;
+        if (!Project(p, &v)) return true; // Jɋ߂/ɉ荞ł
+
+        minX = std::min(minX, v.x); maxX = std::max(maxX, v.x);
+        minY = std::min(minY, v.y); maxY = std::max(maxY, v.y);
+        minZ = std::min(minZ, v.z);
+    }
+
+    // GĂsNZׂ͂Ēׂ
+    int x0 = (int)std::floor(minX);
+    int x1 = (int)std::ceil(maxX);
+    int y0 = (int)std::floor(minY);
+    int y1 = (int)std::ceil(maxY);
+    if (x1 <= x0) x1 = x0 + 1;
+    if (y1 <= y0) y1 = y0 + 1;
+
+    x0 = std::max(x0, 0); x1 = std::min(x1, m_width);
+    y0 = std::max(y0, 0); y1 = std::min(y1, m_height);
+    if (x0 >= x1 || y0 >= y1) return false;
+
+    // Օ̐[ẍԎO艜ij̃sNZ1łΌĂ
+    const __m128 vMinZ = _mm_set1_ps(minZ);
+    const __m128 laneX = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 rectX0 = _mm_set1_ps((float)x0);
+    const __m128 rectX1 = _mm_set1_ps((float)x1);
+    const int xStart = x0 & ~3;
+
+    for (int y = y0; y < y1; ++y)
+    {
+        const float* depthRow = &m_depth[(size_t)y * m_width];
+        for (int x = xStart; x < x1; x += 4)
+        {
+            const __m128 px = _mm_add_ps(_mm_set1_ps((float)x), laneX);
+            const __m128 inRect = _mm_and_ps(_mm_cmpge_ps(px, rectX0), _mm_cmplt_ps(px, rectX1));
+            const __m128 open = _mm_cmpge_ps(_mm_loadu_ps(depthRow + x), vMinZ);
+            if (_mm_movemask_ps(_mm_and_ps(inRect, open)) != 0) return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,69 @@
+/*==============================================================================
+
+@@@\tgEFAՕJO[occlusion_buffer.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    CPU Œ𑜓x̐[xobt@ɑ傫ȔiՕj`āA
+    c AABB ̉ʏ̋`̉ɊSɉBĂ邩𒲂ׂB
+    4sNZ SSE ł܂Ƃ߂ďBD3D ɈˑȂ̂ŃQ[OłB
+
+    ǂSɓ|ĂiBĂȂ̂Ȃj
+      EՕ : sNZŜOp`̓ɂ鏊AsNZňԉ̐[x
+      E葤 : p̓e`OɊۂ߁AԎO̐[xŔׂ
+      Eߕʂ܂̂́AՕȂ`A葤Ȃ猩Ă鈵
+
+==============================================================================*/
+#ifndef OCCLUSION_BUFFER_H
+#define OCCLUSION_BUFFER_H
+
+#include <DirectXMath.h>
+#include <vector>
+
+class OcclusionBuffer
+{
+public:
+    static constexpr int kDefaultWidth = 256;
+    static constexpr int kDefaultHeight = 144;
+
+    explicit OcclusionBuffer(int width = kDefaultWidth, int height = kDefaultHeight);
+
+    // 4̔{ɐ؂グ
+    void Resize(int width, int height);
+
+    // view * projectionisxNgAD3D  z  0`1jݒ肵ĈԉŃNA
+    void Begin(const DirectX::XMFLOAT4X4& viewProjection);
+
+    // Pʗ́i}0.5j world ŕό`ՕƂĕ`B`Ȃ false
+    bool RenderBox(const DirectX::XMFLOAT4X4& world);
+
+    // łĂ\ trueiʊO falsej
+    bool IsAabbVisible(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max) const;
+
+    int Width() const { return m_width; }
+    int Height() const { return m_height; }
+    const float* Depth() const { return m_depth.data(); }   // sDAWidth()*Height()
+    int OccluderCount() const { return m_occluders; }
+    int FaceCount() const { return m_faces; }
+
+private:
+    struct ScreenVertex
+    {
+        float x, y, z; // sNZW z/w
+    };
+
+    // ߕʂOɏop false
+    bool Project(const float (&p)[3], ScreenVertex* out) const;
+    // ʂȎlp`i1ʁjh
+    void RasterizeQuad(const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2, const ScreenVertex& v3);
+
+    float m_viewProjection[4][4]{};
+    int m_width = 0;
+    int m_height = 0;
+    std::vector<float> m_depth;
+    int m_occluders = 0;
+    int m_faces = 0;
+};
+
+#endif // OCCLUSION_BUFFER_H
@@ -62,7 +62,7 @@ void Particle::Draw(int texId) const
 {
     const float t = (m_lifeSeconds <= 0.0f) ? 1.0f : (m_age / m_lifeSeconds);
     const float scale = m_startScale + (m_endScale - m_startScale) * t;
-    Billboard_Draw(texId, m_position, scale, scale, m_color);
+    Billboard_BatchDraw(texId, m_position, scale, scale, m_color);
 }
 
 Emitter::Emitter(const XMFLOAT3& origin,
@@ -0,0 +1,86 @@
+/*==============================================================================
+
+@@@`pX̎s^C~O[pass_scheduler.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "pass_scheduler.h"
+#include <cmath>
+
+bool PassScheduler::ShouldRun(double nowSeconds, uint64_t contentKey)
+{
+    bool run = false;
+
+    if (!m_valid)
+    {
+        // ǑʂȂK`
+        run = true;
+    }
+    else
+    {
+        switch (m_policy)
+        {
+        case Policy::EveryFrame:
+            run = true;
+            break;
+
+        case Policy::EveryNthFrame:
+            run = (m_framesSinceRun + 1 >= m_frameInterval);
+            break;
+
+        case Policy::TimeBudget:
+            // ÕRXg\ZŊԂ󂯂i1mspX10ms/bȂ0.1bj
+            if (m_budgetMsPerSecond <= 0.0f)
+            {
+                run = false;
+            }
+            else
+            {
+                const double waitSeconds = m_lastCostMs / m_budgetMsPerSecond;
+                run = (nowSeconds - m_lastRunSeconds >= waitSeconds);
+            }
+            break;
+
+        case Policy::OnChange:
+            run = (contentKey != m_lastContentKey);
+            break;
+        }
+    }
+
+    if (!run)
+    {
+        ++m_framesSinceRun;
+        ++m_skipCount;
+    }
+    return run;
+}
+
+void PassScheduler::OnRan(double nowSeconds, double costMs, uint64_t contentKey)
+{
+    m_valid = true;
+    m_framesSinceRun = 0;
+    m_lastRunSeconds = nowSeconds;
+    m_lastCostMs = (costMs > 0.0) ? costMs : 0.0;
+    m_lastContentKey = contentKey;
+    ++m_runCount;
+}
+
+uint64_t PassScheduler_HashFloats(const float* values, int count, float quantum, uint64_t seed)
+{
+    // FNV-1ai64bitj
+    uint64_t h = 1469598103934665603ull ^ seed;
+    const float inv = (quantum > 0.0f) ? 1.0f / quantum : 1.0f;
+
+    for (int i = 0; i < count; ++i)
+    {
+        const int64_t q = (int64_t)std::floor(values[i] * inv + 0.5f);
+        for (int b = 0; b < 8; ++b)
+        {
+            h ^= (uint64_t)((q >> (b * 8)) & 0xff);
+            h *= 1099511628211ull;
+        }
+    }
+    return h;
+}
@@ -0,0 +1,74 @@
+/*==============================================================================
+
+@@@`pX̎s^C~O[pass_scheduler.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    t[`ȂĂpXiItXN[̃}bvȂǁjA
+    ENt[1
+    Eԗ\Zi1b艽ms܂ŎgĂ悢j
+    EǐՂĂ钆gς
+    ̂ǂꂩő点BȂ͑Ǒʂ̂܂܎gOB
+    ԂƃRXg͌Ăяon̂ŁAD3D^C}[ŒP̂œB
+
+==============================================================================*/
+#ifndef PASS_SCHEDULER_H
+#define PASS_SCHEDULER_H
+
+#include <cstdint>
+
+class PassScheduler
+{
+public:
+    enum class Policy
+    {
+        EveryFrame,
+        EveryNthFrame,
+        TimeBudget,
+        OnChange,
+    };
+
+    void   SetPolicy(Policy policy) { m_policy = policy; }
+    Policy GetPolicy() const { return m_policy; }
+
+    void SetFrameInterval(int frames) { m_frameInterval = (frames < 1) ? 1 : frames; }
+    int  GetFrameInterval() const { return m_frameInterval; }
+
+    // 1b肱̃pXɎgĂ悢CPU(ms)
+    void  SetBudgetMsPerSecond(float ms) { m_budgetMsPerSecond = (ms > 0.0f) ? ms : 0.0f; }
+    float GetBudgetMsPerSecond() const { return m_budgetMsPerSecond; }
+
+    // ̔ŕK点i^[Qbg蒼AXe[WؑւȂǁj
+    void Invalidate() { m_valid = false; }
+
+    // t[1ĂԁBcontentKey ͒ǐՂĂ钆g̃nbViOnChange ȊOł͖j
+    bool ShouldRun(double nowSeconds, uint64_t contentKey);
+
+    // ۂɑ点ɌĂ
+    void OnRan(double nowSeconds, double costMs, uint64_t contentKey);
+
+    uint64_t RunCount() const { return m_runCount; }
+    uint64_t SkipCount() const { return m_skipCount; }
+    int      FramesSinceRun() const { return m_framesSinceRun; }
+    double   LastCostMs() const { return m_lastCostMs; }
+
+private:
+    Policy   m_policy = Policy::EveryFrame;
+    int      m_frameInterval = 2;
+    float    m_budgetMsPerSecond = 60.0f;
+
+    bool     m_valid = false;
+    int      m_framesSinceRun = 0;
+    double   m_lastRunSeconds = 0.0;
+    double   m_lastCostMs = 0.0;
+    uint64_t m_lastContentKey = 0;
+
+    uint64_t m_runCount = 0;
+    uint64_t m_skipCount = 0;
+};
+
+// ʒuȂǂ float  quantum PʂɊۂ߂ănbViׂh OnChange Ȃ悤Ɂj
+uint64_t PassScheduler_HashFloats(const float* values, int count, float quantum, uint64_t seed = 0);
+
+#endif // PASS_SCHEDULER_H
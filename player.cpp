@@ -217,6 +217,7 @@ void Player_Initialize(const XMFLOAT3& position, const XMFLOAT3& front)
 
 	//g_playerModel = ModelLoad("model/atlas/scene.gltf", 0.2f, false);
 	g_playerModel = SkinnedModel_Load("model/atlas/scene.gltf", 1.0f, false);
+	SkinnedModel_SetCrossfadeTime(g_playerModel, 0.12f); // アニメの切り替えを少しだけ混ぜる
 
 	PlayerAction_Init(g_act);
 	PlayerAction_InitDefaultParams(g_actParam);
@@ -1276,6 +1277,9 @@ void Player_Update(double elapsedTime)
 		}
 
 		s_prevGrounded = g_isGrounded;
+
+		// 上で決まった最後のアニメだけを、ここで1回評価する（切り替え時はクロスフェード）
+		SkinnedModel_Animate(g_playerModel, dt);
 	}
 
 
@@ -0,0 +1,312 @@
+/*==============================================================================
+
+@@@_[Ot[render_graph.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "render_graph.h"
+#include <algorithm>
+
+namespace
+{
+    const char* AccessName(RenderGraphAccess access)
+    {
+        switch (access)
+        {
+        case RENDER_GRAPH_ACCESS_RENDER_TARGET: return "RT";
+        case RENDER_GRAPH_ACCESS_SHADER_READ:   return "SRV";
+        default:                                return "NONE";
+        }
+    }
+}
+
+void RenderGraph::Reset()
+{
+    m_passes.clear();
+    m_resources.clear();
+    m_passLive.clear();
+    m_steps.clear();
+    m_physicalDescs.clear();
+    m_culledPasses = 0;
+    m_mergedClears = 0;
+}
+
+int RenderGraph::ImportTexture(const char* name, int externalId)
+{
+    Resource r{};
+    r.name = name;
+    r.imported = true;
+    r.externalId = externalId;
+    r.physical = -1;
+    m_resources.push_back(r);
+    return (int)m_resources.size() - 1;
+}
+
+int RenderGraph::CreateTexture(const char* name, const RenderGraphTextureDesc& desc)
+{
+    Resource r{};
+    r.name = name;
+    r.imported = false;
+    r.externalId = -1;
+    r.desc = desc;
+    r.physical = -1;
+    m_resources.push_back(r);
+    return (int)m_resources.size() - 1;
+}
+
+void RenderGraph::MarkOutput(int resource)
+{
+    if (!ValidResource(resource)) return;
+    m_resources[resource].output = true;
+}
+
+int RenderGraph::AddPass(const char* name, std::function<void()> execute, bool bindTargets)
+{
+    Pass p{};
+    p.name = name;
+    p.execute = std::move(execute);
+    p.bindTargets = bindTargets;
+    m_passes.push_back(std::move(p));
+    return (int)m_passes.size() - 1;
+}
+
+void RenderGraph::AddRead(int pass, int resource, int slot)
+{
+    if (!ValidPass(pass) || !ValidResource(resource)) return;
+    m_passes[pass].reads.push_back({ resource, slot });
+}
+
+void RenderGraph::AddWrite(int pass, int resource, bool clear)
+{
+    if (!ValidPass(pass) || !ValidResource(resource)) return;
+    m_passes[pass].writes.push_back({ resource, clear });
+}
+
+void RenderGraph::SetSideEffect(int pass)
+{
+    if (!ValidPass(pass)) return;
+    m_passes[pass].sideEffect = true;
+}
+
+bool RenderGraph::Compile()
+{
+    m_steps.clear();
+    m_physicalDescs.clear();
+    m_culledPasses = 0;
+    m_mergedClears = 0;
+
+    // ꎞ^[QbgOɓǂłȂ
+    std::vector<bool> written(m_resources.size(), false);
+    for (const Pass& p : m_passes)
+    {
+        for (const Read& r : p.reads)
+        {
+            if (!m_resources[r.resource].imported && !written[r.resource]) return false;
+        }
+        for (const Write& w : p.writes) written[w.resource] = true;
+    }
+
+    CullPasses();
+    AssignPhysical();
+    BuildSteps();
+    return true;
+}
+
+void RenderGraph::CullPasses()
+{
+    const int passCount = (int)m_passes.size();
+    m_passLive.assign(passCount, false);
+
+    // 납u̐Œgv郊\[Xvǂ
+    std::vector<bool> needed(m_resources.size(), false);
+    for (int i = 0; i < (int)m_resources.size(); ++i)
+    {
+        needed[i] = m_resources[i].output;
+    }
+
+    for (int i = passCount - 1; i >= 0; --i)
+    {
+        const Pass& p = m_passes[i];
+
+        bool live = p.sideEffect;
+        for (const Write& w : p.writes)
+        {
+            if (needed[w.resource]) live = true;
+        }
+
+        if (!live)
+        {
+            ++m_culledPasses;
+            continue;
+        }
+        m_passLive[i] = true;
+
+        // NAďȂAO̒g͗vȂ
+        for (const Write& w : p.writes)
+        {
+            if (w.clear) needed[w.resource] = false;
+        }
+        for (const Read& r : p.reads)
+        {
+            needed[r.resource] = true;
+        }
+    }
+}
+
+void RenderGraph::AssignPhysical()
+{
+    const int passCount = (int)m_passes.size();
+    const int resourceCount = (int)m_resources.size();
+
+    // ꎞ^[Qbg̎iŏƍŌɎgpXj
+    std::vector<int> first(resourceCount, -1);
+    std::vector<int> last(resourceCount, -1);
+    auto touch = [&](int resource, int pass)
+    {
+        if (m_resources[resource].imported) return;
+        if (first[resource] < 0) first[resource] = pass;
+        last[resource] = pass;
+    };
+
+    for (int i = 0; i < passCount; ++i)
+    {
+        if (!m_passLive[i]) continue;
+        for (const Read& r : m_passes[i].reads)  touch(r.resource, i);
+        for (const Write& w : m_passes[i].writes) touch(w.resource, i);
+    }
+
+    std::vector<int> order;
+    for (int i = 0; i < resourceCount; ++i)
+    {
+        m_resources[i].physical = -1;
+        if (first[i] < 0) continue;
+        if (m_resources[i].output) last[i] = passCount; // t[̊O܂Ő
+        order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return first[a] < first[b]; });
+
+    // 쐬ŎdȂȂ͓̂̂
+    std::vector<int> physicalLast;
+    for (int r : order)
+    {
+        int found = -1;
+        for (int p = 0; p < (int)m_physicalDescs.size(); ++p)
+        {
+            if (physicalLast[p] < first[r] && m_physicalDescs[p] == m_resources[r].desc)
+            {
+                found = p;
+                break;
+            }
+        }
+
+        if (found < 0)
+        {
+            found = (int)m_physicalDescs.size();
+            m_physicalDescs.push_back(m_resources[r].desc);
+            physicalLast.push_back(-1);
+        }
+
+        m_resources[r].physical = found;
+        physicalLast[found] = last[r];
+    }
+}
+
+void RenderGraph::BuildSteps()
+{
+    const int resourceCount = (int)m_resources.size();
+
+    // Ԃ͎̒Pʁig񂵂ꎞ^[Qbg͑O̎̏Ԃpj
+    std::vector<RenderGraphAccess> state(resourceCount + m_physicalDescs.size(), RENDER_GRAPH_ACCESS_NONE);
+    auto stateOf = [&](int resource) -> RenderGraphAccess&
+    {
+        const Resource& r = m_resources[resource];
+        return r.imported ? state[resource] : state[resourceCount + r.physical];
+    };
+
+    // NAĂ܂`ĂȂ
+    std::vector<bool> clean(resourceCount, false);
+
+    for (int i = 0; i < (int)m_passes.size(); ++i)
+    {
+        if (!m_passLive[i]) continue;
+        const Pass& p = m_passes[i];
+
+        for (const Read& r : p.reads)
+        {
+            RenderGraphAccess& s = stateOf(r.resource);
+            if (s != RENDER_GRAPH_ACCESS_SHADER_READ)
+            {
+                m_steps.push_back({ STEP_BARRIER, r.resource, s, RENDER_GRAPH_ACCESS_SHADER_READ });
+                s = RENDER_GRAPH_ACCESS_SHADER_READ;
+            }
+        }
+
+        for (const Write& w : p.writes)
+        {
+            RenderGraphAccess& s = stateOf(w.resource);
+            if (s != RENDER_GRAPH_ACCESS_RENDER_TARGET)
+            {
+                m_steps.push_back({ STEP_BARRIER, w.resource, s, RENDER_GRAPH_ACCESS_RENDER_TARGET });
+                s = RENDER_GRAPH_ACCESS_RENDER_TARGET;
+            }
+
+            if (!w.clear) continue;
+            if (clean[w.resource])
+            {
+                ++m_mergedClears;
+                continue;
+            }
+            m_steps.push_back({ STEP_CLEAR, w.resource, RENDER_GRAPH_ACCESS_NONE, RENDER_GRAPH_ACCESS_NONE });
+            clean[w.resource] = true;
+        }
+
+        if (!p.execute) continue; // NÃpX
+
+        m_steps.push_back({ STEP_PASS, i, RENDER_GRAPH_ACCESS_NONE, RENDER_GRAPH_ACCESS_NONE });
+        for (const Write& w : p.writes) clean[w.resource] = false;
+    }
+}
+
+void RenderGraph::Execute(RenderGraphBackend& backend) const
+{
+    for (const Step& step : m_steps)
+    {
+        switch (step.type)
+        {
+        case STEP_BARRIER:
+            backend.Barrier(*this, step.index, step.from, step.to);
+            break;
+
+        case STEP_CLEAR:
+            backend.Clear(*this, step.index);
+            break;
+
+        case STEP_PASS:
+            backend.BeginPass(*this, step.index);
+            m_passes[step.index].execute();
+            backend.EndPass(*this, step.index);
+            break;
+        }
+    }
+}
+
+void RenderGraphNullBackend::Barrier(const RenderGraph& graph, int resource, RenderGraphAccess from, RenderGraphAccess to)
+{
+    m_log.push_back("barrier " + graph.GetResource(resource).name + " " + AccessName(from) + "->" + AccessName(to));
+}
+
+void RenderGraphNullBackend::Clear(const RenderGraph& graph, int resource)
+{
+    m_log.push_back("clear " + graph.GetResource(resource).name);
+}
+
+void RenderGraphNullBackend::BeginPass(const RenderGraph& graph, int pass)
+{
+    m_log.push_back("pass " + graph.GetPass(pass).name);
+}
+
+void RenderGraphNullBackend::EndPass(const RenderGraph&, int)
+{
+}
@@ -0,0 +1,175 @@
+/*==============================================================================
+
+@@@_[Ot[render_graph.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    pXƂɁuǂŉɏv錾ĂACompile ł܂Ƃ߂Ēi肷B
+    Eǂǂ܂Ȃio͂ɓ͂ȂjpX͊O
+    E܂`ĂȂ^[Qbgւ̓dNA1ɂ܂Ƃ߂
+    E݁ǂݍ݂̐؂ւioAjǂޒOɓ
+    EdȂȂꎞ^[Qbĝ͓g
+    ۂ̃oChNA̓obNGhɔĈŁAD3Dł
+    RenderGraphNullBackend ŎsmFłB
+
+    pX͐錾Ɏsiǂރ\[X͐ɐ錾pX́jB
+
+==============================================================================*/
+#ifndef RENDER_GRAPH_H
+#define RENDER_GRAPH_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// ꎞ^[Qbg̍쐬iformat  DXGI_FORMAT ̒l̂܂ܓj
+struct RenderGraphTextureDesc
+{
+    uint32_t width;
+    uint32_t height;
+    uint32_t format;
+    bool     depth;     // [xobt@ꏏɕKv
+};
+
+inline bool operator==(const RenderGraphTextureDesc& a, const RenderGraphTextureDesc& b)
+{
+    return a.width == b.width && a.height == b.height && a.format == b.format && a.depth == b.depth;
+}
+
+enum RenderGraphAccess
+{
+    RENDER_GRAPH_ACCESS_NONE,
+    RENDER_GRAPH_ACCESS_RENDER_TARGET,  // ݒiRTV/DSVɃoChj
+    RENDER_GRAPH_ACCESS_SHADER_READ,    // ǂݍݒiSRVɃoChj
+};
+
+class RenderGraph;
+
+// ۂ̑󂯎iD3DpƃeXgp̋j
+class RenderGraphBackend
+{
+public:
+    virtual ~RenderGraphBackend() = default;
+
+    virtual void Barrier(const RenderGraph& graph, int resource, RenderGraphAccess from, RenderGraphAccess to) = 0;
+    virtual void Clear(const RenderGraph& graph, int resource) = 0;
+    virtual void BeginPass(const RenderGraph& graph, int pass) = 0;
+    virtual void EndPass(const RenderGraph& graph, int pass) = 0;
+};
+
+class RenderGraph
+{
+public:
+    struct Read
+    {
+        int resource;
+        int slot;           // PSSRVXbg
+    };
+
+    struct Write
+    {
+        int  resource;
+        bool clear;         // `OɃNAKvifalse ȂO̒gɏd˂j
+    };
+
+    struct Pass
+    {
+        std::string           name;
+        std::vector<Read>     reads;
+        std::vector<Write>    writes;
+        std::function<void()> execute;      // ȂNÃpX
+        bool                  bindTargets;  // false ȂpXg^[QbgoCh
+        bool                  sideEffect;   // o͂ɓ͂ȂĂc
+    };
+
+    struct Resource
+    {
+        std::string            name;
+        bool                   imported;    // OṓiobNobt@Ȃǁj
+        int                    externalId;  // imported ̎AobNGĥԍ
+        RenderGraphTextureDesc desc;        // ꎞ^[Qbg̎̍쐬
+        bool                   output;      // t[̊Og
+        int                    physical;    // Compile Fꎞ^[Qbg̎̔ԍi-1:Ȃj
+    };
+
+    enum StepType
+    {
+        STEP_BARRIER,
+        STEP_CLEAR,
+        STEP_PASS,
+    };
+
+    struct Step
+    {
+        StepType          type;
+        int               index;    // BARRIER/CLEAR:\[X, PASS:pX
+        RenderGraphAccess from;
+        RenderGraphAccess to;
+    };
+
+    // 蒼ɌĂԁimۍς݂͎̃cj
+    void Reset();
+
+    int ImportTexture(const char* name, int externalId);
+    int CreateTexture(const char* name, const RenderGraphTextureDesc& desc);
+    void MarkOutput(int resource);
+
+    // ߂l̓pXԍBAddRead/AddWrite œǂݏ錾
+    int  AddPass(const char* name, std::function<void()> execute, bool bindTargets = true);
+    void AddRead(int pass, int resource, int slot);
+    void AddWrite(int pass, int resource, bool clear);
+    void SetSideEffect(int pass);
+
+    bool Compile();
+    void Execute(RenderGraphBackend& backend) const;
+
+    int GetPassCount() const { return (int)m_passes.size(); }
+    int GetResourceCount() const { return (int)m_resources.size(); }
+    const Pass&     GetPass(int pass) const { return m_passes[pass]; }
+    const Resource& GetResource(int resource) const { return m_resources[resource]; }
+
+    // Compile ̌
+    const std::vector<Step>& GetSteps() const { return m_steps; }
+    bool IsPassCulled(int pass) const { return !m_passLive[pass]; }
+    int  GetCulledPassCount() const { return m_culledPasses; }
+    int  GetMergedClearCount() const { return m_mergedClears; }
+    int  GetPhysicalCount() const { return (int)m_physicalDescs.size(); }
+    const RenderGraphTextureDesc& GetPhysicalDesc(int physical) const { return m_physicalDescs[physical]; }
+
+private:
+    bool ValidPass(int pass) const { return pass >= 0 && pass < (int)m_passes.size(); }
+    bool ValidResource(int resource) const { return resource >= 0 && resource < (int)m_resources.size(); }
+
+    void CullPasses();
+    void AssignPhysical();
+    void BuildSteps();
+
+    std::vector<Pass>     m_passes;
+    std::vector<Resource> m_resources;
+
+    std::vector<bool>                   m_passLive;
+    std::vector<Step>                   m_steps;
+    std::vector<RenderGraphTextureDesc> m_physicalDescs;
+    int m_culledPasses = 0;
+    int m_mergedClears = 0;
+};
+
+// `ɑ𕶎ŋL^邾̃obNGhiD3DŎsm߂pj
+class RenderGraphNullBackend : public RenderGraphBackend
+{
+public:
+    void Barrier(const RenderGraph& graph, int resource, RenderGraphAccess from, RenderGraphAccess to) override;
+    void Clear(const RenderGraph& graph, int resource) override;
+    void BeginPass(const RenderGraph& graph, int pass) override;
+    void EndPass(const RenderGraph& graph, int pass) override;
+
+    void Reset() { m_log.clear(); }
+    const std::vector<std::string>& GetLog() const { return m_log; }
+
+private:
+    std::vector<std::string> m_log;
+};
+
+#endif // RENDER_GRAPH_H
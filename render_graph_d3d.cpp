@@ -0,0 +1,202 @@
+/*==============================================================================
+
+@@@_[OtD3D11obNGh[render_graph_d3d.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "render_graph_d3d.h"
+#include "direct3d.h"
+#include "debug_ostream.h"
+#include <vector>
+
+namespace
+{
+    struct TransientTarget
+    {
+        RenderGraphTextureDesc    desc{};
+        ID3D11Texture2D*          pTexture = nullptr;
+        ID3D11RenderTargetView*   pRTV = nullptr;
+        ID3D11ShaderResourceView* pSRV = nullptr;
+        ID3D11Texture2D*          pDepthTexture = nullptr;
+        ID3D11DepthStencilView*   pDSV = nullptr;
+    };
+
+    std::vector<TransientTarget> g_transients;
+
+    void ReleaseTarget(TransientTarget& t)
+    {
+        SAFE_RELEASE(t.pTexture);
+        SAFE_RELEASE(t.pRTV);
+        SAFE_RELEASE(t.pSRV);
+        SAFE_RELEASE(t.pDepthTexture);
+        SAFE_RELEASE(t.pDSV);
+    }
+
+    bool CreateTarget(TransientTarget& t, const RenderGraphTextureDesc& desc)
+    {
+        ID3D11Device* device = Direct3D_GetDevice();
+        t.desc = desc;
+
+        D3D11_TEXTURE2D_DESC td{};
+        td.Width = desc.width;
+        td.Height = desc.height;
+        td.MipLevels = 1;
+        td.ArraySize = 1;
+        td.Format = (DXGI_FORMAT)desc.format;
+        td.SampleDesc.Count = 1;
+        td.Usage = D3D11_USAGE_DEFAULT;
+        td.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+        if (FAILED(device->CreateTexture2D(&td, nullptr, &t.pTexture))) return false;
+        if (FAILED(device->CreateRenderTargetView(t.pTexture, nullptr, &t.pRTV))) return false;
+        if (FAILED(device->CreateShaderResourceView(t.pTexture, nullptr, &t.pSRV))) return false;
+
+        if (desc.depth)
+        {
+            D3D11_TEXTURE2D_DESC dd = td;
+            dd.Format = DXGI_FORMAT_D24_UNORM_S8_UINT;
+            dd.BindFlags = D3D11_BIND_DEPTH_STENCIL;
+
+            if (FAILED(device->CreateTexture2D(&dd, nullptr, &t.pDepthTexture))) return false;
+            if (FAILED(device->CreateDepthStencilView(t.pDepthTexture, nullptr, &t.pDSV))) return false;
+        }
+        return true;
+    }
+
+    const TransientTarget* GetTransient(const RenderGraph& graph, int resource)
+    {
+        const int physical = graph.GetResource(resource).physical;
+        if (physical < 0 || physical >= (int)g_transients.size()) return nullptr;
+        return &g_transients[physical];
+    }
+}
+
+bool RenderGraphD3DBackend::Prepare(const RenderGraph& graph)
+{
+    const int count = graph.GetPhysicalCount();
+    if ((int)g_transients.size() < count) g_transients.resize(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        TransientTarget& t = g_transients[i];
+        const RenderGraphTextureDesc& desc = graph.GetPhysicalDesc(i);
+        if (t.pTexture && t.desc == desc) continue;
+
+        ReleaseTarget(t);
+        if (!CreateTarget(t, desc))
+        {
+            ReleaseTarget(t);
+            hal::dout << "_[Oẗꎞ^[Qbg̐Ɏs܂" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+void RenderGraphD3DBackend::Barrier(const RenderGraph&, int, RenderGraphAccess from, RenderGraphAccess to)
+{
+    ID3D11DeviceContext* context = Direct3D_GetContext();
+
+    if (to == RENDER_GRAPH_ACCESS_RENDER_TARGET && from == RENDER_GRAPH_ACCESS_SHADER_READ)
+    {
+        // VF[_[Ɏh܂܂RTVɃoChłȂ̂ŊO
+        ID3D11ShaderResourceView* nulls[16] = {};
+        context->PSSetShaderResources(0, 16, nulls);
+    }
+    else if (to == RENDER_GRAPH_ACCESS_SHADER_READ && from == RENDER_GRAPH_ACCESS_RENDER_TARGET)
+    {
+        // RTVɃoChꂽ܂܂SRVɂłȂ̂ŊO
+        context->OMSetRenderTargets(0, nullptr, nullptr);
+    }
+}
+
+void RenderGraphD3DBackend::Clear(const RenderGraph& graph, int resource)
+{
+    const RenderGraph::Resource& r = graph.GetResource(resource);
+
+    if (r.imported)
+    {
+        switch (r.externalId)
+        {
+        case RENDER_GRAPH_D3D_BACK_BUFFER:  Direct3D_ClearBackBuffer();  break;
+        case RENDER_GRAPH_D3D_OFFSCREEN:    Direct3D_ClearOffscreen();   break;
+        case RENDER_GRAPH_D3D_SHADOW_DEPTH: Direct3D_ClearShadowDepth(); break;
+        }
+        return;
+    }
+
+    const TransientTarget* t = GetTransient(graph, resource);
+    if (!t) return;
+
+    ID3D11DeviceContext* context = Direct3D_GetContext();
+    float clear_color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    context->ClearRenderTargetView(t->pRTV, clear_color);
+    if (t->pDSV) context->ClearDepthStencilView(t->pDSV, D3D11_CLEAR_DEPTH, 1.0f, 0);
+}
+
+void RenderGraphD3DBackend::BeginPass(const RenderGraph& graph, int pass)
+{
+    const RenderGraph::Pass& p = graph.GetPass(pass);
+    ID3D11DeviceContext* context = Direct3D_GetContext();
+
+    // ݐiŏ1BMRT͎gĂȂj
+    if (p.bindTargets && !p.writes.empty())
+    {
+        const int resource = p.writes[0].resource;
+        const RenderGraph::Resource& r = graph.GetResource(resource);
+
+        if (r.imported)
+        {
+            switch (r.externalId)
+            {
+            case RENDER_GRAPH_D3D_BACK_BUFFER: Direct3D_SetBackBuffer(); break;
+            case RENDER_GRAPH_D3D_OFFSCREEN:   Direct3D_SetOffscreen();  break;
+            default: break; // e̐[x ShadowCache ŃoCh
+            }
+        }
+        else if (const TransientTarget* t = GetTransient(graph, resource))
+        {
+            D3D11_VIEWPORT vp{};
+            vp.Width = (FLOAT)t->desc.width;
+            vp.Height = (FLOAT)t->desc.height;
+            vp.MaxDepth = 1.0f;
+            context->RSSetViewports(1, &vp);
+            context->OMSetRenderTargets(1, &t->pRTV, t->pDSV);
+        }
+    }
+
+    // ǂݍރeNX`
+    for (const RenderGraph::Read& read : p.reads)
+    {
+        const RenderGraph::Resource& r = graph.GetResource(read.resource);
+
+        if (r.imported)
+        {
+            switch (r.externalId)
+            {
+            case RENDER_GRAPH_D3D_OFFSCREEN:    Direct3D_SetOffscreenTexture(read.slot);   break;
+            case RENDER_GRAPH_D3D_SHADOW_DEPTH: Direct3D_SetDepthShadowTexture(read.slot); break;
+            default: break;
+            }
+        }
+        else if (const TransientTarget* t = GetTransient(graph, read.resource))
+        {
+            context->PSSetShaderResources(read.slot, 1, &t->pSRV);
+        }
+    }
+}
+
+void RenderGraphD3DBackend::EndPass(const RenderGraph&, int)
+{
+}
+
+void RenderGraphD3D_ReleaseTransients()
+{
+    for (TransientTarget& t : g_transients)
+    {
+        ReleaseTarget(t);
+    }
+    g_transients.clear();
+}
@@ -0,0 +1,40 @@
+/*==============================================================================
+
+@@@_[OtD3D11obNGh[render_graph_d3d.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    RenderGraph ̑ direct3d.cpp ̊֐ D3D11 ĂяoɒuB
+    O玝ރ^[QbgiImportTexture  externalIdj͉ enum Ŏw肷B
+    ꎞ^[Qbg͎̔ԍƂɂł܂Ƃ߂čA쐬񂪕ς蒼B
+
+==============================================================================*/
+#ifndef RENDER_GRAPH_D3D_H
+#define RENDER_GRAPH_D3D_H
+
+#include "render_graph.h"
+
+enum RenderGraphD3DTarget
+{
+    RENDER_GRAPH_D3D_BACK_BUFFER,   // obNobt@i{[xj
+    RENDER_GRAPH_D3D_OFFSCREEN,     // ItXN[i}bvj
+    RENDER_GRAPH_D3D_SHADOW_DEPTH,  // e̐[x}bv
+};
+
+class RenderGraphD3DBackend : public RenderGraphBackend
+{
+public:
+    // Compile ς݂̃Otɍ킹Ĉꎞ^[Qbg̎̂pӂ
+    bool Prepare(const RenderGraph& graph);
+
+    void Barrier(const RenderGraph& graph, int resource, RenderGraphAccess from, RenderGraphAccess to) override;
+    void Clear(const RenderGraph& graph, int resource) override;
+    void BeginPass(const RenderGraph& graph, int pass) override;
+    void EndPass(const RenderGraph& graph, int pass) override;
+};
+
+// ꎞ^[Qbg̎̂SiDirect3D_Finalize Ăԁj
+void RenderGraphD3D_ReleaseTransients();
+
+#endif // RENDER_GRAPH_D3D_H
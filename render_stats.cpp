@@ -0,0 +1,114 @@
+/*==============================================================================
+
+@@@t[Ƃ̕`擝v[render_stats.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "render_stats.h"
+
+namespace
+{
+    RenderStatsPassInfo g_current[RENDER_STATS_PASS_MAX]{};
+    RenderStatsPassInfo g_last[RENDER_STATS_PASS_MAX]{};
+
+    unsigned long long g_currentCounters[RENDER_STATS_COUNTER_MAX]{};
+    unsigned long long g_lastCounters[RENDER_STATS_COUNTER_MAX]{};
+
+    const char* kPassNames[RENDER_STATS_PASS_MAX] =
+    {
+        "Map",
+        "Shadow",
+        "Occlusion",
+        "Light clusters",
+    };
+
+    const char* kCounterNames[RENDER_STATS_COUNTER_MAX] =
+    {
+        "Constant bytes",
+        "Geometry bytes",
+        "Blocks drawn",
+        "Blocks frustum culled",
+        "Blocks occluded",
+        "Light indices",
+        "Field tiles drawn",
+        "Block texture binds",
+    };
+
+    bool IsValidPass(RenderStatsPass pass)
+    {
+        return pass >= 0 && pass < RENDER_STATS_PASS_MAX;
+    }
+
+    bool IsValidCounter(RenderStatsCounter counter)
+    {
+        return counter >= 0 && counter < RENDER_STATS_COUNTER_MAX;
+    }
+}
+
+void RenderStats_BeginFrame()
+{
+    for (int i = 0; i < RENDER_STATS_PASS_MAX; ++i)
+    {
+        g_last[i] = g_current[i];
+        g_current[i] = RenderStatsPassInfo{};
+    }
+
+    for (int i = 0; i < RENDER_STATS_COUNTER_MAX; ++i)
+    {
+        g_lastCounters[i] = g_currentCounters[i];
+        g_currentCounters[i] = 0;
+    }
+}
+
+void RenderStats_AddPassTime(RenderStatsPass pass, double cpuMs)
+{
+    if (!IsValidPass(pass)) return;
+
+    g_current[pass].cpuMs += cpuMs;
+    g_current[pass].runCount++;
+}
+
+void RenderStats_AddPassSkip(RenderStatsPass pass)
+{
+    if (!IsValidPass(pass)) return;
+
+    g_current[pass].skipCount++;
+}
+
+void RenderStats_AddCounter(RenderStatsCounter counter, unsigned long long value)
+{
+    if (!IsValidCounter(counter)) return;
+
+    g_currentCounters[counter] += value;
+}
+
+const RenderStatsPassInfo& RenderStats_GetPass(RenderStatsPass pass)
+{
+    static const RenderStatsPassInfo empty{};
+    if (!IsValidPass(pass)) return empty;
+
+    return g_last[pass];
+}
+
+const char* RenderStats_GetPassName(RenderStatsPass pass)
+{
+    if (!IsValidPass(pass)) return "";
+
+    return kPassNames[pass];
+}
+
+unsigned long long RenderStats_GetCounter(RenderStatsCounter counter)
+{
+    if (!IsValidCounter(counter)) return 0;
+
+    return g_lastCounters[counter];
+}
+
+const char* RenderStats_GetCounterName(RenderStatsCounter counter)
+{
+    if (!IsValidCounter(counter)) return "";
+
+    return kCounterNames[counter];
+}
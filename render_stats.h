@@ -0,0 +1,61 @@
+/*==============================================================================
+
+@@@t[Ƃ̕`擝v[render_stats.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    pXƂCPUԂƁA/XLbv񐔁A]oCgȂǂ̃JE^
+    1t[߂B
+    RenderStats_BeginFrame őOt[̒lm肳̂ŁA
+    UI͕`rł1t[ȎlB
+
+==============================================================================*/
+#ifndef RENDER_STATS_H
+#define RENDER_STATS_H
+
+enum RenderStatsPass
+{
+    RENDER_STATS_PASS_MAP,      // ItXN[̃}bv
+    RENDER_STATS_PASS_SHADOW,   // e̐[x}bv
+    RENDER_STATS_PASS_OCCLUSION,// Xe[WubN̎/ՕJOiCPÛ݁j
+    RENDER_STATS_PASS_LIGHT_CLUSTER, // _̃NX^[U蕪Ɠ]
+
+    RENDER_STATS_PASS_MAX
+};
+
+enum RenderStatsCounter
+{
+    RENDER_STATS_CONSTANT_BYTES,    // 萔obt@֑oCg
+    RENDER_STATS_GEOMETRY_BYTES,    // IȒ_/CfbNX֏oCg
+    RENDER_STATS_BLOCKS_DRAWN,      // `Xe[WubNi[x`͊܂܂Ȃj
+    RENDER_STATS_BLOCKS_FRUSTUM_CULLED, // ̊Oŕ`ȂubN
+    RENDER_STATS_BLOCKS_OCCLUDED,   // ÕubNɉBĕ`ȂubN
+    RENDER_STATS_LIGHT_INDICES,     // NX^[ɐU蕪Cgԍ̐
+    RENDER_STATS_FIELD_TILES_DRAWN, // `bVtB[h̃^C
+    RENDER_STATS_BLOCK_TEXTURE_BINDS, // Xe[WubNŌʃeNX`ւ
+
+    RENDER_STATS_COUNTER_MAX
+};
+
+struct RenderStatsPassInfo
+{
+    double cpuMs;       // ̃t[ŃpXɎgCPUԁiR}hs܂Łj
+    int    runCount;    // ̃t[ő
+    int    skipCount;   // ̃t[ŃXLbviǑʂėpj
+};
+
+// t[̓ŌĂԁiOt[̒lm肵čt[[ɂj
+void RenderStats_BeginFrame();
+
+void RenderStats_AddPassTime(RenderStatsPass pass, double cpuMs);
+void RenderStats_AddPassSkip(RenderStatsPass pass);
+void RenderStats_AddCounter(RenderStatsCounter counter, unsigned long long value);
+
+// mς݁i1t[Oj̒l
+const RenderStatsPassInfo& RenderStats_GetPass(RenderStatsPass pass);
+const char* RenderStats_GetPassName(RenderStatsPass pass);
+unsigned long long RenderStats_GetCounter(RenderStatsCounter counter);
+const char* RenderStats_GetCounterName(RenderStatsCounter counter);
+
+#endif // RENDER_STATS_H
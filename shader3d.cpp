@@ -10,18 +10,29 @@
 #include "debug_ostream.h"
 #include"direct3d.h"
 #include"sampler.h"
+#include "constant_ring.h"
+#include "clustered_light.h"
+#include "vertex_pack.h"
 #include <DirectXMath.h>
 #include <d3d11.h>
 #include <fstream>
+#include <iterator>
+#include <vector>
 
 using namespace DirectX;
 
 static ID3D11VertexShader* g_pVertexShader = nullptr; //̃|C^CreateVertexShader()HLSLcsot@CGPUɓnɃnhႤ
 static ID3D11InputLayout* g_pInputLayout = nullptr;
+static ID3D11VertexShader* g_pVertexShaderPacked = nullptr; // PackedVertex3d p
+static ID3D11InputLayout* g_pInputLayoutPacked = nullptr;
+static ID3D11Buffer* g_pVSPackBounds = nullptr; // 萔obt@b5: l߂ʒűEi[xECgȂ̋l߂łgj
+static ConstantCache  g_packBoundsCache;
 static ID3D11Buffer* g_pVSConstantBuffer0 = nullptr; // 萔obt@b0: world
 //static ID3D11Buffer* g_pVSConstantBuffer1 = nullptr; // 萔obt@b1: view
 //static ID3D11Buffer* g_pVSConstantBuffer2 = nullptr; // 萔obt@b2: proj
 static ID3D11Buffer* g_pPSConstantBuffer0 = nullptr; // 萔obt@b0
+static ConstantObject g_world;       // b0 worldi萔Oɋl߂BgȂ g_pVSConstantBuffer0j
+static ConstantCache  g_colorCache;  // F͓Ȃ瑗蒼Ȃ
 static ID3D11PixelShader* g_pPixelShader = nullptr;
 
 // ӁIŊOݒ肳́BReleasesvB
@@ -119,11 +130,46 @@ bool Shader3D_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 		hal::dout << "Shader_Initialize() : _CAEg̍쐬Ɏs܂" << std::endl;
 		return false;
 	}
+
+	// l߂_iPackedVertex3djpB߂ȊO͏Ɠ
+	std::ifstream ifs_vsp("shader_vertex_3d_packed.cso", std::ios::binary);
+	if (!ifs_vsp) {
+		MessageBox(nullptr, TEXT("_VF[_[̓ǂݍ݂Ɏs܂\n\nshader_vertex_3d_packed.cso"),
+			TEXT("G["), MB_OK);
+		return false;
+	}
+	std::vector<char> vsp_binary((std::istreambuf_iterator<char>(ifs_vsp)), std::istreambuf_iterator<char>());
+
+	hr = g_pDevice->CreateVertexShader(vsp_binary.data(), vsp_binary.size(), nullptr, &g_pVertexShaderPacked);
+	if (FAILED(hr)) {
+		hal::dout << "Shader_Initialize() : _VF[_[il߂_j̍쐬Ɏs܂" << std::endl;
+		return false;
+	}
+
+	D3D11_INPUT_ELEMENT_DESC packed_layout[] = {
+		{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM,    0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM,    0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,    0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+	};
+
+	hr = g_pDevice->CreateInputLayout(packed_layout, ARRAYSIZE(packed_layout), vsp_binary.data(), vsp_binary.size(), &g_pInputLayoutPacked);
+	if (FAILED(hr)) {
+		hal::dout << "Shader_Initialize() : _CAEgil߂_j̍쐬Ɏs܂" << std::endl;
+		return false;
+	}
+
+	D3D11_BUFFER_DESC bounds_desc{};
+	bounds_desc.ByteWidth = sizeof(XMFLOAT4) * 2; // min, extent
+	bounds_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+	g_pDevice->CreateBuffer(&bounds_desc, nullptr, &g_pVSPackBounds);
+	g_packBoundsCache.valid = false;
+
 	// _VF[_[p萔obt@̍쐬
 	D3D11_BUFFER_DESC buffer_desc{};
-	buffer_desc.ByteWidth = sizeof(XMFLOAT4X4); // obt@̃TCY
+	buffer_desc.ByteWidth = sizeof(Shader3DObject); // obt@̃TCY
 	buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER; // oChtO
-	g_pDevice->CreateBuffer(&buffer_desc, nullptr, &g_pVSConstantBuffer0); // world
+	g_pDevice->CreateBuffer(&buffer_desc, nullptr, &g_pVSConstantBuffer0); // world + params
 	//g_pDevice->CreateBuffer(&buffer_desc, nullptr, &g_pVSConstantBuffer1); // view
 	//g_pDevice->CreateBuffer(&buffer_desc, nullptr, &g_pVSConstantBuffer2); // proj
 
@@ -160,10 +206,14 @@ bool Shader3D_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 	buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER; // oChtO
 	g_pDevice->CreateBuffer(&buffer_desc, nullptr, &g_pPSConstantBuffer0); // world*/
 	D3D11_BUFFER_DESC ps_buffer_desc{};
-	ps_buffer_desc.ByteWidth = sizeof(XMFLOAT4X4);
+	ps_buffer_desc.ByteWidth = sizeof(XMFLOAT4); // F1
 	ps_buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
 	g_pDevice->CreateBuffer(&ps_buffer_desc, nullptr, &g_pPSConstantBuffer0);
 
+	g_world = ConstantObject{};
+	g_world.fallback = g_pVSConstantBuffer0;
+	g_colorCache.valid = false;
+
 
 	/*==Tv[XeCgݒsampler.cpp/hɈڂ*/
 	Sampler_SetFilterAnisotropic();
@@ -178,23 +228,37 @@ void Shader3D_Finalize()
 {
 	SAFE_RELEASE(g_pPSConstantBuffer0);
 	SAFE_RELEASE(g_pVSConstantBuffer0);
+	g_world = ConstantObject{};
 	SAFE_RELEASE(g_pPixelShader);
 	SAFE_RELEASE(g_pInputLayout);
 	SAFE_RELEASE(g_pVertexShader);
+	SAFE_RELEASE(g_pVSPackBounds);
+	SAFE_RELEASE(g_pInputLayoutPacked);
+	SAFE_RELEASE(g_pVertexShaderPacked);
 	g_pDevice = nullptr;
 	g_pContext = nullptr;
 }
 void Shader3D_SetWorldMatrix(const DirectX::XMMATRIX& matrix)
 {
-	// 萔obt@i[ps̍\̂`
-	XMFLOAT4X4 transpose;
+	// 萔obt@i[p̍\̂`
+	Shader3DObject object;
 
 	// s]uĒ萔obt@i[psɕϊ
-	XMStoreFloat4x4(&transpose, XMMatrixTranspose(matrix));
+	XMStoreFloat4x4(&object.world, XMMatrixTranspose(matrix));
+	object.params = { -1.0f, 0.0f, 0.0f, 0.0f }; // eNX`z͎gȂ
 
-	//===================UpdateSubresource̓f[^GPUɓn֐=====================
-	// 萔obt@ɍsZbg
-	g_pContext->UpdateSubresource(g_pVSConstantBuffer0, 0, nullptr, &transpose, 0, 0);
+	// 萔Oɏb0ɃoCh
+	ConstantRing_WriteObjectVS(&g_world, 0, &object, sizeof(object));
+}
+
+void Shader3D_SetWorldMatrix(const ConstantRingSpan& span, UINT index)
+{
+	ConstantRing_SetObjectVS(&g_world, 0, span, index);
+}
+
+void Shader3D_SetTextureArray(ID3D11ShaderResourceView* pView)
+{
+	g_pContext->PSSetShaderResources(3, 1, &pView);
 }
 
 /*void Shader3D_SetViewMatrix(const DirectX::XMMATRIX& matrix)
@@ -230,8 +294,8 @@ void Shader3D_SetProjectionMatrix(const DirectX::XMMATRIX& matrix)
 
 void Shader3d_SetColor(const DirectX::XMFLOAT4& color)
 {
-	// 萔obt@ɍsZbg
-	g_pContext->UpdateSubresource(g_pPSConstantBuffer0, 0, nullptr, &color, 0, 0);
+	// 萔obt@ɐFZbgiOƓȂ瑗Ȃj
+	ConstantRing_UpdateCached(g_pPSConstantBuffer0, &g_colorCache, &color, sizeof(color));
 }
 
 void Shader3D_Begin()
@@ -246,13 +310,34 @@ void Shader3D_Begin()
 	g_pContext->IASetInputLayout(g_pInputLayout);
 
 	// 萔obt@(VS)`pCvCɐݒ
-	g_pContext->VSSetConstantBuffers(0, 1, &g_pVSConstantBuffer0); // world
+	ConstantRing_BindObjectVS(&g_world, 0); // world
 
 	// 萔obt@iPSjݒiFpj
 	g_pContext->PSSetConstantBuffers(0, 1, &g_pPSConstantBuffer0);
 
+	// _ib4, t4`t6jBCgJςĂ΂ŐU蕪
+	ClusteredLight_Bind();
+
 	//Tv[XeCg`pCvCɐݒ
 	//g_pContext->PSSetSamplers(0, 1, &g_pSamplerState);
 	//  3D͉ȉȂǂɌٕ
 	Sampler_SetFilterAnisotropic();
-}
\ No newline at end of file
+}
+
+void Shader3D_BeginPacked()
+{
+	Shader3D_Begin();
+
+	g_pContext->VSSetShader(g_pVertexShaderPacked, nullptr, 0);
+	g_pContext->IASetInputLayout(g_pInputLayoutPacked);
+}
+
+void Shader3D_SetPackedBounds(const VertexPackBounds& bounds)
+{
+	const XMFLOAT4 data[2] = {
+		{ bounds.min[0], bounds.min[1], bounds.min[2], 0.0f },
+		{ bounds.extent[0], bounds.extent[1], bounds.extent[2], 0.0f },
+	};
+	ConstantRing_UpdateCached(g_pVSPackBounds, &g_packBoundsCache, data, sizeof(data));
+	g_pContext->VSSetConstantBuffers(5, 1, &g_pVSPackBounds);
+}
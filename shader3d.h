@@ -12,16 +12,34 @@
 #include <d3d11.h>
 #include <DirectXMath.h>
 
+struct ConstantRingSpan;
+struct VertexPackBounds;
+
+// _VF[_[ b0 ̒giConstantRing_Map ł܂Ƃ߂ďƂ͂̌`ŋl߂j
+struct Shader3DObject
+{
+	DirectX::XMFLOAT4X4 world;  // ]uς
+	DirectX::XMFLOAT4   params; // x = eNX`zit3j̃XCXBȂ t0 ̃eNX`g
+};
+
 bool Shader3D_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
 void Shader3D_Finalize();
 
 void Shader3D_SetWorldMatrix(const DirectX::XMMATRIX& matrix);
+// ConstantRing_Map ł܂Ƃ߂ď Shader3DObject  index Ԗڂg
+void Shader3D_SetWorldMatrix(const ConstantRingSpan& span, UINT index);
+// Xe[WubNp̃eNX`z t3 ɒuinullptr ŊOj
+void Shader3D_SetTextureArray(ID3D11ShaderResourceView* pView);
 /*void Shader3D_SetViewMatrix(const DirectX::XMMATRIX& matrix);
 void Shader3D_SetProjectionMatrix(const DirectX::XMMATRIX& matrix);*/
 
 void Shader3d_SetColor(const DirectX::XMFLOAT4& color);
 
 void Shader3D_Begin();
+// l߂_iPackedVertex3dj`ƂBBegin ̑ɌĂ
+void Shader3D_BeginPacked();
+// l߂ʒűE VS  b5 ɒuiShaderDepth / Shader3DUnlit ̋l߂ł̂ǂށj
+void Shader3D_SetPackedBounds(const VertexPackBounds& bounds);
 
 #endif // SHADER3D_H
 
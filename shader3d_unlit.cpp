@@ -14,11 +14,15 @@
 #include <DirectXMath.h>
 #include <d3d11.h>
 #include <fstream>
+#include <iterator>
+#include <vector>
 
 using namespace DirectX;
 
 static ID3D11VertexShader* g_pVertexShader = nullptr; //̃|C^CreateVertexShader()HLSLcsot@CGPUɓnɃnhႤ
 static ID3D11InputLayout* g_pInputLayout = nullptr;
+static ID3D11VertexShader* g_pVertexShaderPacked = nullptr; // PackedVertex3d pib5 ̋E Shader3D_SetPackedBoundsj
+static ID3D11InputLayout* g_pInputLayoutPacked = nullptr;
 static ID3D11Buffer* g_pVSConstantBuffer0 = nullptr; // 萔obt@b0
 static ID3D11Buffer* g_pPSConstantBuffer0 = nullptr; // 萔obt@b0
 static ID3D11PixelShader* g_pPixelShader = nullptr;
@@ -90,6 +94,34 @@ bool Shader3DUnlit_Initialize()
 		hal::dout << "ShaderBillboard_Initialize() : _CAEg̍쐬Ɏs܂" << std::endl;
 		return false;
 	}
+
+	// l߂_iPackedVertex3djpB߂ȊO͏Ɠ
+	std::ifstream ifs_vsp("shader_vertex_3d_unlit_packed.cso", std::ios::binary);
+	if (!ifs_vsp) {
+		MessageBox(nullptr, TEXT("_VF[_[̓ǂݍ݂Ɏs܂\n\nshader_vertex_3d_unlit_packed.cso"),
+			TEXT("G["), MB_OK);
+		return false;
+	}
+	std::vector<char> vsp_binary((std::istreambuf_iterator<char>(ifs_vsp)), std::istreambuf_iterator<char>());
+
+	hr = Direct3D_GetDevice()->CreateVertexShader(vsp_binary.data(), vsp_binary.size(), nullptr, &g_pVertexShaderPacked);
+	if (FAILED(hr)) {
+		hal::dout << "Shader3DUnlit_Initialize() : _VF[_[il߂_j̍쐬Ɏs܂" << std::endl;
+		return false;
+	}
+
+	D3D11_INPUT_ELEMENT_DESC packed_layout[] = {
+		{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM,    0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM,    0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,    0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+	};
+
+	hr = Direct3D_GetDevice()->CreateInputLayout(packed_layout, ARRAYSIZE(packed_layout), vsp_binary.data(), vsp_binary.size(), &g_pInputLayoutPacked);
+	if (FAILED(hr)) {
+		hal::dout << "Shader3DUnlit_Initialize() : _CAEgil߂_j̍쐬Ɏs܂" << std::endl;
+		return false;
+	}
 	// _VF[_[p萔obt@̍쐬
 	D3D11_BUFFER_DESC buffer_desc{};
 	buffer_desc.ByteWidth = sizeof(XMFLOAT4X4); // obt@̃TCY
@@ -147,6 +179,8 @@ void Shader3DUnlit_Finalize()
 	SAFE_RELEASE(g_pPSConstantBuffer0);
 	SAFE_RELEASE(g_pInputLayout);
 	SAFE_RELEASE(g_pVertexShader);
+	SAFE_RELEASE(g_pInputLayoutPacked);
+	SAFE_RELEASE(g_pVertexShaderPacked);
 }
 
 void Shader3DUnlit_SetWorldMatrix(const DirectX::XMMATRIX& matrix)
@@ -189,3 +223,11 @@ void Shader3DUnlit_Begin()
 	// 萔obt@iPSjݒiFpj
 	Direct3D_GetContext()->PSSetConstantBuffers(0, 1, &g_pPSConstantBuffer0);
 }
+
+void Shader3DUnlit_BeginPacked()
+{
+	Shader3DUnlit_Begin();
+
+	Direct3D_GetContext()->VSSetShader(g_pVertexShaderPacked, nullptr, 0);
+	Direct3D_GetContext()->IASetInputLayout(g_pInputLayoutPacked);
+}
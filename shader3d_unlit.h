@@ -20,5 +20,7 @@ void Shader3DUnlit_SetColor(const DirectX::XMFLOAT4& color);
 void Shader3DUnlit_SetClipTopOnly(bool enable);
 
 void Shader3DUnlit_Begin();
+// l߂_iPackedVertex3djpBE Shader3D_SetPackedBounds Œu
+void Shader3DUnlit_BeginPacked();
 
 #endif // SHADER3D_UNLIT_H
@@ -14,6 +14,7 @@
 #include "debug_ostream.h"
 #include "direct3d.h"
 #include "sampler.h"
+#include "constant_ring.h"
 
 #include <d3d11.h>
 #include <fstream>
@@ -34,6 +35,10 @@ static ID3D11Buffer* g_pVSConstantBufferUV    = nullptr;
 // PS: b0 color
 static ID3D11Buffer* g_pPSConstantBufferColor = nullptr;
 
+// world ͒萔Oɋl߂igȂ g_pVSConstantBufferWorldjBc͓gȂ瑗蒼Ȃ
+static ConstantObject g_world;
+static ConstantCache  g_viewCache, g_projCache, g_uvCache, g_colorCache;
+
 static bool LoadFileBinary(const char* path, unsigned char** outData, size_t* outSize)
 {
     std::ifstream ifs(path, std::ios::binary);
@@ -108,6 +113,10 @@ bool ShaderBillboard_Initialize()
 
         bd.ByteWidth = sizeof(XMFLOAT4); // 16 bytes
         if (FAILED(Direct3D_GetDevice()->CreateBuffer(&bd, nullptr, &g_pPSConstantBufferColor))) return false;
+
+        g_world = ConstantObject{};
+        g_world.fallback = g_pVSConstantBufferWorld;
+        g_viewCache.valid = g_projCache.valid = g_uvCache.valid = g_colorCache.valid = false;
     }
 
     // --- Pixel shader ---
@@ -166,41 +175,44 @@ void ShaderBillboard_Finalize()
     SAFE_RELEASE(g_pVSConstantBufferProj);
     SAFE_RELEASE(g_pVSConstantBufferView);
     SAFE_RELEASE(g_pVSConstantBufferWorld);
+    g_world = ConstantObject{};
     SAFE_RELEASE(g_pInputLayout);
     SAFE_RELEASE(g_pPixelShader);
     SAFE_RELEASE(g_pVertexShader);
 }
 
-static void UpdateMatrixCB(ID3D11Buffer* cb, const XMMATRIX& m)
+static void UpdateMatrixCB(ID3D11Buffer* cb, ConstantCache* cache, const XMMATRIX& m)
 {
     XMFLOAT4X4 t;
     XMStoreFloat4x4(&t, XMMatrixTranspose(m));
-    Direct3D_GetContext()->UpdateSubresource(cb, 0, nullptr, &t, 0, 0);
+    ConstantRing_UpdateCached(cb, cache, &t, sizeof(t));
 }
 
 void ShaderBillboard_SetWorldMatrix(const XMMATRIX& matrix)
 {
-    UpdateMatrixCB(g_pVSConstantBufferWorld, matrix);
+    XMFLOAT4X4 t;
+    XMStoreFloat4x4(&t, XMMatrixTranspose(matrix));
+    ConstantRing_WriteObjectVS(&g_world, 0, &t, sizeof(t));
 }
 
 void ShaderBillboard_SetViewMatrix(const XMMATRIX& matrix)
 {
-    UpdateMatrixCB(g_pVSConstantBufferView, matrix);
+    UpdateMatrixCB(g_pVSConstantBufferView, &g_viewCache, matrix);
 }
 
 void ShaderBillboard_SetProjectionMatrix(const XMMATRIX& matrix)
 {
-    UpdateMatrixCB(g_pVSConstantBufferProj, matrix);
+    UpdateMatrixCB(g_pVSConstantBufferProj, &g_projCache, matrix);
 }
 
 void ShaderBillboard_SetColor(const XMFLOAT4& color)
 {
-    Direct3D_GetContext()->UpdateSubresource(g_pPSConstantBufferColor, 0, nullptr, &color, 0, 0);
+    ConstantRing_UpdateCached(g_pPSConstantBufferColor, &g_colorCache, &color, sizeof(color));
 }
 
 void ShaderBillboard_SetUVParameter(const UVParameter& parameter)
 {
-    Direct3D_GetContext()->UpdateSubresource(g_pVSConstantBufferUV, 0, nullptr, &parameter, 0, 0);
+    ConstantRing_UpdateCached(g_pVSConstantBufferUV, &g_uvCache, &parameter, sizeof(parameter));
 }
 
 void ShaderBillboard_Begin()
@@ -214,7 +226,7 @@ void ShaderBillboard_Begin()
     ctx->PSSetShader(g_pPixelShader, nullptr, 0);
     ctx->IASetInputLayout(g_pInputLayout);
 
-    ctx->VSSetConstantBuffers(0, 1, &g_pVSConstantBufferWorld);
+    ConstantRing_BindObjectVS(&g_world, 0);
     ctx->VSSetConstantBuffers(1, 1, &g_pVSConstantBufferView);
     ctx->VSSetConstantBuffers(2, 1, &g_pVSConstantBufferProj);
     ctx->VSSetConstantBuffers(6, 1, &g_pVSConstantBufferUV);
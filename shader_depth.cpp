@@ -2,19 +2,26 @@
 #include "debug_ostream.h"
 #include"direct3d.h"
 #include"sampler.h"
+#include "constant_ring.h"
 #include <DirectXMath.h>
 #include <d3d11.h>
 #include <fstream>
+#include <iterator>
+#include <vector>
 
 using namespace DirectX;
 
 static ID3D11VertexShader* g_pVertexShader = nullptr; //̃|C^CreateVertexShader()HLSLcsot@CGPUɓnɃnhႤ
 static ID3D11InputLayout* g_pInputLayout = nullptr;
+static ID3D11VertexShader* g_pVertexShaderPacked = nullptr; // PackedVertex3d pib5 ̋E Shader3D_SetPackedBoundsj
+static ID3D11InputLayout* g_pInputLayoutPacked = nullptr;
 static ID3D11Buffer* g_pVSConstantBuffer0 = nullptr; // 萔obt@b0: world
 static ID3D11Buffer* g_pVSConstantBuffer1 = nullptr; // 萔obt@b1: view
 static ID3D11Buffer* g_pVSConstantBuffer2 = nullptr; // 萔obt@b2: proj
 static ID3D11Buffer* g_pPSConstantBuffer0 = nullptr; // 萔obt@b0
 static ID3D11PixelShader* g_pPixelShader = nullptr;
+static ConstantObject g_world;  // b0 worldi萔Oɋl߂BgȂ g_pVSConstantBuffer0j
+static ConstantCache  g_viewCache, g_projCache, g_colorCache; // gȂ瑗蒼Ȃ
 
 bool ShaderDepth_Initialize()
 {
@@ -72,6 +79,34 @@ bool ShaderDepth_Initialize()
 		hal::dout << "ShaderDepth_Initialize() : _CAEg̍쐬Ɏs܂" << std::endl;
 		return false;
 	}
+
+	// l߂_iPackedVertex3djpB߂ȊO͏Ɠ
+	std::ifstream ifs_vsp("shader_vertex_depth_packed.cso", std::ios::binary);
+	if (!ifs_vsp) {
+		MessageBox(nullptr, TEXT("_VF[_[̓ǂݍ݂Ɏs܂\n\nshader_vertex_depth_packed.cso"),
+			TEXT("G["), MB_OK);
+		return false;
+	}
+	std::vector<char> vsp_binary((std::istreambuf_iterator<char>(ifs_vsp)), std::istreambuf_iterator<char>());
+
+	hr = Direct3D_GetDevice()->CreateVertexShader(vsp_binary.data(), vsp_binary.size(), nullptr, &g_pVertexShaderPacked);
+	if (FAILED(hr)) {
+		hal::dout << "ShaderDepth_Initialize() : _VF[_[il߂_j̍쐬Ɏs܂" << std::endl;
+		return false;
+	}
+
+	D3D11_INPUT_ELEMENT_DESC packed_layout[] = {
+		{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM,    0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM,    0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,    0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+	};
+
+	hr = Direct3D_GetDevice()->CreateInputLayout(packed_layout, ARRAYSIZE(packed_layout), vsp_binary.data(), vsp_binary.size(), &g_pInputLayoutPacked);
+	if (FAILED(hr)) {
+		hal::dout << "ShaderDepth_Initialize() : _CAEgil߂_j̍쐬Ɏs܂" << std::endl;
+		return false;
+	}
 	// _VF[_[p萔obt@̍쐬
 	D3D11_BUFFER_DESC buffer_desc{};
 	buffer_desc.ByteWidth = sizeof(XMFLOAT4X4); // obt@̃TCY
@@ -112,6 +147,10 @@ bool ShaderDepth_Initialize()
 	ps_buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
 	Direct3D_GetDevice()->CreateBuffer(&ps_buffer_desc, nullptr, &g_pPSConstantBuffer0);
 
+	g_world = ConstantObject{};
+	g_world.fallback = g_pVSConstantBuffer0;
+	g_viewCache.valid = g_projCache.valid = g_colorCache.valid = false;
+
 	/*==Tv[XeCgݒsampler.cpp/hɈڂ*/
 	Sampler_SetFilterAnisotropic();
 
@@ -123,10 +162,13 @@ void ShaderDepth_Finalize()
 	SAFE_RELEASE(g_pPixelShader);
 	SAFE_RELEASE(g_pPSConstantBuffer0);
 	SAFE_RELEASE(g_pVSConstantBuffer0);
+	g_world = ConstantObject{};
 	SAFE_RELEASE(g_pVSConstantBuffer1);
 	SAFE_RELEASE(g_pVSConstantBuffer2);
 	SAFE_RELEASE(g_pInputLayout);
 	SAFE_RELEASE(g_pVertexShader);
+	SAFE_RELEASE(g_pInputLayoutPacked);
+	SAFE_RELEASE(g_pVertexShaderPacked);
 }
 
 void ShaderDepth_SetWorldMatrix(const DirectX::XMMATRIX& matrix)
@@ -137,23 +179,27 @@ void ShaderDepth_SetWorldMatrix(const DirectX::XMMATRIX& matrix)
 	// s]uĒ萔obt@i[psɕϊ
 	XMStoreFloat4x4(&transpose, XMMatrixTranspose(matrix));
 
-	//===================UpdateSubresource̓f[^GPUɓn֐=====================
-	// 萔obt@ɍsZbg
-	Direct3D_GetContext()->UpdateSubresource(g_pVSConstantBuffer0, 0, nullptr, &transpose, 0, 0);
+	// 萔Oɏb0ɃoCh
+	ConstantRing_WriteObjectVS(&g_world, 0, &transpose, sizeof(transpose));
+}
+
+void ShaderDepth_SetWorldMatrix(const ConstantRingSpan& span, UINT index)
+{
+	ConstantRing_SetObjectVS(&g_world, 0, span, index);
 }
 
 void ShaderDepth_SetViewMatrix(const DirectX::XMMATRIX& matrix)
 {
 	XMFLOAT4X4 t;
 	XMStoreFloat4x4(&t, XMMatrixTranspose(matrix));
-	Direct3D_GetContext()->UpdateSubresource(g_pVSConstantBuffer1, 0, nullptr, &t, 0, 0);
+	ConstantRing_UpdateCached(g_pVSConstantBuffer1, &g_viewCache, &t, sizeof(t));
 }
 
 void ShaderDepth_SetProjectionMatrix(const DirectX::XMMATRIX& matrix)
 {
 	XMFLOAT4X4 t;
 	XMStoreFloat4x4(&t, XMMatrixTranspose(matrix));
-	Direct3D_GetContext()->UpdateSubresource(g_pVSConstantBuffer2, 0, nullptr, &t, 0, 0);
+	ConstantRing_UpdateCached(g_pVSConstantBuffer2, &g_projCache, &t, sizeof(t));
 }
 
 
@@ -165,8 +211,8 @@ void ShaderDepth_SetColor(const DirectX::XMFLOAT4& color)
 		return;
 	}
 
-	// 萔obt@ɍsZbg
-	Direct3D_GetContext()->UpdateSubresource(g_pPSConstantBuffer0, 0, nullptr, &color, 0, 0);
+	// 萔obt@ɐFZbgiOƓȂ瑗Ȃj
+	ConstantRing_UpdateCached(g_pPSConstantBuffer0, &g_colorCache, &color, sizeof(color));
 }
 
 void ShaderDepth_Begin()
@@ -182,9 +228,18 @@ void ShaderDepth_Begin()
 
 	// 萔obt@(VS)`pCvCɐݒ
 	//Direct3D_GetContext()->VSSetConstantBuffers(0, 1, &g_pVSConstantBuffer0); // world
-	ID3D11Buffer* vsCBs[] = { g_pVSConstantBuffer0, g_pVSConstantBuffer1, g_pVSConstantBuffer2 };
-	Direct3D_GetContext()->VSSetConstantBuffers(0, 3, vsCBs);
+	ID3D11Buffer* vsCBs[] = { g_pVSConstantBuffer1, g_pVSConstantBuffer2 };
+	Direct3D_GetContext()->VSSetConstantBuffers(1, 2, vsCBs);
+	ConstantRing_BindObjectVS(&g_world, 0); // world
 
 	// 萔obt@iPSjݒiFpj
 	Direct3D_GetContext()->PSSetConstantBuffers(0, 1, &g_pPSConstantBuffer0);
 }
+
+void ShaderDepth_BeginPacked()
+{
+	ShaderDepth_Begin();
+
+	Direct3D_GetContext()->VSSetShader(g_pVertexShaderPacked, nullptr, 0);
+	Direct3D_GetContext()->IASetInputLayout(g_pInputLayoutPacked);
+}
@@ -13,14 +13,20 @@
 #include<d3d11.h>
 #include<DirectXMath.h>
 
+struct ConstantRingSpan;
+
 bool ShaderDepth_Initialize();
 void ShaderDepth_Finalize();
 
 void ShaderDepth_SetWorldMatrix(const DirectX::XMMATRIX& matrix);
+// ConstantRing_Map ł܂Ƃ߂ďi]uς݂́j[hs index Ԗڂg
+void ShaderDepth_SetWorldMatrix(const ConstantRingSpan& span, UINT index);
 void ShaderDepth_SetViewMatrix(const DirectX::XMMATRIX& matrix);
 void ShaderDepth_SetProjectionMatrix(const DirectX::XMMATRIX& matrix);
 void ShaderDepth_SetColor(const DirectX::XMFLOAT4& color);
 void ShaderDepth_Begin();
+// l߂_iPackedVertex3djpBE Shader3D_SetPackedBounds Œu
+void ShaderDepth_BeginPacked();
 
 #endif//SHADER_DEPTH_H
 
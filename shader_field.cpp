@@ -12,6 +12,7 @@
 #include <fstream>
 #include"direct3d.h"
 #include"sampler.h"
+#include "constant_ring.h"
 
 using namespace DirectX;
 
@@ -19,6 +20,7 @@ static ID3D11VertexShader* g_pVertexShader = nullptr;
 static ID3D11InputLayout* g_pInputLayout = nullptr;
 static ID3D11Buffer* g_pVSConstantBuffer0 = nullptr;//萔obt@O
 static ID3D11PixelShader* g_pPixelShader = nullptr;
+static ConstantObject g_world;  // b0 worldi萔Oɋl߂BgȂ g_pVSConstantBuffer0j
 
 // ӁIŊOݒ肳́BReleasesvB
 static ID3D11Device* g_pDevice = nullptr;
@@ -70,6 +72,8 @@ bool ShaderField_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext
 	bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
 	bd.ByteWidth = sizeof(DirectX::XMFLOAT4X4);
 	g_pDevice->CreateBuffer(&bd, nullptr, &g_pVSConstantBuffer0); // b0: world
+	g_world = ConstantObject{};
+	g_world.fallback = g_pVSConstantBuffer0;
 
 	// Begin() ŃoCh
 	g_pContext->VSSetConstantBuffers(0, 1, &g_pVSConstantBuffer0); // world -> b0
@@ -149,6 +153,7 @@ void Shader_field_Finalize()
 {
 	SAFE_RELEASE(g_pPixelShader);
 	SAFE_RELEASE(g_pVSConstantBuffer0);
+	g_world = ConstantObject{};
 	SAFE_RELEASE(g_pInputLayout);
 	SAFE_RELEASE(g_pVertexShader);
 }
@@ -161,8 +166,8 @@ void Shader_field_SetWorldMatrix(const DirectX::XMMATRIX& matrix)
 	// s]uĒ萔obt@i[psɕϊ
 	XMStoreFloat4x4(&mt, XMMatrixTranspose(matrix));
 
-	// 萔obt@ɍsZbg
-	g_pContext->UpdateSubresource(g_pVSConstantBuffer0, 0, nullptr, &mt, 0, 0);
+	// 萔Oɏb0ɃoCh
+	ConstantRing_WriteObjectVS(&g_world, 0, &mt, sizeof(mt));
 }
 /*
 void Shader_field_SetViewMatrix(const XMMATRIX& m) {
@@ -186,7 +191,7 @@ void Shader_field_Begin()
 	g_pContext->IASetInputLayout(g_pInputLayout);
 
 	// 萔obt@`pCvCɐݒ
-	g_pContext->VSSetConstantBuffers(0, 1, &g_pVSConstantBuffer0);
+	ConstantRing_BindObjectVS(&g_world, 0);
 
 	//Tv[XeCg`pCvCɐݒ
 	//g_pContext->PSSetSamplers(0, 1, &g_pSamplerState);
@@ -34,6 +34,8 @@ cbuffer PS_CONSTANT_SPECULAR : register(b3)
     float4 specular_color = { 0.2f, 0.2f, 0.2f ,1.0f};
 };
 
+//_̓NX^[iʂ̃^C~s̃XCXjƂ
+//͂Cg̔ԍׂCPU瑗Ă炤iclustered_light.cppj
 struct PointLight
 {
     float3 pointlight_posW;
@@ -42,10 +44,27 @@ struct PointLight
 };
 cbuffer PS_CONSTANT_POINTLIGHT : register(b4)
 {
-    PointLight point_light[4];
-    int point_light_count;
-    float3 point_light_dummy;
+    float4x4 cluster_view_projection; //NX^[؂J
+    float4 cluster_view_z; //dot(float4(posW,1), cluster_view_z) = r[Ԃz
+    uint4 cluster_dims; //x,y = ^C, z = XCX, w = Cg
+    float4 cluster_depth; //XCX = (z>0.5 ? log(viewZ) : viewZ) * x + y
 };
+StructuredBuffer<PointLight> point_light : register(t4);
+StructuredBuffer<uint2> cluster_range : register(t5); //(offset, count)
+StructuredBuffer<uint> cluster_light_index : register(t6);
+
+uint ClusterIndex(float3 posW)
+{
+    float4 clip = mul(float4(posW, 1.0f), cluster_view_projection);
+    float2 ndc = clip.xy / max(clip.w, 0.0001f);
+    float2 tile = clamp(floor((ndc * float2(0.5f, -0.5f) + 0.5f) * cluster_dims.xy), 0.0f, cluster_dims.xy - 1.0f);
+
+    float viewZ = dot(float4(posW, 1.0f), cluster_view_z);
+    float slice = (cluster_depth.z > 0.5f ? log(max(viewZ, 0.001f)) : viewZ) * cluster_depth.x + cluster_depth.y;
+    slice = clamp(floor(slice), 0.0f, cluster_dims.z - 1.0f);
+
+    return ((uint)slice * cluster_dims.y + (uint)tile.y) * cluster_dims.x + (uint)tile.x;
+}
 
 struct PS_IN
 {
@@ -55,16 +74,28 @@ struct PS_IN
     float3 normalW : NORMAL0;
     float4 color : COLOR0;
     float2 uv : TEXCOORD0;
+    nointerpolation float slice : TEXCOORD1;
 };
 
 Texture2D tex : register(t0);//eNX`
 Texture2D tex2 : register(t2);//[xeNX`
+Texture2DArray tex_array : register(t3);//Xe[WubÑeNX`zislice >= 0 ̂Ƃj
 SamplerState samp : register(s0);
 //SamplerState samp1 : register(s1);
 
 float4 main(PS_IN pi) : SV_TARGET
 {
-    float3 material_color = tex.Sample(samp, pi.uv).rgb * pi.color.rgb * diffuse_color.rgb; //ގ̐F
+    //slice ͕`悲ƂɓlȂ̂ŁA򂵂ĂSsNZʂ
+    float4 tex_color;
+    if (pi.slice >= 0.0f)
+    {
+        tex_color = tex_array.Sample(samp, float3(pi.uv, pi.slice));
+    }
+    else
+    {
+        tex_color = tex.Sample(samp, pi.uv);
+    }
+    float3 material_color = tex_color.rgb * pi.color.rgb * diffuse_color.rgb; //ގ̐F
     
     //CgvZ
     //s(fBt[YCgEfBNViCg)
@@ -84,7 +115,7 @@ float4 main(PS_IN pi) : SV_TARGET
     float t = pow(max(dot(r, toEye), 0.0f), specular_power); //XyL[Cg̋
     float3 specular = specular_color.rgb * t;
    
-    float alpha = tex.Sample(samp, pi.uv).a * pi.color.a * diffuse_color.a;
+    float alpha = tex_color.a * pi.color.a * diffuse_color.a;
     float3 color = ambient + diffuse + specular;//͉Z//ꂪŏIIɖڂɓ͂F
     
     float lim = max(dot(normalW.xyz, toEye), 0.0f);
@@ -92,8 +123,15 @@ float4 main(PS_IN pi) : SV_TARGET
     //color += float3(lim, lim, lim);
     
     //_i|CgCgj̃TvR[h
-    for (int i = 0; i<point_light_count; i++)
+    //̃sNZ̃NX^[ɓ͂Cg
+    uint2 lights = uint2(0, 0);
+    if (cluster_dims.w > 0)
+    {
+        lights = cluster_range[ClusterIndex(pi.posW.xyz)];
+    }
+    for (uint n = 0; n < lights.y; n++)
     {
+        uint i = cluster_light_index[lights.x + n];
         //_ʁisNZj
         float3 lightToPixel = pi.posW.xyz - point_light[i].pointlight_posW;
     //ʁisNZjƃCgƂ̋𑪂
@@ -117,8 +155,8 @@ float4 main(PS_IN pi) : SV_TARGET
         float t = pow(max(dot(r, toEye), 0.0f), specular_power);
         
         
-        //_̃X؃L
-        color += point_light[i].color.rgb * t;
+        //_̃X؃Li͈͊ÕCg͉Ȃ̂ŁAĂj
+        color += point_light[i].color.rgb * t * influence;
 
     }
     
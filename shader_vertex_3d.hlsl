@@ -36,6 +36,7 @@ XMFLOAT4 
 cbuffer VS_CONSTANT_BUFFER0 : register(b0) 
 {
     float4x4 world;
+    float4 world_params; //x = eNX`z̃XCXiȂ t0 ̕ʂ̃eNX`j
 };
 
 cbuffer VS_CONSTANT_BUFFER1 : register(b1)
@@ -69,6 +70,7 @@ struct VS_OUT//
     float3 normalW : NORMAL0;
     float4 color : COLOR0;
     float2 uv : TEXCOORD0;
+    nointerpolation float slice : TEXCOORD1;
 };
 
 VS_OUT main(VS_IN vi)
@@ -94,6 +96,7 @@ VS_OUT main(VS_IN vi)
     
     vo.color = vi.color;
     vo.uv = vi.uv;
+    vo.slice = world_params.x;
 
     return vo;
 }
\ No newline at end of file
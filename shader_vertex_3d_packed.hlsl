@@ -0,0 +1,65 @@
+/*==============================================================================
+
+   3D`p_VF[_[il߂_j [shader_vertex_3d_packed.hlsl]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+    shader_vertex_3d.hlsl ̓͂ PackedVertex3d ɂ́B߂͓B
+==============================================================================*/
+#include "shader_vertex_packed.hlsli"
+
+cbuffer VS_CONSTANT_BUFFER0 : register(b0)
+{
+    float4x4 world;
+    float4 world_params; //x = eNX`z̃XCXiȂ t0 ̕ʂ̃eNX`j
+};
+
+cbuffer VS_CONSTANT_BUFFER1 : register(b1)
+{
+    float4x4 view;
+};
+
+cbuffer VS_CONSTANT_BUFFER2 : register(b2)
+{
+    float4x4 projection;
+};
+
+cbuffer VS_CONSTANT_BUFFER3 : register(b3)
+{
+    float4x4 light_view_proj;
+};
+
+struct VS_OUT
+{
+    float4 posH : SV_POSITION;
+    float4 posW : POSITION0;
+    float4 posLightWVP : POSITION1;
+    float3 normalW : NORMAL0;
+    float4 color : COLOR0;
+    float2 uv : TEXCOORD0;
+    nointerpolation float slice : TEXCOORD1;
+};
+
+VS_OUT main(VS_IN_PACKED vi)
+{
+    VS_OUT vo;
+
+    float4 posL = UnpackPosition(vi.posQ);
+    float3 normalL = UnpackNormal(vi.normalOct);
+
+    float4 posW = mul(posL, world);
+    float4 posV = mul(posW, view);
+    vo.posH = mul(posV, projection);
+
+    vo.posLightWVP = mul(posL, mul(world, light_view_proj));
+
+    float4 normalW = mul(float4(normalL, 0.0f), world);
+    vo.normalW = normalize(normalW.xyz);
+    vo.posW = posW;
+
+    vo.color = vi.color;
+    vo.uv = vi.uv;
+    vo.slice = world_params.x;
+
+    return vo;
+}
@@ -0,0 +1,45 @@
+/*==============================================================================
+
+   CeBOȂ3D_VF[_[il߂_j [shader_vertex_3d_unlit_packed.hlsl]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+    shader_vertex_3d_unlit.hlsl ̓͂ PackedVertex3d ɂ́B
+==============================================================================*/
+#include "shader_vertex_packed.hlsli"
+
+cbuffer VS_CONSTANT_BUFFER0 : register(b0)
+{
+    float4x4 world;
+};
+
+cbuffer VS_CONSTANT_BUFFER1 : register(b1)
+{
+    float4x4 view;
+};
+
+cbuffer VS_CONSTANT_BUFFER2 : register(b2)
+{
+    float4x4 projection;
+};
+
+struct VS_OUT
+{
+    float4 posH : SV_POSITION;
+    float2 uv : TEXCOORD0;
+    float posLy : TEXCOORD1;
+};
+
+VS_OUT main(VS_IN_PACKED vi)
+{
+    VS_OUT vo;
+
+    float4 posL = UnpackPosition(vi.posQ);
+
+    float4x4 mtxWV = mul(world, view);
+    float4x4 mtxWVP = mul(mtxWV, projection);
+    vo.posH = mul(posL, mtxWVP);
+    vo.uv = vi.uv;
+    vo.posLy = posL.y;
+    return vo;
+}
@@ -0,0 +1,41 @@
+/*==============================================================================
+
+   [x`p_VF[_[il߂_j [shader_vertex_depth_packed.hlsl]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+    shader_vertex_depth.hlsl ̓͂ PackedVertex3d ɂ́B
+==============================================================================*/
+#include "shader_vertex_packed.hlsli"
+
+cbuffer VS_CONSTANT_BUFFER : register(b0)
+{
+    float4x4 world;
+};
+
+cbuffer VS_CONSTANT_BUFFER : register(b1)
+{
+    float4x4 view;
+};
+
+cbuffer VS_CONSTANT_BUFFER : register(b2)
+{
+    float4x4 proj;
+};
+
+struct VS_0UT
+{
+    float4 posH : SV_POSITION;
+    float4 posW : POSITION0;
+};
+
+VS_0UT main(VS_IN_PACKED vi)
+{
+    VS_0UT vo;
+
+    vo.posW = mul(UnpackPosition(vi.posQ), world);
+    float4x4 mtxVP = mul(view, proj);
+    vo.posH = mul(vo.posW, mtxVP);
+
+    return vo;
+}
@@ -0,0 +1,38 @@
+/*==============================================================================
+
+   l߂_iPackedVertex3dj߂ [shader_vertex_packed.hlsli]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+    vertex_pack.h  VertexPack_Unpack ƓvZB̓CAEg
+    UNORM16 / SNORM16 / UNORM8 / half  0`1 Ȃǂ float ɂȂē͂B
+==============================================================================*/
+
+// ʒűEiShader3D_SetPackedBounds őj
+cbuffer VS_CONSTANT_BUFFER5 : register(b5)
+{
+    float4 pack_min;
+    float4 pack_extent;
+};
+
+struct VS_IN_PACKED
+{
+    float4 posQ : POSITION0;   // E̒ 0`1
+    float2 normalOct : NORMAL0; // ʑ̎ʑ
+    float4 color : COLOR0;
+    float2 uv : TEXCOORD0;
+};
+
+float4 UnpackPosition(float4 posQ)
+{
+    return float4(pack_min.xyz + posQ.xyz * pack_extent.xyz, 1.0f);
+}
+
+float3 UnpackNormal(float2 f)
+{
+    float3 n = float3(f.x, f.y, 1.0f - abs(f.x) - abs(f.y));
+    float t = saturate(-n.z);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    return normalize(n);
+}
@@ -0,0 +1,126 @@
+/*==============================================================================
+
+@@@e̐[x}bv쐬iÓILX^[̃LbVj[shadow_cache.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "shadow_cache.h"
+#include "direct3d.h"
+#include "camera.h"
+#include "light_camera.h"
+#include "shader_depth.h"
+#include "stage01_manage.h"
+#include "frustum.h"
+#include "render_stats.h"
+#include "system_timer.h"
+#include <cstring>
+
+using namespace DirectX;
+
+namespace
+{
+    ShadowMode g_mode = SHADOW_MODE_DYNAMIC_ONLY;
+
+    bool         g_valid = false;          // LbVɒg邩
+    unsigned int g_bakedRevision = 0;      // Ă Stage01_GetStaticRevision()
+    XMFLOAT4X4   g_bakedView{};            // ẴCgs
+    XMFLOAT4X4   g_bakedProj{};
+    unsigned int g_bakeCount = 0;
+
+    void SetLightMatrices(const XMMATRIX& view, const XMMATRIX& proj)
+    {
+        // JɊւsVF[_[ɐݒ肷
+        Camera_SetMatrix(view, proj);
+
+        ShaderDepth_SetViewMatrix(view);
+        ShaderDepth_SetProjectionMatrix(proj);
+
+        // [xL
+        Direct3D_SetDepthEnable(true);
+    }
+
+    bool NeedsBake(const XMFLOAT4X4& view, const XMFLOAT4X4& proj)
+    {
+        if (!g_valid) return true;
+        if (g_bakedRevision != Stage01_GetStaticRevision()) return true;
+        if (std::memcmp(&g_bakedView, &view, sizeof(view)) != 0) return true;
+        if (std::memcmp(&g_bakedProj, &proj, sizeof(proj)) != 0) return true;
+        return false;
+    }
+
+    void RenderPass(void (*drawDynamicCasters)())
+    {
+        // CgJisj̐ݒ
+        XMFLOAT4X4 mtxView = LightCamera_GetViewMatrix();
+        XMFLOAT4X4 mtxProj = LightCamera_GetProjectionMatrix();
+        XMMATRIX view = XMLoadFloat4x4(&mtxView);
+        XMMATRIX proj = XMLoadFloat4x4(&mtxProj);
+
+        if (g_mode == SHADOW_MODE_DYNAMIC_ONLY)
+        {
+            // _[^[QbgeNX`
+            Direct3D_SetShadowDepth();
+            Direct3D_ClearShadowDepth();
+
+            SetLightMatrices(view, proj);
+            if (drawDynamicCasters) drawDynamicCasters();
+            return;
+        }
+
+        const Frustum lightFrustum = Frustum_FromViewProjection(view * proj);
+
+        // ÓILX^[FωLbV֏Ă
+        if (NeedsBake(mtxView, mtxProj))
+        {
+            Direct3D_SetStaticShadowDepth();
+            SetLightMatrices(view, proj);
+            Stage01_DepthDrawCasters(STAGE01_CASTER_STATIC, lightFrustum);
+
+            g_valid = true;
+            g_bakedRevision = Stage01_GetStaticRevision();
+            g_bakedView = mtxView;
+            g_bakedProj = mtxProj;
+            ++g_bakeCount;
+        }
+
+        // LbVRs[āȀɓ̂d˂
+        Direct3D_SetShadowDepthFromStatic();
+        SetLightMatrices(view, proj);
+
+        Stage01_DepthDrawCasters(STAGE01_CASTER_MOVING, lightFrustum);
+        if (drawDynamicCasters) drawDynamicCasters();
+    }
+}
+
+void ShadowCache_SetMode(ShadowMode mode)
+{
+    if (g_mode != mode) g_valid = false;
+    g_mode = mode;
+}
+
+ShadowMode ShadowCache_GetMode()
+{
+    return g_mode;
+}
+
+void ShadowCache_Invalidate()
+{
+    g_valid = false;
+}
+
+void ShadowCache_Render(void (*drawDynamicCasters)())
+{
+    const double begin = SystemTimer_GetAbsoluteTime();
+
+    RenderPass(drawDynamicCasters);
+
+    RenderStats_AddPassTime(RENDER_STATS_PASS_SHADOW,
+        (SystemTimer_GetAbsoluteTime() - begin) * 1000.0);
+}
+
+unsigned int ShadowCache_GetStaticBakeCount()
+{
+    return g_bakeCount;
+}
@@ -0,0 +1,37 @@
+/*==============================================================================
+
+@@@e̐[x}bv쐬iÓILX^[̃LbVj[shadow_cache.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    eXe[W lightRendering() ̒gB
+    ȂXe[WubN͕ʂ̐[x}bv1񂾂ĂĂAt[
+    Rs[ĂvC[Ɠꂾd˂ĕ`B
+    Ă̂̓ubN\ςiStage01_GetStaticRevisionj
+    Cg̍s񂪕ςBLX^[̓Cg̎ōiB
+
+==============================================================================*/
+#ifndef SHADOW_CACHE_H
+#define SHADOW_CACHE_H
+
+enum ShadowMode
+{
+    SHADOW_MODE_DYNAMIC_ONLY,  // ]ʂFt[NAēILX^[`
+    SHADOW_MODE_CACHED_STATIC, // Xe[WubNe𗎂ƂiÓI̓LbVj
+};
+
+//  SHADOW_MODE_DYNAMIC_ONLYiڂ͏]̂܂܁jBubNɂe𗎂ƂƂ؂ւ
+void       ShadowCache_SetMode(ShadowMode mode);
+ShadowMode ShadowCache_GetMode();
+
+// ̃t[ŐÓILX^[KĂiXe[WؑւȂǁj
+void ShadowCache_Invalidate();
+
+// [x}bvBdrawDynamicCasters ɂ̓vC[Ȃǖt[̂`֐n
+void ShadowCache_Render(void (*drawDynamicCasters)());
+
+// ܂łɐÓILX^[Ă񐔁imFpj
+unsigned int ShadowCache_GetStaticBakeCount();
+
+#endif // SHADOW_CACHE_H
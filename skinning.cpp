@@ -0,0 +1,517 @@
+/*==============================================================================
+
+@@@CPU XLjO[skinning.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "skinning.h"
+#include "worker_pool.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define SKINNING_TARGET_AVX2
+#else
+#define SKINNING_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+
+namespace
+{
+    const uint32_t kBatch = 8;      // AVX2 1
+    const uint32_t kChunk = 2048;   // [J[1Ŕz钸_ikBatch ̔{j
+
+    // (p - min) * scale  0..65535 ɂ
+    struct PackScale
+    {
+        float min[3];
+        float scale[3];
+    };
+
+    PackScale MakePackScale(const VertexPackBounds& bounds)
+    {
+        PackScale ps;
+        for (int a = 0; a < 3; ++a) {
+            ps.min[a] = bounds.min[a];
+            // ݂̂Ȃ͑S 0i߂ min ̂́j
+            ps.scale[a] = bounds.extent[a] > 0.0f ? 65535.0f / bounds.extent[a] : 0.0f;
+        }
+        return ps;
+    }
+
+    void WriteVertex(const SkinningStream& stream, uint32_t v, const int32_t position[3], const int32_t normal[2], PackedVertex3d* out)
+    {
+        PackedVertex3d packed;
+        for (int a = 0; a < 3; ++a) packed.position[a] = (uint16_t)position[a];
+        packed.position[3] = 65535;
+        packed.normal[0] = (int16_t)normal[0];
+        packed.normal[1] = (int16_t)normal[1];
+        std::memcpy(packed.color, &stream.color[v], sizeof(packed.color));
+        std::memcpy(packed.texcoord, &stream.texcoord[v], sizeof(packed.texcoord));
+        *out = packed; // ݌Ȃ̂œǂ܂ɏɏ
+    }
+
+    void RunScalar(const SkinningStream& stream, const SkinningPalette& palette, const VertexPackBounds& bounds,
+        uint32_t begin, uint32_t end, PackedVertex3d* out)
+    {
+        const PackScale ps = MakePackScale(bounds);
+        const float* bones = palette.data.data();
+
+        for (uint32_t v = begin; v < end; ++v) {
+            float m[16] = {};
+            for (int k = 0; k < 4; ++k) {
+                const float w = stream.weight[k][v];
+                if (w == 0.0f) continue;
+                const float* b = bones + stream.bone[k][v] * 16;
+                for (int c = 0; c < 16; ++c) m[c] += w * b[c];
+            }
+
+            const float p[3] = { stream.position[0][v], stream.position[1][v], stream.position[2][v] };
+            const float n[3] = { stream.normal[0][v], stream.normal[1][v], stream.normal[2][v] };
+
+            int32_t position[3];
+            float normal[3];
+            for (int r = 0; r < 3; ++r) {
+                const float q = (p[0] * m[r] + p[1] * m[4 + r] + p[2] * m[8 + r] + m[12 + r] - ps.min[r]) * ps.scale[r];
+                position[r] = (int32_t)((std::max)(0.0f, (std::min)(q, 65535.0f)) + 0.5f);
+                normal[r] = n[0] * m[r] + n[1] * m[4 + r] + n[2] * m[8 + r];
+            }
+
+            // ʑ̎ʑ͒Ŋ蒼̂ŁAŐKȂĂ悢
+            int16_t oct[2];
+            VertexPack_OctEncode(normal, oct);
+            const int32_t octOut[2] = { oct[0], oct[1] };
+            WriteVertex(stream, v, position, octOut, &out[v]);
+        }
+    }
+
+    SKINNING_TARGET_AVX2
+    void RunAVX2(const SkinningStream& stream, const SkinningPalette& palette, const VertexPackBounds& bounds,
+        uint32_t begin, uint32_t end, PackedVertex3d* out)
+    {
+        const PackScale ps = MakePackScale(bounds);
+        const float* bones = palette.data.data();
+
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        const __m256 maxQ = _mm256_set1_ps(65535.0f);
+        const __m256 snorm = _mm256_set1_ps(32767.0f);
+        const __m256 tiny = _mm256_set1_ps(FLT_MIN);
+
+        alignas(32) float skinned[2][kBatch][4]; // ʒuE@i_Ɓj
+        alignas(32) int32_t qp[3][kBatch];
+        alignas(32) int32_t qn[2][kBatch];
+
+        for (uint32_t v = begin; v < end; v += kBatch) {
+            // _Ƃɍ̍sāigather gȂjAʒuƖ@Ɋ|B
+            // s [s0|s1] [s2|s3]  2 {Bv' = x*s0 + y*s1 + z*s2 + s3
+            for (uint32_t i = 0; i < kBatch; ++i) {
+                __m256 m01 = zero;
+                __m256 m23 = zero;
+                for (int k = 0; k < 4; ++k) {
+                    const float weight = stream.weight[k][v + i];
+                    if (weight == 0.0f) continue;
+                    const float* b = bones + stream.bone[k][v + i] * 16;
+                    const __m256 w = _mm256_set1_ps(weight);
+                    m01 = _mm256_fmadd_ps(w, _mm256_loadu_ps(b), m01);
+                    m23 = _mm256_fmadd_ps(w, _mm256_loadu_ps(b + 8), m23);
+                }
+
+                const __m256 pxy = _mm256_set_m128(_mm_set1_ps(stream.position[1][v + i]), _mm_set1_ps(stream.position[0][v + i]));
+                const __m256 pz1 = _mm256_set_m128(_mm_set1_ps(1.0f), _mm_set1_ps(stream.position[2][v + i]));
+                const __m256 nxy = _mm256_set_m128(_mm_set1_ps(stream.normal[1][v + i]), _mm_set1_ps(stream.normal[0][v + i]));
+                const __m256 nz0 = _mm256_set_m128(_mm_setzero_ps(), _mm_set1_ps(stream.normal[2][v + i]));
+
+                const __m256 p = _mm256_fmadd_ps(m01, pxy, _mm256_mul_ps(m23, pz1));
+                const __m256 n = _mm256_fmadd_ps(m01, nxy, _mm256_mul_ps(m23, nz0));
+                _mm_store_ps(skinned[0][i], _mm_add_ps(_mm256_castps256_ps128(p), _mm256_extractf128_ps(p, 1)));
+                _mm_store_ps(skinned[1][i], _mm_add_ps(_mm256_castps256_ps128(n), _mm256_extractf128_ps(n, 1)));
+            }
+
+            // 8 _ ~ xyzw 𐬕Ƃ 8 {ɕבւ
+            __m256 soa[2][3];
+            for (int t = 0; t < 2; ++t) {
+                const __m256 r04 = _mm256_set_m128(_mm_load_ps(skinned[t][4]), _mm_load_ps(skinned[t][0]));
+                const __m256 r15 = _mm256_set_m128(_mm_load_ps(skinned[t][5]), _mm_load_ps(skinned[t][1]));
+                const __m256 r26 = _mm256_set_m128(_mm_load_ps(skinned[t][6]), _mm_load_ps(skinned[t][2]));
+                const __m256 r37 = _mm256_set_m128(_mm_load_ps(skinned[t][7]), _mm_load_ps(skinned[t][3]));
+                const __m256 xy01 = _mm256_unpacklo_ps(r04, r15);   // x0 x1 y0 y1 | x4 x5 y4 y5
+                const __m256 xy23 = _mm256_unpacklo_ps(r26, r37);
+                const __m256 zw01 = _mm256_unpackhi_ps(r04, r15);   // z0 z1 w0 w1 | z4 z5 w4 w5
+                const __m256 zw23 = _mm256_unpackhi_ps(r26, r37);
+                soa[t][0] = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+                soa[t][1] = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+                soa[t][2] = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+            }
+
+            __m256 n[3];
+            for (int r = 0; r < 3; ++r) {
+                __m256 q = _mm256_mul_ps(_mm256_sub_ps(soa[0][r], _mm256_set1_ps(ps.min[r])), _mm256_set1_ps(ps.scale[r]));
+                q = _mm256_min_ps(_mm256_max_ps(q, zero), maxQ);
+                _mm256_store_si256((__m256i*)qp[r], _mm256_cvtps_epi32(q));
+                n[r] = soa[1][r];
+            }
+
+            // ʑ̎ʑiVertexPack_OctEncode ƓBŊ蒼̂ŐK͗vȂj
+            const __m256 ax = _mm256_andnot_ps(signMask, n[0]);
+            const __m256 ay = _mm256_andnot_ps(signMask, n[1]);
+            const __m256 az = _mm256_andnot_ps(signMask, n[2]);
+            const __m256 inv = _mm256_div_ps(one, _mm256_max_ps(_mm256_add_ps(ax, _mm256_add_ps(ay, az)), tiny));
+            __m256 ox = _mm256_mul_ps(n[0], inv);
+            __m256 oy = _mm256_mul_ps(n[1], inv);
+            const __m256 sx = _mm256_or_ps(one, _mm256_and_ps(ox, signMask));
+            const __m256 sy = _mm256_or_ps(one, _mm256_and_ps(oy, signMask));
+            const __m256 fx = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_andnot_ps(signMask, oy)), sx);
+            const __m256 fy = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_andnot_ps(signMask, ox)), sy);
+            const __m256 lower = _mm256_cmp_ps(n[2], zero, _CMP_LT_OQ);
+            ox = _mm256_blendv_ps(ox, fx, lower);
+            oy = _mm256_blendv_ps(oy, fy, lower);
+            ox = _mm256_min_ps(_mm256_max_ps(ox, _mm256_sub_ps(zero, one)), one);
+            oy = _mm256_min_ps(_mm256_max_ps(oy, _mm256_sub_ps(zero, one)), one);
+            _mm256_store_si256((__m256i*)qn[0], _mm256_cvtps_epi32(_mm256_mul_ps(ox, snorm)));
+            _mm256_store_si256((__m256i*)qn[1], _mm256_cvtps_epi32(_mm256_mul_ps(oy, snorm)));
+
+            // WriteVertex ƓBAVX ̂܂ SSE ̊֐ĂԂƐ؂ւŒxȂ̂ŁAɏ
+            const uint32_t lanes = (std::min)(kBatch, end - v);
+            for (uint32_t i = 0; i < lanes; ++i) {
+                PackedVertex3d packed;
+                packed.position[0] = (uint16_t)qp[0][i];
+                packed.position[1] = (uint16_t)qp[1][i];
+                packed.position[2] = (uint16_t)qp[2][i];
+                packed.position[3] = 65535;
+                packed.normal[0] = (int16_t)qn[0][i];
+                packed.normal[1] = (int16_t)qn[1][i];
+                std::memcpy(packed.color, &stream.color[v + i], sizeof(packed.color));
+                std::memcpy(packed.texcoord, &stream.texcoord[v + i], sizeof(packed.texcoord));
+                out[v + i] = packed;
+            }
+        }
+    }
+
+    bool DetectAVX2()
+    {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) return false;
+        __cpuid(info, 1);
+        const bool fma = (info[2] & (1 << 12)) != 0;
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        if (!fma || !osxsave || !avx) return false;
+        if ((_xgetbv(0) & 6) != 6) return false; // OS  YMM ޔĂ邩
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+    }
+}
+
+size_t SkinningStream::Bytes() const
+{
+    return (size_t)paddedCount * (6 * sizeof(float) + 4 * (sizeof(uint16_t) + sizeof(float)) + 2 * sizeof(uint32_t))
+        + boxes.size() * sizeof(SkinningBoneBox);
+}
+
+void Skinning_Build(const SkinningSourceVertex* vertices, uint32_t vertexCount, uint32_t boneCount, SkinningStream* out)
+{
+    SkinningStream& s = *out;
+    s = SkinningStream{};
+    s.vertexCount = vertexCount;
+    s.paddedCount = (vertexCount + kBatch - 1) & ~(kBatch - 1);
+    for (int a = 0; a < 3; ++a) {
+        s.position[a].assign(s.paddedCount, 0.0f);
+        s.normal[a].assign(s.paddedCount, 0.0f);
+    }
+    for (int k = 0; k < 4; ++k) {
+        s.bone[k].assign(s.paddedCount, 0);
+        s.weight[k].assign(s.paddedCount, 0.0f);
+    }
+    s.color.assign(s.paddedCount, 0);
+    s.texcoord.assign(s.paddedCount, 0);
+
+    // Ƃ̔iŌ͍̂Ȃ_pj
+    std::vector<SkinningBoneBox> boxes(boneCount + 1);
+    std::vector<bool> used(boneCount + 1, false);
+    for (uint32_t b = 0; b <= boneCount; ++b) {
+        boxes[b].bone = b;
+        for (int a = 0; a < 3; ++a) {
+            boxes[b].min[a] = FLT_MAX;
+            boxes[b].max[a] = -FLT_MAX;
+        }
+    }
+
+    const VertexPackBounds none{};
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+        const SkinningSourceVertex& src = vertices[v];
+        for (int a = 0; a < 3; ++a) {
+            s.position[a][v] = src.position[a];
+            s.normal[a][v] = src.normal[a];
+        }
+
+        uint16_t bone[4] = {};
+        float weight[4] = {};
+        float sum = 0.0f;
+        for (int k = 0; k < 4; ++k) {
+            if (src.weight[k] > 0.0f && src.bone[k] < boneCount) {
+                bone[k] = src.bone[k];
+                weight[k] = src.weight[k];
+                sum += weight[k];
+            }
+        }
+        if (sum <= 0.0f) {
+            // 񂪂Ȃ_͒PʍsŁioCh|[Ŷ܂܁j
+            bone[0] = (uint16_t)boneCount;
+            weight[0] = 1.0f;
+        }
+        else {
+            for (float& w : weight) w /= sum;
+        }
+
+        for (int k = 0; k < 4; ++k) {
+            s.bone[k][v] = bone[k];
+            s.weight[k][v] = weight[k];
+            if (weight[k] <= 0.0f) continue;
+
+            SkinningBoneBox& box = boxes[bone[k]];
+            used[bone[k]] = true;
+            for (int a = 0; a < 3; ++a) {
+                box.min[a] = (std::min)(box.min[a], src.position[a]);
+                box.max[a] = (std::max)(box.max[a], src.position[a]);
+            }
+        }
+
+        // F UV ̓|[YŕςȂ̂ŁAl߂`ŎĂ
+        PackedVertex3d packed;
+        VertexPack_Pack(none, src.position, src.normal, src.color, src.texcoord, &packed);
+        std::memcpy(&s.color[v], packed.color, sizeof(packed.color));
+        std::memcpy(&s.texcoord[v], packed.texcoord, sizeof(packed.texcoord));
+    }
+
+    for (uint32_t b = 0; b <= boneCount; ++b) {
+        if (used[b]) s.boxes.push_back(boxes[b]);
+    }
+}
+
+void Skinning_InitPalette(SkinningPalette* palette, uint32_t boneCount)
+{
+    palette->boneCount = boneCount;
+    palette->data.assign((size_t)(boneCount + 1) * 16, 0.0f);
+    for (uint32_t b = 0; b <= boneCount; ++b) {
+        float* m = &palette->data[b * 16];
+        m[0] = m[5] = m[10] = 1.0f;
+    }
+}
+
+void Skinning_SetBone(SkinningPalette* palette, uint32_t bone, const float m[16])
+{
+    if (bone >= palette->boneCount) return;
+
+    // 4 ځiˉej͎gȂ̂ 0 ɂĂi w  0 ̂܂܂ɂȂj
+    float* dst = &palette->data[bone * 16];
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 3; ++c) dst[r * 4 + c] = m[r * 4 + c];
+        dst[r * 4 + 3] = 0.0f;
+    }
+}
+
+VertexPackBounds Skinning_ComputeBounds(const SkinningStream& stream, const SkinningPalette& palette)
+{
+    float mn[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+    float mx[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    // XL̒_́Aeœ_d݂ṓ̓ʕ̒
+    for (const SkinningBoneBox& box : stream.boxes) {
+        const float* m = &palette.data[box.bone * 16];
+        float center[3], half[3];
+        for (int a = 0; a < 3; ++a) {
+            center[a] = (box.min[a] + box.max[a]) * 0.5f;
+            half[a] = (box.max[a] - box.min[a]) * 0.5f;
+        }
+        for (int r = 0; r < 3; ++r) {
+            const float c = center[0] * m[r] + center[1] * m[4 + r] + center[2] * m[8 + r] + m[12 + r];
+            const float e = half[0] * std::fabs(m[r]) + half[1] * std::fabs(m[4 + r]) + half[2] * std::fabs(m[8 + r]);
+            mn[r] = (std::min)(mn[r], c - e);
+            mx[r] = (std::max)(mx[r], c + e);
+        }
+    }
+    if (stream.boxes.empty()) {
+        for (int a = 0; a < 3; ++a) mn[a] = mx[a] = 0.0f;
+    }
+    return VertexPack_MakeBounds(mn, mx);
+}
+
+void Skinning_Run(const SkinningStream& stream, const SkinningPalette& palette, const VertexPackBounds& bounds,
+    uint32_t begin, uint32_t end, PackedVertex3d* out, bool allowSimd)
+{
+    end = (std::min)(end, stream.vertexCount);
+    if (begin >= end) return;
+
+    if (allowSimd && Skinning_HasAVX2())
+        RunAVX2(stream, palette, bounds, begin, end, out);
+    else
+        RunScalar(stream, palette, bounds, begin, end, out);
+}
+
+void Skinning_RunJobs(WorkerPool* pool, const SkinningPalette& palette, const SkinningJob* jobs, size_t jobCount)
+{
+    struct Range
+    {
+        const SkinningJob* job;
+        uint32_t begin;
+        uint32_t end;
+    };
+    std::vector<Range> ranges;
+    for (size_t j = 0; j < jobCount; ++j) {
+        for (uint32_t begin = 0; begin < jobs[j].stream->vertexCount; begin += kChunk) {
+            ranges.push_back({ &jobs[j], begin, (std::min)(begin + kChunk, jobs[j].stream->vertexCount) });
+        }
+    }
+
+    auto run = [&](uint32_t i) {
+        const Range& r = ranges[i];
+        Skinning_Run(*r.job->stream, palette, r.job->bounds, r.begin, r.end, r.job->out);
+    };
+    if (pool)
+        pool->ParallelFor((uint32_t)ranges.size(), run);
+    else
+        for (uint32_t i = 0; i < (uint32_t)ranges.size(); ++i) run(i);
+}
+
+bool Skinning_HasAVX2()
+{
+    static const bool s_hasAVX2 = DetectAVX2();
+    return s_hasAVX2;
+}
+
+SkinningBenchmarkResult Skinning_Benchmark(uint32_t vertexCount, uint32_t boneCount, int iterations, WorkerPool* pool)
+{
+    SkinningBenchmarkResult result{};
+    if (vertexCount == 0 || boneCount == 0) return result;
+    iterations = (std::max)(1, iterations);
+
+    // 蕨̃bVF1`4 {̍ɁA炵d݂ŏ悹
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_int_distribution<int> boneDist(0, (int)boneCount - 1);
+    std::uniform_int_distribution<int> countDist(1, 4);
+
+    std::vector<SkinningSourceVertex> source(vertexCount);
+    for (SkinningSourceVertex& v : source) {
+        v = SkinningSourceVertex{};
+        for (int a = 0; a < 3; ++a) v.position[a] = unit(rng);
+        const float n[3] = { unit(rng), unit(rng), unit(rng) + 0.01f };
+        const float len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        for (int a = 0; a < 3; ++a) v.normal[a] = n[a] / len;
+        for (float& c : v.color) c = 1.0f;
+        v.texcoord[0] = unit(rng) * 0.5f + 0.5f;
+        v.texcoord[1] = unit(rng) * 0.5f + 0.5f;
+
+        const int influences = countDist(rng);
+        float sum = 0.0f;
+        for (int k = 0; k < influences; ++k) {
+            v.bone[k] = (uint16_t)boneDist(rng);
+            v.weight[k] = unit(rng) * 0.5f + 0.5f + 0.01f;
+            sum += v.weight[k];
+        }
+        for (int k = 0; k < influences; ++k) v.weight[k] /= sum;
+    }
+
+    // ͉]{ړ{̊gkirow-vector  4x4j
+    std::vector<float> matrices(boneCount * 16);
+    SkinningPalette palette;
+    Skinning_InitPalette(&palette, boneCount);
+    for (uint32_t b = 0; b < boneCount; ++b) {
+        const float angle = unit(rng) * 3.14159265f;
+        const float c = std::cos(angle), s = std::sin(angle), scale = 1.0f + unit(rng) * 0.1f;
+        float* m = &matrices[b * 16];
+        const float rows[16] = {
+            c * scale, 0.0f, -s * scale, 0.0f,
+            0.0f, scale, 0.0f, 0.0f,
+            s * scale, 0.0f, c * scale, 0.0f,
+            unit(rng), unit(rng), unit(rng), 1.0f,
+        };
+        std::copy(rows, rows + 16, m);
+        Skinning_SetBone(&palette, b, m);
+    }
+
+    SkinningStream stream;
+    Skinning_Build(source.data(), vertexCount, boneCount, &stream);
+
+    std::vector<PackedVertex3d> reference(vertexCount), out(vertexCount);
+    using Clock = std::chrono::steady_clock;
+    auto average = [&](auto&& fn) {
+        fn(); // 1ڂ̓LbV߂邾
+        const Clock::time_point start = Clock::now();
+        for (int i = 0; i < iterations; ++i) fn();
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+    };
+
+    // ȑÔFƂɈʒuƖ@ϊčAƗp̔zɒuĂ狫Eċl߂
+    struct Staging
+    {
+        float position[3];
+        float normal[3];
+        float color[4];
+        float texcoord[2];
+    };
+    std::vector<Staging> staging(vertexCount);
+    result.perInfluenceMs = average([&] {
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            const SkinningSourceVertex& src = source[v];
+            float p[3] = {}, n[3] = {};
+            for (int k = 0; k < 4; ++k) {
+                if (src.weight[k] <= 0.0f) continue;
+                const float* m = &matrices[src.bone[k] * 16];
+                for (int r = 0; r < 3; ++r) {
+                    p[r] += src.weight[k] * (src.position[0] * m[r] + src.position[1] * m[4 + r] + src.position[2] * m[8 + r] + m[12 + r]);
+                    n[r] += src.weight[k] * (src.normal[0] * m[r] + src.normal[1] * m[4 + r] + src.normal[2] * m[8 + r]);
+                }
+            }
+            const float len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            Staging& dst = staging[v];
+            for (int a = 0; a < 3; ++a) {
+                dst.position[a] = p[a];
+                dst.normal[a] = len > 0.0f ? n[a] / len : 0.0f;
+            }
+            std::copy(src.color, src.color + 4, dst.color);
+            std::copy(src.texcoord, src.texcoord + 2, dst.texcoord);
+        }
+        const VertexPackBounds bounds = VertexPack_ComputeBounds(&staging[0].position[0], vertexCount, sizeof(Staging));
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            const Staging& s = staging[v];
+            VertexPack_Pack(bounds, s.position, s.normal, s.color, s.texcoord, &reference[v]);
+        }
+    });
+    const VertexPackBounds referenceBounds = VertexPack_ComputeBounds(&staging[0].position[0], vertexCount, sizeof(Staging));
+
+    const VertexPackBounds bounds = Skinning_ComputeBounds(stream, palette);
+    result.scalarMs = average([&] {
+        Skinning_Run(stream, palette, Skinning_ComputeBounds(stream, palette), 0, vertexCount, out.data(), false);
+    });
+    result.simdMs = average([&] {
+        Skinning_Run(stream, palette, Skinning_ComputeBounds(stream, palette), 0, vertexCount, out.data(), true);
+    });
+    result.parallelMs = average([&] {
+        const SkinningJob job{ &stream, Skinning_ComputeBounds(stream, palette), out.data() };
+        Skinning_RunJobs(pool, palette, &job, 1);
+    });
+    result.threads = (pool && pool->IsRunning()) ? pool->ThreadCount() + 1 : 1;
+
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+        float a[3], b[3], n[3], c[4], t[2];
+        VertexPack_Unpack(referenceBounds, reference[v], a, n, c, t);
+        VertexPack_Unpack(bounds, out[v], b, n, c, t);
+        for (int i = 0; i < 3; ++i) result.maxPositionError = (std::max)(result.maxPositionError, std::fabs(a[i] - b[i]));
+    }
+    return result;
+}
@@ -0,0 +1,113 @@
+/*==============================================================================
+
+@@@CPU XLjO[skinning.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    _Ƃɍ̍sd݂ō1ɂĂAʒuƖ@1񂸂|
+    iƂɕϊĂ獬̂ƌʂ͓ŁA|Z 1/4 ɂȂjB
+    _ SoA ŎAAVX2 g CPU Ȃ 8 _܂Ƃ߂ďB
+    ʂ PackedVertex3divertex_pack.hjɋl߂āAMap _obt@֒ڏB
+
+    l߂邽߂̋ÉAƂɁu̍_̃oCh̔v
+    ̍sœč킹́iXL̒_͕K̒ɓjB
+    _OɌ܂̂ŁAƗp̔z܂1ŏB
+
+    Skinning_RunJobs ̓bV𒸓_͈̔͂ɐ؂ă[J[iworker_pool.hjɔzB
+    CPU ŊiD3D ɈˑȂjB
+
+==============================================================================*/
+#ifndef SKINNING_H
+#define SKINNING_H
+
+#include "vertex_pack.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class WorkerPool;
+
+// Skinning_Build ɓn1_BgȂe weight 0
+struct SkinningSourceVertex
+{
+    float position[3];
+    float normal[3];
+    float color[4];
+    float texcoord[2];
+    uint16_t bone[4];
+    float weight[4];
+};
+
+// 鍜_̃oCh̔
+struct SkinningBoneBox
+{
+    uint32_t bone;
+    float min[3];
+    float max[3];
+};
+
+// 1bVBz 8 ̔{܂ŋlߕĂ
+struct SkinningStream
+{
+    uint32_t vertexCount = 0;
+    uint32_t paddedCount = 0;
+    std::vector<float> position[3];
+    std::vector<float> normal[3];
+    std::vector<uint16_t> bone[4];
+    std::vector<float> weight[4];       // _Ƃɍv 1
+    std::vector<uint32_t> color;        // PackedVertex3d::color ̂܂
+    std::vector<uint32_t> texcoord;     // PackedVertex3d::texcoord ̂܂
+    std::vector<SkinningBoneBox> boxes;
+
+    size_t Bytes() const;
+};
+
+// Ƃ row-vector  4x4i4 ڂ 0jBŌɍ̂Ȃ_p̒PʍsB
+// 1{ 64 oCgȂ̂ŁA_Ƃ 256bit 2{ō
+struct SkinningPalette
+{
+    uint32_t boneCount = 0;
+    std::vector<float> data; // (boneCount + 1) * 16
+};
+
+// Map obt@1bV
+struct SkinningJob
+{
+    const SkinningStream* stream;
+    VertexPackBounds bounds;
+    PackedVertex3d* out; // stream->vertexCount 
+};
+
+// boneCount ȏ̍ԍ͎̂Ăďd݂𐳋KBd݂cȂ_̓oCh|[Ŷ܂
+void Skinning_Build(const SkinningSourceVertex* vertices, uint32_t vertexCount, uint32_t boneCount, SkinningStream* out);
+
+void Skinning_InitPalette(SkinningPalette* palette, uint32_t boneCount); // SPʍs
+// m  row-vector iv' = v * mj 4x4 sƂɕׂ́iXMFLOAT4X4 Ɠj
+void Skinning_SetBone(SkinningPalette* palette, uint32_t bone, const float m[16]);
+
+VertexPackBounds Skinning_ComputeBounds(const SkinningStream& stream, const SkinningPalette& palette);
+
+// [begin, end) ̒_ out[begin..end) ɏBbegin  8 ̔{
+void Skinning_Run(const SkinningStream& stream, const SkinningPalette& palette, const VertexPackBounds& bounds,
+    uint32_t begin, uint32_t end, PackedVertex3d* out, bool allowSimd = true);
+
+// bV𒸓_͈̔͂ɐ؂ pool ŉ񂷁ipool  nullptr ȂĂяoŁj
+void Skinning_RunJobs(WorkerPool* pool, const SkinningPalette& palette, const SkinningJob* jobs, size_t jobCount);
+
+bool Skinning_HasAVX2();
+
+// _E̐w肵蕨̃bVŁA1񕪂̃XLjOɂ鎞ԁimsj𑪂
+struct SkinningBenchmarkResult
+{
+    double perInfluenceMs;  // ƂɕϊĂ獬AƗpzoċl߂iȑÔj
+    double scalarMs;        // sEXJ[
+    double simdMs;          // sEAVX2igȂ scalar Ɠj
+    double parallelMs;      // AVX2 + pool
+    int threads;            // parallel œXbhiĂяo܂ށj
+    float maxPositionError; // perInfluence Ƃ̍i߂ʒuj
+};
+
+SkinningBenchmarkResult Skinning_Benchmark(uint32_t vertexCount, uint32_t boneCount, int iterations, WorkerPool* pool);
+
+#endif//SKINNING_H
@@ -0,0 +1,166 @@
+/*==============================================================================
+
+@@@CPU XLjÕ`FbN[skinning_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D Ȃőg߂B
+        g++ -std=c++17 -O2 -pthread skinning_test.cpp skinning.cpp vertex_pack.cpp worker_pool.cpp
+    8 ̔{łȂ_āAXJ[ AVX2 ƃ[J[̌ʂƁA
+    ƂɕϊčfȌvZƖ߂ʒuƂB
+    Ō Skinning_Benchmark ̎ԂoiԂ͔̂̂肵ȂjB
+
+==============================================================================*/
+#include "skinning.h"
+#include "test_check.h"
+#include "worker_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Mesh
+    {
+        std::vector<SkinningSourceVertex> source;
+        std::vector<float> matrices;
+        SkinningStream stream;
+        SkinningPalette palette;
+    };
+
+    // 1`4 {̍ɏ悹蕨̃bVB͉]{ړ{̊gk
+    void MakeMesh(uint32_t vertexCount, uint32_t boneCount, uint32_t seed, Mesh* mesh)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_int_distribution<int> boneDist(0, (int)boneCount - 1);
+        std::uniform_int_distribution<int> countDist(1, 4);
+
+        mesh->source.assign(vertexCount, SkinningSourceVertex{});
+        for (SkinningSourceVertex& v : mesh->source) {
+            for (int a = 0; a < 3; ++a) v.position[a] = unit(rng) * 2.0f;
+            const float n[3] = { unit(rng), unit(rng), unit(rng) + 0.01f };
+            const float len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (int a = 0; a < 3; ++a) v.normal[a] = n[a] / len;
+            for (float& c : v.color) c = unit(rng) * 0.5f + 0.5f;
+            v.texcoord[0] = unit(rng) * 0.5f + 0.5f;
+            v.texcoord[1] = unit(rng) * 0.5f + 0.5f;
+
+            const int influences = countDist(rng);
+            float sum = 0.0f;
+            for (int k = 0; k < influences; ++k) {
+                v.bone[k] = (uint16_t)boneDist(rng);
+                v.weight[k] = unit(rng) * 0.5f + 0.5f + 0.01f;
+                sum += v.weight[k];
+            }
+            for (int k = 0; k < influences; ++k) v.weight[k] /= sum;
+        }
+
+        mesh->matrices.assign(boneCount * 16, 0.0f);
+        Skinning_InitPalette(&mesh->palette, boneCount);
+        for (uint32_t b = 0; b < boneCount; ++b) {
+            const float angle = unit(rng) * 3.14159265f;
+            const float c = std::cos(angle), s = std::sin(angle), scale = 1.0f + unit(rng) * 0.1f;
+            const float rows[16] = {
+                c * scale, 0.0f, -s * scale, 0.0f,
+                0.0f, scale, 0.0f, 0.0f,
+                s * scale, 0.0f, c * scale, 0.0f,
+                unit(rng), unit(rng), unit(rng), 1.0f,
+            };
+            std::copy(rows, rows + 16, &mesh->matrices[b * 16]);
+            Skinning_SetBone(&mesh->palette, b, rows);
+        }
+
+        Skinning_Build(mesh->source.data(), vertexCount, boneCount, &mesh->stream);
+    }
+
+    // ƂɕϊĂ獬fȈʒu
+    void ReferencePosition(const Mesh& mesh, const SkinningSourceVertex& src, float out[3])
+    {
+        out[0] = out[1] = out[2] = 0.0f;
+        for (int k = 0; k < 4; ++k) {
+            if (src.weight[k] <= 0.0f) continue;
+            const float* m = &mesh.matrices[src.bone[k] * 16];
+            for (int r = 0; r < 3; ++r) {
+                out[r] += src.weight[k] * (src.position[0] * m[r] + src.position[1] * m[4 + r] + src.position[2] * m[8 + r] + m[12 + r]);
+            }
+        }
+    }
+
+    // l߂_ǂ̍BʒuƖ@͊ۂ߂̌ 1 ꂤAF UV ͂̂܂܎ʂ̂ňv
+    struct PackedDiff
+    {
+        int position = 0;
+        int normal = 0;
+        bool exactRest = true;
+    };
+
+    PackedDiff Compare(const std::vector<PackedVertex3d>& a, const std::vector<PackedVertex3d>& b)
+    {
+        PackedDiff diff;
+        for (size_t v = 0; v < a.size(); ++v) {
+            for (int i = 0; i < 3; ++i) diff.position = (std::max)(diff.position, std::abs((int)a[v].position[i] - (int)b[v].position[i]));
+            for (int i = 0; i < 2; ++i) diff.normal = (std::max)(diff.normal, std::abs((int)a[v].normal[i] - (int)b[v].normal[i]));
+            for (int i = 0; i < 4; ++i) diff.exactRest = diff.exactRest && a[v].color[i] == b[v].color[i];
+            for (int i = 0; i < 2; ++i) diff.exactRest = diff.exactRest && a[v].texcoord[i] == b[v].texcoord[i];
+        }
+        return diff;
+    }
+
+    void CheckCount(uint32_t vertexCount, WorkerPool* pool)
+    {
+        Mesh mesh;
+        MakeMesh(vertexCount, 24, 1000 + vertexCount, &mesh);
+        const VertexPackBounds bounds = Skinning_ComputeBounds(mesh.stream, mesh.palette);
+
+        std::vector<PackedVertex3d> scalar(vertexCount), simd(vertexCount), jobs(vertexCount);
+        Skinning_Run(mesh.stream, mesh.palette, bounds, 0, vertexCount, scalar.data(), false);
+        Skinning_Run(mesh.stream, mesh.palette, bounds, 0, vertexCount, simd.data(), true);
+        const SkinningJob job{ &mesh.stream, bounds, jobs.data() };
+        Skinning_RunJobs(pool, mesh.palette, &job, 1);
+
+        const std::string tag = "n=" + std::to_string(vertexCount);
+        const PackedDiff simdDiff = Compare(scalar, simd);
+        const PackedDiff jobDiff = Compare(scalar, jobs);
+        TestCheck_Expect(simdDiff.position <= 1, (tag + " simd position lsb").c_str(), simdDiff.position, 1);
+        TestCheck_Expect(simdDiff.normal <= 1, (tag + " simd normal lsb").c_str(), simdDiff.normal, 1);
+        TestCheck_True(simdDiff.exactRest, (tag + " simd color/uv").c_str());
+        TestCheck_Expect(jobDiff.position <= 1, (tag + " jobs position lsb").c_str(), jobDiff.position, 1);
+        TestCheck_Expect(jobDiff.normal <= 1, (tag + " jobs normal lsb").c_str(), jobDiff.normal, 1);
+        TestCheck_True(jobDiff.exactRest, (tag + " jobs color/uv").c_str());
+
+        // ߂ʒu͑fȌvZ 16bit  1 ڐi{ۂ߁jȓ
+        float error = 0.0f, step = 0.0f;
+        for (int a = 0; a < 3; ++a) step = (std::max)(step, bounds.extent[a] / 65535.0f);
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            float ref[3], p[3], n[3], c[4], t[2];
+            ReferencePosition(mesh, mesh.source[v], ref);
+            VertexPack_Unpack(bounds, simd[v], p, n, c, t);
+            for (int a = 0; a < 3; ++a) error = (std::max)(error, std::fabs(ref[a] - p[a]));
+        }
+        TestCheck_Expect(error <= step, (tag + " position vs reference").c_str(), error, step);
+    }
+}
+
+int main()
+{
+    WorkerPool pool;
+    pool.Start(3);
+    std::printf("AVX2 %s\n", Skinning_HasAVX2() ? "yes" : "no");
+
+    const uint32_t counts[] = { 1, 7, 8, 9, 2049, 30000 };
+    for (uint32_t count : counts) CheckCount(count, &pool);
+
+    const SkinningBenchmarkResult bench = Skinning_Benchmark(30000, 64, 20, &pool);
+    std::printf("30000 verts / 64 bones : per-influence %.3f ms, scalar %.3f ms, simd %.3f ms, parallel %.3f ms (%d threads)\n",
+        bench.perInfluenceMs, bench.scalarMs, bench.simdMs, bench.parallelMs, bench.threads);
+    TestCheck_Expect(bench.maxPositionError <= 1e-3f, "benchmark position error", bench.maxPositionError, 1e-3);
+
+    pool.Stop();
+    return TestCheck_Result();
+}
@@ -15,6 +15,8 @@ using namespace DirectX;
 #include "debug_ostream.h" 
 #include "sprite.h"
 #include"texture.h"
+#include "dynamic_ring.h"
+#include "sprite_atlas.h"
 
 
 
@@ -39,7 +41,8 @@ g_pContext->Unmap(g_pVertexBuffer, 0);
 
 5.描画時に「これ使って！」と指定
 g_pContext->IASetVertexBuffers(..., &g_pVertexBuffer, ...);*/
-static ID3D11Buffer* g_pVertexBuffer = nullptr; // 頂点バッファ（上行に説明）
+// ※ 頂点バッファは自前で持たず、描画ごとに共有リング（dynamic_ring.h）から4頂点ぶん切り出す。
+//    描画のたびに WRITE_DISCARD するとドライバがバッファを差し替え続けて重いため。
 static ID3D11ShaderResourceView* g_pTexture = nullptr; //テクスチャ
 
 // 注意！初期化で外部から設定されるもの。Release不要。
@@ -71,24 +74,14 @@ void Sprite_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 	g_pDevice = pDevice;
 	g_pContext = pContext;
 
-	// 頂点バッファ生成
-	D3D11_BUFFER_DESC bd = {};
-	bd.Usage = D3D11_USAGE_DYNAMIC;
-	bd.ByteWidth = sizeof(Vertex) * NUM_VERTEX;
-	bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-	bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-
-	g_pDevice->CreateBuffer(&bd, NULL, &g_pVertexBuffer);
-
-
-	
+	SpriteAtlas_Initialize(pDevice, pContext);
 }
 
 
 void Sprite_Finalize(void)
 {
+	SpriteAtlas_Finalize();
 	SAFE_RELEASE(g_pTexture);
-	SAFE_RELEASE(g_pVertexBuffer);
 }
 
 void Sprite_Begin()
@@ -117,11 +110,11 @@ void Sprite_Draw(int texid, float dx, float dy, const DirectX::XMFLOAT4& color)
 Map()：ロックして書き込み開始
 v：頂点データを書き込むためのポインタ*/
 	
-	D3D11_MAPPED_SUBRESOURCE msr;//GPUのバッファにアクセスするための情報（構造体）**です
-	g_pContext->Map(g_pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
+	DynamicRingSpan span;//共有リングから切り出した書き込み先（バッファ・オフセット・ポインタ）
+	if (!DynamicRing_MapVertices(sizeof(Vertex) * NUM_VERTEX, &span)) return;
 
 	// 頂点バッファへの仮想ポインタを取得
-	Vertex* v = (Vertex*)msr.pData;
+	Vertex* v = (Vertex*)span.data;
 
 
 	// 画面の左上から右下に向かう線分を描画する
@@ -165,17 +158,20 @@ g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 	/*画像のどの部分を貼り付けるかを設定
 → (0.0〜1.0) の範囲で「画像の左上〜右下」を指定。*/
-	v[0].uv = { 0.0f, 0.0f, };//左上
-	v[1].uv = { 1.0f, 0.0f, };//右上
-	v[2].uv = { 0.0f, 1.0f, };//左下
-	v[3].uv = { 1.0f, 1.0f, };//右下
+	// アトラスに入っていればページ上の位置に読み替える（頂点バッファは書くだけで読み返さない）
+	float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+	SpriteAtlas_RemapRect(texid, &u0, &v0, &u1, &v1);
+	v[0].uv = { u0,v0 };//左上
+	v[1].uv = { u1,v0 };//右上
+	v[2].uv = { u0,v1 };//左下
+	v[3].uv = { u1,v1 };//右下
 
 
 
 
 	// 頂点バッファのロックを解除
 	// 書き込んだ頂点データをGPUに戻す（ロック解除）
-	g_pContext->Unmap(g_pVertexBuffer, 0);
+	DynamicRing_Unmap(span);
 
 
 	//world変換行列を設定
@@ -185,8 +181,8 @@ g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 	// 頂点バッファを描画パイプラインに設定
 	//どの頂点バッファを使うかをGPUに伝える処理
 	UINT stride = sizeof(Vertex);
-	UINT offset = 0;
-	g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
+	UINT offset = span.offset;
+	g_pContext->IASetVertexBuffers(0, 1, &span.buffer, &stride, &offset);
 
 	
 
@@ -198,7 +194,7 @@ g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 	//テクスチャの設定
 	//これで指定したテクスチャ（texid番の画像）を GPU に渡します。
-	Texture_SetTexture(texid);
+	SpriteAtlas_SetTexture(texid);
 
 	// ポリゴン描画命令発行
 	/*これで、positionで作ったポリゴンにuvで切り取ったテクスチャを貼り付けて、
@@ -214,11 +210,11 @@ void Sprite_Draw(int texid, float dx, float dy, float dw, float dh, const Direct
 	Shader2D_Begin();
 
 	// 頂点バッファをロックする
-	D3D11_MAPPED_SUBRESOURCE msr;
-	g_pContext->Map(g_pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
+	DynamicRingSpan span;
+	if (!DynamicRing_MapVertices(sizeof(Vertex) * NUM_VERTEX, &span)) return;
 
 	// 頂点バッファへの仮想ポインタを取得
-	Vertex* v = (Vertex*)msr.pData;
+	Vertex* v = (Vertex*)span.data;
 
 	
 
@@ -241,16 +237,19 @@ void Sprite_Draw(int texid, float dx, float dy, float dw, float dh, const Direct
 	v[3].color = color;
 
 
-	v[0].uv = { 0.0f, 0.0f, };//左上
-	v[1].uv = { 1.0f, 0.0f, };//右上
-	v[2].uv = { 0.0f, 1.0f, };//左下
-	v[3].uv = { 1.0f, 1.0f, };//右下
+	// アトラスに入っていればページ上の位置に読み替える（頂点バッファは書くだけで読み返さない）
+	float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+	SpriteAtlas_RemapRect(texid, &u0, &v0, &u1, &v1);
+	v[0].uv = { u0,v0 };//左上
+	v[1].uv = { u1,v0 };//右上
+	v[2].uv = { u0,v1 };//左下
+	v[3].uv = { u1,v1 };//右下
 
 
 
 
 	// 頂点バッファのロックを解除
-	g_pContext->Unmap(g_pVertexBuffer, 0);
+	DynamicRing_Unmap(span);
 
 	//world変換行列を設定
 	//XMMatrixIdentity単位行列を作る　かけても変わらんやつ１と同じ
@@ -258,8 +257,8 @@ void Sprite_Draw(int texid, float dx, float dy, float dw, float dh, const Direct
 
 	// 頂点バッファを描画パイプラインに設定
 	UINT stride = sizeof(Vertex);
-	UINT offset = 0;
-	g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
+	UINT offset = span.offset;
+	g_pContext->IASetVertexBuffers(0, 1, &span.buffer, &stride, &offset);
 
 
 
@@ -268,7 +267,7 @@ void Sprite_Draw(int texid, float dx, float dy, float dw, float dh, const Direct
 	g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 	//テクスチャの設定
-	Texture_SetTexture(texid);
+	SpriteAtlas_SetTexture(texid);
 
 	// ポリゴン描画命令発行
 	g_pContext->Draw(NUM_VERTEX, 0);
@@ -283,11 +282,11 @@ void Sprite_Draw(int texid, float dx, float dy, int px, int py, int pw, int ph,
 	Shader2D_Begin();
 
 	// 頂点バッファをロックする
-	D3D11_MAPPED_SUBRESOURCE msr;
-	g_pContext->Map(g_pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
+	DynamicRingSpan span;
+	if (!DynamicRing_MapVertices(sizeof(Vertex) * NUM_VERTEX, &span)) return;
 
 	// 頂点バッファへの仮想ポインタを取得
-	Vertex* v = (Vertex*)msr.pData;
+	Vertex* v = (Vertex*)span.data;
 
 
 
@@ -319,6 +318,7 @@ void Sprite_Draw(int texid, float dx, float dy, int px, int py, int pw, int ph,
     float u1 = (px + pw) / tw;
     float v1 = (py + ph) / th;
 
+	SpriteAtlas_RemapRect(texid, &u0, &v0, &u1, &v1);
 	v[0].uv = { u0,v0 };//左上
 	v[1].uv = { u1,v0 };//右上
 	v[2].uv = { u0,v1 };//左下
@@ -328,7 +328,7 @@ void Sprite_Draw(int texid, float dx, float dy, int px, int py, int pw, int ph,
 
 
 	// 頂点バッファのロックを解除
-	g_pContext->Unmap(g_pVertexBuffer, 0);
+	DynamicRing_Unmap(span);
 
 
 	//world変換行列を設定
@@ -337,8 +337,8 @@ void Sprite_Draw(int texid, float dx, float dy, int px, int py, int pw, int ph,
 
 	// 頂点バッファを描画パイプラインに設定
 	UINT stride = sizeof(Vertex);
-	UINT offset = 0;
-	g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
+	UINT offset = span.offset;
+	g_pContext->IASetVertexBuffers(0, 1, &span.buffer, &stride, &offset);
 
 
 
@@ -347,7 +347,7 @@ void Sprite_Draw(int texid, float dx, float dy, int px, int py, int pw, int ph,
 	g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 	//テクスチャの設定
-	Texture_SetTexture(texid);
+	SpriteAtlas_SetTexture(texid);
 
 	// ポリゴン描画命令発行
 	g_pContext->Draw(NUM_VERTEX, 0);
@@ -363,11 +363,11 @@ void Sprite_Draw04(int texid, float dx, float dy, float dw, float dh, int px, in
 	Shader2D_Begin();
 
 	// 頂点バッファをロックする
-	D3D11_MAPPED_SUBRESOURCE msr;
-	g_pContext->Map(g_pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
+	DynamicRingSpan span;
+	if (!DynamicRing_MapVertices(sizeof(Vertex) * NUM_VERTEX, &span)) return;
 
 	// 頂点バッファへの仮想ポインタを取得
-	Vertex* v = (Vertex*)msr.pData;
+	Vertex* v = (Vertex*)span.data;
 
 	
 
@@ -399,6 +399,7 @@ void Sprite_Draw04(int texid, float dx, float dy, float dw, float dh, int px, in
 	float u1 = (px + pw) / tw;
 	float v1 = (py + ph) / th;
 
+	SpriteAtlas_RemapRect(texid, &u0, &v0, &u1, &v1);
 	v[0].uv = { u0,v0 };//左上
 	v[1].uv = { u1,v0 };//右上
 	v[2].uv = { u0,v1 };//左下
@@ -408,7 +409,7 @@ void Sprite_Draw04(int texid, float dx, float dy, float dw, float dh, int px, in
 
 
 	// 頂点バッファのロックを解除
-	g_pContext->Unmap(g_pVertexBuffer, 0);
+	DynamicRing_Unmap(span);
 
 	//world変換行列を設定
 	//XMMatrixIdentity単位行列を作る　かけても変わらんやつ１と同じ
@@ -416,8 +417,8 @@ void Sprite_Draw04(int texid, float dx, float dy, float dw, float dh, int px, in
 
 	// 頂点バッファを描画パイプラインに設定
 	UINT stride = sizeof(Vertex);
-	UINT offset = 0;
-	g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
+	UINT offset = span.offset;
+	g_pContext->IASetVertexBuffers(0, 1, &span.buffer, &stride, &offset);
 
 
 
@@ -426,7 +427,7 @@ void Sprite_Draw04(int texid, float dx, float dy, float dw, float dh, int px, in
 	g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 	//テクスチャの設定
-	Texture_SetTexture(texid);
+	SpriteAtlas_SetTexture(texid);
 
 	// ポリゴン描画命令発行
 	g_pContext->Draw(NUM_VERTEX, 0);
@@ -440,11 +441,11 @@ void Sprite_Draw(int texid, float dx, float dy, float dw, float dh, int px, int
 	Shader2D_Begin();
 
 	// 頂点バッファをロックする
-	D3D11_MAPPED_SUBRESOURCE msr;
-	g_pContext->Map(g_pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
+	DynamicRingSpan span;
+	if (!DynamicRing_MapVertices(sizeof(Vertex) * NUM_VERTEX, &span)) return;
 
 	// 頂点バッファへの仮想ポインタを取得
-	Vertex* v = (Vertex*)msr.pData;
+	Vertex* v = (Vertex*)span.data;
 
 
 
@@ -476,6 +477,7 @@ void Sprite_Draw(int texid, float dx, float dy, float dw, float dh, int px, int
 	float u1 = (px + pw) / tw;
 	float v1 = (py + ph) / th;
 
+	SpriteAtlas_RemapRect(texid, &u0, &v0, &u1, &v1);
 	v[0].uv = { u0,v0 };//左上
 	v[1].uv = { u1,v0 };//右上
 	v[2].uv = { u0,v1 };//左下
@@ -485,7 +487,7 @@ void Sprite_Draw(int texid, float dx, float dy, float dw, float dh, int px, int
 
 
 	// 頂点バッファのロックを解除
-	g_pContext->Unmap(g_pVertexBuffer, 0);
+	DynamicRing_Unmap(span);
 
 
 	//world変換行列を設定
@@ -512,8 +514,8 @@ void Sprite_Draw(int texid, float dx, float dy, float dw, float dh, int px, int
 
 	// 頂点バッファを描画パイプラインに設定
 	UINT stride = sizeof(Vertex);
-	UINT offset = 0;
-	g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
+	UINT offset = span.offset;
+	g_pContext->IASetVertexBuffers(0, 1, &span.buffer, &stride, &offset);
 
 
 
@@ -522,7 +524,7 @@ void Sprite_Draw(int texid, float dx, float dy, float dw, float dh, int px, int
 	g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 	//テクスチャの設定
-	Texture_SetTexture(texid);
+	SpriteAtlas_SetTexture(texid);
 
 	// ポリゴン描画命令発行
 	g_pContext->Draw(NUM_VERTEX, 0);
@@ -537,11 +539,11 @@ void Sprite_Draw(float dx, float dy, float dw, float dh, const DirectX::XMFLOAT4
 Map()：ロックして書き込み開始
 v：頂点データを書き込むためのポインタ*/
 
-	D3D11_MAPPED_SUBRESOURCE msr;//GPUのバッファにアクセスするための情報（構造体）**です
-	g_pContext->Map(g_pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
+	DynamicRingSpan span;//共有リングから切り出した書き込み先（バッファ・オフセット・ポインタ）
+	if (!DynamicRing_MapVertices(sizeof(Vertex) * NUM_VERTEX, &span)) return;
 
 	// 頂点バッファへの仮想ポインタを取得
-	Vertex* v = (Vertex*)msr.pData;
+	Vertex* v = (Vertex*)span.data;
 
 
 	v[0].position = { dx,        dy,        0.0f }; // 左上
@@ -569,7 +571,7 @@ v：頂点データを書き込むためのポインタ*/
 
 	// 頂点バッファのロックを解除
 	// 書き込んだ頂点データをGPUに戻す（ロック解除）
-	g_pContext->Unmap(g_pVertexBuffer, 0);
+	DynamicRing_Unmap(span);
 
 
 	//world変換行列を設定
@@ -579,8 +581,8 @@ v：頂点データを書き込むためのポインタ*/
 	// 頂点バッファを描画パイプラインに設定
 	//どの頂点バッファを使うかをGPUに伝える処理
 	UINT stride = sizeof(Vertex);
-	UINT offset = 0;
-	g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
+	UINT offset = span.offset;
+	g_pContext->IASetVertexBuffers(0, 1, &span.buffer, &stride, &offset);
 
 
 
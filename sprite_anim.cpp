@@ -9,6 +9,7 @@
 #include "sprite_anim.h"
 #include"sprite.h"
 #include"texture.h"
+#include"sprite_atlas.h"
 #include"billboard.h"
 #include<DirectXMath.h>
 using namespace DirectX;
@@ -164,7 +165,7 @@ void BillboardAnim_Draw(int playid, const DirectX::XMFLOAT3& position, const Dir
 	int anim_pattern_id = g_AnimPlay[playid].m_PatternId;
 	AnimPatternData* pAnimPatternData = &g_AnimPattern[anim_pattern_id];
 
-	Billboard_Draw(pAnimPatternData->m_TextureId,
+	Billboard_BatchDraw(pAnimPatternData->m_TextureId,
 		position, scale,
 		{
 			pAnimPatternData->m_StartPosition.x
@@ -209,6 +210,9 @@ int SpriteAnim_RegisterPattern(int texid, int pattern_max,int h_pattern_max, dou
 		g_AnimPattern[i].m_StartPosition = start_position;
 		g_AnimPattern[i].m_IsLooped = is_looped;
 
+		//XvCgV[gAgXɓĂiĂΉȂj
+		SpriteAtlas_Add(&texid, 1);
+
 		/*o^Aj[V IDiCfbNXԍjԂB
 @ꂪŃAjĐɎguǗԍvłB*/
 		return i;
@@ -0,0 +1,273 @@
+/*==============================================================================
+
+@@@XvCgpAgX[sprite_atlas.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "sprite_atlas.h"
+#include "atlas_pack.h"
+#include "texture.h"
+#include "direct3d.h"
+#include "debug_ostream.h"
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    constexpr int kPageSize = 2048;
+    constexpr int kPageMips = 4;                        // 2^(4-1) = 8 f̗]Ń~bv3iڂ܂ōȂ
+    constexpr int kGutter = 1 << (kPageMips - 1);
+    constexpr int kMaxImageSide = kPageSize / 2;        // 傫摜͒P̂̂܂
+    constexpr DXGI_FORMAT kPageFormat = DXGI_FORMAT_R8G8B8A8_UNORM;
+
+    struct Page
+    {
+        ID3D11Texture2D* pTexture = nullptr;
+        ID3D11ShaderResourceView* pView = nullptr;
+    };
+
+    struct Entry
+    {
+        int page = -1;
+        float u0 = 0.0f, v0 = 0.0f; // y[W̍
+        float su = 1.0f, sv = 1.0f; // y[W̕EiUVj
+    };
+
+    std::vector<Page> g_pages;
+    std::vector<SkylinePacker> g_packers; // g_pages Ɠ
+    std::vector<int> g_pageLive;          // g_pages ƓсBy[WɓĂ鐶eNX`̐
+    std::vector<Entry> g_entries;         // texid ň
+
+    // ӁIŊOݒ肳́BReleasesvB
+    ID3D11Device* g_pDevice = nullptr;
+    ID3D11DeviceContext* g_pContext = nullptr;
+
+    const Entry* FindEntry(int texid)
+    {
+        if (texid < 0 || texid >= (int)g_entries.size()) return nullptr;
+        const Entry& e = g_entries[texid];
+        return (e.page >= 0) ? &e : nullptr;
+    }
+
+    bool CreatePage(Page* out)
+    {
+        D3D11_TEXTURE2D_DESC desc{};
+        desc.Width = kPageSize;
+        desc.Height = kPageSize;
+        desc.MipLevels = kPageMips;
+        desc.ArraySize = 1;
+        desc.Format = kPageFormat;
+        desc.SampleDesc.Count = 1;
+        desc.Usage = D3D11_USAGE_DEFAULT;
+        desc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET; // GenerateMips ɗv
+        desc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
+
+        if (FAILED(g_pDevice->CreateTexture2D(&desc, nullptr, &out->pTexture))) {
+            hal::dout << "SpriteAtlas : y[W̍쐬Ɏs܂" << std::endl;
+            return false;
+        }
+        if (FAILED(g_pDevice->CreateShaderResourceView(out->pTexture, nullptr, &out->pView))) {
+            hal::dout << "SpriteAtlas : y[W̃r[쐬Ɏs܂" << std::endl;
+            SAFE_RELEASE(out->pTexture);
+            return false;
+        }
+        return true;
+    }
+
+    // eNX`̍ŏʃ~bv CPU ɓǂݖ߂iǂݍݎȂ̂ő҂Ă悢j
+    bool ReadPixels(int texid, std::vector<unsigned char>* out, UINT* pitch)
+    {
+        D3D11_TEXTURE2D_DESC src{};
+        if (!Texture_GetDesc(texid, &src)) return false;
+
+        D3D11_TEXTURE2D_DESC desc{};
+        desc.Width = src.Width;
+        desc.Height = src.Height;
+        desc.MipLevels = 1;
+        desc.ArraySize = 1;
+        desc.Format = src.Format;
+        desc.SampleDesc.Count = 1;
+        desc.Usage = D3D11_USAGE_STAGING;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+        ID3D11Texture2D* pStaging = nullptr;
+        if (FAILED(g_pDevice->CreateTexture2D(&desc, nullptr, &pStaging))) return false;
+
+        g_pContext->CopySubresourceRegion(pStaging, 0, 0, 0, 0, Texture_GetResource(texid), 0, nullptr);
+
+        D3D11_MAPPED_SUBRESOURCE msr{};
+        bool ok = SUCCEEDED(g_pContext->Map(pStaging, 0, D3D11_MAP_READ, 0, &msr));
+        if (ok) {
+            *pitch = src.Width * 4;
+            out->resize((size_t)*pitch * src.Height);
+            for (UINT y = 0; y < src.Height; ++y) {
+                memcpy(out->data() + (size_t)y * *pitch, (const unsigned char*)msr.pData + (size_t)y * msr.RowPitch, *pitch);
+            }
+            g_pContext->Unmap(pStaging, 0);
+        }
+
+        SAFE_RELEASE(pStaging);
+        return ok;
+    }
+
+    // ̃eNX`ꂽÅǗԍ̓ǂݑւ߂
+    // iԍ͕ʂ̉摜Ɏg񂳂邽߁jBy[WɂȂlߍ݂ŏ蒼A
+    // y[W̃eNX`͂̂܂܎ɓ̂ɎgiʂsĂy[WȂj
+    void OnTextureRelease(int texid)
+    {
+        if (texid < 0 || texid >= (int)g_entries.size()) return;
+
+        const int page = g_entries[texid].page;
+        g_entries[texid] = Entry{};
+        if (page < 0) return;
+
+        if (--g_pageLive[page] == 0) g_packers[page].Clear();
+    }
+}
+
+void SpriteAtlas_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
+{
+    g_pDevice = pDevice;
+    g_pContext = pContext;
+    SpriteAtlas_Clear();
+    Texture_SetReleaseCallback(OnTextureRelease);
+}
+
+void SpriteAtlas_Finalize()
+{
+    Texture_SetReleaseCallback(nullptr);
+    SpriteAtlas_Clear();
+    g_pDevice = nullptr;
+    g_pContext = nullptr;
+}
+
+void SpriteAtlas_Clear()
+{
+    for (Page& p : g_pages) {
+        SAFE_RELEASE(p.pView);
+        SAFE_RELEASE(p.pTexture);
+    }
+    g_pages.clear();
+    g_packers.clear();
+    g_pageLive.clear();
+    g_entries.clear();
+}
+
+int SpriteAtlas_Add(const int* texIds, int count)
+{
+    if (!g_pDevice || !texIds || count <= 0) return 0;
+
+    // ̂W߂āAfǂݖ߂Ă
+    std::vector<AtlasPackImage> images;
+    std::vector<std::vector<unsigned char>> pixels;
+    std::vector<UINT> pitches;
+    for (int i = 0; i < count; ++i) {
+        const int texid = texIds[i];
+        if (FindEntry(texid)) continue;
+
+        bool dup = false;
+        for (const AtlasPackImage& img : images) dup |= (img.id == texid);
+        if (dup) continue;
+
+        D3D11_TEXTURE2D_DESC desc{};
+        if (!Texture_GetDesc(texid, &desc)) continue;
+        if (desc.Format != kPageFormat || desc.ArraySize != 1 || desc.SampleDesc.Count != 1) continue;
+        if ((int)desc.Width > kMaxImageSide || (int)desc.Height > kMaxImageSide) continue;
+
+        std::vector<unsigned char> data;
+        UINT pitch = 0;
+        if (!ReadPixels(texid, &data, &pitch)) continue;
+
+        images.push_back({ texid, (int)desc.Width, (int)desc.Height });
+        pixels.push_back(std::move(data));
+        pitches.push_back(pitch);
+    }
+    if (images.empty()) return 0;
+
+    const SkylinePacker pageTemplate(kPageSize, kPageSize, kGutter, kGutter);
+    std::vector<AtlasPackPlacement> placed;
+    AtlasPack_Place(&g_packers, pageTemplate, images.data(), (int)images.size(), &placed);
+
+    // y[WiȂ΂̃y[Wɓ̂͒߂j
+    std::vector<bool> pageOk(g_packers.size(), true);
+    for (size_t p = g_pages.size(); p < g_packers.size(); ++p) {
+        Page page;
+        pageOk[p] = CreatePage(&page);
+        g_pages.push_back(page);
+        g_pageLive.push_back(0);
+    }
+
+    std::vector<bool> touched(g_pages.size(), false);
+    std::vector<unsigned char> padded;
+    int added = 0;
+    for (size_t i = 0; i < images.size(); ++i) {
+        const AtlasPackPlacement& pl = placed[i];
+        if (pl.page < 0 || !pageOk[pl.page] || !g_pages[pl.page].pTexture) continue;
+
+        const int w = pl.rect.w + kGutter * 2;
+        const int h = pl.rect.h + kGutter * 2;
+        padded.resize((size_t)w * h * 4);
+        AtlasPack_BlitPadded(pixels[i].data(), pl.rect.w, pl.rect.h, (int)pitches[i], padded.data(), w * 4, kGutter);
+
+        D3D11_BOX box{};
+        box.left = (UINT)(pl.rect.x - kGutter);
+        box.top = (UINT)(pl.rect.y - kGutter);
+        box.right = box.left + (UINT)w;
+        box.bottom = box.top + (UINT)h;
+        box.back = 1;
+        g_pContext->UpdateSubresource(g_pages[pl.page].pTexture, 0, &box, padded.data(), (UINT)w * 4, 0);
+        touched[pl.page] = true;
+
+        const int texid = images[i].id;
+        if (texid >= (int)g_entries.size()) g_entries.resize(texid + 1);
+        Entry& e = g_entries[texid];
+        e.page = pl.page;
+        e.u0 = (float)pl.rect.x / kPageSize;
+        e.v0 = (float)pl.rect.y / kPageSize;
+        e.su = (float)pl.rect.w / kPageSize;
+        e.sv = (float)pl.rect.h / kPageSize;
+        ++g_pageLive[pl.page];
+        ++added;
+    }
+
+    for (size_t p = 0; p < touched.size(); ++p) {
+        if (touched[p]) g_pContext->GenerateMips(g_pages[p].pView);
+    }
+
+    return added;
+}
+
+bool SpriteAtlas_RemapRect(int texid, float* u0, float* v0, float* u1, float* v1)
+{
+    const Entry* e = FindEntry(texid);
+    if (!e) return false;
+
+    *u0 = e->u0 + *u0 * e->su;
+    *v0 = e->v0 + *v0 * e->sv;
+    *u1 = e->u0 + *u1 * e->su;
+    *v1 = e->v0 + *v1 * e->sv;
+    return true;
+}
+
+void SpriteAtlas_SetTexture(int texid, int slot)
+{
+    const Entry* e = FindEntry(texid);
+    if (!e) {
+        Texture_SetTexture(texid, slot);
+        return;
+    }
+    g_pContext->PSSetShaderResources(slot, 1, &g_pages[e->page].pView);
+}
+
+int SpriteAtlas_GetPageCount()
+{
+    return (int)g_pages.size();
+}
+
+float SpriteAtlas_GetOccupancy(int page)
+{
+    if (page < 0 || page >= (int)g_packers.size()) return 0.0f;
+    return g_packers[page].Occupancy();
+}
@@ -0,0 +1,45 @@
+/*==============================================================================
+
+@@@XvCgpAgX[sprite_atlas.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    ǂݍݍς݂̏ȃeNX`傫ȃy[WɃRs[ĕׂB
+    Sprite_Draw ͓nꂽ texid AgXɓĂ΃y[WoChA
+    UV y[Ẅʒuɓǂݑւ̂ŁAĂяo͂̂܂܂ł悢B
+    ̃eNX`͎ĉŁAr{[h3D͍܂łǂgB
+    AgX͎QƂȂB̃eNX`Ō Texture_Release ŉ
+    ̊Ǘԍ͓ǂݑւ̑ΏۂOBy[WɓĂׂ̂ĉƁA
+    ̃y[W͋ɖ߂Ď SpriteAtlas_Add Ŏg񂳂B
+
+    y[W̗̎]͉̐FL΂ĂA~bvĂׂƍȂB
+    UV  0`1 ̊OɏoiJԂ\jgeNX`͓ȂƁB
+
+==============================================================================*/
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include <d3d11.h>
+
+void SpriteAtlas_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
+void SpriteAtlas_Finalize();
+
+// y[WɓB傫EtH[}bgႤEĂ͔̂΂B
+// ߂lFV
+int SpriteAtlas_Add(const int* texIds, int count);
+
+// ׂẴy[ŴĂiTexture_AllRelease ̌ȂǁAtexid ւƂj
+void SpriteAtlas_Clear();
+
+// AgXɓĂ΁A UV `i0`1jy[W UV ɓǂݑւ
+// ݐp̒_obt@ǂݕԂɍςނ悤A[Jϐɑ΂Ďg
+bool SpriteAtlas_RemapRect(int texid, float* u0, float* v0, float* u1, float* v1);
+
+// AgXɓĂ΃y[WAĂȂΌ̃eNX`oCh
+void SpriteAtlas_SetTexture(int texid, int slot = 0);
+
+int SpriteAtlas_GetPageCount();
+float SpriteAtlas_GetOccupancy(int page);
+
+#endif // SPRITE_ATLAS_H
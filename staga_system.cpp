@@ -1,6 +1,8 @@
 #include "staga_system.h"
 #include "stage_simple_manager.h"
 #include "stage_magma_manager.h"
+#include "model.h"
+#include "model_skinned_fixed.h"
 
 // StageSystem routes calls to each stage manager.
 // NOTE: Only playable stages (StageId::StageSimple .. StageId::StageInvisible) are valid here.
@@ -46,6 +48,11 @@ namespace
         }
 
         g_inited = true;
+
+        // Drop models the previous stage used but this one did not pick up again
+        // (shared ones like the player and goal stay loaded across the switch)
+        Model_PurgeUnused();
+        SkinnedModel_PurgeUnused();
     }
 
     static void UpdateCurrent(double dt)
@@ -88,6 +95,9 @@ void StageSystem_Initialize(StageId first)
 void StageSystem_Finalize()
 {
     FinalizeCurrent();
+
+    Model_PurgeUnused();
+    SkinnedModel_PurgeUnused();
 }
 
 void StageSystem_RequestChange(StageId next)
@@ -11,9 +11,14 @@
 
 #include "cube_.h"
 #include "texture.h"
+#include "texture_array_pack.h"
 #include "direct3d.h"
 #include"stage_cube.h"
 #include"stage_map.h"
+#include "frustum.h"
+#include "occlusion_buffer.h"
+#include "render_stats.h"
+#include "system_timer.h"
 #include <vector>
 #include <cfloat> // FLT_MAX
 #include <fstream>
@@ -38,10 +43,14 @@ namespace
         XMFLOAT3 position{ 0,0,0 };
         XMFLOAT3 size{ 0,0,0 };
         XMFLOAT3 rotation{ 0,0,0 };
+        bool moving = false; // xłsɓie͖t[̓IpXŕ`j
     };
     
     std::vector<StageRuntimeOffset> g_offsets;
 
+    // ÓIubN̒ǉE폜EĂŐi߂
+    unsigned int g_staticRevision = 0;
+
     /*=====================================*/
     //eNX`ǉƂ͂Sӏ
     enum TexSlot : int
@@ -65,6 +74,11 @@ namespace
 
     int g_tex[TEX_MAX];//TexSloť
 
+    // 傫EtH[}bgňԑeNX`܂Ƃ߂zƁAXbgXCX̑Ή
+    ID3D11ShaderResourceView* g_texArray = nullptr;
+    bool g_texArrayPending = false; // ubNpeNX`̓ǂݍݑ҂
+    int g_texSlice[TEX_MAX];//zɓĂȂXbg -1
+
     char g_stageJsonPath[260] = "stage01.json";
 
 
@@ -182,6 +196,54 @@ namespace
         else
             b.texId = g_tex[TEX_BRICK];
     }
+
+    // ApplyTex ƓǂݑւŃXCX
+    int TexSliceOf(const StageBlock& b)
+    {
+        const int slot = (b.texSlot >= 0 && b.texSlot < TEX_MAX) ? b.texSlot : TEX_BRICK;
+        return g_texSlice[slot];
+    }
+
+    void ReleaseTexArray()
+    {
+        Cube_SetTextureArray(nullptr);
+        SAFE_RELEASE(g_texArray);
+        std::fill(std::begin(g_texSlice), std::end(g_texSlice), -1);
+    }
+
+    // ǂݍ񂾃ubNpeNX`̂AEEtH[}bgE~bvĂ
+    // ԑ傫O[v1 Texture2DArray ɂ܂Ƃ߂Bc͏]ǂʂɃoCh
+    void BuildTexArray()
+    {
+        ReleaseTexArray();
+
+        std::vector<TextureArrayImage> images;
+        std::vector<int> slots;
+        for (int slot = 0; slot < TEX_MAX; ++slot)
+        {
+            D3D11_TEXTURE2D_DESC desc{};
+            if (!Texture_GetDesc(g_tex[slot], &desc)) continue;
+            if (desc.ArraySize != 1 || desc.SampleDesc.Count != 1) continue;
+
+            images.push_back({ g_tex[slot], desc.Width, desc.Height, (unsigned int)desc.Format, desc.MipLevels });
+            slots.push_back(slot);
+        }
+
+        TextureArrayPlan plan;
+        TextureArrayPack_Plan(images.data(), (int)images.size(), 2,
+            D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION, &plan);
+        if (plan.groups.empty()) return;
+
+        const TextureArrayGroup& group = plan.groups[0];
+        g_texArray = Texture_CreateArray(group.ids.data(), (int)group.ids.size());
+        if (!g_texArray) return;
+
+        for (size_t i = 0; i < images.size(); ++i)
+        {
+            if (plan.group[i] == 0) g_texSlice[slots[i]] = plan.slice[i];
+        }
+        Cube_SetTextureArray(g_texArray);
+    }
 }
 
 int Stage01_GetTexSlotCount() { return TEX_MAX; }
@@ -261,30 +323,34 @@ void Stage01_Initialize(const char* jsonPath)
     g_offsets.clear();
     g_blocks.reserve(4096);
     g_offsets.reserve(4096);
+    ++g_staticRevision;
 
     std::fill(std::begin(g_tex), std::end(g_tex), -1);
 
 
 /*==============================================*/
-    g_tex[TEX_BRICK] = Texture_Load(L"texture/rengaBlock.png");
-    g_tex[TEX_RED] = Texture_Load(L"texture/red.png");
-    g_tex[TEX_WHITE] = Texture_Load(L"white.png");
+    g_tex[TEX_BRICK] = Texture_LoadAsync(L"texture/rengaBlock.png");
+    g_tex[TEX_RED] = Texture_LoadAsync(L"texture/red.png");
+    g_tex[TEX_WHITE] = Texture_LoadAsync(L"white.png");
+
+    g_tex[TEX_STONE0] = Texture_LoadAsync(L"texture/stone0.png"); g_tex[TEX_STONE1] = Texture_LoadAsync(L"texture/stone1.png");
+    g_tex[TEX_STONE2] = Texture_LoadAsync(L"texture/stone2.png"); g_tex[TEX_STONE3] = Texture_LoadAsync(L"texture/stone3.png");
+    g_tex[TEX_STONE4] = Texture_LoadAsync(L"texture/stone4.png"); g_tex[TEX_STONE5] = Texture_LoadAsync(L"texture/stone5.png");
+    g_tex[TEX_STONE6] = Texture_LoadAsync(L"texture/stone6.png"); g_tex[TEX_STONE7] = Texture_LoadAsync(L"texture/stone7.png");
+    g_tex[TEX_STONE8] = Texture_LoadAsync(L"texture/stone8.jpg"); g_tex[TEX_STONE9] = Texture_LoadAsync(L"texture/stone9.jpg");
 
-    g_tex[TEX_STONE0] = Texture_Load(L"texture/stone0.png"); g_tex[TEX_STONE1] = Texture_Load(L"texture/stone1.png");
-    g_tex[TEX_STONE2] = Texture_Load(L"texture/stone2.png"); g_tex[TEX_STONE3] = Texture_Load(L"texture/stone3.png");
-    g_tex[TEX_STONE4] = Texture_Load(L"texture/stone4.png"); g_tex[TEX_STONE5] = Texture_Load(L"texture/stone5.png");
-    g_tex[TEX_STONE6] = Texture_Load(L"texture/stone6.png"); g_tex[TEX_STONE7] = Texture_Load(L"texture/stone7.png");
-    g_tex[TEX_STONE8] = Texture_Load(L"texture/stone8.jpg"); g_tex[TEX_STONE9] = Texture_Load(L"texture/stone9.jpg");
+    g_tex[TEX_WOOD0] = Texture_LoadAsync(L"texture/wood0.png"); g_tex[TEX_WOOD1] = Texture_LoadAsync(L"texture/wood1.png");
+    g_tex[TEX_WOOD2] = Texture_LoadAsync(L"texture/wood2.png"); g_tex[TEX_WOOD3] = Texture_LoadAsync(L"texture/wood3.png");
 
-    g_tex[TEX_WOOD0] = Texture_Load(L"texture/wood0.png"); g_tex[TEX_WOOD1] = Texture_Load(L"texture/wood1.png");
-    g_tex[TEX_WOOD2] = Texture_Load(L"texture/wood2.png"); g_tex[TEX_WOOD3] = Texture_Load(L"texture/wood3.png");
+    g_tex[TEX_V0] = Texture_LoadAsync(L"texture/v0.png"); g_tex[TEX_V1] = Texture_LoadAsync(L"texture/v1.png");
+    g_tex[TEX_V2] = Texture_LoadAsync(L"texture/v2.png"); g_tex[TEX_V3] = Texture_LoadAsync(L"texture/v3.png");
+    g_tex[TEX_V4] = Texture_LoadAsync(L"texture/v4.png"); g_tex[TEX_V5] = Texture_LoadAsync(L"texture/v5.png");
+    g_tex[TEX_V6] = Texture_LoadAsync(L"texture/v6.jpg"); g_tex[TEX_V7] = Texture_LoadAsync(L"texture/v7.png");
 
-    g_tex[TEX_V0] = Texture_Load(L"texture/v0.png"); g_tex[TEX_V1] = Texture_Load(L"texture/v1.png");
-    g_tex[TEX_V2] = Texture_Load(L"texture/v2.png"); g_tex[TEX_V3] = Texture_Load(L"texture/v3.png");
-    g_tex[TEX_V4] = Texture_Load(L"texture/v4.png"); g_tex[TEX_V5] = Texture_Load(L"texture/v5.png");
-    g_tex[TEX_V6] = Texture_Load(L"texture/v6.jpg"); g_tex[TEX_V7] = Texture_Load(L"texture/v7.png");
+    g_tex[TEX_CHECK0] = Texture_LoadAsync(L"texture/check0.png"); g_tex[TEX_CHECK1] = Texture_LoadAsync(L"texture/check1.jpg");
 
-    g_tex[TEX_CHECK0] = Texture_Load(L"texture/check0.png"); g_tex[TEX_CHECK1] = Texture_Load(L"texture/check1.jpg");
+    // 摜͗œWJBS͂Ă Stage01_Update Ŕzɂ܂Ƃ߂
+    g_texArrayPending = true;
 
     // ܂͎w json ǂށi: stage02.jsonj
     if (Stage01_LoadJson(Stage01_GetCurrentJsonPath()))
@@ -317,28 +383,59 @@ void Stage01_Initialize(const char* jsonPath)
 
 void Stage01_Finalize()
 {
+    ReleaseTexArray();
+    g_texArrayPending = false;
+
+    // Initialize œǂ񂾕̎QƂԂĩXe[WŎgȂ̂͂ŏj
+    for (int& tex : g_tex)
+    {
+        Texture_Release(tex);
+        tex = -1;
+    }
+
     Cube_Finalize();
     Map_Finalize();
 
     g_blocks.clear();
     g_offsets.clear();
+    ++g_staticRevision;
 }
 
 void Stage01_Update(double elapsedTime)
 {
+    // 񓯊ǂݍ݂܂ł͌ʂɃoChi̔jŕ`Azɂ܂Ƃ߂
+    if (g_texArrayPending &&
+        std::none_of(std::begin(g_tex), std::end(g_tex), [](int tex) { return Texture_IsPending(tex); }))
+    {
+        g_texArrayPending = false;
+        BuildTexArray();
+    }
+
     Cube_Update(elapsedTime);
 }
 
+// ꊇ`p̕сit[蒼̂Ŋmۍς݂̗͎̈g񂷁j
+static std::vector<CubeBlock> g_drawList;
+
+static void PushDrawBlock(const StageBlock& b)
+{
+    CubeBlock cb{};
+    cb.kind = b.kind;
+    cb.texId = b.texId;
+    cb.texSlice = TexSliceOf(b);
+    cb.world = b.world;// Bakeς݂world̂܂܎g
+    g_drawList.push_back(cb);
+}
+
 void Stage01_Draw()
 {
+    g_drawList.clear();
     for (const auto& b : g_blocks)
     {
-        CubeBlock cb{};
-        cb.kind = b.kind;
-        cb.texId = b.texId;
-        cb.world = b.world;// Bakeς݂world̂܂܎g
-        Cube_DrawBlock(cb);
+        PushDrawBlock(b);
     }
+    Cube_DrawBlocks(g_drawList.data(), (int)g_drawList.size());
+    RenderStats_AddCounter(RENDER_STATS_BLOCKS_DRAWN, g_drawList.size());
     /*
     for (const auto& b : g_blocks)
     {
@@ -347,16 +444,137 @@ void Stage01_Draw()
     }*/
 }
 
+namespace
+{
+    OcclusionBuffer g_occlusion;
+    bool g_occlusionEnabled = true;
+
+    constexpr int   kMaxOccluders = 32;             // ՕƂĕ`̏
+    constexpr float kMinOccluderScore = 0.01f;      // (Ίp/)^2B菬f锠͎ՕɂȂ
+    constexpr size_t kMinBlocksForOcclusion = 16;   // 菭ȂΎՕ͂Ȃ
+
+    std::vector<int> g_frustumVisible;
+    std::vector<std::pair<float, int>> g_occluderScores;
+    std::vector<unsigned char> g_isOccluder;
+
+    // ʂɑ傫f锠ՕɑIŕ`
+    void RenderOccluders(const XMFLOAT3& eye)
+    {
+        g_occluderScores.clear();
+        for (int i : g_frustumVisible)
+        {
+            const AABB& box = g_blocks[i].aabb;
+            const XMFLOAT3 center{
+                (box.min.x + box.max.x) * 0.5f,
+                (box.min.y + box.max.y) * 0.5f,
+                (box.min.z + box.max.z) * 0.5f };
+            const XMFLOAT3 extent{ box.max.x - box.min.x, box.max.y - box.min.y, box.max.z - box.min.z };
+
+            const float dx = center.x - eye.x, dy = center.y - eye.y, dz = center.z - eye.z;
+            const float distSq = std::max(dx * dx + dy * dy + dz * dz, 1.0e-4f);
+            const float score = (extent.x * extent.x + extent.y * extent.y + extent.z * extent.z) / distSq;
+            if (score >= kMinOccluderScore)
+            {
+                g_occluderScores.emplace_back(score, i);
+            }
+        }
+
+        const size_t count = std::min(g_occluderScores.size(), (size_t)kMaxOccluders);
+        std::partial_sort(g_occluderScores.begin(), g_occluderScores.begin() + count, g_occluderScores.end(),
+            [](const std::pair<float, int>& a, const std::pair<float, int>& b) { return a.first > b.first; });
+
+        for (size_t n = 0; n < count; ++n)
+        {
+            const int i = g_occluderScores[n].second;
+            if (g_occlusion.RenderBox(g_blocks[i].world))
+            {
+                g_isOccluder[i] = 1;
+            }
+        }
+    }
+}
+
+void Stage01_Draw(const XMMATRIX& view, const XMMATRIX& projection)
+{
+    const double begin = SystemTimer_GetAbsoluteTime();
+
+    const XMMATRIX viewProjection = view * projection;
+    const Frustum frustum = Frustum_FromViewProjection(viewProjection);
+
+    g_frustumVisible.clear();
+    for (int i = 0; i < (int)g_blocks.size(); ++i)
+    {
+        if (Frustum_IntersectsAabb(frustum, g_blocks[i].aabb.min, g_blocks[i].aabb.max))
+        {
+            g_frustumVisible.push_back(i);
+        }
+    }
+
+    g_drawList.clear();
+    size_t occluded = 0;
+
+    if (g_occlusionEnabled && g_frustumVisible.size() >= kMinBlocksForOcclusion)
+    {
+        XMFLOAT4X4 vp;
+        XMStoreFloat4x4(&vp, viewProjection);
+        g_occlusion.Begin(vp);
+
+        XMFLOAT3 eye;
+        XMStoreFloat3(&eye, XMMatrixInverse(nullptr, view).r[3]);
+
+        g_isOccluder.assign(g_blocks.size(), 0);
+        RenderOccluders(eye);
+
+        for (int i : g_frustumVisible)
+        {
+            const StageBlock& b = g_blocks[i];
+            if (!g_isOccluder[i] && !g_occlusion.IsAabbVisible(b.aabb.min, b.aabb.max))
+            {
+                ++occluded;
+                continue;
+            }
+            PushDrawBlock(b);
+        }
+    }
+    else
+    {
+        for (int i : g_frustumVisible)
+        {
+            PushDrawBlock(g_blocks[i]);
+        }
+    }
+
+    RenderStats_AddPassTime(RENDER_STATS_PASS_OCCLUSION, (SystemTimer_GetAbsoluteTime() - begin) * 1000.0);
+    RenderStats_AddCounter(RENDER_STATS_BLOCKS_FRUSTUM_CULLED, g_blocks.size() - g_frustumVisible.size());
+    RenderStats_AddCounter(RENDER_STATS_BLOCKS_OCCLUDED, occluded);
+
+    Cube_DrawBlocks(g_drawList.data(), (int)g_drawList.size());
+    RenderStats_AddCounter(RENDER_STATS_BLOCKS_DRAWN, g_drawList.size());
+}
+
+void Stage01_SetOcclusionCulling(bool enable)
+{
+    g_occlusionEnabled = enable;
+}
+
+bool Stage01_IsOcclusionCulling()
+{
+    return g_occlusionEnabled;
+}
+
+const OcclusionBuffer& Stage01_GetOcclusionBuffer()
+{
+    return g_occlusion;
+}
+
 void Stage01_DepthDraw()
 {
+    g_drawList.clear();
     for (const auto& b : g_blocks)
     {
-        CubeBlock cb{};
-        cb.kind = b.kind;
-        cb.texId = b.texId;
-        cb.world = b.world;
-        Cube_DepthDrawBlock(cb);
+        PushDrawBlock(b);
     }
+    Cube_DepthDrawBlocks(g_drawList.data(), (int)g_drawList.size());
     /*
     for (const auto& b : g_blocks)
     {
@@ -365,6 +583,28 @@ void Stage01_DepthDraw()
     }*/
 }
 
+void Stage01_DepthDrawCasters(Stage01CasterSet set, const Frustum& lightFrustum)
+{
+    const bool wantMoving = (set == STAGE01_CASTER_MOVING);
+
+    g_drawList.clear();
+    for (size_t i = 0; i < g_blocks.size(); ++i)
+    {
+        if (g_offsets[i].moving != wantMoving) continue;
+
+        const StageBlock& b = g_blocks[i];
+        if (!Frustum_IntersectsAabb(lightFrustum, b.aabb.min, b.aabb.max)) continue;
+
+        PushDrawBlock(b);
+    }
+    Cube_DepthDrawBlocks(g_drawList.data(), (int)g_drawList.size());
+}
+
+unsigned int Stage01_GetStaticRevision()
+{
+    return g_staticRevision;
+}
+
 // ===== ImGuii͖gpłOKj=====
 int Stage01_GetCount() { return (int)g_blocks.size(); }
 
@@ -385,6 +625,9 @@ void Stage01_RebuildObject(int i)
     if (i < 0 || i >= (int)g_blocks.size()) return;
     ApplyTex(g_blocks[i]);
     Bake(g_blocks[i], g_offsets[i]);
+
+    // ubN͖t[`̂ŁAeLbV͐ÓIȂ̂
+    if (!g_offsets[i].moving) ++g_staticRevision;
 }
 
 void Stage01_RebuildAll()
@@ -393,6 +636,7 @@ void Stage01_RebuildAll()
         Bake(g_blocks[i], g_offsets[i]);
         ApplyTex(g_blocks[i]);
     }
+    ++g_staticRevision;
 }
 
 int Stage01_Add(const StageBlock& b, bool bake)
@@ -403,6 +647,7 @@ int Stage01_Add(const StageBlock& b, bool bake)
         ApplyTex(g_blocks.back());
         Bake(g_blocks.back(), g_offsets.back());
     }
+    ++g_staticRevision;
     return (int)g_blocks.size() - 1;
 }
 
@@ -411,12 +656,14 @@ void Stage01_Remove(int i)
     if (i < 0 || i >= (int)g_blocks.size()) return;
     g_blocks.erase(g_blocks.begin() + i);
     g_offsets.erase(g_offsets.begin() + i);
+    ++g_staticRevision;
 }
 
 void Stage01_Clear()
 {
     g_blocks.clear();
     g_offsets.clear();
+    ++g_staticRevision;
 }
 
 bool Stage01_AddObjectTransform(int index,
@@ -436,7 +683,14 @@ bool Stage01_AddObjectTransform(int index,
     offset.rotation.x += rotationDelta.x;
     offset.rotation.y += rotationDelta.y;
     offset.rotation.z += rotationDelta.z;
-    Stage01_RebuildObject(index);
+
+    // ߂ēÓILX^[Oiȍ~̈ړł͉eLbV̂ĂȂj
+    if (!offset.moving) {
+        offset.moving = true;
+        ++g_staticRevision;
+    }
+    ApplyTex(g_blocks[index]);
+    Bake(g_blocks[index], offset);
     return true;
 }
 
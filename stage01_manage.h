@@ -47,8 +47,29 @@ void Stage01_Initialize(const char* jsonPath);
 void Stage01_Finalize();
 void Stage01_Update(double elapsedTime);
 void Stage01_Draw();
+// ƎՕiȎ傫ȃubNjŌȂubNĂ`
+void Stage01_Draw(const DirectX::XMMATRIX& view, const DirectX::XMMATRIX& projection);
 void Stage01_DepthDraw(); // epigȂj
 
+// \tgEFAՕJO̗L/ifobO\pɍŌ̐[xobt@j
+class OcclusionBuffer;
+void Stage01_SetOcclusionCulling(bool enable);
+bool Stage01_IsOcclusionCulling();
+const OcclusionBuffer& Stage01_GetOcclusionBuffer();
+
+// ẽLX^[Bs Stage01_AddObjectTransform œubN MOVINGA
+// ȊO STATICieLbVɏĂjBCg̎ɓ̂`
+enum Stage01CasterSet
+{
+    STAGE01_CASTER_STATIC,
+    STAGE01_CASTER_MOVING,
+};
+struct Frustum;
+void Stage01_DepthDrawCasters(Stage01CasterSet set, const Frustum& lightFrustum);
+
+// ÓIubN̍\ς邽тɐiޔԍieLbV̏Ăpj
+unsigned int Stage01_GetStaticRevision();
+
 // ===== ImGuig߂̍Œ =====
 int  Stage01_GetCount();
 const StageBlock* Stage01_Get(int i);
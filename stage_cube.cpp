@@ -12,9 +12,13 @@
 #include "shader3d.h"
 #include "shader_depth.h"
 #include "texture.h"
+#include "constant_ring.h"
+#include "render_stats.h"
 
 #include <DirectXMath.h>
+#include <algorithm>
 #include <cfloat>
+#include <climits>
 #include <cstring>
 #include <unordered_map>
 
@@ -38,6 +42,7 @@ static ID3D11Device* g_pDevice = nullptr;
 static ID3D11DeviceContext* g_pContext = nullptr;
 
 static int g_defaultTexId = -1;
+static ID3D11ShaderResourceView* g_pTextureArray = nullptr; // ؂Ă邾
 
 struct KindGpu
 {
@@ -306,6 +311,108 @@ void Cube_DepthDrawBlock(const CubeBlock& block)
     drawKindInternal(block.kind, block.texId, world, true);
 }
 
+static void drawBlocksInternal(const CubeBlock* blocks, int count, bool depth)
+{
+    if (!blocks || count <= 0 || !g_pIndexBuffer) return;
+
+    // 1 Map ŏi256oCg~1024 = 256KBj
+    constexpr int kChunk = 1024;
+
+    int done = 0;
+    while (done < count)
+    {
+        const int chunk = std::min(count - done, kChunk);
+
+        ConstantRingSpan span;
+        if (!ConstantRing_Map(sizeof(Shader3DObject), (UINT)chunk, &span))
+        {
+            // ItZbgoChgȂF1]̕@
+            for (int i = done; i < count; ++i)
+            {
+                drawKindInternal(blocks[i].kind, blocks[i].texId, XMLoadFloat4x4(&blocks[i].world), depth);
+            }
+            return;
+        }
+
+        // [xVF[_[͐擪 world ǂ
+        for (int i = 0; i < chunk; ++i)
+        {
+            const CubeBlock& block = blocks[done + i];
+            Shader3DObject* dst = static_cast<Shader3DObject*>(ConstantRing_Element(span, (UINT)i));
+            XMStoreFloat4x4(&dst->world, XMMatrixTranspose(XMLoadFloat4x4(&block.world)));
+            const float slice = (g_pTextureArray && block.texSlice >= 0) ? (float)block.texSlice : -1.0f;
+            dst->params = { slice, 0.0f, 0.0f, 0.0f };
+        }
+        ConstantRing_Unmap(span);
+
+        if (depth)
+        {
+            ShaderDepth_Begin();
+        }
+        else
+        {
+            Shader3D_Begin();
+            Shader3d_SetColor({ 1,1,1,1 });
+            if (g_pTextureArray) Shader3D_SetTextureArray(g_pTextureArray);
+        }
+
+        g_pContext->IASetIndexBuffer(g_pIndexBuffer, DXGI_FORMAT_R16_UINT, 0);
+        g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+        const UINT stride = sizeof(Vertex3d);
+        const UINT offset = 0;
+        ID3D11Buffer* boundVb = nullptr;
+        int boundTex = INT_MIN;
+        unsigned long long texBinds = 0;
+
+        for (int i = 0; i < chunk; ++i)
+        {
+            const CubeBlock& block = blocks[done + i];
+            KindGpu* k = findKind(block.kind);
+            if (!k || !k->vb) continue;
+
+            if (k->vb != boundVb)
+            {
+                g_pContext->IASetVertexBuffers(0, 1, &k->vb, &stride, &offset);
+                boundVb = k->vb;
+            }
+
+            if (depth)
+            {
+                ShaderDepth_SetWorldMatrix(span, (UINT)i);
+            }
+            else
+            {
+                Shader3D_SetWorldMatrix(span, (UINT)i);
+
+                const bool sliced = g_pTextureArray && block.texSlice >= 0;
+                const int texId = (block.texId < 0) ? g_defaultTexId : block.texId;
+                if (!sliced && texId != boundTex)
+                {
+                    Texture_SetTexture(texId);
+                    boundTex = texId;
+                    ++texBinds;
+                }
+            }
+
+            g_pContext->DrawIndexed(NUM_INDEX, 0, 0);
+        }
+
+        if (texBinds) RenderStats_AddCounter(RENDER_STATS_BLOCK_TEXTURE_BINDS, texBinds);
+        done += chunk;
+    }
+}
+
+void Cube_DrawBlocks(const CubeBlock* blocks, int count)
+{
+    drawBlocksInternal(blocks, count, false);
+}
+
+void Cube_DepthDrawBlocks(const CubeBlock* blocks, int count)
+{
+    drawBlocksInternal(blocks, count, true);
+}
+
 static CubeTemplate makeLegacyTemplate()
 {
     CubeTemplate t = CubeTemplate_Unit();
@@ -407,6 +514,15 @@ void Cube_Finalize()
     g_kinds.clear();
 
     SAFE_RELEASE(g_pIndexBuffer);
+    g_pTextureArray = nullptr;
+
+    Texture_Release(g_defaultTexId);
+    g_defaultTexId = -1;
+}
+
+void Cube_SetTextureArray(ID3D11ShaderResourceView* pView)
+{
+    g_pTextureArray = pView;
 }
 
 void Cube_Update(double)
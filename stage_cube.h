@@ -87,6 +87,7 @@ struct CubeBlock
 {
     int kind = 0;
     int texId = -1;
+    int texSlice = -1; // Cube_SetTextureArray ̔z̃XCXBȂ texId ʂɃoCh
 
     DirectX::XMFLOAT3 position{ 0,0,0 };
     DirectX::XMFLOAT3 size{ 1,1,1 };
@@ -102,6 +103,14 @@ void Cube_DrawBlock(const CubeBlock& block);
 
 void Cube_DepthDrawBlock(const CubeBlock& block);
 
+// ܂Ƃ߂ĕ`i[hs͒萔OֈꊇŏA`悲ƂɃItZbg؂ւj
+// texSlice ubN̓eNX`z񂩂̂ŁAeNX`̍ւNȂ
+void Cube_DrawBlocks(const CubeBlock* blocks, int count);
+void Cube_DepthDrawBlocks(const CubeBlock* blocks, int count);
+
+// Cube_DrawBlocks ŎgeNX`ziLȂBnullptr Ȃ texSlice ͖j
+void Cube_SetTextureArray(ID3D11ShaderResourceView* pView);
+
 void Cube_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
 void Cube_Finalize();
 void Cube_Update(double elapsedTime);
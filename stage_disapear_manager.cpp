@@ -27,6 +27,9 @@
 #include"mouse.h"
 #include"sprite.h"
 #include "shader_depth.h"
+#include "shadow_cache.h"
+#include "map_pass.h"
+#include "stage_frame.h"
 #include"map_camera.h"
 #include"light_camera.h"
 #include"stage01_manage.h"
@@ -101,9 +104,11 @@ namespace
 
 
 static void mapRendering() {
-	// _[^[QbgeNX`
-	Direct3D_SetOffscreen();
-	Direct3D_ClearOffscreen();
+	// f钆givC[ƓȂubNjȂǑʂg
+	const XMFLOAT3& playerPos = Player_GetPosition();
+	const XMFLOAT3& playerFront = Player_GetFront();
+	const float tracked[6] = { playerPos.x, playerPos.y, playerPos.z, playerFront.x, playerFront.y, playerFront.z };
+	if (!MapPass_Begin(PassScheduler_HashFloats(tracked, 6, 0.01f, Stage01_GetStaticRevision()))) return;
 
 	// CgJisj̐ݒ
 	XMFLOAT4X4 mtxView = LightCamera_GetViewMatrix();
@@ -131,32 +136,14 @@ static void mapRendering() {
 	//Enemy_Draw();
 	Player_Draw();
 	//Map_Draw();
+
+	MapPass_End();
 }
 
 static void lightRendering() {
-	// _[^[QbgeNX`
-	Direct3D_SetShadowDepth();
-	Direct3D_ClearShadowDepth();
-
-	// CgJisj̐ݒ
-	XMFLOAT4X4 mtxView = LightCamera_GetViewMatrix();
-	XMFLOAT4X4 mtxProj = LightCamera_GetProjectionMatrix();
-	XMMATRIX view = XMLoadFloat4x4(&mtxView);
-	XMMATRIX proj = XMLoadFloat4x4(&mtxProj);
-
-	// JɊւsVF[_[ɐݒ肷
-	Camera_SetMatrix(view, proj);
-
-	ShaderDepth_SetViewMatrix(view);
-	ShaderDepth_SetProjectionMatrix(proj);
-
-	// [xL
-	Direct3D_SetDepthEnable(true);
-
-	//LXg(e𗎂ƂIuWFNg)
-	//Enemy_DepthDraw();
-	Player_DepthDraw();
-	//Map_Draw();
+	// e̐[x}bvBȂubN̓LbViωĂjA
+	// vC[Ɠ͖t[d˂
+	ShadowCache_Render(Player_DepthDraw);
 }
 
 DirectX::XMFLOAT3 StageDisapearManager_GetSpawnPosition()
@@ -184,6 +171,8 @@ void StageDisapearManager_Initialize(const StageInfo& info)
 	testTex = Texture_Load(L"runningman001.png");
 	g_animId = SpriteAnim_RegisterPattern(testTex, 10, 5, 0.1, { 140,200 }, { 0,0, });
 	LightCamera_Initialize({ -1.0f,-1.0f,1.0f }, { 0.0f,20.0f,-0.0f });
+	ShadowCache_Invalidate(); // Xe[Wς̂ŉeLbV͍蒼
+	MapPass_Invalidate();
 
 	g_animPlayId = SpriteAnim_CreatePlayer(g_animId);
 
@@ -335,27 +324,9 @@ void StageDisapearManager_Update(double elapsedTime)
 	}
 }
 
-void StageDisapearManager_Draw()
+// obNobt@ւ̖{`i_[^[QbgƉe̐[x̓_[OtoChς݁j
+static void sceneRendering()
 {
-	// S[o̓Xe[W`ANAUI\
-	if (g_goalDisapear == GoalState::Clear || g_goalDisapear == GoalState::WaitInput)
-	{
-		Goal_DrawUI();
-		return;
-	}
-
-
-	mapRendering();
-	lightRendering();
-
-	Direct3D_SetBackBuffer();
-
-	Direct3D_SetDepthShadowTexture(2);
-
-	//_[^[QbgobNobtA
-	Direct3D_SetOffscreen();
-	Direct3D_SetBackBuffer();
-
 	static int draw_count = 0;
 	Mouse_State ms;
 	Mouse_GetState(&ms);
@@ -468,8 +439,21 @@ void StageDisapearManager_Draw()
 
 
 	Camera_SetMatrix(view, proj);//Kv
-	Stage01_Draw();
+	Stage01_Draw(view, proj);
 	Item_Draw();
 }
 
+void StageDisapearManager_Draw()
+{
+	// S[o̓Xe[W`ANAUI\
+	if (g_goalDisapear == GoalState::Clear || g_goalDisapear == GoalState::WaitInput)
+	{
+		Goal_DrawUI();
+		return;
+	}
+
+	// }bv  e̐[x  {` ̒i̓_[OtC
+	StageFrame_Draw({ mapRendering, lightRendering, sceneRendering });
+}
+
 
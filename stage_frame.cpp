@@ -0,0 +1,67 @@
+/*==============================================================================
+
+@@@Xe[Wʂ̃t[`[stage_frame.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "stage_frame.h"
+#include "render_graph.h"
+#include "render_graph_d3d.h"
+
+namespace
+{
+    RenderGraph           g_graph;
+    RenderGraphD3DBackend g_backend;
+
+    // gݒ̓pX̒gςiXe[Wؑցj
+    StageFramePasses g_builtPasses{};
+    bool             g_built = false;
+}
+
+void StageFrame_BuildGraph(RenderGraph& graph, const StageFramePasses& passes)
+{
+    graph.Reset();
+
+    const int backBuffer  = graph.ImportTexture("BackBuffer", RENDER_GRAPH_D3D_BACK_BUFFER);
+    const int offscreen   = graph.ImportTexture("Offscreen", RENDER_GRAPH_D3D_OFFSCREEN);
+    const int shadowDepth = graph.ImportTexture("ShadowDepth", RENDER_GRAPH_D3D_SHADOW_DEPTH);
+
+    graph.MarkOutput(backBuffer);
+    // ItXN[̓t[܂ŎcADirect3D_SetOffscreenTexture ŊOǂ߂
+    graph.MarkOutput(offscreen);
+
+    // }bv͕`Ȃt[ɑǑʂĉŁANA MapPass_Begin ɔC
+    void (*map)() = passes.map;
+    const int mapPass = graph.AddPass("Map", [map]() { if (map) map(); }, false);
+    graph.AddWrite(mapPass, offscreen, false);
+
+    // e̓LbṼRs[NȂ
+    void (*shadow)() = passes.shadow;
+    const int shadowPass = graph.AddPass("Shadow", [shadow]() { if (shadow) shadow(); }, false);
+    graph.AddWrite(shadowPass, shadowDepth, false);
+
+    // obNobt@̃NA̓t[̓ōςł
+    void (*scene)() = passes.scene;
+    const int scenePass = graph.AddPass("Scene", [scene]() { if (scene) scene(); });
+    graph.AddRead(scenePass, shadowDepth, 2);
+    graph.AddWrite(scenePass, backBuffer, false);
+
+    graph.Compile();
+}
+
+void StageFrame_Draw(const StageFramePasses& passes)
+{
+    if (!g_built
+        || g_builtPasses.map != passes.map
+        || g_builtPasses.shadow != passes.shadow
+        || g_builtPasses.scene != passes.scene)
+    {
+        StageFrame_BuildGraph(g_graph, passes);
+        g_built = g_backend.Prepare(g_graph);
+        g_builtPasses = passes;
+    }
+
+    g_graph.Execute(g_backend);
+}
@@ -0,0 +1,31 @@
+/*==============================================================================
+
+@@@Xe[Wʂ̃t[`[stage_frame.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    eXe[W Draw Ŏ菑Ă
+        ItXN[̃}bv  e̐[x}bv  obNobt@
+    ̕т_[Otɂ܂Ƃ߂́BXe[W͊epX̒gnB
+
+==============================================================================*/
+#ifndef STAGE_FRAME_H
+#define STAGE_FRAME_H
+
+class RenderGraph;
+
+struct StageFramePasses
+{
+    void (*map)();      // ItXN[̃}bviMapPass ŊԈAŃoChj
+    void (*shadow)();   // e̐[x}bviShadowCache ŃoChj
+    void (*scene)();    // obNobt@ւ̖{`ie̐[xǂށj
+};
+
+// OtgނiD3D RenderGraphNullBackend ɗďԂm߂j
+void StageFrame_BuildGraph(RenderGraph& graph, const StageFramePasses& passes);
+
+// Otg D3D Ŏs
+void StageFrame_Draw(const StageFramePasses& passes);
+
+#endif // STAGE_FRAME_H
@@ -0,0 +1,188 @@
+/*==============================================================================
+
+@@@Xe[W̃t[Ot̃`FbN[stage_frame_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D Ȃőg߂B
+        g++ -std=c++17 stage_frame_test.cpp stage_frame.cpp render_graph.cpp
+    StageFrame_BuildGraph ̌ʂ RenderGraphNullBackend ɗāApX̏Ԃ
+    ^[Qbg̐؂ւioAjENAB킹 RenderGraph 
+    pX̊ԈENÂ܂Ƃ߁Eꎞ^[Qbg̎g񂵂B
+
+==============================================================================*/
+#include "stage_frame.h"
+#include "render_graph.h"
+#include "render_graph_d3d.h"
+#include "test_check.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// stage_frame.cpp Ă D3D obNGh̒gBł StageFrame_Draw Ă΂Ȃ̂ŋł悢
+bool RenderGraphD3DBackend::Prepare(const RenderGraph&) { return false; }
+void RenderGraphD3DBackend::Barrier(const RenderGraph&, int, RenderGraphAccess, RenderGraphAccess) {}
+void RenderGraphD3DBackend::Clear(const RenderGraph&, int) {}
+void RenderGraphD3DBackend::BeginPass(const RenderGraph&, int) {}
+void RenderGraphD3DBackend::EndPass(const RenderGraph&, int) {}
+
+namespace
+{
+    std::vector<std::string> g_calls; // pX̒gĂ΂ꂽ
+
+    void MapPass() { g_calls.push_back("map"); }
+    void ShadowPass() { g_calls.push_back("shadow"); }
+    void ScenePass() { g_calls.push_back("scene"); }
+
+    std::string Join(const std::vector<std::string>& lines)
+    {
+        std::string s;
+        for (const std::string& line : lines) s += line + " | ";
+        return s;
+    }
+
+    bool SameLog(const std::vector<std::string>& log, const std::vector<std::string>& expected)
+    {
+        if (log == expected) return true;
+        std::printf("     got      : %s\n     expected : %s\n", Join(log).c_str(), Join(expected).c_str());
+        return false;
+    }
+
+    void CheckStageFrame()
+    {
+        RenderGraph graph;
+        StageFrame_BuildGraph(graph, { MapPass, ShadowPass, ScenePass });
+
+        TestCheck_True(graph.GetPassCount() == 3 && graph.GetCulledPassCount() == 0, "three passes, none culled");
+        TestCheck_True(graph.GetPhysicalCount() == 0, "only imported targets");
+
+        // }bv  e  {`Be̐[x͏A{`œǂޒO SRV ցB
+        // ǂ̃^[QbgNA̓pX̊OiMapPass_BeginEẽLbVEt[̓jɔC
+        const std::vector<std::string> expected = {
+            "barrier Offscreen NONE->RT",
+            "pass Map",
+            "barrier ShadowDepth NONE->RT",
+            "pass Shadow",
+            "barrier ShadowDepth RT->SRV",
+            "barrier BackBuffer NONE->RT",
+            "pass Scene",
+        };
+
+        RenderGraphNullBackend backend;
+        g_calls.clear();
+        graph.Execute(backend);
+        TestCheck_True(SameLog(backend.GetLog(), expected), "pass order and transitions");
+        TestCheck_True(g_calls == std::vector<std::string>({ "map", "shadow", "scene" }), "pass bodies run in order");
+
+        // t[iɂȂiÕt[̏ԂzȂj
+        backend.Reset();
+        graph.Execute(backend);
+        TestCheck_True(SameLog(backend.GetLog(), expected), "second frame repeats the same steps");
+
+        // gnȂpXĂԂ͕ς炸AȂ
+        StageFrame_BuildGraph(graph, { nullptr, ShadowPass, ScenePass });
+        backend.Reset();
+        g_calls.clear();
+        graph.Execute(backend);
+        TestCheck_True(SameLog(backend.GetLog(), expected), "missing map body keeps the same steps");
+        TestCheck_True(g_calls == std::vector<std::string>({ "shadow", "scene" }), "missing map body is skipped");
+    }
+
+    // o͂ɓ͂ȂpX͊OAANA1ȀdȂȂꎞ^[Qbĝ͎L
+    void CheckGraphRules()
+    {
+        const RenderGraphTextureDesc desc = { 256, 256, 28, false };
+        RenderGraph graph;
+        const int back = graph.ImportTexture("Back", 0);
+        const int a = graph.CreateTexture("A", desc);
+        const int b = graph.CreateTexture("B", desc);
+        const int unused = graph.CreateTexture("Unused", desc);
+        graph.MarkOutput(back);
+
+        auto noop = []() {};
+        const int clearAB = graph.AddPass("ClearAB", nullptr); // NA
+        graph.AddWrite(clearAB, a, true);
+        graph.AddWrite(clearAB, b, true);
+        const int drawA = graph.AddPass("DrawA", noop);
+        graph.AddWrite(drawA, a, true);          // ܂`ĂȂ̂ŁÃNA͗vȂ
+        const int blurB = graph.AddPass("BlurB", noop);
+        graph.AddRead(blurB, a, 0);
+        graph.AddWrite(blurB, b, false);         // NA B ɏd˂
+        const int dead = graph.AddPass("Dead", noop);
+        graph.AddWrite(dead, unused, true);      // Nǂ܂Ȃ
+        const int compose = graph.AddPass("Compose", noop);
+        graph.AddRead(compose, b, 0);
+        graph.AddWrite(compose, back, false);
+
+        TestCheck_True(graph.Compile(), "graph compiles");
+        TestCheck_True(graph.IsPassCulled(dead) && graph.GetCulledPassCount() == 1, "pass that reaches no output is culled");
+        TestCheck_True(!graph.IsPassCulled(clearAB), "clear-only pass kept while B still needs it");
+        TestCheck_True(graph.GetMergedClearCount() == 1, "second clear of an untouched target is merged");
+        TestCheck_True(graph.GetPhysicalCount() == 2 && graph.GetResource(a).physical != graph.GetResource(b).physical,
+            "overlapping transients get separate textures");
+
+        RenderGraphNullBackend backend;
+        graph.Execute(backend);
+        const std::vector<std::string> expected = {
+            "barrier A NONE->RT",
+            "clear A",
+            "barrier B NONE->RT",
+            "clear B",
+            "pass DrawA",
+            "barrier A RT->SRV",
+            "pass BlurB",
+            "barrier B RT->SRV",
+            "barrier Back NONE->RT",
+            "pass Compose",
+        };
+        TestCheck_True(SameLog(backend.GetLog(), expected), "steps for clear/draw/blur/compose");
+
+        // ̃pXNAďȂAÕNÃpX͊O
+        RenderGraph overwritten;
+        const int outO = overwritten.ImportTexture("Out", 0);
+        overwritten.MarkOutput(outO);
+        const int early = overwritten.AddPass("EarlyClear", nullptr);
+        overwritten.AddWrite(early, outO, true);
+        const int late = overwritten.AddPass("Draw", noop);
+        overwritten.AddWrite(late, outO, true);
+        TestCheck_True(overwritten.Compile() && overwritten.IsPassCulled(early) && !overwritten.IsPassCulled(late),
+            "clear-only pass overwritten by a later clear is culled");
+
+        // A gIĂ C gȂ瓯
+        RenderGraph chain;
+        const int out = chain.ImportTexture("Out", 0);
+        const int t0 = chain.CreateTexture("T0", desc);
+        const int t1 = chain.CreateTexture("T1", desc);
+        const int t2 = chain.CreateTexture("T2", desc);
+        chain.MarkOutput(out);
+        const int p0 = chain.AddPass("P0", noop);
+        chain.AddWrite(p0, t0, true);
+        const int p1 = chain.AddPass("P1", noop);
+        chain.AddRead(p1, t0, 0);
+        chain.AddWrite(p1, t1, true);
+        const int p2 = chain.AddPass("P2", noop);
+        chain.AddRead(p2, t1, 0);
+        chain.AddWrite(p2, t2, true);
+        const int p3 = chain.AddPass("P3", noop);
+        chain.AddRead(p3, t2, 0);
+        chain.AddWrite(p3, out, false);
+        TestCheck_True(chain.Compile(), "chain compiles");
+        TestCheck_True(chain.GetPhysicalCount() == 2 && chain.GetResource(t0).physical == chain.GetResource(t2).physical,
+            "transients with disjoint lifetimes share a texture");
+
+        // ĂȂꎞ^[QbgǂރOt͑g߂Ȃ
+        RenderGraph broken;
+        const int never = broken.CreateTexture("Never", desc);
+        const int reader = broken.AddPass("Reader", noop);
+        broken.AddRead(reader, never, 0);
+        TestCheck_True(!broken.Compile(), "reading an unwritten transient fails to compile");
+    }
+}
+
+int main()
+{
+    CheckStageFrame();
+    CheckGraphRules();
+    return TestCheck_Result();
+}
@@ -76,6 +76,11 @@ bool Map_Initialize()
 void Map_Finalize()
 {
     g_Blocks.clear();
+
+    Texture_Release(g_TexBrick);
+    Texture_Release(g_TexDefault);
+    g_TexBrick = -1;
+    g_TexDefault = -1;
 }
 
 void Map_Update(double)
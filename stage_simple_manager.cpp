@@ -28,6 +28,9 @@
 #include"mouse.h"
 #include"sprite.h"
 #include "shader_depth.h"
+#include "shadow_cache.h"
+#include "map_pass.h"
+#include "stage_frame.h"
 #include"map_camera.h"
 #include"light_camera.h"
 #include"stage01_manage.h"
@@ -121,9 +124,11 @@ namespace
 
 
 static void mapRendering() {
-	// _[^[QbgeNX`
-	Direct3D_SetOffscreen();
-	Direct3D_ClearOffscreen();
+	// f钆givC[ƓȂubNjȂǑʂg
+	const XMFLOAT3& playerPos = Player_GetPosition();
+	const XMFLOAT3& playerFront = Player_GetFront();
+	const float tracked[6] = { playerPos.x, playerPos.y, playerPos.z, playerFront.x, playerFront.y, playerFront.z };
+	if (!MapPass_Begin(PassScheduler_HashFloats(tracked, 6, 0.01f, Stage01_GetStaticRevision()))) return;
 
 	// CgJisj̐ݒ
 	XMFLOAT4X4 mtxView = LightCamera_GetViewMatrix();
@@ -151,32 +156,14 @@ static void mapRendering() {
 	//Enemy_Draw();
 	Player_Draw();
 	//Map_Draw();
+
+	MapPass_End();
 }
 
 static void lightRendering() {
-	// _[^[QbgeNX`
-	Direct3D_SetShadowDepth();
-	Direct3D_ClearShadowDepth();
-
-	// CgJisj̐ݒ
-	XMFLOAT4X4 mtxView = LightCamera_GetViewMatrix();
-	XMFLOAT4X4 mtxProj = LightCamera_GetProjectionMatrix();
-	XMMATRIX view = XMLoadFloat4x4(&mtxView);
-	XMMATRIX proj = XMLoadFloat4x4(&mtxProj);
-
-	// JɊւsVF[_[ɐݒ肷
-	Camera_SetMatrix(view, proj);
-
-	ShaderDepth_SetViewMatrix(view);
-	ShaderDepth_SetProjectionMatrix(proj);
-
-	// [xL
-	Direct3D_SetDepthEnable(true);
-
-	//LXg(e𗎂ƂIuWFNg)
-	//Enemy_DepthDraw();
-	Player_DepthDraw();
-	//Map_Draw();
+	// e̐[x}bvBȂubN̓LbViωĂjA
+	// vC[Ɠ͖t[d˂
+	ShadowCache_Render(Player_DepthDraw);
 }
 
 DirectX::XMFLOAT3 StageSimpleManager_GetSpawnPosition()
@@ -235,6 +222,8 @@ void StageSimpleManager_Initialize(const StageInfo& info)
 	g_emitterManager.Initialize(L"effect000.jpg");
 	g_firework.Initialize(L"effect000.jpg");
 	LightCamera_Initialize({ -1.0f,-1.0f,1.0f }, { 0.0f,20.0f,-0.0f });
+	ShadowCache_Invalidate(); // Xe[Wς̂ŉeLbV͍蒼
+	MapPass_Invalidate();
 
 
 	//Enemy_Create({ 1.0f,0.0f,1.0f });
@@ -406,27 +395,9 @@ void StageSimpleManager_Update(float elapsedTime)
 	}
 }
 
-void StageSimpleManager_Draw()
+// obNobt@ւ̖{`i_[^[QbgƉe̐[x̓_[OtoChς݁j
+static void sceneRendering()
 {
-	// S[o̓Xe[W`ANAUI\
-	if (g_goalSimple == GoalState::Clear || g_goalSimple == GoalState::WaitInput)
-	{
-		Goal_DrawUI();
-		return;
-	}
-
-
-	mapRendering();
-	lightRendering();
-
-	Direct3D_SetBackBuffer();
-
-	Direct3D_SetDepthShadowTexture(2);
-
-	//_[^[QbgobNobtA
-	Direct3D_SetOffscreen();
-	Direct3D_SetBackBuffer();
-
 	static int draw_count = 0;
 	Mouse_State ms;
 	Mouse_GetState(&ms);
@@ -487,7 +458,7 @@ void StageSimpleManager_Draw()
 	//Bullet_Draw();
 
 	Camera_SetMatrix(view, proj);//Kv
-	Stage01_Draw();
+	Stage01_Draw(view, proj);
 	Item_Draw();
 
 
@@ -504,7 +475,9 @@ void StageSimpleManager_Draw()
 	DirectX::XMFLOAT4X4 viewF;
 	DirectX::XMStoreFloat4x4(&viewF, view);
 	Billboard_SetViewMatrix(viewF);
-	Billboard_Draw(g_testTex, { -3.0f,0.0f,0.0f }, 5.0f, 5.0f , { 0.0f,0.0f});
+	// r{[h̓eNX`ɂ܂Ƃ߂ĕ`iXe[gޔ/ABatchEnd1j
+	Billboard_BatchBegin();
+	Billboard_BatchDraw(g_testTex, { -3.0f,0.0f,0.0f }, 5.0f, 5.0f, { 1.0f,1.0f,1.0f,1.0f }, { 0.0f,0.0f });
 	//BillboardAnim_Draw(g_animPlayId, { -3.0f,2.0f,0.0f }, { 5.0f, 5.0f }, { 0.0f,2.0f });
 	if (g_animBrickHitId >= 0 && !g_spinBreakBillboardPositions.empty())
 		 {
@@ -516,6 +489,7 @@ void StageSimpleManager_Draw()
 
 	g_emitterManager.Draw();
 	g_firework.Draw();
+	Billboard_BatchEnd();
 
 	if (g_isDebug) {
 		Camera_DebugDraw();
@@ -528,4 +502,17 @@ void StageSimpleManager_Draw()
 	
 }
 
+void StageSimpleManager_Draw()
+{
+	// S[o̓Xe[W`ANAUI\
+	if (g_goalSimple == GoalState::Clear || g_goalSimple == GoalState::WaitInput)
+	{
+		Goal_DrawUI();
+		return;
+	}
+
+	// }bv  e̐[x  {` ̒i̓_[OtC
+	StageFrame_Draw({ mapRendering, lightRendering, sceneRendering });
+}
+
 
@@ -0,0 +1,56 @@
+/*==============================================================================
+
+@@@P̃`FbN̋ʕ[test_check.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    *_test.cppiQ[ɂ͓ȂAD3D Ȃőg߂P̂̃`FbNjŎgB
+    1ڂ ok / FAIL oAŌ TestCheck_Result  main ̖߂lɂ
+    is 1jB
+
+==============================================================================*/
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <cstdio>
+
+inline int& TestCheck_Failures()
+{
+    static int failures = 0;
+    return failures;
+}
+
+// lƏoځiok ̔͌ĂяoŁj
+inline bool TestCheck_Expect(bool ok, const char* what, double value, double limit)
+{
+    std::printf("%s %s : %g (<= %g)\n", ok ? "ok  " : "FAIL", what, value, limit);
+    if (!ok) ++TestCheck_Failures();
+    return ok;
+}
+
+// lƉoځiPSNR ȂǑ傫قǂ悢́j
+inline bool TestCheck_ExpectMin(bool ok, const char* what, double value, double floor)
+{
+    std::printf("%s %s : %g (>= %g)\n", ok ? "ok  " : "FAIL", what, value, floor);
+    if (!ok) ++TestCheck_Failures();
+    return ok;
+}
+
+// 藧ǂ̍
+inline bool TestCheck_True(bool ok, const char* what)
+{
+    std::printf("%s %s\n", ok ? "ok  " : "FAIL", what);
+    if (!ok) ++TestCheck_Failures();
+    return ok;
+}
+
+inline int TestCheck_Result()
+{
+    const int failures = TestCheck_Failures();
+    if (failures) std::printf("%d failed\n", failures);
+    else std::printf("all passed\n");
+    return failures ? 1 : 0;
+}
+
+#endif // TEST_CHECK_H
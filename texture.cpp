@@ -12,6 +12,14 @@
 #include"d3d11.h"//Releaseg
 #include "direct3d.h"
 #include"WICTextureLoader11.h"
+#include "debug_ostream.h"
+#include "texture_registry.h"
+#include "texture_stream.h"
+#include "texture_cook.h"
+#include <wincodec.h>
+#include <algorithm>
+#include <deque>
+#include <fstream>
 #include<string>
 
 using namespace DirectX;
@@ -21,21 +29,116 @@ using namespace DirectX;
 static constexpr int TEXTURE_MAX = 256;
 
 struct Texture {
-	std::wstring filename;
 	ID3D11Resource* pTexture = nullptr;
 	ID3D11ShaderResourceView* pTextureView;//VF[_[ANZXł郊\[XieNX`obt@jv\
 	unsigned int width;
 	unsigned int height;
+	bool pending = false;  // 񓯊ǂݍݒi̔eNX`wĂj
+	uint32_t ticket = 0;   // Eėp̂тɐi߂BÂWJʂ̂Ă邽
 };
 
 
 static Texture g_Textures[TEXTURE_MAX]{};
+static TextureRegistry g_Registry(TEXTURE_MAX); // t@C  ǗԍAQƐAgpoCgA󂫂ɖ߂Ƃ̒m点
 static  int g_SetTextureIndex = -1;
 
+// 񓯊ǂݍ
+static TextureDecodePool g_DecodePool;
+static std::deque<TextureDecodeResult> g_Ready;          // WJς݂ GPU ֑鏇ԑ҂
+static TextureUploadBudget g_UploadBudget;
+static unsigned long long g_UploadBudgetBytes = 8ull * 1024 * 1024; // 1t[őoCg
+static ID3D11Resource* g_pPlaceholder = nullptr;         // ͂܂őɓ\ 1x1 ̔
+static ID3D11ShaderResourceView* g_pPlaceholderView = nullptr;
+
+// OϊiBC1/BC3 + ~bvĵ̒uꏊBO͌摜̒g̃nbV
+static const wchar_t* const COOKED_DIR = L"cooked";
+
 // ӁIŊOݒ肳́BReleasesvB
 static ID3D11Device* g_pDevice = nullptr;
 static ID3D11DeviceContext* g_pContext = nullptr;
 
+//=====[J[Xbhł̓WJiWICj=====
+//t@Ng̓XbhƂ1Ďg
+static thread_local IWICImagingFactory* t_pWICFactory = nullptr;
+
+static void DecodeThreadBegin()
+{
+	CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+	CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&t_pWICFactory));
+}
+
+static void DecodeThreadEnd()
+{
+	SAFE_RELEASE(t_pWICFactory);
+	CoUninitialize();
+}
+
+//t@C̒g܂邲Ɠǂ
+static bool ReadFileBytes(const std::wstring& path, std::vector<uint8_t>* out)
+{
+	std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+	if (!ifs) return false;
+
+	const std::streamsize size = ifs.tellg();
+	if (size <= 0) return false;
+	out->resize((size_t)size);
+	ifs.seekg(0);
+	return (bool)ifs.read((char*)out->data(), size);
+}
+
+//PNG/JPG Ȃǂ RGBA8 ɓWJ
+static bool DecodeImageWIC(const std::vector<uint8_t>& bytes, uint32_t* width, uint32_t* height, std::vector<uint8_t>* rgba)
+{
+	if (!t_pWICFactory || bytes.empty()) return false;
+
+	IWICStream* pStream = nullptr;
+	IWICBitmapDecoder* pDecoder = nullptr;
+	IWICBitmapFrameDecode* pFrame = nullptr;
+	IWICFormatConverter* pConverter = nullptr;
+
+	HRESULT hr = t_pWICFactory->CreateStream(&pStream);
+	if (SUCCEEDED(hr)) hr = pStream->InitializeFromMemory((BYTE*)bytes.data(), (DWORD)bytes.size());
+	if (SUCCEEDED(hr)) hr = t_pWICFactory->CreateDecoderFromStream(pStream, nullptr, WICDecodeMetadataCacheOnDemand, &pDecoder);
+	if (SUCCEEDED(hr)) hr = pDecoder->GetFrame(0, &pFrame);
+	if (SUCCEEDED(hr)) hr = pFrame->GetSize(width, height);
+	if (SUCCEEDED(hr)) hr = t_pWICFactory->CreateFormatConverter(&pConverter);
+	if (SUCCEEDED(hr)) hr = pConverter->Initialize(pFrame, GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom);
+	if (SUCCEEDED(hr)) {
+		const UINT stride = *width * 4;
+		rgba->resize((size_t)stride * *height);
+		hr = pConverter->CopyPixels(nullptr, stride, (UINT)rgba->size(), rgba->data());
+	}
+
+	SAFE_RELEASE(pConverter);
+	SAFE_RELEASE(pFrame);
+	SAFE_RELEASE(pDecoder);
+	SAFE_RELEASE(pStream);
+	return SUCCEEDED(hr);
+}
+
+//[J[ł̓WJBł BC1/BC3 ֕ϊăLbVɏĂi񂩂͂ǂށj
+static bool DecodeAndCook(const std::wstring& path, uint32_t* width, uint32_t* height, std::vector<uint8_t>* rgba)
+{
+	std::vector<uint8_t> bytes;
+	if (!ReadFileBytes(path, &bytes)) return false;
+	if (!DecodeImageWIC(bytes, width, height, rgba)) return false;
+
+	TextureCookImage cooked;
+	std::vector<uint8_t> dds;
+	if (!TextureCook_Cook(rgba->data(), *width, *height, &cooked)) return true; // 4̔{łȂ̂ RGBA8 ̂܂
+	if (!TextureCook_WriteDDS(cooked, &dds)) return true;
+
+	//摜ʂ̃XbhĂ邱Ƃ̂ŁAꎞt@CɏĂ獷ւ
+	const std::wstring cachePath = TextureCook_CachePath(COOKED_DIR, TextureCook_Hash(bytes.data(), bytes.size()));
+	const std::wstring tmpPath = cachePath + L"." + std::to_wstring(GetCurrentThreadId()) + L".tmp";
+	{
+		std::ofstream ofs(tmpPath, std::ios::binary | std::ios::trunc);
+		if (!ofs || !ofs.write((const char*)dds.data(), dds.size())) return true;
+	}
+	if (!MoveFileExW(tmpPath.c_str(), cachePath.c_str(), MOVEFILE_REPLACE_EXISTING)) DeleteFileW(tmpPath.c_str());
+	return true;
+}
+
 void Texture_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 {
 	for (Texture& t : g_Textures) {
@@ -43,16 +146,142 @@ void Texture_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 	};
 
 	g_SetTextureIndex = -1;
+	g_Registry.Clear();
 
 	// foCXƃfoCXReLXg̕ۑ
 	g_pDevice = pDevice;
 	g_pContext = pContext;
 
+	// ǂݍݒɓ\Ă 1x1 ̔
+	const uint32_t white = 0xffffffff;
+	D3D11_TEXTURE2D_DESC desc{};
+	desc.Width = 1;
+	desc.Height = 1;
+	desc.MipLevels = 1;
+	desc.ArraySize = 1;
+	desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_IMMUTABLE;
+	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	D3D11_SUBRESOURCE_DATA sd{ &white, sizeof(white), 0 };
+	ID3D11Texture2D* pPlaceholder = nullptr;
+	if (SUCCEEDED(g_pDevice->CreateTexture2D(&desc, &sd, &pPlaceholder))) {
+		g_pPlaceholder = pPlaceholder;
+		g_pDevice->CreateShaderResourceView(pPlaceholder, nullptr, &g_pPlaceholderView);
+	}
+
+	// WJp̃[J[iCXbhƕ`̕cj
+	const int threads = std::max(1, std::min(4, (int)std::thread::hardware_concurrency() - 1));
+	CreateDirectoryW(COOKED_DIR, nullptr);
+	g_DecodePool.Start(threads, DecodeAndCook, DecodeThreadBegin, DecodeThreadEnd);
 }
 
 void Texture_Finalize(void)
 {
+	g_DecodePool.Stop();
+	g_Ready.clear();
 	Texture_AllRelease();
+	SAFE_RELEASE(g_pPlaceholderView);
+	SAFE_RELEASE(g_pPlaceholder);
+}
+
+//1f̃rbgiubNk1fɒljBgpoCǧςp
+static unsigned int BitsPerPixel(DXGI_FORMAT format)
+{
+	switch (format) {
+	case DXGI_FORMAT_R32G32B32A32_FLOAT:
+		return 128;
+	case DXGI_FORMAT_R16G16B16A16_FLOAT:
+	case DXGI_FORMAT_R16G16B16A16_UNORM:
+		return 64;
+	case DXGI_FORMAT_R8_UNORM:
+	case DXGI_FORMAT_A8_UNORM:
+	case DXGI_FORMAT_BC2_UNORM:
+	case DXGI_FORMAT_BC2_UNORM_SRGB:
+	case DXGI_FORMAT_BC3_UNORM:
+	case DXGI_FORMAT_BC3_UNORM_SRGB:
+	case DXGI_FORMAT_BC5_UNORM:
+	case DXGI_FORMAT_BC7_UNORM:
+	case DXGI_FORMAT_BC7_UNORM_SRGB:
+		return 8;
+	case DXGI_FORMAT_BC1_UNORM:
+	case DXGI_FORMAT_BC1_UNORM_SRGB:
+	case DXGI_FORMAT_BC4_UNORM:
+		return 4;
+	case DXGI_FORMAT_R16_UNORM:
+	case DXGI_FORMAT_R16_FLOAT:
+	case DXGI_FORMAT_B5G6R5_UNORM:
+	case DXGI_FORMAT_B5G5R5A1_UNORM:
+		return 16;
+	default:
+		return 32; // WIC œǂނ̂͂ق RGBA8 / BGRA8
+	}
+}
+
+//~bv܂߂gpoCǧς
+static unsigned long long EstimateBytes(const D3D11_TEXTURE2D_DESC& desc)
+{
+	const unsigned int bpp = BitsPerPixel(desc.Format);
+	unsigned long long bits = 0;
+	UINT w = desc.Width, h = desc.Height;
+	for (UINT mip = 0; mip < desc.MipLevels; ++mip) {
+		bits += (unsigned long long)w * h * bpp;
+		w = (w > 1) ? w / 2 : 1;
+		h = (h > 1) ? h / 2 : 1;
+	}
+	return bits / 8 * desc.ArraySize;
+}
+
+//LbVɕϊς݂̂̂΂ǂށBȂ -1
+static int LoadCooked(const std::wstring& filename)
+{
+	std::vector<uint8_t> bytes;
+	if (!ReadFileBytes(filename, &bytes)) return -1;
+
+	std::vector<uint8_t> dds;
+	TextureCookImage image;
+	if (!ReadFileBytes(TextureCook_CachePath(COOKED_DIR, TextureCook_Hash(bytes.data(), bytes.size())), &dds)) return -1;
+	if (!TextureCook_ReadDDS(dds.data(), dds.size(), &image)) return -1;
+
+	D3D11_TEXTURE2D_DESC desc{};
+	desc.Width = image.levels[0].width;
+	desc.Height = image.levels[0].height;
+	desc.MipLevels = (UINT)image.levels.size();
+	desc.ArraySize = 1;
+	desc.Format = image.format == TEXTURE_COOK_BC1 ? DXGI_FORMAT_BC1_UNORM : DXGI_FORMAT_BC3_UNORM;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_IMMUTABLE;
+	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	std::vector<D3D11_SUBRESOURCE_DATA> initData(image.levels.size());
+	for (size_t m = 0; m < image.levels.size(); ++m) {
+		initData[m].pSysMem = image.levels[m].data.data();
+		initData[m].SysMemPitch = TextureCook_RowPitch(image.format, image.levels[m].width);
+	}
+
+	ID3D11Texture2D* pTexture = nullptr;
+	ID3D11ShaderResourceView* pView = nullptr;
+	HRESULT hr = g_pDevice->CreateTexture2D(&desc, initData.data(), &pTexture);
+	if (SUCCEEDED(hr)) hr = g_pDevice->CreateShaderResourceView(pTexture, nullptr, &pView);
+	if (FAILED(hr)) {
+		SAFE_RELEASE(pView);
+		SAFE_RELEASE(pTexture);
+		return -1;
+	}
+
+	const int i = g_Registry.Insert(filename, EstimateBytes(desc));
+	if (i < 0) {
+		hal::dout << "Texture_LoadAsync() : ǗłeNX`̖𒴂܂" << std::endl;
+		SAFE_RELEASE(pView);
+		SAFE_RELEASE(pTexture);
+		return -1;
+	}
+
+	g_Textures[i].pTexture = pTexture;
+	g_Textures[i].pTextureView = pView;
+	g_Textures[i].width = desc.Width;
+	g_Textures[i].height = desc.Height;
+	return i;
 }
 
 /*eNX`dēǂݍ܂Ȃ悤ɂAVeNX`ǂݍŊǗԍԂ֐
@@ -71,52 +300,219 @@ DirectX
 */
 int Texture_Load(const wchar_t* pFilename)
 {
-	//łɓǂݍ񂾃t@C͓ǂݍ܂Ȃ
-	for (int i = 0;i < TEXTURE_MAX;i++) {
-		if (g_Textures[i].filename == pFilename) {//i͊Ǘԍ
-			return i;
-		}
+	if (!pFilename) return -1;
+
+	//łɓǂݍ񂾃t@C͓ǂݍ܂ȂiQƐ₷j
+	const std::wstring filename = pFilename;
+	const int found = g_Registry.Find(filename);
+	if (found >= 0) {
+		g_Registry.AddRef(found);
+		return found;
 	}
-	//󂢂ĂǗ̈T
-	for (int i = 0;i < TEXTURE_MAX;i++) {
 
-		if (g_Textures[i].pTextureView)continue;//gp
+	//eNX`̓ǂݍ݁iϊς݂̃LbV͌ȂBTexture_LoadAsync gj
+	ID3D11Resource* pResource = nullptr;
+	ID3D11ShaderResourceView* pView = nullptr;
+	HRESULT hr = CreateWICTextureFromFile(g_pDevice, g_pContext, pFilename, &pResource, &pView);
 
+	/*̂悤ɂāAhr ̒gs`FbNĂ܂B
+	*/
+	if (FAILED(hr)) {
+		MessageBoxW(nullptr, L"eNX`̓ǂݍ݂Ɏs܂", pFilename, MB_OK | MB_ICONERROR);
+		return -1;
+	}
 
-		//eNX`̓ǂݍ
-		HRESULT hr;
+	D3D11_TEXTURE2D_DESC t2desc;
+	((ID3D11Texture2D*)pResource)->GetDesc(&t2desc);
 
-	    hr = CreateWICTextureFromFile(g_pDevice, g_pContext, pFilename, &g_Textures[i].pTexture, &g_Textures[i].pTextureView);
-	
-		/*̂悤ɂāAhr ̒gs`FbNĂ܂B
-		*/
-		if (FAILED(hr)) {
-			MessageBoxW(nullptr, L"eNX`̓ǂݍ݂Ɏs܂", pFilename, MB_OK | MB_ICONERROR);
-			return -1;
-		}
+	//󂢂ĂǗԍ炤
+	const int i = g_Registry.Insert(filename, EstimateBytes(t2desc));
+	if (i < 0) {
+		hal::dout << "Texture_Load() : ǗłeNX`̖𒴂܂" << std::endl;
+		SAFE_RELEASE(pView);
+		SAFE_RELEASE(pResource);
+		return -1;
+	}
 
-		ID3D11Texture2D* pTexture = (ID3D11Texture2D*)g_Textures[i].pTexture;
-		D3D11_TEXTURE2D_DESC t2desc;
-		pTexture->GetDesc(&t2desc);
-		g_Textures[i].width = t2desc.Width;
-		g_Textures[i].height = t2desc.Height;
-		
+	g_Textures[i].pTexture = pResource;
+	g_Textures[i].pTextureView = pView;
+	g_Textures[i].width = t2desc.Width;
+	g_Textures[i].height = t2desc.Height;
 
-		g_Textures[i].filename = pFilename;
+	return i;
+}
 
+int Texture_AddRef(int texid)
+{
+	return g_Registry.AddRef(texid);
+}
+
+void Texture_SetReleaseCallback(TextureReleaseFunc func)
+{
+	g_Registry.SetReleaseCallback(func);
+}
 
-		return i;
+void Texture_Release(int texid)
+{
+	if (g_Registry.RefCount(texid) != 1) {
+		g_Registry.Release(texid);
+		return;
 	}
-	return -1;
+
+	//Ō̎QƁFGPUĂ䒠󂯂im点͑䒠Ăԁj
+	Texture& t = g_Textures[texid];
+	SAFE_RELEASE(t.pTexture);
+	SAFE_RELEASE(t.pTextureView);
+	t.width = 0;
+	t.height = 0;
+	t.pending = false;
+	++t.ticket; // WJ̌ʂォ͂Ă̂Ă
+	if (g_SetTextureIndex == texid) g_SetTextureIndex = -1;
+	g_Registry.Release(texid);
 }
 
 void Texture_AllRelease()
 {
 	for (Texture& t : g_Textures) {
-		t.filename.clear();
 		SAFE_RELEASE(t.pTexture);
 		SAFE_RELEASE(t.pTextureView);
+		t.pending = false;
+		++t.ticket;
+	}
+	g_Ready.clear();
+	g_Registry.Clear();
+	g_SetTextureIndex = -1;
+}
+
+/*񓯊łTexture_Load
+Ǘԍ͂ԂA͂܂ł 1x1 ̔\ĂB
+WJ̓[J[XbhAGPUւ̓] Texture_UpdateiCXbhjŗ\Z̕sB*/
+int Texture_LoadAsync(const wchar_t* pFilename)
+{
+	if (!pFilename) return -1;
+
+	const std::wstring filename = pFilename;
+	const int found = g_Registry.Find(filename);
+	if (found >= 0) {
+		g_Registry.AddRef(found);
+		return found;
+	}
+
+	//ϊς݂͓̂̂WJvȂ̂ł̏ő
+	const int cooked = LoadCooked(filename);
+	if (cooked >= 0) return cooked;
+
+	if (!g_DecodePool.IsRunning() || !g_pPlaceholderView) return Texture_Load(pFilename);
+
+	const int i = g_Registry.Insert(filename, 0);
+	if (i < 0) {
+		hal::dout << "Texture_LoadAsync() : ǗłeNX`̖𒴂܂" << std::endl;
+		return -1;
 	}
+
+	Texture& t = g_Textures[i];
+	t.pTexture = g_pPlaceholder;
+	t.pTextureView = g_pPlaceholderView;
+	t.pTexture->AddRef();
+	t.pTextureView->AddRef();
+	t.width = 1;
+	t.height = 1;
+	t.pending = true;
+	++t.ticket;
+
+	g_DecodePool.Submit(i, t.ticket, filename);
+	return i;
+}
+
+//WJς݂̉摜 GPU ֑čւi~bv GPU ōj
+static void UploadDecoded(const TextureDecodeResult& r)
+{
+	Texture& t = g_Textures[r.handle];
+
+	if (!r.ok) {
+		hal::dout << "Texture_Update() : eNX`̓WJɎs܂" << std::endl;
+		t.pending = false; // ̂܂܎g
+		return;
+	}
+
+	D3D11_TEXTURE2D_DESC desc{};
+	desc.Width = r.width;
+	desc.Height = r.height;
+	desc.MipLevels = 0; // Si
+	desc.ArraySize = 1;
+	desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET; // GenerateMips ɗv
+	desc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
+
+	ID3D11Texture2D* pTexture = nullptr;
+	ID3D11ShaderResourceView* pView = nullptr;
+	HRESULT hr = g_pDevice->CreateTexture2D(&desc, nullptr, &pTexture);
+	if (SUCCEEDED(hr)) hr = g_pDevice->CreateShaderResourceView(pTexture, nullptr, &pView);
+	if (FAILED(hr)) {
+		hal::dout << "Texture_Update() : eNX`̍쐬Ɏs܂" << std::endl;
+		SAFE_RELEASE(pView);
+		SAFE_RELEASE(pTexture);
+		t.pending = false;
+		return;
+	}
+
+	g_pContext->UpdateSubresource(pTexture, 0, nullptr, r.rgba.data(), r.width * 4, 0);
+	g_pContext->GenerateMips(pView);
+
+	SAFE_RELEASE(t.pTexture);
+	SAFE_RELEASE(t.pTextureView);
+	t.pTexture = pTexture;
+	t.pTextureView = pView;
+	t.width = r.width;
+	t.height = r.height;
+	t.pending = false;
+
+	pTexture->GetDesc(&desc);
+	g_Registry.SetBytes(r.handle, EstimateBytes(desc));
+}
+
+//͂܂łɉEėpꂽԍ̌ʂ͎̂Ă
+static bool IsCurrentTicket(int handle, uint32_t ticket)
+{
+	if (handle < 0 || handle >= TEXTURE_MAX) return false;
+	const Texture& t = g_Textures[handle];
+	return t.pending && t.ticket == ticket;
+}
+
+void Texture_Update()
+{
+	g_UploadBudget.BeginFrame(g_UploadBudgetBytes);
+	TextureStream_Pump(&g_DecodePool, &g_Ready, &g_UploadBudget, IsCurrentTicket, UploadDecoded);
+}
+
+bool Texture_IsPending(int texid)
+{
+	if (!g_Registry.IsLive(texid)) return false;
+	return g_Textures[texid].pending;
+}
+
+int Texture_GetPendingCount()
+{
+	int count = 0;
+	for (const Texture& t : g_Textures) count += t.pending ? 1 : 0;
+	return count;
+}
+
+void Texture_SetUploadBudget(unsigned long long bytesPerFrame)
+{
+	g_UploadBudgetBytes = bytesPerFrame;
+}
+
+int Texture_GetResidentCount()
+{
+	return g_Registry.Count();
+}
+
+unsigned long long Texture_GetResidentBytes()
+{
+	return g_Registry.TotalBytes();
 }
 
 //eNX`
@@ -141,3 +537,80 @@ unsigned int Texture_Height(int texid)
 	if (texid < 0)return 0;
 	return g_Textures[texid].height;
 }
+
+bool Texture_GetDesc(int texid, D3D11_TEXTURE2D_DESC* pDesc)
+{
+	if (texid < 0 || texid >= TEXTURE_MAX || !pDesc) return false;
+	if (!g_Textures[texid].pTexture) return false;
+
+	ID3D11Texture2D* pTexture = (ID3D11Texture2D*)g_Textures[texid].pTexture;
+	pTexture->GetDesc(pDesc);
+	return true;
+}
+
+ID3D11Resource* Texture_GetResource(int texid)
+{
+	if (texid < 0 || texid >= TEXTURE_MAX) return nullptr;
+	return g_Textures[texid].pTexture;
+}
+
+//eNX`z
+//GPUŃXCXƁE~bvƂɃRs[̂ŉ摜ǂݒ͂Ȃ
+ID3D11ShaderResourceView* Texture_CreateArray(const int* texIds, int count)
+{
+	if (!texIds || count <= 0 || count > D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION) return nullptr;
+
+	D3D11_TEXTURE2D_DESC first{};
+	if (!Texture_GetDesc(texIds[0], &first)) return nullptr;
+
+	for (int i = 1; i < count; ++i) {
+		D3D11_TEXTURE2D_DESC d{};
+		if (!Texture_GetDesc(texIds[i], &d)) return nullptr;
+		if (d.Width != first.Width || d.Height != first.Height ||
+			d.Format != first.Format || d.MipLevels != first.MipLevels) {
+			hal::dout << "Texture_CreateArray() : 傫tH[}bg̈ႤeNX`Ă܂" << std::endl;
+			return nullptr;
+		}
+	}
+
+	D3D11_TEXTURE2D_DESC desc = first;
+	desc.ArraySize = (UINT)count;
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	desc.CPUAccessFlags = 0;
+	desc.MiscFlags = 0; // ~bv͌̃eNX`Rs[̂ GENERATE_MIPS ͂Ȃ
+
+	ID3D11Texture2D* pArray = nullptr;
+	HRESULT hr = g_pDevice->CreateTexture2D(&desc, nullptr, &pArray);
+	if (FAILED(hr)) {
+		hal::dout << "Texture_CreateArray() : eNX`z̍쐬Ɏs܂" << std::endl;
+		return nullptr;
+	}
+
+	for (int i = 0; i < count; ++i) {
+		for (UINT mip = 0; mip < desc.MipLevels; ++mip) {
+			g_pContext->CopySubresourceRegion(
+				pArray, D3D11CalcSubresource(mip, (UINT)i, desc.MipLevels), 0, 0, 0,
+				g_Textures[texIds[i]].pTexture, D3D11CalcSubresource(mip, 0, first.MipLevels), nullptr);
+		}
+	}
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc{};
+	srvDesc.Format = desc.Format;
+	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+	srvDesc.Texture2DArray.MostDetailedMip = 0;
+	srvDesc.Texture2DArray.MipLevels = desc.MipLevels;
+	srvDesc.Texture2DArray.FirstArraySlice = 0;
+	srvDesc.Texture2DArray.ArraySize = desc.ArraySize;
+
+	ID3D11ShaderResourceView* pView = nullptr;
+	hr = g_pDevice->CreateShaderResourceView(pArray, &srvDesc, &pView);
+	SAFE_RELEASE(pArray); // r[QƂ
+
+	if (FAILED(hr)) {
+		hal::dout << "Texture_CreateArray() : eNX`z̃r[쐬Ɏs܂" << std::endl;
+		return nullptr;
+	}
+
+	return pView;
+}
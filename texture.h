@@ -21,16 +21,57 @@ void Texture_Finalize(void);
 // eNX`摜̓ǂݍ
 //
 // ߂lFǗԍBǂݍ߂Ȃꍇ-1B
+// ̉摜̂܂ RGBA8 œǂށicooked/ ̃LbV͌ȂjB
+// XvCgEUI ͂œǂށiSpriteAtlas_Add  RGBA8 󂯕tȂj
 //
 int Texture_Load(const wchar_t* pFilename);
 
+// QƐ𑝂₷^炷BTexture_Load 1ɂ Texture_Release 1B
+// Ō̎QƂOꂽeNX`͉AǗԍ͎̓ǂݍ݂Ŏg񂳂
+int  Texture_AddRef(int texid);
+void Texture_Release(int texid);
+
+// Ǘԍ󂫂ɖ߂ƂiŌ Texture_ReleaseETexture_AllReleasejɁAGPU ̃\[X
+// ̂ĂŌĂ΂iAllRelease ͔ԍ̏jBԍɕRÂiAgẌʒuȂǁj
+// ̂Ă̂ɎgBnullptr ŊO
+typedef void (*TextureReleaseFunc)(int texid);
+void Texture_SetReleaseCallback(TextureReleaseFunc func);
+
+// 񓯊ŁBǗԍ͂ԂAWJI܂ł 1x1 ̔\
+// iTexture_Width/Height ͂܂ł 1jB Texture_Release œ
+// cooked/ ɕϊς݁iBC1/BC3 + ~bvĵ̂΂̏œǂށBȂΓWĴł
+// ϊăLbVɏBBC ɂȂ邱Ƃ̂ŁAXe[W⃂f̖ʂɓ\̂ɎgB
+// t@Cǂݍݍς݂Ȃǂ̊֐łԂi`͍ŏɓǂ񂾕̂܂܁j
+int Texture_LoadAsync(const wchar_t* pFilename);
+
+// t[ĂԁBWJ̏I摜A1t[̗\Z̕ GPU ֑čւ
+void Texture_Update();
+// ܂̃eNX`̂܂܂
+bool Texture_IsPending(int texid);
+int  Texture_GetPendingCount();
+// 1t[ GPU ֑oCg̖ڈi 8MBBŏ1͒Ăj
+void Texture_SetUploadBudget(unsigned long long bytesPerFrame);
+
 void Texture_AllRelease();
 
+// ǂݍ܂Ă閇ƁA~bv݂̎gpoCgiςj
+int Texture_GetResidentCount();
+unsigned long long Texture_GetResidentBytes();
+
 void Texture_SetTexture(int texid, int slot = 0);
 //eNX`[̕
 unsigned int Texture_Width(int texid);
 unsigned int Texture_Height(int texid);
 
+// ǂݍ񂾃eNX`̏ڍׁitH[}bg~bvjBȔԍȂ false
+bool Texture_GetDesc(int texid, D3D11_TEXTURE2D_DESC* pDesc);
+// Rs[ƂĎg\[XiQƃJEg͑₳ȂjBȔԍȂ nullptr
+ID3D11Resource* Texture_GetResource(int texid);
+
+// EEtH[}bgE~bṽeNX`ׂ Texture2DArray փRs[
+// ߂l̃r[͌Ăяo Release BȂ nullptr
+ID3D11ShaderResourceView* Texture_CreateArray(const int* texIds, int count);
+
 /*Texture_Initialize(...)FeNX`Ǘ̏BfoCXۑB
 
 Texture_Finalize()FׂẴeNX`B
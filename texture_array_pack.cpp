@@ -0,0 +1,87 @@
+/*==============================================================================
+
+@@@eNX`zւ̋lߕ[texture_array_pack.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "texture_array_pack.h"
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+    bool SameShape(const TextureArrayGroup& g, const TextureArrayImage& img)
+    {
+        return g.width == img.width && g.height == img.height &&
+            g.format == img.format && g.mipLevels == img.mipLevels;
+    }
+}
+
+void TextureArrayPack_Plan(const TextureArrayImage* images, int count,
+    int minSlices, int maxSlices, TextureArrayPlan* out)
+{
+    if (!out) return;
+
+    out->groups.clear();
+    out->group.assign(count > 0 ? count : 0, -1);
+    out->slice.assign(count > 0 ? count : 0, -1);
+    if (!images || count <= 0) return;
+
+    if (minSlices < 1) minSlices = 1;
+
+    // `ƂɏW߂ioĂj
+    std::vector<TextureArrayGroup> candidates;
+    for (int i = 0; i < count; ++i)
+    {
+        const TextureArrayImage& img = images[i];
+        if (img.id < 0 || img.width == 0 || img.height == 0) continue;
+
+        auto it = std::find_if(candidates.begin(), candidates.end(),
+            [&](const TextureArrayGroup& g) { return SameShape(g, img); });
+        if (it == candidates.end())
+        {
+            candidates.push_back({ img.width, img.height, img.format, img.mipLevels, {} });
+            it = candidates.end() - 1;
+        }
+
+        if (std::find(it->ids.begin(), it->ids.end(), img.id) != it->ids.end()) continue;
+        if (maxSlices > 0 && (int)it->ids.size() >= maxSlices) continue;
+        it->ids.push_back(img.id);
+    }
+
+    // ̑BȂoĂ̂܂
+    std::vector<int> order(candidates.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b)
+        {
+            return candidates[a].ids.size() > candidates[b].ids.size();
+        });
+
+    for (int c : order)
+    {
+        if ((int)candidates[c].ids.size() < minSlices) break;
+        out->groups.push_back(std::move(candidates[c]));
+    }
+
+    // 摜Ƃ (O[v, XCX)
+    for (int i = 0; i < count; ++i)
+    {
+        const TextureArrayImage& img = images[i];
+        if (img.id < 0) continue;
+
+        for (int g = 0; g < (int)out->groups.size(); ++g)
+        {
+            const TextureArrayGroup& grp = out->groups[g];
+            if (!SameShape(grp, img)) continue;
+
+            auto it = std::find(grp.ids.begin(), grp.ids.end(), img.id);
+            if (it == grp.ids.end()) break; // ňꂽ
+
+            out->group[i] = g;
+            out->slice[i] = (int)(it - grp.ids.begin());
+            break;
+        }
+    }
+}
@@ -0,0 +1,51 @@
+/*==============================================================================
+
+@@@eNX`zւ̋lߕ[texture_array_pack.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    EEtH[}bgE~bv摜1 Texture2DArray 
+    ܂Ƃ߂邽߂̊蓖Ă߂B摜̂̂ɂ͐GȂ̂ŁA
+    D3D ȂłiTextureArrayImagejׂ邾Ōʂm߂B
+
+     id ̉摜͓XCXLieNX`𕡐̃Xbg
+    gĂƂjBid ̉摜͂ǂ̃O[vɂȂB
+
+==============================================================================*/
+#ifndef TEXTURE_ARRAY_PACK_H
+#define TEXTURE_ARRAY_PACK_H
+
+#include <vector>
+
+struct TextureArrayImage
+{
+    int          id;        // eNX`̊ǗԍȂǁBȂǂݍݎsƂĔ΂
+    unsigned int width;
+    unsigned int height;
+    unsigned int format;    // DXGI_FORMAT
+    unsigned int mipLevels;
+};
+
+struct TextureArrayGroup
+{
+    unsigned int width;
+    unsigned int height;
+    unsigned int format;
+    unsigned int mipLevels;
+    std::vector<int> ids;   // XCX ididȂj
+};
+
+struct TextureArrayPlan
+{
+    std::vector<TextureArrayGroup> groups; // 傫iȂɏoĂj
+    std::vector<int> group;                // 摜Ƃ̃O[vԍBȂ -1
+    std::vector<int> slice;                // 摜Ƃ̃XCXԍBȂ -1
+};
+
+// minSlices W܂ȂO[v͍ȂiP̂̃eNX`̂܂܁j
+// maxSlices 𒴂ȂiD3D11  2048 ܂Łj
+void TextureArrayPack_Plan(const TextureArrayImage* images, int count,
+    int minSlices, int maxSlices, TextureArrayPlan* out);
+
+#endif // TEXTURE_ARRAY_PACK_H
@@ -0,0 +1,211 @@
+/*==============================================================================
+
+@@@eNX`zւ̋lߕ̃`FbN[texture_array_pack_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D Ȃőg߂B
+        g++ -std=c++17 texture_array_pack_test.cpp texture_array_pack.cpp
+    `Ƃ̃O[vA id ̃XCXLAƍŏAяA
+     (O[v, XCX) 猳 id 邱ƁiVF[_[ UV 
+    ̂܂܂ float3(uv, slice) ̂ŁAƕʂ̊GɂȂjB
+
+==============================================================================*/
+#include "texture_array_pack.h"
+#include "test_check.h"
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace
+{
+    constexpr unsigned RGBA8 = 28;  // DXGI_FORMAT_R8G8B8A8_UNORM
+    constexpr unsigned BC1 = 71;    // DXGI_FORMAT_BC1_UNORM
+
+    bool SameShape(const TextureArrayGroup& g, const TextureArrayImage& img)
+    {
+        return g.width == img.width && g.height == img.height &&
+            g.format == img.format && g.mipLevels == img.mipLevels;
+    }
+
+    // ǂ̌ʂł藧
+    bool CheckPlan(const TextureArrayImage* images, int count, int minSlices, int maxSlices,
+                   const TextureArrayPlan& plan)
+    {
+        if ((int)plan.group.size() != count || (int)plan.slice.size() != count) return false;
+
+        for (size_t g = 0; g < plan.groups.size(); ++g)
+        {
+            const TextureArrayGroup& grp = plan.groups[g];
+            if ((int)grp.ids.size() < minSlices) return false;
+            if (maxSlices > 0 && (int)grp.ids.size() > maxSlices) return false;
+            if (std::set<int>(grp.ids.begin(), grp.ids.end()).size() != grp.ids.size()) return false;
+            if (g > 0 && grp.ids.size() > plan.groups[g - 1].ids.size()) return false;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            const int g = plan.group[i];
+            const int s = plan.slice[i];
+            if ((g < 0) != (s < 0)) return false;
+            if (g < 0) continue;
+            if (g >= (int)plan.groups.size()) return false;
+
+            const TextureArrayGroup& grp = plan.groups[g];
+            if (s >= (int)grp.ids.size()) return false;
+            if (grp.ids[s] != images[i].id) return false;   // XCX猳̉摜ɖ߂
+            if (!SameShape(grp, images[i])) return false;
+        }
+
+        // O[vɓ id ́Ǎ`̉摜ׂĂœXCXɂȂĂ
+        for (int i = 0; i < count; ++i)
+        {
+            if (plan.group[i] >= 0 || images[i].id < 0) continue;
+            for (const TextureArrayGroup& grp : plan.groups)
+            {
+                if (!SameShape(grp, images[i])) continue;
+                for (int id : grp.ids)
+                {
+                    if (id == images[i].id) return false;   // Ă̂Ɋ蓖ĘR
+                }
+            }
+        }
+        return true;
+    }
+
+    uint32_t Next(uint32_t& state)
+    {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+}
+
+int main()
+{
+    // `̍Xe[WFԑ`擪A1̌`͂܂Ƃ߂ȂA id ƕ0͔΂
+    {
+        const TextureArrayImage images[] = {
+            { 10, 256, 256, RGBA8, 9 },
+            { 11, 128, 128, RGBA8, 8 },
+            { 12, 256, 256, RGBA8, 9 },
+            { -1, 256, 256, RGBA8, 9 },
+            { 13,  64,  64, RGBA8, 7 },
+            { 14, 128, 128, RGBA8, 8 },
+            { 15, 256, 256, RGBA8, 9 },
+            { 16,   0, 256, RGBA8, 9 },
+        };
+        const int count = (int)(sizeof(images) / sizeof(images[0]));
+        TextureArrayPlan plan;
+        TextureArrayPack_Plan(images, count, 2, 2048, &plan);
+
+        TestCheck_True(CheckPlan(images, count, 2, 2048, plan), "mixed: plan invariants");
+        TestCheck_True(plan.groups.size() == 2 && plan.groups[0].width == 256 && plan.groups[1].width == 128,
+                       "mixed: biggest group first, single-image shape left out");
+        TestCheck_True(plan.groups[0].ids == std::vector<int>({ 10, 12, 15 }) &&
+                       plan.groups[1].ids == std::vector<int>({ 11, 14 }), "mixed: slices in first-seen order");
+        const int expectGroup[] = { 0, 1, 0, -1, -1, 1, 0, -1 };
+        const int expectSlice[] = { 0, 0, 1, -1, -1, 1, 2, -1 };
+        bool ok = true;
+        for (int i = 0; i < count; ++i) ok = ok && plan.group[i] == expectGroup[i] && plan.slice[i] == expectSlice[i];
+        TestCheck_True(ok, "mixed: per-image group and slice");
+    }
+
+    // eNX`𕡐̃XbgŎgFXCX1L
+    {
+        const TextureArrayImage images[] = {
+            { 3, 128, 128, RGBA8, 8 },
+            { 4, 128, 128, RGBA8, 8 },
+            { 3, 128, 128, RGBA8, 8 },
+            { 3, 128, 128, RGBA8, 8 },
+        };
+        TextureArrayPlan plan;
+        TextureArrayPack_Plan(images, 4, 2, 2048, &plan);
+        TestCheck_True(CheckPlan(images, 4, 2, 2048, plan), "shared id: plan invariants");
+        TestCheck_True(plan.groups.size() == 1 && plan.groups[0].ids.size() == 2 &&
+                       plan.slice[0] == 0 && plan.slice[2] == 0 && plan.slice[3] == 0 && plan.slice[1] == 1,
+                       "shared id: one slice for all uses");
+
+        // 2 id Ȃ̂ŁAŏ3ȂȂ
+        TextureArrayPack_Plan(images, 4, 3, 2048, &plan);
+        TestCheck_True(plan.groups.empty() && plan.group[0] == -1 && plan.slice[2] == -1,
+                       "shared id: duplicates do not count towards minSlices");
+    }
+
+    // 傫łtH[}bg~bvႦΕʂ̃O[v
+    {
+        const TextureArrayImage images[] = {
+            { 1, 256, 256, RGBA8, 9 },
+            { 2, 256, 256, BC1, 9 },
+            { 3, 256, 256, RGBA8, 1 },
+            { 4, 256, 256, BC1, 9 },
+            { 5, 256, 256, RGBA8, 9 },
+            { 6, 256, 256, RGBA8, 1 },
+        };
+        TextureArrayPlan plan;
+        TextureArrayPack_Plan(images, 6, 2, 2048, &plan);
+        TestCheck_True(CheckPlan(images, 6, 2, 2048, plan), "format/mips: plan invariants");
+        TestCheck_True(plan.groups.size() == 3 &&
+                       plan.groups[0].ids == std::vector<int>({ 1, 5 }) &&
+                       plan.groups[1].ids == std::vector<int>({ 2, 4 }) &&
+                       plan.groups[2].ids == std::vector<int>({ 3, 6 }),
+                       "format/mips: split by format and mip count, ties keep first-seen order");
+    }
+
+    // 𒴂͌ʂ̂܂
+    {
+        std::vector<TextureArrayImage> images;
+        for (int i = 0; i < 5; ++i) images.push_back({ 100 + i, 64, 64, RGBA8, 7 });
+        TextureArrayPlan plan;
+        TextureArrayPack_Plan(images.data(), 5, 2, 3, &plan);
+        TestCheck_True(CheckPlan(images.data(), 5, 2, 3, plan), "maxSlices: plan invariants");
+        TestCheck_True(plan.groups.size() == 1 && plan.groups[0].ids.size() == 3 &&
+                       plan.slice[2] == 2 && plan.group[3] == -1 && plan.group[4] == -1,
+                       "maxSlices: overflow images stay single");
+    }
+
+    // ̓
+    {
+        TextureArrayPlan plan;
+        plan.groups.push_back({});
+        TextureArrayPack_Plan(nullptr, 3, 2, 2048, &plan);
+        TestCheck_True(plan.groups.empty() && plan.group.size() == 3 && plan.slice[1] == -1,
+                       "null images: everything unassigned");
+    }
+
+    // ŕׂ摜ŁAǂ̐ݒł藧
+    {
+        const unsigned sizes[] = { 64, 128, 256 };
+        const unsigned formats[] = { RGBA8, BC1 };
+        uint32_t state = 12345;
+        bool ok = true;
+        for (int round = 0; round < 200; ++round)
+        {
+            const int count = 1 + (int)(Next(state) % 300);
+            std::vector<TextureArrayImage> images(count);
+            for (TextureArrayImage& img : images)
+            {
+                img.id = (int)(Next(state) % 120) - 5;
+                img.width = sizes[Next(state) % 3];
+                img.height = img.width;
+                img.format = formats[Next(state) % 2];
+                img.mipLevels = 1 + Next(state) % 2;
+                //  id ͓摜Ȃ̂ŁA` id Ō߂
+                if (img.id >= 0)
+                {
+                    img.width = img.height = sizes[img.id % 3];
+                    img.format = formats[(img.id / 3) % 2];
+                    img.mipLevels = 1 + (img.id / 6) % 2;
+                }
+            }
+            const int minSlices = 1 + (int)(Next(state) % 4);
+            const int maxSlices = (round % 3 == 0) ? 0 : 1 + (int)(Next(state) % 12);
+            TextureArrayPlan plan;
+            TextureArrayPack_Plan(images.data(), count, minSlices, maxSlices, &plan);
+            ok = ok && CheckPlan(images.data(), count, minSlices, maxSlices, plan);
+        }
+        TestCheck_True(ok, "random: plan invariants over 200 inputs");
+    }
+
+    return TestCheck_Result();
+}
@@ -0,0 +1,518 @@
+/*==============================================================================
+
+@@@eNX`̎OϊiubNkj[texture_cook.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    BC1 ̐F́A16 f̎听̗̎[o_ɂāA
+    蓖āi0/1/2/3jŒ肵ŏŒ[_2lߒA덷̈ԏ̂gB
+    At@iBC3j͍ŏEő[_ɂ 8 iKB
+
+==============================================================================*/
+#include "texture_cook.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    //=====565 Ƃ̕ϊ=====
+    uint16_t Pack565(const float* c)
+    {
+        const int r = std::clamp((int)std::lround(c[0] * 31.0f / 255.0f), 0, 31);
+        const int g = std::clamp((int)std::lround(c[1] * 63.0f / 255.0f), 0, 63);
+        const int b = std::clamp((int)std::lround(c[2] * 31.0f / 255.0f), 0, 31);
+        return (uint16_t)((r << 11) | (g << 5) | b);
+    }
+
+    void Unpack565(uint16_t c, int* rgb)
+    {
+        const int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+        rgb[0] = (r << 3) | (r >> 2);
+        rgb[1] = (g << 2) | (g >> 4);
+        rgb[2] = (b << 3) | (b >> 2);
+    }
+
+    // 4F[h̃pbgi0 = c0, 1 = c1, 2 = 2/3 c0, 3 = 1/3 c0j
+    void Palette4(uint16_t c0, uint16_t c1, int palette[4][3])
+    {
+        Unpack565(c0, palette[0]);
+        Unpack565(c1, palette[1]);
+        for (int k = 0; k < 3; ++k) {
+            palette[2][k] = (2 * palette[0][k] + palette[1][k] + 1) / 3;
+            palette[3][k] = (palette[0][k] + 2 * palette[1][k] + 1) / 3;
+        }
+    }
+
+    // efɈԋ߂pbg蓖ĂB߂l͓덷̍v
+    int AssignIndices(const uint8_t* block, uint16_t c0, uint16_t c1, uint8_t* indices)
+    {
+        int palette[4][3];
+        Palette4(c0, c1, palette);
+
+        int total = 0;
+        for (int i = 0; i < 16; ++i) {
+            const uint8_t* p = block + i * 4;
+            int best = 0, bestErr = INT32_MAX;
+            for (int j = 0; j < 4; ++j) {
+                const int dr = p[0] - palette[j][0], dg = p[1] - palette[j][1], db = p[2] - palette[j][2];
+                const int err = dr * dr + dg * dg + db * db;
+                if (err < bestErr) { bestErr = err; best = j; }
+            }
+            indices[i] = (uint8_t)best;
+            total += bestErr;
+        }
+        return total;
+    }
+
+    // 蓖ĂŒ肵āA[_ŏŋߒBȂ false
+    bool RefineEndpoints(const uint8_t* block, const uint8_t* indices, float* e0, float* e1)
+    {
+        static const float kWeight[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+
+        float aa = 0, ab = 0, bb = 0;
+        float ax[3] = {}, bx[3] = {};
+        for (int i = 0; i < 16; ++i) {
+            const float a = kWeight[indices[i]], b = 1.0f - a;
+            aa += a * a; ab += a * b; bb += b * b;
+            for (int k = 0; k < 3; ++k) {
+                ax[k] += a * block[i * 4 + k];
+                bx[k] += b * block[i * 4 + k];
+            }
+        }
+
+        const float det = aa * bb - ab * ab;
+        if (std::fabs(det) < 1e-6f) return false;
+
+        const float inv = 1.0f / det;
+        for (int k = 0; k < 3; ++k) {
+            e0[k] = std::clamp((ax[k] * bb - bx[k] * ab) * inv, 0.0f, 255.0f);
+            e1[k] = std::clamp((bx[k] * aa - ax[k] * ab) * inv, 0.0f, 255.0f);
+        }
+        return true;
+    }
+
+    // [_̏lF听̎ɓe[
+    void PrincipalEndpoints(const uint8_t* block, float* e0, float* e1)
+    {
+        float mean[3] = {}, lo[3] = { 255, 255, 255 }, hi[3] = {};
+        for (int i = 0; i < 16; ++i) {
+            for (int k = 0; k < 3; ++k) {
+                const float v = block[i * 4 + k];
+                mean[k] += v;
+                lo[k] = std::min(lo[k], v);
+                hi[k] = std::max(hi[k], v);
+            }
+        }
+        for (float& m : mean) m /= 16.0f;
+
+        float cov[6] = {}; // rr rg rb gg gb bb
+        for (int i = 0; i < 16; ++i) {
+            const float r = block[i * 4 + 0] - mean[0];
+            const float g = block[i * 4 + 1] - mean[1];
+            const float b = block[i * 4 + 2] - mean[2];
+            cov[0] += r * r; cov[1] += r * g; cov[2] += r * b;
+            cov[3] += g * g; cov[4] += g * b; cov[5] += b * b;
+        }
+
+        // ׂ@io_͐F͈̔͂̑Ίpj
+        float axis[3] = { hi[0] - lo[0], hi[1] - lo[1], hi[2] - lo[2] };
+        for (int it = 0; it < 8; ++it) {
+            const float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+            const float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+            const float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+            const float len = std::max(std::max(std::fabs(x), std::fabs(y)), std::fabs(z));
+            if (len < 1e-6f) break;
+            axis[0] = x / len; axis[1] = y / len; axis[2] = z / len;
+        }
+        const float len2 = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+        if (len2 < 1e-12f) {
+            for (int k = 0; k < 3; ++k) e0[k] = e1[k] = mean[k];
+            return;
+        }
+
+        float tMin = FLT_MAX, tMax = -FLT_MAX;
+        for (int i = 0; i < 16; ++i) {
+            const float t = (block[i * 4 + 0] - mean[0]) * axis[0]
+                + (block[i * 4 + 1] - mean[1]) * axis[1]
+                + (block[i * 4 + 2] - mean[2]) * axis[2];
+            tMin = std::min(tMin, t);
+            tMax = std::max(tMax, t);
+        }
+        for (int k = 0; k < 3; ++k) {
+            e0[k] = std::clamp(mean[k] + axis[k] * tMax / len2, 0.0f, 255.0f);
+            e1[k] = std::clamp(mean[k] + axis[k] * tMin / len2, 0.0f, 255.0f);
+        }
+    }
+
+    void WriteColorBlock(uint16_t c0, uint16_t c1, const uint8_t* indices, uint8_t* out)
+    {
+        uint32_t bits = 0;
+        if (c0 < c1) {
+            // 4F[h c0 > c1 Bւ 0<->1, 2<->3 ɂȂ
+            std::swap(c0, c1);
+            for (int i = 0; i < 16; ++i) bits |= (uint32_t)(indices[i] ^ 1) << (i * 2);
+        }
+        else if (c0 != c1) {
+            for (int i = 0; i < 16; ++i) bits |= (uint32_t)indices[i] << (i * 2);
+        }
+        // c0 == c1 ȂS 0iPFj
+
+        out[0] = (uint8_t)(c0 & 0xff); out[1] = (uint8_t)(c0 >> 8);
+        out[2] = (uint8_t)(c1 & 0xff); out[3] = (uint8_t)(c1 >> 8);
+        for (int k = 0; k < 4; ++k) out[4 + k] = (uint8_t)(bits >> (k * 8));
+    }
+
+    void EncodeColor(const uint8_t* block, uint8_t* out)
+    {
+        float e0[3], e1[3];
+        PrincipalEndpoints(block, e0, e1);
+
+        uint16_t bestC0 = Pack565(e0), bestC1 = Pack565(e1);
+        uint8_t best[16];
+        int bestErr = AssignIndices(block, bestC0, bestC1, best);
+
+        uint8_t indices[16];
+        std::memcpy(indices, best, sizeof(indices));
+        for (int it = 0; it < 2 && bestErr > 0; ++it) {
+            if (!RefineEndpoints(block, indices, e0, e1)) break;
+
+            const uint16_t c0 = Pack565(e0), c1 = Pack565(e1);
+            const int err = AssignIndices(block, c0, c1, indices);
+            if (err >= bestErr) break;
+
+            bestErr = err;
+            bestC0 = c0; bestC1 = c1;
+            std::memcpy(best, indices, sizeof(best));
+        }
+
+        WriteColorBlock(bestC0, bestC1, best, out);
+    }
+
+    void EncodeAlpha(const uint8_t* block, uint8_t* out)
+    {
+        uint8_t lo = 255, hi = 0;
+        for (int i = 0; i < 16; ++i) {
+            lo = std::min(lo, block[i * 4 + 3]);
+            hi = std::max(hi, block[i * 4 + 3]);
+        }
+
+        out[0] = hi;
+        out[1] = lo;
+        std::memset(out + 2, 0, 6);
+        if (hi == lo) return;
+
+        // 8iK[hia0 > a1j: 0 = a0, 1 = a1, 2..7 = 
+        int palette[8] = { hi, lo };
+        for (int k = 1; k < 7; ++k) palette[k + 1] = ((7 - k) * hi + k * lo + 3) / 7;
+
+        uint64_t bits = 0;
+        for (int i = 0; i < 16; ++i) {
+            const int a = block[i * 4 + 3];
+            int best = 0, bestErr = INT32_MAX;
+            for (int j = 0; j < 8; ++j) {
+                const int err = std::abs(a - palette[j]);
+                if (err < bestErr) { bestErr = err; best = j; }
+            }
+            bits |= (uint64_t)best << (i * 3);
+        }
+        for (int k = 0; k < 6; ++k) out[2 + k] = (uint8_t)(bits >> (k * 8));
+    }
+
+    void DecodeColor(const uint8_t* in, uint8_t* block)
+    {
+        const uint16_t c0 = (uint16_t)(in[0] | (in[1] << 8));
+        const uint16_t c1 = (uint16_t)(in[2] | (in[3] << 8));
+        int palette[4][3];
+        Palette4(c0, c1, palette);
+        if (c0 <= c1) {
+            // 3F[hi2 = ԁA3 = j
+            for (int k = 0; k < 3; ++k) {
+                palette[2][k] = (palette[0][k] + palette[1][k]) / 2;
+                palette[3][k] = 0;
+            }
+        }
+
+        const uint32_t bits = in[4] | (in[5] << 8) | (in[6] << 16) | ((uint32_t)in[7] << 24);
+        for (int i = 0; i < 16; ++i) {
+            const int j = (bits >> (i * 2)) & 3;
+            block[i * 4 + 0] = (uint8_t)palette[j][0];
+            block[i * 4 + 1] = (uint8_t)palette[j][1];
+            block[i * 4 + 2] = (uint8_t)palette[j][2];
+        }
+    }
+
+    // 4x4 oi͂ݏo͒[̉fj
+    void FetchBlock(const uint8_t* rgba, uint32_t width, uint32_t height, uint32_t bx, uint32_t by, uint8_t* block)
+    {
+        for (uint32_t y = 0; y < 4; ++y) {
+            const uint32_t sy = std::min(by * 4 + y, height - 1);
+            for (uint32_t x = 0; x < 4; ++x) {
+                const uint32_t sx = std::min(bx * 4 + x, width - 1);
+                std::memcpy(block + (y * 4 + x) * 4, rgba + ((size_t)sy * width + sx) * 4, 4);
+            }
+        }
+    }
+
+    uint32_t BlockBytes(TextureCookFormat format)
+    {
+        return format == TEXTURE_COOK_BC1 ? 8u : 16u;
+    }
+
+    size_t LevelBytes(TextureCookFormat format, uint32_t width, uint32_t height)
+    {
+        if (format == TEXTURE_COOK_RGBA8) return (size_t)width * height * 4;
+        return (size_t)TextureCook_RowPitch(format, width) * std::max(1u, (height + 3) / 4);
+    }
+
+    //=====DDS=====
+    const uint32_t kDDSMagic = 0x20534444;     // "DDS "
+    const uint32_t kFourCCDXT1 = 0x31545844;   // "DXT1"
+    const uint32_t kFourCCDXT5 = 0x35545844;   // "DXT5"
+    const uint32_t kHeaderSize = 124;
+    const uint32_t kPixelFormatSize = 32;
+
+    void Put32(std::vector<uint8_t>* out, uint32_t v)
+    {
+        for (int k = 0; k < 4; ++k) out->push_back((uint8_t)(v >> (k * 8)));
+    }
+
+    uint32_t Get32(const uint8_t* p)
+    {
+        return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+}
+
+uint64_t TextureCook_Hash(const void* data, size_t size)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+std::wstring TextureCook_CachePath(const std::wstring& dir, uint64_t sourceHash)
+{
+    // ϊ̔łigς蒼j
+    const uint64_t key = sourceHash ^ ((uint64_t)TEXTURE_COOK_VERSION * 0x9E3779B97F4A7C15ull);
+
+    wchar_t name[17];
+    static const wchar_t kHex[] = L"0123456789abcdef";
+    for (int i = 0; i < 16; ++i) name[i] = kHex[(key >> ((15 - i) * 4)) & 15];
+    name[16] = L'\0';
+
+    std::wstring path = dir;
+    if (!path.empty() && path.back() != L'/' && path.back() != L'\\') path += L'/';
+    return path + name + L".dds";
+}
+
+uint32_t TextureCook_RowPitch(TextureCookFormat format, uint32_t width)
+{
+    if (format == TEXTURE_COOK_RGBA8) return width * 4;
+    return std::max(1u, (width + 3) / 4) * BlockBytes(format);
+}
+
+void TextureCook_GenerateMips(const uint8_t* rgba, uint32_t width, uint32_t height,
+    std::vector<TextureCookLevel>* levels)
+{
+    levels->clear();
+    if (!rgba || width == 0 || height == 0) return;
+
+    TextureCookLevel top;
+    top.width = width;
+    top.height = height;
+    top.data.assign(rgba, rgba + (size_t)width * height * 4);
+    levels->push_back(std::move(top));
+
+    while (levels->back().width > 1 || levels->back().height > 1) {
+        const TextureCookLevel& src = levels->back();
+        TextureCookLevel dst;
+        dst.width = std::max(1u, src.width / 2);
+        dst.height = std::max(1u, src.height / 2);
+        dst.data.resize((size_t)dst.width * dst.height * 4);
+
+        for (uint32_t y = 0; y < dst.height; ++y) {
+            const uint32_t y0 = std::min(y * 2, src.height - 1), y1 = std::min(y * 2 + 1, src.height - 1);
+            for (uint32_t x = 0; x < dst.width; ++x) {
+                const uint32_t x0 = std::min(x * 2, src.width - 1), x1 = std::min(x * 2 + 1, src.width - 1);
+                const uint8_t* a = &src.data[((size_t)y0 * src.width + x0) * 4];
+                const uint8_t* b = &src.data[((size_t)y0 * src.width + x1) * 4];
+                const uint8_t* c = &src.data[((size_t)y1 * src.width + x0) * 4];
+                const uint8_t* d = &src.data[((size_t)y1 * src.width + x1) * 4];
+                uint8_t* o = &dst.data[((size_t)y * dst.width + x) * 4];
+                for (int k = 0; k < 4; ++k) o[k] = (uint8_t)((a[k] + b[k] + c[k] + d[k] + 2) / 4);
+            }
+        }
+        levels->push_back(std::move(dst));
+    }
+}
+
+bool TextureCook_HasAlpha(const uint8_t* rgba, size_t pixelCount)
+{
+    for (size_t i = 0; i < pixelCount; ++i) {
+        if (rgba[i * 4 + 3] != 255) return true;
+    }
+    return false;
+}
+
+void TextureCook_EncodeBC1Block(const uint8_t* block, uint8_t* out8)
+{
+    EncodeColor(block, out8);
+}
+
+void TextureCook_EncodeBC3Block(const uint8_t* block, uint8_t* out16)
+{
+    EncodeAlpha(block, out16);
+    EncodeColor(block, out16 + 8);
+}
+
+void TextureCook_DecodeBC1Block(const uint8_t* in8, uint8_t* block)
+{
+    DecodeColor(in8, block);
+    for (int i = 0; i < 16; ++i) block[i * 4 + 3] = 255;
+}
+
+void TextureCook_DecodeBC3Block(const uint8_t* in16, uint8_t* block)
+{
+    DecodeColor(in16 + 8, block);
+
+    const int a0 = in16[0], a1 = in16[1];
+    int palette[8] = { a0, a1 };
+    if (a0 > a1) {
+        for (int k = 1; k < 7; ++k) palette[k + 1] = ((7 - k) * a0 + k * a1 + 3) / 7;
+    }
+    else {
+        for (int k = 1; k < 5; ++k) palette[k + 1] = ((5 - k) * a0 + k * a1 + 2) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    uint64_t bits = 0;
+    for (int k = 0; k < 6; ++k) bits |= (uint64_t)in16[2 + k] << (k * 8);
+    for (int i = 0; i < 16; ++i) block[i * 4 + 3] = (uint8_t)palette[(bits >> (i * 3)) & 7];
+}
+
+void TextureCook_Compress(const uint8_t* rgba, uint32_t width, uint32_t height,
+    TextureCookFormat format, std::vector<uint8_t>* out)
+{
+    out->clear();
+    if (!rgba || width == 0 || height == 0) return;
+
+    if (format == TEXTURE_COOK_RGBA8) {
+        out->assign(rgba, rgba + (size_t)width * height * 4);
+        return;
+    }
+
+    const uint32_t bw = (width + 3) / 4, bh = (height + 3) / 4;
+    const uint32_t blockBytes = BlockBytes(format);
+    out->resize((size_t)bw * bh * blockBytes);
+
+    uint8_t block[64];
+    for (uint32_t by = 0; by < bh; ++by) {
+        for (uint32_t bx = 0; bx < bw; ++bx) {
+            FetchBlock(rgba, width, height, bx, by, block);
+            uint8_t* dst = out->data() + ((size_t)by * bw + bx) * blockBytes;
+            if (format == TEXTURE_COOK_BC1) TextureCook_EncodeBC1Block(block, dst);
+            else TextureCook_EncodeBC3Block(block, dst);
+        }
+    }
+}
+
+bool TextureCook_Cook(const uint8_t* rgba, uint32_t width, uint32_t height, TextureCookImage* out)
+{
+    if (!rgba || width == 0 || height == 0) return false;
+    if (width % 4 != 0 || height % 4 != 0) return false;
+
+    out->format = TextureCook_HasAlpha(rgba, (size_t)width * height) ? TEXTURE_COOK_BC3 : TEXTURE_COOK_BC1;
+    TextureCook_GenerateMips(rgba, width, height, &out->levels);
+    for (TextureCookLevel& level : out->levels) {
+        std::vector<uint8_t> blocks;
+        TextureCook_Compress(level.data.data(), level.width, level.height, out->format, &blocks);
+        level.data.swap(blocks);
+    }
+    return true;
+}
+
+bool TextureCook_WriteDDS(const TextureCookImage& image, std::vector<uint8_t>* out)
+{
+    out->clear();
+    if (image.levels.empty()) return false;
+    if (image.format != TEXTURE_COOK_BC1 && image.format != TEXTURE_COOK_BC3) return false;
+
+    const TextureCookLevel& top = image.levels[0];
+    size_t total = 0;
+    for (const TextureCookLevel& level : image.levels) total += level.data.size();
+    out->reserve(4 + kHeaderSize + total);
+
+    Put32(out, kDDSMagic);
+    Put32(out, kHeaderSize);
+    Put32(out, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | 0x80000); // CAPS HEIGHT WIDTH PIXELFORMAT MIPMAPCOUNT LINEARSIZE
+    Put32(out, top.height);
+    Put32(out, top.width);
+    Put32(out, (uint32_t)top.data.size());
+    Put32(out, 0); // depth
+    Put32(out, (uint32_t)image.levels.size());
+    for (int i = 0; i < 11; ++i) Put32(out, 0);
+
+    Put32(out, kPixelFormatSize);
+    Put32(out, 0x4); // FOURCC
+    Put32(out, image.format == TEXTURE_COOK_BC1 ? kFourCCDXT1 : kFourCCDXT5);
+    for (int i = 0; i < 5; ++i) Put32(out, 0);
+
+    Put32(out, 0x1000 | 0x8 | 0x400000); // TEXTURE COMPLEX MIPMAP
+    for (int i = 0; i < 4; ++i) Put32(out, 0);
+
+    for (const TextureCookLevel& level : image.levels) {
+        out->insert(out->end(), level.data.begin(), level.data.end());
+    }
+    return true;
+}
+
+bool TextureCook_ReadDDS(const uint8_t* data, size_t size, TextureCookImage* out)
+{
+    if (!data || size < 4 + kHeaderSize) return false;
+    if (Get32(data) != kDDSMagic || Get32(data + 4) != kHeaderSize) return false;
+
+    const uint8_t* h = data + 4;
+    const uint32_t height = Get32(h + 8);
+    const uint32_t width = Get32(h + 12);
+    const uint32_t mipCount = std::max(1u, Get32(h + 24));
+    const uint32_t fourCC = Get32(h + 72 + 8);
+    if (Get32(h + 72) != kPixelFormatSize || !(Get32(h + 72 + 4) & 0x4)) return false;
+    if (width == 0 || height == 0 || mipCount > 32) return false;
+
+    TextureCookFormat format;
+    if (fourCC == kFourCCDXT1) format = TEXTURE_COOK_BC1;
+    else if (fourCC == kFourCCDXT5) format = TEXTURE_COOK_BC3;
+    else return false;
+
+    out->format = format;
+    out->levels.clear();
+
+    size_t offset = 4 + kHeaderSize;
+    uint32_t w = width, hgt = height;
+    for (uint32_t i = 0; i < mipCount; ++i) {
+        const size_t bytes = LevelBytes(format, w, hgt);
+        if (offset + bytes > size) {
+            out->levels.clear();
+            return false;
+        }
+
+        TextureCookLevel level;
+        level.width = w;
+        level.height = hgt;
+        level.data.assign(data + offset, data + offset + bytes);
+        out->levels.push_back(std::move(level));
+
+        offset += bytes;
+        w = std::max(1u, w / 2);
+        hgt = std::max(1u, hgt / 2);
+    }
+    return true;
+}
@@ -0,0 +1,82 @@
+/*==============================================================================
+
+@@@eNX`̎OϊiubNkj[texture_cook.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    PNG/JPG WJ RGBA8 A~bv BC1isj/ BC3ij
+    ɈkADDS ƂďoBǂݍݑ DDS ̂܂ GPU ֑邾Ȃ̂ŁA
+    񂩂͓WJ~bv쐬v炸AVRAM  1/8iBC1j 1/4iBC3jōςށB
+
+    LbṼt@C͌摜̒g̃nbViTextureCook_CachePathjB
+    摜ւΖOς̂ŁAÂLbVgĂ܂Ƃ͂ȂB
+
+    CPU ŊiD3D ɈˑȂjB
+
+==============================================================================*/
+#ifndef TEXTURE_COOK_H
+#define TEXTURE_COOK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum TextureCookFormat
+{
+    TEXTURE_COOK_RGBA8, // ~bv쐬̂݁ikOj
+    TEXTURE_COOK_BC1,   // 4x4 ubN 8 oCgBAt@Ȃ
+    TEXTURE_COOK_BC3,   // 4x4 ubN 16 oCgBAt@ BC4 
+};
+
+struct TextureCookLevel
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<uint8_t> data; // RGBA8 ̉fAkubN̕
+};
+
+struct TextureCookImage
+{
+    TextureCookFormat format = TEXTURE_COOK_RGBA8;
+    std::vector<TextureCookLevel> levels; // [0] ̑傫
+};
+
+// ϊ̒gςグiLbV̖Oɍj
+static const uint32_t TEXTURE_COOK_VERSION = 1;
+
+// g̃nbViFNV-1a 64bitj
+uint64_t TextureCook_Hash(const void* data, size_t size);
+// LbṼt@Cidir/0123456789abcdef.ddsj
+std::wstring TextureCook_CachePath(const std::wstring& dir, uint64_t sourceHash);
+
+// 1Ci1̃ubNj̃oCg
+uint32_t TextureCook_RowPitch(TextureCookFormat format, uint32_t width);
+
+// RGBA8  1x1 ܂ł̃~bvi2x2 ̕ρB̕ӂ͒[JԂj
+void TextureCook_GenerateMips(const uint8_t* rgba, uint32_t width, uint32_t height,
+    std::vector<TextureCookLevel>* levels);
+
+// At@ 255 łȂf邩
+bool TextureCook_HasAlpha(const uint8_t* rgba, size_t pixelCount);
+
+// 4x4 fiRGBA8AsD 64 oCgj 1 ubNɈk^WJ
+void TextureCook_EncodeBC1Block(const uint8_t* block, uint8_t* out8);
+void TextureCook_EncodeBC3Block(const uint8_t* block, uint8_t* out16);
+void TextureCook_DecodeBC1Block(const uint8_t* in8, uint8_t* block);
+void TextureCook_DecodeBC3Block(const uint8_t* in16, uint8_t* block);
+
+// 1Ԃki4 ̔{łȂӂ͒[̉fJԂĖ߂j
+void TextureCook_Compress(const uint8_t* rgba, uint32_t width, uint32_t height,
+    TextureCookFormat format, std::vector<uint8_t>* out);
+
+// ~bvĈkBAt@ BC3AȂ BC1
+// E 4 ̔{łȂ̂ D3D11  BC eNX`ɂłȂ̂ false
+bool TextureCook_Cook(const uint8_t* rgba, uint32_t width, uint32_t height, TextureCookImage* out);
+
+// DDSiDXT1/DXT5jƂďo^ǂݍށB̂ BC1/BC3 ̂
+bool TextureCook_WriteDDS(const TextureCookImage& image, std::vector<uint8_t>* out);
+bool TextureCook_ReadDDS(const uint8_t* data, size_t size, TextureCookImage* out);
+
+#endif//TEXTURE_COOK_H
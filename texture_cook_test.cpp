@@ -0,0 +1,247 @@
+/*==============================================================================
+
+@@@eNX`ϊ̃`FbN[texture_cook_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D Ȃőg߂B
+        g++ -std=c++17 -O2 texture_cook_test.cpp texture_cook.cpp
+    蕨̉摜 BC1/BC3 ɈkĖ߂APSNR ȂƁA
+    DDS ɏēǂݖ߂ƓɂȂ邱ƁALbṼnbVB
+
+==============================================================================*/
+#include "texture_cook.h"
+#include "test_check.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t kSize = 256;
+
+    // Ȃ߂炩ȕω
+    std::vector<uint8_t> Gradient(uint32_t w, uint32_t h)
+    {
+        std::vector<uint8_t> rgba(w * h * 4);
+        for (uint32_t y = 0; y < h; ++y) {
+            for (uint32_t x = 0; x < w; ++x) {
+                uint8_t* p = &rgba[(y * w + x) * 4];
+                p[0] = (uint8_t)(x * 255 / (w - 1));
+                p[1] = (uint8_t)(y * 255 / (h - 1));
+                p[2] = (uint8_t)((x + y) * 255 / (w + h - 2));
+                p[3] = 255;
+            }
+        }
+        return rgba;
+    }
+
+    // Ȃ߂炩ȕωɍׂmCYiBC1 ̋Ȃ́j
+    std::vector<uint8_t> NoisyGradient(uint32_t w, uint32_t h)
+    {
+        std::vector<uint8_t> rgba = Gradient(w, h);
+        std::mt19937 rng(99);
+        std::uniform_int_distribution<int> noise(-24, 24);
+        for (size_t i = 0; i < rgba.size(); ++i) {
+            if (i % 4 == 3) continue;
+            rgba[i] = (uint8_t)std::min(255, std::max(0, rgba[i] + noise(rng)));
+        }
+        return rgba;
+    }
+
+    // KF2F̖ʂƖڒnÂނ
+    std::vector<uint8_t> Bricks(uint32_t w, uint32_t h)
+    {
+        std::vector<uint8_t> rgba(w * h * 4);
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> grain(-6, 6);
+        for (uint32_t y = 0; y < h; ++y) {
+            for (uint32_t x = 0; x < w; ++x) {
+                const uint32_t row = y / 16;
+                const uint32_t bx = (x + (row % 2) * 16) % 32;
+                const bool mortar = (y % 16) < 2 || bx < 2;
+                const int g = grain(rng);
+                uint8_t* p = &rgba[(y * w + x) * 4];
+                p[0] = (uint8_t)std::min(255, std::max(0, (mortar ? 200 : 150) + g));
+                p[1] = (uint8_t)std::min(255, std::max(0, (mortar ? 196 : 70) + g));
+                p[2] = (uint8_t)std::min(255, std::max(0, (mortar ? 190 : 50) + g));
+                p[3] = 255;
+            }
+        }
+        return rgba;
+    }
+
+    // i~̓sA͂Ȃ߂炩j
+    std::vector<uint8_t> Cutout(uint32_t w, uint32_t h)
+    {
+        std::vector<uint8_t> rgba = Gradient(w, h);
+        const float cx = w * 0.5f, cy = h * 0.5f, r = w * 0.35f;
+        for (uint32_t y = 0; y < h; ++y) {
+            for (uint32_t x = 0; x < w; ++x) {
+                const float d = std::sqrt((x - cx) * (x - cx) + (y - cy) * (y - cy));
+                const float a = std::min(1.0f, std::max(0.0f, (r - d) / 6.0f + 0.5f));
+                rgba[(y * w + x) * 4 + 3] = (uint8_t)std::lround(a * 255.0f);
+            }
+        }
+        return rgba;
+    }
+
+    // ubN̕т RGBA8 ɖ߂
+    std::vector<uint8_t> DecodeImage(const std::vector<uint8_t>& blocks, uint32_t w, uint32_t h, TextureCookFormat format)
+    {
+        std::vector<uint8_t> rgba(w * h * 4);
+        const uint32_t blockBytes = (format == TEXTURE_COOK_BC1) ? 8 : 16;
+        const uint32_t pitch = TextureCook_RowPitch(format, w);
+        uint8_t block[64];
+        for (uint32_t by = 0; by < (h + 3) / 4; ++by) {
+            for (uint32_t bx = 0; bx < (w + 3) / 4; ++bx) {
+                const uint8_t* in = &blocks[by * pitch + bx * blockBytes];
+                if (format == TEXTURE_COOK_BC1) TextureCook_DecodeBC1Block(in, block);
+                else TextureCook_DecodeBC3Block(in, block);
+                for (uint32_t y = 0; y < 4 && by * 4 + y < h; ++y) {
+                    for (uint32_t x = 0; x < 4 && bx * 4 + x < w; ++x) {
+                        for (int c = 0; c < 4; ++c) rgba[((by * 4 + y) * w + bx * 4 + x) * 4 + c] = block[(y * 4 + x) * 4 + c];
+                    }
+                }
+            }
+        }
+        return rgba;
+    }
+
+    // first..last ̃`l PSNRidBj
+    double Psnr(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, int first, int last)
+    {
+        double sum = 0.0;
+        size_t n = 0;
+        for (size_t i = 0; i < a.size(); i += 4) {
+            for (int c = first; c <= last; ++c) {
+                const double d = (double)a[i + c] - (double)b[i + c];
+                sum += d * d;
+                ++n;
+            }
+        }
+        const double mse = sum / (double)n;
+        return (mse <= 0.0) ? 99.0 : 10.0 * std::log10(255.0 * 255.0 / mse);
+    }
+
+    void CheckQuality(const char* name, const std::vector<uint8_t>& rgba, TextureCookFormat format, double minRgb, double minAlpha)
+    {
+        std::vector<uint8_t> blocks;
+        const auto start = std::chrono::steady_clock::now();
+        TextureCook_Compress(rgba.data(), kSize, kSize, format, &blocks);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        const std::vector<uint8_t> decoded = DecodeImage(blocks, kSize, kSize, format);
+        const double rgb = Psnr(rgba, decoded, 0, 2);
+        std::printf("     %s : %s %ux%u %.2f ms\n", name, format == TEXTURE_COOK_BC1 ? "BC1" : "BC3", kSize, kSize, ms);
+
+        const std::string tag = name;
+        TestCheck_True(blocks.size() == (size_t)TextureCook_RowPitch(format, kSize) * (kSize / 4), (tag + " block data size").c_str());
+        TestCheck_ExpectMin(rgb >= minRgb, (tag + " RGB PSNR (dB)").c_str(), rgb, minRgb);
+        if (minAlpha > 0.0) {
+            const double alpha = Psnr(rgba, decoded, 3, 3);
+            TestCheck_ExpectMin(alpha >= minAlpha, (tag + " alpha PSNR (dB)").c_str(), alpha, minAlpha);
+        }
+    }
+
+    // 1F̃ubN 565 ̊ۂ߈ȓŖ߂
+    void CheckSolidBlock()
+    {
+        uint8_t block[64], out[8], back[64];
+        for (int i = 0; i < 16; ++i) {
+            block[i * 4 + 0] = 201;
+            block[i * 4 + 1] = 77;
+            block[i * 4 + 2] = 13;
+            block[i * 4 + 3] = 255;
+        }
+        TextureCook_EncodeBC1Block(block, out);
+        TextureCook_DecodeBC1Block(out, back);
+        int worst = 0;
+        for (int i = 0; i < 64; ++i) worst = std::max(worst, std::abs((int)block[i] - (int)back[i]));
+        TestCheck_Expect(worst <= 4, "solid BC1 block max channel error", worst, 4);
+    }
+
+    void CheckCook()
+    {
+        TextureCookImage opaque, alpha, odd;
+        const std::vector<uint8_t> g = Gradient(kSize, kSize);
+        const std::vector<uint8_t> c = Cutout(kSize, kSize);
+        TestCheck_True(TextureCook_Cook(g.data(), kSize, kSize, &opaque) && opaque.format == TEXTURE_COOK_BC1, "opaque image cooks to BC1");
+        TestCheck_True(TextureCook_Cook(c.data(), kSize, kSize, &alpha) && alpha.format == TEXTURE_COOK_BC3, "image with alpha cooks to BC3");
+
+        bool chain = opaque.levels.size() == 9; // 256  1
+        for (size_t m = 0; chain && m < opaque.levels.size(); ++m) {
+            const uint32_t side = kSize >> m;
+            const TextureCookLevel& level = opaque.levels[m];
+            chain = level.width == side && level.height == side
+                && level.data.size() == (size_t)TextureCook_RowPitch(TEXTURE_COOK_BC1, side) * ((side + 3) / 4);
+        }
+        TestCheck_True(chain, "mip chain sizes down to 1x1");
+
+        const std::vector<uint8_t> g6 = Gradient(6, 6);
+        TestCheck_True(!TextureCook_Cook(g6.data(), 6, 6, &odd), "size not a multiple of 4 is not cooked");
+    }
+
+    void CheckDDS()
+    {
+        const std::vector<uint8_t> c = Cutout(kSize, kSize);
+        const std::vector<uint8_t> g = Gradient(kSize, kSize);
+        const std::vector<uint8_t>* sources[] = { &g, &c };
+        for (const std::vector<uint8_t>* src : sources) {
+            TextureCookImage image, back;
+            std::vector<uint8_t> dds;
+            TextureCook_Cook(src->data(), kSize, kSize, &image);
+            const std::string tag = (image.format == TEXTURE_COOK_BC1) ? "BC1" : "BC3";
+
+            bool same = TextureCook_WriteDDS(image, &dds) && TextureCook_ReadDDS(dds.data(), dds.size(), &back)
+                && back.format == image.format && back.levels.size() == image.levels.size();
+            for (size_t m = 0; same && m < image.levels.size(); ++m) {
+                same = back.levels[m].width == image.levels[m].width && back.levels[m].height == image.levels[m].height
+                    && back.levels[m].data == image.levels[m].data;
+            }
+            TestCheck_True(same, (tag + " DDS write/read round trip").c_str());
+            TestCheck_True(dds.size() > 4 && dds[0] == 'D' && dds[1] == 'D' && dds[2] == 'S' && dds[3] == ' ', (tag + " DDS magic").c_str());
+
+            TextureCookImage broken;
+            TestCheck_True(!TextureCook_ReadDDS(dds.data(), dds.size() - 1, &broken), (tag + " truncated DDS is rejected").c_str());
+            std::vector<uint8_t> bad = dds;
+            bad[0] = 'X';
+            TestCheck_True(!TextureCook_ReadDDS(bad.data(), bad.size(), &broken), (tag + " bad magic is rejected").c_str());
+        }
+    }
+
+    void CheckHash()
+    {
+        // FNV-1a 64bit ̌JĂl
+        TestCheck_True(TextureCook_Hash("", 0) == 0xcbf29ce484222325ull, "FNV-1a of empty input");
+        TestCheck_True(TextureCook_Hash("a", 1) == 0xaf63dc4c8601ec8cull, "FNV-1a of \"a\"");
+        TestCheck_True(TextureCook_Hash("foobar", 6) == 0x85944171f73967e8ull, "FNV-1a of \"foobar\"");
+
+        const std::wstring a = TextureCook_CachePath(L"cooked", TextureCook_Hash("a", 1));
+        const std::wstring b = TextureCook_CachePath(L"cooked/", TextureCook_Hash("b", 1));
+        bool hex = a.size() == 7 + 16 + 4;
+        for (size_t i = 7; hex && i < 7 + 16; ++i) hex = (a[i] >= L'0' && a[i] <= L'9') || (a[i] >= L'a' && a[i] <= L'f');
+        TestCheck_True(a.compare(0, 7, L"cooked/") == 0 && a.compare(a.size() - 4, 4, L".dds") == 0 && hex, "cache path is dir/<16 hex>.dds");
+        TestCheck_True(b.compare(0, 8, L"cooked//") != 0 && b.size() == a.size(), "trailing slash is not doubled");
+        TestCheck_True(a != b, "different sources get different cache names");
+    }
+}
+
+int main()
+{
+    CheckQuality("gradient", Gradient(kSize, kSize), TEXTURE_COOK_BC1, 40.0, 0.0);
+    CheckQuality("noise+gradient", NoisyGradient(kSize, kSize), TEXTURE_COOK_BC1, 27.0, 0.0);
+    CheckQuality("bricks", Bricks(kSize, kSize), TEXTURE_COOK_BC1, 36.0, 0.0);
+    CheckQuality("alpha cutout", Cutout(kSize, kSize), TEXTURE_COOK_BC3, 40.0, 40.0);
+    CheckSolidBlock();
+    CheckCook();
+    CheckDDS();
+    CheckHash();
+    return TestCheck_Result();
+}
@@ -0,0 +1,122 @@
+/*==============================================================================
+
+@@@eNX`̊Ǘ䒠[texture_registry.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "texture_registry.h"
+
+TextureRegistry::TextureRegistry(int capacity)
+{
+    Reset(capacity);
+}
+
+void TextureRegistry::Reset(int capacity)
+{
+    m_slots.assign(capacity > 0 ? capacity : 0, Slot{});
+    Clear();
+}
+
+void TextureRegistry::Clear()
+{
+    std::vector<int> released;
+    for (int i = 0; i < (int)m_slots.size(); ++i)
+    {
+        if (m_slots[i].refs > 0) released.push_back(i);
+        m_slots[i] = Slot{};
+    }
+
+    m_free.clear();
+    m_index.clear();
+    m_index.reserve(m_slots.size());
+    m_count = 0;
+    m_totalBytes = 0;
+
+    // m点I܂ł͋󂫂ɐς܂Ȃ
+    if (m_onRelease)
+    {
+        for (int handle : released) m_onRelease(handle);
+    }
+
+    m_free.reserve(m_slots.size());
+    for (int i = (int)m_slots.size() - 1; i >= 0; --i) m_free.push_back(i);
+}
+
+int TextureRegistry::Find(const std::wstring& path) const
+{
+    const auto it = m_index.find(path);
+    return (it != m_index.end()) ? it->second : -1;
+}
+
+int TextureRegistry::Insert(const std::wstring& path, uint64_t bytes)
+{
+    if (m_free.empty() || m_index.count(path)) return -1;
+
+    const int handle = m_free.back();
+    m_free.pop_back();
+
+    Slot& s = m_slots[handle];
+    s.path = path;
+    s.refs = 1;
+    s.bytes = bytes;
+
+    m_index.emplace(path, handle);
+    ++m_count;
+    m_totalBytes += bytes;
+    return handle;
+}
+
+int TextureRegistry::AddRef(int handle)
+{
+    if (!IsLive(handle)) return -1;
+    return ++m_slots[handle].refs;
+}
+
+int TextureRegistry::Release(int handle)
+{
+    if (!IsLive(handle)) return -1;
+
+    Slot& s = m_slots[handle];
+    if (--s.refs > 0) return s.refs;
+
+    m_index.erase(s.path);
+    --m_count;
+    m_totalBytes -= s.bytes;
+    s = Slot{};
+
+    if (m_onRelease) m_onRelease(handle);
+    m_free.push_back(handle);
+    return 0;
+}
+
+void TextureRegistry::SetBytes(int handle, uint64_t bytes)
+{
+    if (!IsLive(handle)) return;
+
+    Slot& s = m_slots[handle];
+    m_totalBytes = m_totalBytes - s.bytes + bytes;
+    s.bytes = bytes;
+}
+
+bool TextureRegistry::IsLive(int handle) const
+{
+    return handle >= 0 && handle < (int)m_slots.size() && m_slots[handle].refs > 0;
+}
+
+int TextureRegistry::RefCount(int handle) const
+{
+    return IsLive(handle) ? m_slots[handle].refs : 0;
+}
+
+uint64_t TextureRegistry::Bytes(int handle) const
+{
+    return IsLive(handle) ? m_slots[handle].bytes : 0;
+}
+
+const std::wstring& TextureRegistry::Path(int handle) const
+{
+    static const std::wstring kEmpty;
+    return IsLive(handle) ? m_slots[handle].path : kEmpty;
+}
@@ -0,0 +1,79 @@
+/*==============================================================================
+
+@@@eNX`̊Ǘ䒠[texture_registry.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    t@C  ǗԍnbVňAǗԍƂɎQƐƎgpoCgB
+    GPU ̃\[X͎Ȃitexture.cpp Ǘԍ̈ʒuɒuĵŁA
+    foCXȂœǂݍ݁E̗m߂B
+
+    Ǘԍ 0 ` capacity-1Bꂽԍ͎ Insert Ŏg
+    iŌɋ󂢂ԍjBԍ󂫂ɖ߂Ƃ͒m点ĂԁB
+
+==============================================================================*/
+#ifndef TEXTURE_REGISTRY_H
+#define TEXTURE_REGISTRY_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class TextureRegistry
+{
+public:
+    typedef void (*ReleaseFunc)(int handle);
+
+    explicit TextureRegistry(int capacity = 256);
+
+    void Reset(int capacity);
+    void Clear(); // ׂĖgpɖ߂ieʂ͂̂܂܁jBgĂԍɒm点
+
+    // ԍ󂫂ɖ߂ƂiRelease  0AClear / ResetjɌĂԁBnullptr ŊO
+    // Ă΂ꂽɂ͂ IsLive  false ŁAFind łȂA
+    // m点悩߂܂ł͂̔ԍ Insert Ŏg񂳂Ȃ
+    void SetReleaseCallback(ReleaseFunc func) { m_onRelease = func; }
+
+    // ǂݍݍς݂ȂǗԍB -1iQƐ͕ςȂj
+    int Find(const std::wstring& path) const;
+
+    // Vo^iQƐ 1jBto^ς݂Ȃ -1
+    int Insert(const std::wstring& path, uint64_t bytes);
+
+    // QƐ𑝂₷^炷B߂l͕ύX̎QƐiȔԍȂ -1j
+    // Release  0 Ԃԍ͋󂫂ɖ߂̂ŁAĂяo͐ GPU ̃\[X̂Ă
+    // iRefCount  1 ȂŌ̎QƁj
+    int AddRef(int handle);
+    int Release(int handle);
+
+    // gpoCgւi񓯊ǂݍ݂Œg͂ƂȂǁj
+    void SetBytes(int handle, uint64_t bytes);
+
+    bool IsLive(int handle) const;
+    int RefCount(int handle) const;
+    uint64_t Bytes(int handle) const;
+    const std::wstring& Path(int handle) const;
+
+    int Capacity() const { return (int)m_slots.size(); }
+    int Count() const { return m_count; }                 // ǂݍ܂Ă閇
+    uint64_t TotalBytes() const { return m_totalBytes; }  // ̍voCg
+
+private:
+    struct Slot
+    {
+        std::wstring path;
+        int refs = 0;
+        uint64_t bytes = 0;
+    };
+
+    std::vector<Slot> m_slots;
+    std::vector<int> m_free; // iԍɏo悤tɐςށj
+    std::unordered_map<std::wstring, int> m_index;
+    int m_count = 0;
+    uint64_t m_totalBytes = 0;
+    ReleaseFunc m_onRelease = nullptr;
+};
+
+#endif // TEXTURE_REGISTRY_H
@@ -0,0 +1,146 @@
+/*==============================================================================
+
+@@@eNX`̊Ǘ䒠̃`FbN[texture_registry_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D Ȃőg߂B
+        g++ -std=c++17 texture_registry_test.cpp texture_registry.cpp
+    Ǘԍ̎g񂵁AQƐAgpoCgA̒m点̉񐔂Ə
+    im点̍Œɂ̔ԍ܂g񂳂ȂƁjB
+
+==============================================================================*/
+#include "texture_registry.h"
+#include "test_check.h"
+#include <vector>
+
+namespace
+{
+    TextureRegistry* g_registry = nullptr;
+    std::vector<int> g_released;            // m炳ꂽ̔ԍ
+    bool g_liveDuringCallback = false;      // m点̍Œ IsLive / Find ňĂ܂
+    int g_reinsertedHandle = -2;            // m点̍Œ Insert Ďꂽԍ
+
+    void OnRelease(int handle)
+    {
+        g_released.push_back(handle);
+        if (g_registry->IsLive(handle)) g_liveDuringCallback = true;
+    }
+
+    // m点̒ŕʂ̃eNX`ǂݍށiAgX蒼ƂȂǁj
+    void OnReleaseInsert(int handle)
+    {
+        g_released.push_back(handle);
+        g_reinsertedHandle = g_registry->Insert(L"inside_callback.png", 1);
+    }
+}
+
+int main()
+{
+    // ԍ̕oƎg
+    {
+        TextureRegistry reg(4);
+        const int a = reg.Insert(L"a.png", 100);
+        const int b = reg.Insert(L"b.png", 200);
+        const int c = reg.Insert(L"c.png", 300);
+        TestCheck_True(a == 0 && b == 1 && c == 2, "handles start at 0 in order");
+        TestCheck_True(reg.Insert(L"a.png", 1) == -1 && reg.Count() == 3, "duplicate path is rejected");
+        TestCheck_True(reg.Find(L"b.png") == b && reg.Find(L"x.png") == -1 && reg.RefCount(b) == 1,
+                       "Find does not change the ref count");
+
+        TestCheck_True(reg.Release(b) == 0 && !reg.IsLive(b) && reg.Find(L"b.png") == -1,
+                       "last release frees the handle and the name");
+        TestCheck_True(reg.Insert(L"d.png", 50) == b && reg.Path(b) == L"d.png" && reg.Bytes(b) == 50,
+                       "freed handle is reused by the next insert");
+
+        reg.Release(a);
+        reg.Release(c);
+        TestCheck_True(reg.Insert(L"e.png", 1) == c && reg.Insert(L"f.png", 1) == a,
+                       "most recently freed handle is reused first");
+        TestCheck_True(reg.Insert(L"g.png", 1) == 3 && reg.Insert(L"h.png", 1) == -1 && reg.Count() == 4,
+                       "full registry rejects inserts");
+    }
+
+    // QƐƎgpoCg
+    {
+        TextureRegistry reg(8);
+        const int h = reg.Insert(L"tex.png", 1000);
+        const int other = reg.Insert(L"other.png", 24);
+        TestCheck_True(reg.AddRef(h) == 2 && reg.AddRef(h) == 3 && reg.RefCount(h) == 3, "AddRef counts up");
+        TestCheck_True(reg.Release(h) == 2 && reg.Release(h) == 1 && reg.IsLive(h), "Release counts down");
+
+        reg.SetBytes(h, 4000);
+        TestCheck_True(reg.TotalBytes() == 4024 && reg.Bytes(h) == 4000, "SetBytes replaces the size in the total");
+
+        TestCheck_True(reg.Release(h) == 0 && reg.TotalBytes() == 24 && reg.Count() == 1, "last release drops the bytes");
+        TestCheck_True(reg.Release(h) == -1 && reg.AddRef(h) == -1 && reg.RefCount(h) == 0 && reg.Bytes(h) == 0 &&
+                       reg.Path(h).empty(), "dead handle is ignored");
+        reg.SetBytes(h, 99);
+        TestCheck_True(reg.TotalBytes() == 24, "SetBytes on a dead handle is ignored");
+        TestCheck_True(reg.Release(-1) == -1 && reg.Release(8) == -1 && reg.RefCount(other) == 1 && !reg.IsLive(100), "out-of-range handle");
+    }
+
+    // ̒m点FŌ Release 1񂾂A̎ɂ͂Ȃ
+    {
+        TextureRegistry reg(4);
+        g_registry = &reg;
+        g_released.clear();
+        g_liveDuringCallback = false;
+        reg.SetReleaseCallback(OnRelease);
+
+        const int a = reg.Insert(L"a.png", 1);
+        const int b = reg.Insert(L"b.png", 1);
+        reg.AddRef(a);
+        reg.Release(a);
+        TestCheck_True(g_released.empty(), "callback: not called while references remain");
+        reg.Release(b);
+        reg.Release(a);
+        TestCheck_True(g_released == std::vector<int>({ b, a }), "callback: called once per handle in release order");
+        TestCheck_True(!g_liveDuringCallback, "callback: handle is already dead inside the callback");
+        reg.Release(a);
+        TestCheck_True(g_released.size() == 2, "callback: releasing a dead handle does not call it again");
+
+        // Clear ͎gĂԍ
+        g_released.clear();
+        const int c = reg.Insert(L"c.png", 1);  // g񂵂 a
+        const int d = reg.Insert(L"d.png", 1);  // g񂵂 b
+        const int e = reg.Insert(L"e.png", 1);
+        reg.Release(d);
+        g_released.clear();
+        reg.Clear();
+        TestCheck_True(c < e && g_released == std::vector<int>({ c, e }), "callback: Clear reports live handles in ascending order");
+        TestCheck_True(!g_liveDuringCallback && reg.Count() == 0 && reg.TotalBytes() == 0, "callback: Clear empties the registry");
+        TestCheck_True(reg.Insert(L"z.png", 1) == 0, "callback: after Clear handles start at 0 again");
+
+        reg.SetReleaseCallback(nullptr);
+        g_released.clear();
+        reg.Release(0);
+        TestCheck_True(g_released.empty(), "callback: nullptr detaches it");
+    }
+
+    // m点̒œǂݍݒĂA󂢂΂̔ԍ͓nȂ
+    {
+        TextureRegistry reg(2);
+        g_registry = &reg;
+        g_released.clear();
+        reg.SetReleaseCallback(OnReleaseInsert);
+
+        const int a = reg.Insert(L"a.png", 1);
+        reg.Release(a);
+        TestCheck_True(g_released == std::vector<int>({ a }) && g_reinsertedHandle >= 0 && g_reinsertedHandle != a,
+                       "callback: insert inside the callback does not get the handle being freed");
+        TestCheck_True(reg.Find(L"inside_callback.png") == g_reinsertedHandle && reg.Insert(L"next.png", 1) == a,
+                       "callback: the freed handle is available after the callback");
+
+        // Clear ̍Œ͂܂󂫂
+        g_released.clear();
+        g_reinsertedHandle = -2;
+        reg.Clear();
+        TestCheck_True(g_released.size() == 2 && g_reinsertedHandle == -1 && reg.Count() == 0,
+                       "callback: insert inside Clear's callbacks fails and leaves it empty");
+        reg.SetReleaseCallback(nullptr);
+    }
+
+    return TestCheck_Result();
+}
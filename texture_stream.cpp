@@ -0,0 +1,150 @@
+/*==============================================================================
+
+@@@eNX`̔񓯊ǂݍ[texture_stream.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "texture_stream.h"
+
+TextureDecodePool::~TextureDecodePool()
+{
+    Stop();
+}
+
+bool TextureDecodePool::Start(int threadCount, TextureDecodeFunc decode,
+    TextureThreadFunc threadBegin, TextureThreadFunc threadEnd)
+{
+    Stop();
+    if (!decode || threadCount <= 0) return false;
+
+    m_decode = decode;
+    m_threadBegin = threadBegin;
+    m_threadEnd = threadEnd;
+    m_stop = false;
+
+    for (int i = 0; i < threadCount; ++i)
+    {
+        m_threads.emplace_back(&TextureDecodePool::WorkerMain, this);
+    }
+    return true;
+}
+
+void TextureDecodePool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+        m_jobs.clear();
+    }
+    m_wake.notify_all();
+
+    for (std::thread& t : m_threads) t.join();
+    m_threads.clear();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_done.clear();
+    m_busy = 0;
+}
+
+void TextureDecodePool::Submit(int handle, uint32_t ticket, const std::wstring& path)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back({ handle, ticket, path });
+    }
+    m_wake.notify_one();
+}
+
+bool TextureDecodePool::PopCompleted(TextureDecodeResult* out)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_done.empty()) return false;
+
+    if (out) *out = std::move(m_done.front());
+    m_done.pop_front();
+    return true;
+}
+
+int TextureDecodePool::Outstanding() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (int)(m_jobs.size() + m_done.size()) + m_busy;
+}
+
+void TextureDecodePool::WorkerMain()
+{
+    if (m_threadBegin) m_threadBegin();
+
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+            if (m_stop) break;
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+            ++m_busy;
+        }
+
+        TextureDecodeResult result;
+        result.handle = job.handle;
+        result.ticket = job.ticket;
+        result.path = std::move(job.path);
+        result.ok = m_decode(result.path, &result.width, &result.height, &result.rgba);
+        if (!result.ok) result.rgba.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_busy;
+            if (!m_stop) m_done.push_back(std::move(result));
+        }
+    }
+
+    if (m_threadEnd) m_threadEnd();
+}
+
+void TextureUploadBudget::BeginFrame(uint64_t budgetBytes)
+{
+    m_budget = budgetBytes;
+    m_used = 0;
+    m_uploads = 0;
+}
+
+bool TextureUploadBudget::TryConsume(uint64_t bytes)
+{
+    // \Z傫1܂łȂAƂƂȂ悤ɍŏ1͒ʂ
+    if (m_uploads > 0 && m_used + bytes > m_budget) return false;
+
+    m_used += bytes;
+    ++m_uploads;
+    return true;
+}
+
+int TextureStream_Pump(TextureDecodePool* pool, std::deque<TextureDecodeResult>* ready,
+    TextureUploadBudget* budget, TextureTicketFunc isCurrent, TextureUploadFunc upload)
+{
+    TextureDecodeResult r;
+    while (pool->PopCompleted(&r))
+    {
+        if (isCurrent(r.handle, r.ticket)) ready->push_back(std::move(r));
+    }
+
+    // ԑ҂̊Ԃɉꂽ̂̂ŁA钼Oɂx
+    int uploaded = 0;
+    while (!ready->empty())
+    {
+        const TextureDecodeResult& front = ready->front();
+        if (isCurrent(front.handle, front.ticket))
+        {
+            if (!budget->TryConsume(front.Bytes())) break;
+            upload(front);
+            ++uploaded;
+        }
+        ready->pop_front();
+    }
+    return uploaded;
+}
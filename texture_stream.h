@@ -0,0 +1,120 @@
+/*==============================================================================
+
+@@@eNX`̔񓯊ǂݍ[texture_stream.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    TextureDecodePool   : 摜t@C  RGBA8 ̓WJ[J[XbhōsB
+                          WĴ̂͊֐|C^Ŏ󂯎iQ[ł WICĵŁA
+                          GPU ȂŋU̓WJ֐nĊm߂B
+    TextureUploadBudget : 1t[ GPU ֑Ă悢oCg̊ǗB
+                          \Z𒴂傫ȉ摜łÃt[̍ŏ1͒ʂB
+    TextureStream_Pump  : 1t[̉Ɠ]BÂʂ̂Ă邩ǂ
+                          GPU ւ̓]֐|C^Ŏ󂯎B
+
+    ǂCXbhĂԁB[J[Ĝ̓v[̒B
+
+==============================================================================*/
+#ifndef TEXTURE_STREAM_H
+#define TEXTURE_STREAM_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct TextureDecodeResult
+{
+    int handle = -1;          // Submit ɓnԍ
+    uint32_t ticket = 0;      // iEėpꂽԍ̌ʂ̂Ă邽߁j
+    std::wstring path;
+    bool ok = false;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<uint8_t> rgba; // width * height * 4
+
+    uint64_t Bytes() const { return ok ? (uint64_t)width * height * 4 : 0; }
+};
+
+// Ȃ true  RGBA8 ̉f
+typedef bool (*TextureDecodeFunc)(const std::wstring& path, uint32_t* width, uint32_t* height, std::vector<uint8_t>* rgba);
+// [J[Xbh̊JnEIɌĂԁiCOM ̏ȂǁjBnullptr 
+typedef void (*TextureThreadFunc)();
+
+class TextureDecodePool
+{
+public:
+    TextureDecodePool() = default;
+    ~TextureDecodePool();
+
+    TextureDecodePool(const TextureDecodePool&) = delete;
+    TextureDecodePool& operator=(const TextureDecodePool&) = delete;
+
+    bool Start(int threadCount, TextureDecodeFunc decode,
+        TextureThreadFunc threadBegin = nullptr, TextureThreadFunc threadEnd = nullptr);
+    void Stop(); // WĴ̂͑҂BÊ͎̂̂Ă
+
+    bool IsRunning() const { return !m_threads.empty(); }
+
+    void Submit(int handle, uint32_t ticket, const std::wstring& path);
+
+    // Î1oiIjB false
+    bool PopCompleted(TextureDecodeResult* out);
+
+    // ҂EWJE̍v
+    int Outstanding() const;
+
+private:
+    struct Job
+    {
+        int handle;
+        uint32_t ticket;
+        std::wstring path;
+    };
+
+    void WorkerMain();
+
+    TextureDecodeFunc m_decode = nullptr;
+    TextureThreadFunc m_threadBegin = nullptr;
+    TextureThreadFunc m_threadEnd = nullptr;
+
+    std::vector<std::thread> m_threads;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::deque<Job> m_jobs;
+    std::deque<TextureDecodeResult> m_done;
+    int m_busy = 0;
+    bool m_stop = false;
+};
+
+class TextureUploadBudget
+{
+public:
+    void BeginFrame(uint64_t budgetBytes);
+
+    // Ă悯 trueig𐔂j
+    bool TryConsume(uint64_t bytes);
+
+    uint64_t Used() const { return m_used; }
+    int Uploads() const { return m_uploads; }
+
+private:
+    uint64_t m_budget = 0;
+    uint64_t m_used = 0;
+    int m_uploads = 0;
+};
+
+// ʂ܂vȂ truei͂܂łɔԍEėpĂ falsej
+typedef bool (*TextureTicketFunc)(int handle, uint32_t ticket);
+typedef void (*TextureUploadFunc)(const TextureDecodeResult& result);
+
+// IWJ ready ɏW߁A擪\Z̕ upload ɓnic͎̃t[jB
+// isCurrent  false ̌ʂ͗\Zg킸Ɏ̂ĂB߂l upload ɓn
+int TextureStream_Pump(TextureDecodePool* pool, std::deque<TextureDecodeResult>* ready,
+    TextureUploadBudget* budget, TextureTicketFunc isCurrent, TextureUploadFunc upload);
+
+#endif // TEXTURE_STREAM_H
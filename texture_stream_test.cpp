@@ -0,0 +1,247 @@
+/*==============================================================================
+
+@@@eNX`̔񓯊ǂݍ݂̃`FbN[texture_stream_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D  WIC Ȃőg߂B
+        g++ -std=c++17 -pthread texture_stream_test.cpp texture_stream.cpp
+    U̓WJ֐it@C傫߂A"bad" ͎sAQ[gŎ~߂j
+    TextureDecodePool  OutstandingiStop / Start ܂łjA
+    TextureUploadBudget ́uŏ1͒ʂvATextureStream_Pump ł̌Â`Pbg
+    ̂ĕƗ\Z̎gB
+
+==============================================================================*/
+#include "texture_stream.h"
+#include "test_check.h"
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+
+namespace
+{
+    // WJ~߂ĂQ[g
+    std::mutex g_gateMutex;
+    std::condition_variable g_gateWake;
+    bool g_gateOpen = true;
+    std::atomic<int> g_decodeEntered{ 0 };
+    std::atomic<int> g_threadsBegun{ 0 };
+    std::atomic<int> g_threadsEnded{ 0 };
+
+    void SetGate(bool open)
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_gateMutex);
+            g_gateOpen = open;
+        }
+        g_gateWake.notify_all();
+    }
+
+    // "w_h" ̌`̃t@C炻̑傫̉fB"bad" ͎s
+    bool FakeDecode(const std::wstring& path, uint32_t* width, uint32_t* height, std::vector<uint8_t>* rgba)
+    {
+        ++g_decodeEntered;
+        {
+            std::unique_lock<std::mutex> lock(g_gateMutex);
+            g_gateWake.wait(lock, [] { return g_gateOpen; });
+        }
+
+        if (path == L"bad")
+        {
+            *width = 16;
+            *height = 16;
+            rgba->assign(16, 0xff);   // sĂ̂Ă邱
+            return false;
+        }
+
+        const size_t sep = path.find(L'_');
+        *width = (uint32_t)std::stoul(path.substr(0, sep));
+        *height = (uint32_t)std::stoul(path.substr(sep + 1));
+        rgba->assign((size_t)*width * *height * 4, 0x80);
+        return true;
+    }
+
+    void ThreadBegin() { ++g_threadsBegun; }
+    void ThreadEnd() { ++g_threadsEnded; }
+
+    // 藧܂ő҂iő2bj
+    template <class F>
+    bool WaitFor(F condition)
+    {
+        for (int i = 0; i < 2000; ++i)
+        {
+            if (condition()) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return condition();
+    }
+
+    // TextureStream_Pump pFԍƂ̍̃`Pbgitexture.cpp  g_Textures ̑j
+    std::map<int, uint32_t> g_tickets;
+    std::vector<int> g_uploaded;
+
+    bool IsCurrent(int handle, uint32_t ticket)
+    {
+        const auto it = g_tickets.find(handle);
+        return it != g_tickets.end() && it->second == ticket;
+    }
+
+    void Upload(const TextureDecodeResult& r)
+    {
+        g_uploaded.push_back(r.handle);
+    }
+
+    TextureDecodeResult MakeResult(int handle, uint32_t ticket, uint32_t width, uint32_t height)
+    {
+        TextureDecodeResult r;
+        r.handle = handle;
+        r.ticket = ticket;
+        r.ok = true;
+        r.width = width;
+        r.height = height;
+        r.rgba.assign((size_t)width * height * 4, 0);
+        return r;
+    }
+}
+
+int main()
+{
+    // TextureUploadBudgetF\Z͒ʂA~߂Bt[̍ŏ1͕Kʂ
+    {
+        TextureUploadBudget budget;
+        budget.BeginFrame(100);
+        TestCheck_True(budget.TryConsume(60) && budget.TryConsume(40) && !budget.TryConsume(1),
+                       "budget: fills up to the limit and stops");
+        TestCheck_True(budget.Used() == 100 && budget.Uploads() == 2, "budget: counts bytes and uploads");
+
+        budget.BeginFrame(100);
+        TestCheck_True(budget.TryConsume(500) && budget.Used() == 500, "budget: first upload passes even over budget");
+        TestCheck_True(!budget.TryConsume(1) && budget.Uploads() == 1, "budget: nothing after an oversized first upload");
+
+        budget.BeginFrame(0);
+        TestCheck_True(budget.TryConsume(4) && !budget.TryConsume(4),
+                       "budget: zero budget still passes one upload per frame");
+    }
+
+    // TextureDecodePoolFWJʁAsAOutstanding
+    {
+        TextureDecodePool pool;
+        TestCheck_True(!pool.Start(0, FakeDecode) && !pool.Start(2, nullptr) && !pool.IsRunning(),
+                       "pool: bad Start arguments are rejected");
+        TestCheck_True(pool.Start(2, FakeDecode, ThreadBegin, ThreadEnd) && pool.IsRunning(), "pool: starts");
+
+        pool.Submit(1, 10, L"4_2");
+        pool.Submit(2, 20, L"bad");
+        TestCheck_True(WaitFor([&] { return g_decodeEntered == 2; }), "pool: both jobs reach the decoder");
+        TestCheck_True(pool.Outstanding() == 2, "pool: outstanding counts busy and unpopped jobs");
+
+        std::map<int, TextureDecodeResult> results;
+        TextureDecodeResult r;
+        WaitFor([&] { while (pool.PopCompleted(&r)) results[r.handle] = r; return results.size() == 2; });
+        TestCheck_True(results.size() == 2 && pool.Outstanding() == 0, "pool: all results popped");
+        const TextureDecodeResult& good = results[1];
+        const TextureDecodeResult& bad = results[2];
+        TestCheck_True(good.ok && good.ticket == 10 && good.path == L"4_2" && good.width == 4 && good.height == 2 &&
+                       good.rgba.size() == 32 && good.Bytes() == 32, "pool: result carries handle, ticket and pixels");
+        TestCheck_True(!bad.ok && bad.ticket == 20 && bad.rgba.empty() && bad.Bytes() == 0,
+                       "pool: failed decode has no pixels and no upload bytes");
+        TestCheck_True(!pool.PopCompleted(nullptr), "pool: nothing left");
+    }
+    TestCheck_True(g_threadsBegun == 2 && g_threadsEnded == 2, "pool: thread begin/end hooks run once per worker");
+
+    // Stop / Start ܂ OutstandingFWJ͑҂AƖ͎̂Ă
+    {
+        TextureDecodePool pool;
+        pool.Start(1, FakeDecode);
+        g_decodeEntered = 0;
+        SetGate(false);
+        pool.Submit(1, 1, L"8_8");
+        pool.Submit(2, 1, L"8_8");
+        pool.Submit(3, 1, L"8_8");
+        WaitFor([&] { return g_decodeEntered == 1; });
+        TestCheck_True(pool.Outstanding() == 3, "stop/start: queued plus busy are outstanding");
+
+        std::thread opener([] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            SetGate(true);
+        });
+        pool.Stop();
+        opener.join();
+        TestCheck_True(!pool.IsRunning() && pool.Outstanding() == 0 && !pool.PopCompleted(nullptr),
+                       "stop/start: Stop waits for the busy job and drops everything");
+        TestCheck_True(g_decodeEntered == 1, "stop/start: queued jobs were never decoded");
+
+        pool.Start(1, FakeDecode);
+        TestCheck_True(pool.Outstanding() == 0, "stop/start: restarted pool starts empty");
+        pool.Submit(7, 3, L"2_2");
+        TextureDecodeResult r;
+        TestCheck_True(WaitFor([&] { return pool.Outstanding() == 1 && pool.PopCompleted(&r); }) &&
+                       r.handle == 7 && pool.Outstanding() == 0, "stop/start: only the new job comes back");
+    }
+
+    // TextureStream_Pump ̑鑤Fԑ҂ɒڐςŁAt[Ƃ̓܂`Ō
+    {
+        TextureDecodePool idle; // ĂȂ̂ŉ͂Ȃ
+        std::deque<TextureDecodeResult> ready;
+        TextureUploadBudget budget;
+        g_uploaded.clear();
+
+        // 1 ͓͂OɉEėpi`Pbgi񂾁jA2 ͉ꂽ܂܁A3  4 ͂܂v
+        g_tickets = { { 1, 5 }, { 3, 1 }, { 4, 1 } };
+        ready.push_back(MakeResult(1, 4, 64, 64));
+        ready.push_back(MakeResult(2, 1, 64, 64));
+        ready.push_back(MakeResult(3, 1, 32, 32));
+        ready.push_back(MakeResult(4, 1, 32, 32));
+
+        // \Z 32x32 1ԂBÂ2\Zuŏ1vg 3 Ȃ
+        budget.BeginFrame(32 * 32 * 4);
+        int uploaded = TextureStream_Pump(&idle, &ready, &budget, IsCurrent, Upload);
+        TestCheck_True(uploaded == 1 && g_uploaded == std::vector<int>({ 3 }) && ready.size() == 1 &&
+                       budget.Used() == 32 * 32 * 4, "pump: stale results are dropped without using the budget");
+
+        // ԑ҂̊Ԃ 4 ꂽ
+        g_tickets.erase(4);
+        budget.BeginFrame(32 * 32 * 4);
+        uploaded = TextureStream_Pump(&idle, &ready, &budget, IsCurrent, Upload);
+        TestCheck_True(uploaded == 0 && ready.empty() && budget.Uploads() == 0,
+                       "pump: results released while waiting are dropped at upload time");
+
+        // \Z傫Ăt[̍ŏ1ƂđÃ͎t[
+        g_tickets = { { 8, 1 }, { 9, 2 } };
+        ready.push_back(MakeResult(9, 2, 256, 256));
+        ready.push_back(MakeResult(8, 1, 4, 4));
+        budget.BeginFrame(1024);
+        uploaded = TextureStream_Pump(&idle, &ready, &budget, IsCurrent, Upload);
+        TestCheck_True(uploaded == 1 && g_uploaded.back() == 9 && budget.Used() == 256u * 256 * 4 && ready.size() == 1,
+                       "pump: oversized first upload passes, the rest waits");
+        budget.BeginFrame(1024);
+        uploaded = TextureStream_Pump(&idle, &ready, &budget, IsCurrent, Upload);
+        TestCheck_True(uploaded == 1 && g_uploaded.back() == 8 && ready.empty(), "pump: waiting result goes next frame");
+    }
+
+    // TextureStream_Pump ̉F[J[͂Âʂ͏ԑ҂ɂς܂Ȃ
+    {
+        TextureDecodePool pool;
+        pool.Start(2, FakeDecode);
+        std::deque<TextureDecodeResult> ready;
+        TextureUploadBudget budget;
+        g_uploaded.clear();
+
+        g_tickets = { { 1, 5 }, { 5, 1 } };
+        pool.Submit(1, 4, L"16_16");
+        pool.Submit(2, 1, L"16_16");
+        pool.Submit(5, 1, L"16_16");
+        const bool done = WaitFor([&]
+        {
+            budget.BeginFrame(1 << 20);
+            TextureStream_Pump(&pool, &ready, &budget, IsCurrent, Upload);
+            return pool.Outstanding() == 0;
+        });
+        TestCheck_True(done && g_uploaded == std::vector<int>({ 5 }) && ready.empty(),
+                       "pump: only the current result is collected and uploaded");
+    }
+
+    return TestCheck_Result();
+}
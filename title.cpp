@@ -12,6 +12,7 @@
 #include "gamepad.h"
 #include "key_logger.h"
 #include "sprite.h"
+#include "sprite_atlas.h"
 #include "stage_registry.h"
 #include "texture.h"
 #include "debug_text.h"
@@ -132,6 +133,10 @@ void Title_Initialize()
     
     space = Texture_Load(L"space1.png");
 
+    // ̂̓AgX̃y[Wɂ܂Ƃ߂i傫wiȂǂ͒P̂̂܂܁j
+    const int atlasTex[] = { g_titleLogoTex, g_stageIconTex, space };
+    SpriteAtlas_Add(atlasTex, (int)(sizeof(atlasTex) / sizeof(atlasTex[0])));
+
     const float screenW = (float)Direct3D_GetBackBufferWidth();
     const float screenH = (float)Direct3D_GetBackBufferHeight();
     const float textOffsetX = screenW * 0.5f - 230.0f;
@@ -152,6 +157,15 @@ void Title_Initialize()
 
 void Title_Finalize()
 {
+    // AgX͎QƂȂ̂ŁAŉƃAgXO
+    // iy[WɂȂ΁Aɗ͂̃y[W֓꒼j
+    Texture_Release(g_titleLogoTex);
+    Texture_Release(g_stageIconTex);
+    Texture_Release(space);
+    g_titleLogoTex = -1;
+    g_stageIconTex = -1;
+    space = -1;
+
     delete g_titleText;
     g_titleText = nullptr;
     UnloadAudio(titleBgm);
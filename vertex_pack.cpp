@@ -0,0 +1,198 @@
+/*==============================================================================
+
+@@@_̋lߍ[vertex_pack.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "vertex_pack.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+static_assert(sizeof(PackedVertex3d) == 20, "PackedVertex3d must match the packed input layout");
+
+namespace
+{
+    float Saturate(float v)
+    {
+        return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+    }
+
+    float SignNotZero(float v)
+    {
+        return v >= 0.0f ? 1.0f : -1.0f;
+    }
+
+    // GPU  SNORM Ɠ߂i-32768  -1 Ɋۂ߂j
+    float FromSnorm16(int16_t v)
+    {
+        return std::max(v / 32767.0f, -1.0f);
+    }
+}
+
+uint16_t VertexPack_FloatToHalf(float value)
+{
+    uint32_t f;
+    std::memcpy(&f, &value, sizeof(f));
+
+    const uint32_t sign = (f >> 16) & 0x8000;
+    const uint32_t absf = f & 0x7fffffff;
+
+    if (absf >= 0x7f800000) {
+        // inf  NaNiNaN ͉̏̕cj
+        return (uint16_t)(sign | 0x7c00 | (absf > 0x7f800000 ? 0x200 | ((absf >> 13) & 0x3ff) : 0));
+    }
+    if (absf >= 0x477ff000) {
+        // 65520 ȏ͊ۂ߂ inf
+        return (uint16_t)(sign | 0x7c00);
+    }
+    if (absf < 0x38800000) {
+        // half ̔񐳋Ki2^-14 jB炵čŋߐڋɊۂ߂
+        const uint32_t shift = 113 - (absf >> 23);
+        if (shift > 12) return (uint16_t)sign; // 2^-25 ȉ 0
+        const uint32_t mant = (absf & 0x7fffff) | 0x800000;
+        uint32_t h = mant >> (shift + 13);
+        const uint32_t rest = mant & ((1u << (shift + 13)) - 1);
+        const uint32_t half = 1u << (shift + 12);
+        if (rest > half || (rest == half && (h & 1))) ++h;
+        return (uint16_t)(sign | h);
+    }
+
+    // KBwtւĉ 13 rbgŋߐڋɊۂ߂iJオ͎wցj
+    const uint32_t biased = absf - 0x38000000;
+    const uint32_t h = (biased + 0x0fff + ((biased >> 13) & 1)) >> 13;
+    return (uint16_t)(sign | h);
+}
+
+float VertexPack_HalfToFloat(uint16_t value)
+{
+    const uint32_t sign = (uint32_t)(value & 0x8000) << 16;
+    const uint32_t exp = (value >> 10) & 0x1f;
+    const uint32_t mant = value & 0x3ff;
+
+    uint32_t f;
+    if (exp == 0) {
+        if (mant == 0) {
+            f = sign;
+        }
+        else {
+            // 񐳋K float Ȃ琳Kł
+            const float v = mant / 16777216.0f; // mant * 2^-24
+            std::memcpy(&f, &v, sizeof(f));
+            f |= sign;
+        }
+    }
+    else if (exp == 31) {
+        f = sign | 0x7f800000 | (mant << 13);
+    }
+    else {
+        f = sign | ((exp + 112) << 23) | (mant << 13);
+    }
+
+    float out;
+    std::memcpy(&out, &f, sizeof(out));
+    return out;
+}
+
+void VertexPack_OctEncode(const float n[3], int16_t out[2])
+{
+    const float l1 = std::fabs(n[0]) + std::fabs(n[1]) + std::fabs(n[2]);
+    float x = 0.0f, y = 0.0f;
+    if (l1 > 0.0f) {
+        x = n[0] / l1;
+        y = n[1] / l1;
+        if (n[2] < 0.0f) {
+            // ͊O̎Op֐܂Ԃ
+            const float ox = (1.0f - std::fabs(y)) * SignNotZero(x);
+            const float oy = (1.0f - std::fabs(x)) * SignNotZero(y);
+            x = ox;
+            y = oy;
+        }
+    }
+    out[0] = (int16_t)std::lround(std::max(-1.0f, std::min(1.0f, x)) * 32767.0f);
+    out[1] = (int16_t)std::lround(std::max(-1.0f, std::min(1.0f, y)) * 32767.0f);
+}
+
+void VertexPack_OctDecode(const int16_t in[2], float n[3])
+{
+    float x = FromSnorm16(in[0]);
+    float y = FromSnorm16(in[1]);
+    const float z = 1.0f - std::fabs(x) - std::fabs(y);
+    const float t = Saturate(-z);
+    x += x >= 0.0f ? -t : t;
+    y += y >= 0.0f ? -t : t;
+
+    const float len = std::sqrt(x * x + y * y + z * z);
+    n[0] = x / len;
+    n[1] = y / len;
+    n[2] = z / len;
+}
+
+VertexPackBounds VertexPack_ComputeBounds(const float* positions, size_t count, size_t stride)
+{
+    float mn[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+    float mx[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    const uint8_t* p = (const uint8_t*)positions;
+    for (size_t i = 0; i < count; ++i, p += stride) {
+        const float* v = (const float*)p;
+        for (int a = 0; a < 3; ++a) {
+            mn[a] = std::min(mn[a], v[a]);
+            mx[a] = std::max(mx[a], v[a]);
+        }
+    }
+    if (count == 0) {
+        for (int a = 0; a < 3; ++a) mn[a] = mx[a] = 0.0f;
+    }
+    return VertexPack_MakeBounds(mn, mx);
+}
+
+VertexPackBounds VertexPack_MakeBounds(const float min[3], const float max[3])
+{
+    VertexPackBounds b;
+    for (int a = 0; a < 3; ++a) {
+        b.min[a] = min[a];
+        b.extent[a] = std::max(max[a] - min[a], 0.0f);
+    }
+    return b;
+}
+
+void VertexPack_Pack(const VertexPackBounds& bounds,
+    const float position[3], const float normal[3], const float color[4], const float texcoord[2],
+    PackedVertex3d* out)
+{
+    for (int a = 0; a < 3; ++a) {
+        // ݂̂Ȃ͑S 0i߂ min ̂́j
+        const float t = bounds.extent[a] > 0.0f ? (position[a] - bounds.min[a]) / bounds.extent[a] : 0.0f;
+        out->position[a] = (uint16_t)std::lround(Saturate(t) * 65535.0f);
+    }
+    out->position[3] = 65535;
+
+    VertexPack_OctEncode(normal, out->normal);
+
+    for (int c = 0; c < 4; ++c) {
+        out->color[c] = (uint8_t)std::lround(Saturate(color[c]) * 255.0f);
+    }
+
+    out->texcoord[0] = VertexPack_FloatToHalf(texcoord[0]);
+    out->texcoord[1] = VertexPack_FloatToHalf(texcoord[1]);
+}
+
+void VertexPack_Unpack(const VertexPackBounds& bounds, const PackedVertex3d& in,
+    float position[3], float normal[3], float color[4], float texcoord[2])
+{
+    for (int a = 0; a < 3; ++a) {
+        position[a] = bounds.min[a] + in.position[a] / 65535.0f * bounds.extent[a];
+    }
+
+    VertexPack_OctDecode(in.normal, normal);
+
+    for (int c = 0; c < 4; ++c) {
+        color[c] = in.color[c] / 255.0f;
+    }
+
+    texcoord[0] = VertexPack_HalfToFloat(in.texcoord[0]);
+    texcoord[1] = VertexPack_HalfToFloat(in.texcoord[1]);
+}
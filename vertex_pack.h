@@ -0,0 +1,60 @@
+/*==============================================================================
+
+@@@_̋lߍ[vertex_pack.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    48 oCg Vertex3difloat3 ʒu / float3 @ / float4 F / float2 UVj
+    20 oCgɋl߂B
+
+      ʒu : Eɑ΂ UNORM16 ~4iw ͎gȂj  R16G16B16A16_UNORM  8
+      @ : ʑ̎ʑ SNORM16 ~2                  R16G16_SNORM        4
+      F   : UNORM8 ~4                                  R8G8B8A8_UNORM      4
+      UV   : half ~2                                    R16G16_FLOAT        4
+
+    ʒǔ덷͋Ȇ傫 / 131070 ȉBUV  half Ȃ̂ 1 𒴂
+    JԂ UV قǑeȂi[1,2) Ŗ 1/2048jB
+    VF[_[̖߂ shader_vertex_packed.hlsliB
+    CPU ŊiD3D ɈˑȂjB
+
+==============================================================================*/
+#ifndef VERTEX_PACK_H
+#define VERTEX_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+
+struct PackedVertex3d
+{
+    uint16_t position[4];
+    int16_t  normal[2];
+    uint8_t  color[4];
+    uint16_t texcoord[2];
+};
+
+// ʒu߂߂̋EiVF[_[ b5 ɑ`j
+struct VertexPackBounds
+{
+    float min[3];
+    float extent[3];
+};
+
+uint16_t VertexPack_FloatToHalf(float value);
+float    VertexPack_HalfToFloat(uint16_t value);
+
+// n ͐Kς
+void VertexPack_OctEncode(const float n[3], int16_t out[2]);
+void VertexPack_OctDecode(const int16_t in[2], float n[3]);
+
+// stride oCgɕ float3 ̈ʒu狫E߂
+VertexPackBounds VertexPack_ComputeBounds(const float* positions, size_t count, size_t stride);
+VertexPackBounds VertexPack_MakeBounds(const float min[3], const float max[3]);
+
+void VertexPack_Pack(const VertexPackBounds& bounds,
+    const float position[3], const float normal[3], const float color[4], const float texcoord[2],
+    PackedVertex3d* out);
+void VertexPack_Unpack(const VertexPackBounds& bounds, const PackedVertex3d& in,
+    float position[3], float normal[3], float color[4], float texcoord[2]);
+
+#endif//VERTEX_PACK_H
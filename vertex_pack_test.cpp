@@ -0,0 +1,206 @@
+/*==============================================================================
+
+@@@_̋lߍ݂̌덷`FbN[vertex_pack_test.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    Q[ɂ͓ȂP̂̃`FbNBD3D Ȃőg߂B
+        g++ -std=c++17 vertex_pack_test.cpp vertex_pack.cpp
+    l߂Ė߂_ vertex_pack.h ɏxɎ܂邩Bs 1 ԂB
+
+      ʒu : Ƃ Ȇ傫 / 131070 ȉ
+      @ : ʑ̎ʑ̊px̌덷i}Z ƁA܂Ԃڂj
+      UV   : half ̊ۂ߁i 2^-11 ȉBhalf ŕ\l͂̂܂ܖ߂j
+      F   : UNORM8  n/255 ꂽ n/255 ̂܂ܖ߂
+
+==============================================================================*/
+#include "vertex_pack.h"
+#include "test_check.h"
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    const double kPi = 3.14159265358979323846;
+    const float kMaxNormalErrorDeg = 0.01f;
+
+    float Angle(const float a[3], const float b[3])
+    {
+        // px͓ςƌ̂ŁAOς̒Ɠςo
+        const double cx = (double)a[1] * b[2] - (double)a[2] * b[1];
+        const double cy = (double)a[2] * b[0] - (double)a[0] * b[2];
+        const double cz = (double)a[0] * b[1] - (double)a[1] * b[0];
+        const double dot = (double)a[0] * b[0] + (double)a[1] * b[1] + (double)a[2] * b[2];
+        return (float)(std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), dot) * 180.0 / kPi);
+    }
+
+    void Normalize(float n[3])
+    {
+        const float len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        for (int a = 0; a < 3; ++a) n[a] /= len;
+    }
+
+    // ʒuF낢ȑ傫Eꏊ̋EŁAƂ̌덷
+    void CheckPositions(std::mt19937& rng)
+    {
+        struct Box { const char* name; float min[3]; float max[3]; };
+        const Box boxes[] = {
+            { "unit box",     { 0.0f, 0.0f, 0.0f },       { 1.0f, 1.0f, 1.0f } },
+            { "character",    { -0.6f, 0.0f, -0.4f },     { 0.6f, 1.8f, 0.4f } },
+            { "large extent", { -500.0f, -20.0f, -500.0f }, { 500.0f, 80.0f, 500.0f } },
+            { "far offset",   { 1000.0f, 0.0f, -3000.0f }, { 1010.0f, 2.0f, -2990.0f } },
+            { "flat axis",    { -1.0f, 0.0f, -1.0f },     { 1.0f, 0.0f, 1.0f } },
+        };
+
+        const float zeroN[3] = { 0.0f, 1.0f, 0.0f };
+        const float zeroC[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        const float zeroT[2] = { 0.0f, 0.0f };
+
+        for (const Box& box : boxes) {
+            const VertexPackBounds bounds = VertexPack_MakeBounds(box.min, box.max);
+            double worst = 0.0;  // eɑ΂銄
+            double worstAbs = 0.0;
+            for (int i = 0; i < 20000; ++i) {
+                float p[3];
+                for (int a = 0; a < 3; ++a) {
+                    // pƖʂ̏
+                    const float t = (i % 7 == 0) ? (float)(i / 7 % 2) : std::uniform_real_distribution<float>(0.0f, 1.0f)(rng);
+                    p[a] = box.min[a] + t * (box.max[a] - box.min[a]);
+                }
+
+                PackedVertex3d packed;
+                VertexPack_Pack(bounds, p, zeroN, zeroC, zeroT, &packed);
+                float q[3], n[3], c[4], uv[2];
+                VertexPack_Unpack(bounds, packed, q, n, c, uv);
+
+                for (int a = 0; a < 3; ++a) {
+                    // float ̂̊ۂ߁iW̑傫 2ulpj͋
+                    const float magnitude = std::max(std::fabs(box.min[a]), std::fabs(box.max[a]));
+                    const double limit = bounds.extent[a] / 131070.0 + 2.0 * magnitude * FLT_EPSILON;
+                    const double error = std::fabs((double)q[a] - p[a]);
+                    worstAbs = std::max(worstAbs, error);
+                    worst = std::max(worst, limit > 0.0 ? error / limit : (error > 0.0 ? 2.0 : 0.0));
+                }
+            }
+            char label[96];
+            std::snprintf(label, sizeof(label), "position %s (error / (extent/131070))", box.name);
+            TestCheck_Expect(worst <= 1.0, label, worst, 1.0);
+            std::printf("     max error %g\n", worstAbs);
+        }
+    }
+
+    // @FʑŚEE܂Ԃ̋
+    void CheckNormals(std::mt19937& rng)
+    {
+        std::vector<std::array<float, 3>> normals = {
+            { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f },
+            { 1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f },
+            { 0.0f, 1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f },
+        };
+        // ܂Ԃ̋ځiz 傤 0 ƁÂEjƁA xEy  0 ̕
+        for (int i = 0; i < 360; ++i) {
+            const float a = (float)(i * kPi / 180.0);
+            for (float z : { 0.0f, -1e-4f, 1e-4f, -1e-2f }) {
+                std::array<float, 3> n = { std::cos(a), std::sin(a), z };
+                Normalize(n.data());
+                normals.push_back(n);
+            }
+            std::array<float, 3> onX = { std::cos(a), 0.0f, -std::fabs(std::sin(a)) - 1e-3f };
+            std::array<float, 3> onY = { 0.0f, std::cos(a), -std::fabs(std::sin(a)) - 1e-3f };
+            Normalize(onX.data());
+            Normalize(onY.data());
+            normals.push_back(onX);
+            normals.push_back(onY);
+        }
+        std::normal_distribution<float> g(0.0f, 1.0f);
+        for (int i = 0; i < 100000; ++i) {
+            std::array<float, 3> n = { g(rng), g(rng), g(rng) };
+            Normalize(n.data());
+            normals.push_back(n);
+        }
+
+        float worst = 0.0f, worstSeam = 0.0f, worstAxis = 0.0f;
+        for (size_t i = 0; i < normals.size(); ++i) {
+            int16_t oct[2];
+            float back[3];
+            VertexPack_OctEncode(normals[i].data(), oct);
+            VertexPack_OctDecode(oct, back);
+            const float e = Angle(normals[i].data(), back);
+            worst = std::max(worst, e);
+            if (i < 6) worstAxis = std::max(worstAxis, e);
+            else if (i < 6 + 360 * 6) worstSeam = std::max(worstSeam, e);
+        }
+        TestCheck_Expect(worstAxis <= kMaxNormalErrorDeg, "normal axes incl. +-Z (deg)", worstAxis, kMaxNormalErrorDeg);
+        TestCheck_Expect(worstSeam <= kMaxNormalErrorDeg, "normal fold seam (deg)", worstSeam, kMaxNormalErrorDeg);
+        TestCheck_Expect(worst <= kMaxNormalErrorDeg, "normal sphere (deg)", worst, kMaxNormalErrorDeg);
+    }
+
+    // UVFhalf ŕ\l͂̂܂ܖ߂AȊO͍ŋߐڂ half Ɋۂ܂
+    void CheckTexcoords(std::mt19937& rng)
+    {
+        int mismatched = 0;
+        for (uint32_t h = 0; h < 0x10000; ++h) {
+            if ((h & 0x7c00) == 0x7c00) continue; // infENaN
+            if (VertexPack_FloatToHalf(VertexPack_HalfToFloat((uint16_t)h)) != h) ++mismatched;
+        }
+        TestCheck_Expect(mismatched == 0, "half exact round trip (mismatched patterns)", mismatched, 0);
+
+        double worst = 0.0;
+        std::uniform_real_distribution<float> u(-4.0f, 4.0f);
+        for (int i = 0; i < 200000; ++i) {
+            const float v = (i % 10 == 0) ? std::uniform_real_distribution<float>(0.0f, 1.0f)(rng) * 1e-3f : u(rng);
+            const float back = VertexPack_HalfToFloat(VertexPack_FloatToHalf(v));
+            // K͑ 2^-11A񐳋Ki2^-14 j͐ 2^-25 ܂
+            const double limit = std::max(std::fabs((double)v) * std::ldexp(1.0, -11), std::ldexp(1.0, -25));
+            worst = std::max(worst, std::fabs((double)back - v) / limit);
+        }
+        TestCheck_Expect(worst <= 1.0, "half rounding (error / limit)", worst, 1.0);
+    }
+
+    // FFn/255  n ɋl܂An/255 ɖ߂B͈͊O͒[Ɋۂ܂
+    void CheckColors()
+    {
+        const float boxMin[3] = { 0.0f, 0.0f, 0.0f };
+        const float boxMax[3] = { 1.0f, 1.0f, 1.0f };
+        const VertexPackBounds bounds = VertexPack_MakeBounds(boxMin, boxMax);
+        const float p[3] = { 0.5f, 0.5f, 0.5f };
+        const float n[3] = { 0.0f, 0.0f, 1.0f };
+        const float uv[2] = { 0.0f, 0.0f };
+
+        int wrong = 0;
+        for (int k = 0; k < 256; ++k) {
+            const float c[4] = { k / 255.0f, (255 - k) / 255.0f, k / 255.0f, 1.0f };
+            PackedVertex3d packed;
+            VertexPack_Pack(bounds, p, n, c, uv, &packed);
+            float q[3], m[3], back[4], t[2];
+            VertexPack_Unpack(bounds, packed, q, m, back, t);
+            if (packed.color[0] != k || packed.color[1] != 255 - k || packed.color[3] != 255) ++wrong;
+            for (int i = 0; i < 4; ++i) {
+                if (back[i] != c[i]) ++wrong;
+            }
+        }
+        const float outside[4] = { -0.5f, 1.5f, 0.0f, 2.0f };
+        PackedVertex3d packed;
+        VertexPack_Pack(bounds, p, n, outside, uv, &packed);
+        if (packed.color[0] != 0 || packed.color[1] != 255 || packed.color[3] != 255) ++wrong;
+
+        TestCheck_Expect(wrong == 0, "color UNORM8 exact (wrong values)", wrong, 0);
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(43);
+    CheckPositions(rng);
+    CheckNormals(rng);
+    CheckTexcoords(rng);
+    CheckColors();
+
+    return TestCheck_Result();
+}
@@ -0,0 +1,102 @@
+/*==============================================================================
+
+@@@[J[Xbh̕ for[worker_pool.cpp]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+==============================================================================*/
+#include "worker_pool.h"
+
+WorkerPool::~WorkerPool()
+{
+    Stop();
+}
+
+bool WorkerPool::Start(int threadCount)
+{
+    Stop();
+    if (threadCount <= 0) return false;
+
+    m_stop = false;
+    for (int i = 0; i < threadCount; ++i)
+    {
+        m_threads.emplace_back(&WorkerPool::WorkerMain, this, m_generation);
+    }
+    return true;
+}
+
+void WorkerPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+
+    for (std::thread& t : m_threads) t.join();
+    m_threads.clear();
+}
+
+void WorkerPool::ParallelFor(uint32_t count, const std::function<void(uint32_t)>& fn)
+{
+    if (count == 0) return;
+    if (!IsRunning() || count == 1)
+    {
+        for (uint32_t i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_fn = &fn;
+        m_count = count;
+        m_next.store(0);
+        m_working = (int)m_threads.size();
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    // Ăяo`
+    RunItems(fn, count);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_working == 0; });
+    m_fn = nullptr;
+}
+
+void WorkerPool::RunItems(const std::function<void(uint32_t)>& fn, uint32_t count)
+{
+    for (;;)
+    {
+        const uint32_t i = m_next.fetch_add(1);
+        if (i >= count) break;
+        fn(i);
+    }
+}
+
+// seen  Start _̐iStop  Start ĂO̎dEȂ悤Ɂj
+void WorkerPool::WorkerMain(uint64_t seen)
+{
+    for (;;)
+    {
+        const std::function<void(uint32_t)>* fn;
+        uint32_t count;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+            if (m_stop) break;
+
+            seen = m_generation;
+            fn = m_fn;
+            count = m_count;
+        }
+
+        RunItems(*fn, count);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_working == 0) m_done.notify_one();
+        }
+    }
+}
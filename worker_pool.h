@@ -0,0 +1,59 @@
+/*==============================================================================
+
+@@@[J[Xbh̕ for[worker_pool.h]
+														 Author : Tanaka Kouki
+														 Date   : 2026/10/18
+--------------------------------------------------------------------------------
+
+    ParallelFor(count, fn)  fn(0..count-1) [J[ƌĂяoŕA
+    SIĂԂBԍ͑ҏŔẑŁAd΂Ă΂ȂB
+    CXbhĂԁiqEĂяo͂ȂjB
+    Start ĂȂΌĂяoŏɉ񂷁B
+
+==============================================================================*/
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkerPool
+{
+public:
+    WorkerPool() = default;
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    bool Start(int threadCount);
+    void Stop();
+
+    bool IsRunning() const { return !m_threads.empty(); }
+    int ThreadCount() const { return (int)m_threads.size(); }
+
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& fn);
+
+private:
+    void WorkerMain(uint64_t seen);
+    void RunItems(const std::function<void(uint32_t)>& fn, uint32_t count);
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    bool m_stop = false;
+
+    uint64_t m_generation = 0;                          // ParallelFor Ƃɐi߂
+    const std::function<void(uint32_t)>* m_fn = nullptr;
+    uint32_t m_count = 0;
+    std::atomic<uint32_t> m_next{ 0 };                  // ɔzԍ
+    int m_working = 0;                                  // ̎d܂ĂȂ[J[
+};
+
+#endif//WORKER_POOL_H